@@ -0,0 +1,710 @@
+/**
+ * @file benchmark.cpp
+ * @brief Gerador de carga e benchmark por operação dos gerenciadores
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ *
+ * Gera uma carga sintética (catálogo, estoque, camarins, artistas, pedidos
+ * e listas de compras) e mede o tempo médio de cada operação em ns/op.
+ * Também serve como carga de treino do PGO (make pgo).
+ *
+ * Saída (stdout): uma linha "<operacao> <ns_por_op>" por operação.
+ * Uso: bench [--escala N] [--semente S]
+ */
+
+#include <iostream>   // Para cout, cerr
+#include <string>     // Para string
+#include <vector>     // Para vector
+#include <random>     // Para mt19937 (gerador pseudoaleatório)
+#include <chrono>     // Para medir tempo
+#include <functional> // Para function
+#include <iomanip>    // Para setprecision
+#include <sstream>    // Para o fluxo de leituras do leitor
+#include <future>     // Para async (comparação com o escalonador)
+
+#include "artista.h"
+#include "item.h"
+#include "estoque.h"
+#include "camarim.h"
+#include "pedido.h"
+#include "listacompras.h"
+#include "arquivo.h"
+#include "identificadores.h"
+#include "paralelo.h"
+#include "relatorio.h"
+#include "fornecedores.h"
+#include "esquema.h"
+#include "excecoes.h"
+#include "visao.h"
+#include "painel.h"
+#include "frequentes.h"
+#include "historico.h"
+#include "referencias.h"
+#include "agenda.h"
+#include "alocacao.h"
+#include "modelo.h"
+#include "reposicao.h"
+#include "reconciliacao.h"
+#include "leitor.h"
+
+using namespace std;
+
+// Acumulador global: impede que o otimizador descarte resultados não usados
+static volatile long long sumidouro = 0;
+
+/**
+ * @class GeradorCarga
+ * @brief Produz dados sintéticos reproduzíveis (mesma semente = mesma carga)
+ */
+class GeradorCarga {
+private:
+    mt19937 rng;   // Gerador pseudoaleatório determinístico
+    int escala;    // Quantidade base de entidades
+
+public:
+    GeradorCarga(unsigned semente, int escala) : rng(semente), escala(escala) {}
+
+    int getEscala() const { return escala; }
+
+    // Inteiro uniforme no intervalo fechado [min, max]
+    int inteiro(int min, int max) {
+        return uniform_int_distribution<int>(min, max)(rng);
+    }
+
+    // Nome de item no formato "<produto> <n>" (ex: "Agua Mineral 17")
+    string nomeItem(int n) {
+        static const char* produtos[] = {
+            "Agua Mineral", "Refrigerante", "Toalha", "Cerveja", "Fruta",
+            "Suco", "Sanduiche", "Cafe", "Cha", "Energetico"
+        };
+        return string(produtos[n % 10]) + " " + to_string(n);
+    }
+
+    // Preenche o catálogo com 'escala' itens
+    void popularItens(GerenciadorItens& itens) {
+        for (int i = 0; i < escala; i++) {
+            itens.cadastrar(nomeItem(i), inteiro(100, 5000) / 100.0);
+        }
+    }
+
+    // Coloca uma quantidade aleatória de cada item do catálogo no estoque
+    void popularEstoque(Estoque& estoque, const GerenciadorItens& itens) {
+        for (const auto& item : itens.listar()) {
+            estoque.adicionarItem(item.getId(), item.getNome(), inteiro(10, 500));
+        }
+    }
+
+    // Cria 'escala / 10' camarins e 'escala / 5' artistas distribuídos entre eles
+    void popularCamarinsEArtistas(GerenciadorCamarins& camarins, GerenciadorArtistas& artistas) {
+        int totalCamarins = escala / 10 + 1;
+        for (int i = 0; i < totalCamarins; i++) {
+            camarins.cadastrar("Camarim " + to_string(i + 1), 0);
+        }
+        for (int i = 0; i < escala / 5; i++) {
+            artistas.cadastrar("Artista " + to_string(i + 1), inteiro(0, totalCamarins));
+        }
+    }
+
+    // Cria 'escala' pedidos com 1 a 5 itens; cerca de metade é marcada como atendida
+    void popularPedidos(GerenciadorPedidos& pedidos, GerenciadorItens& itens, int totalCamarins) {
+        for (int i = 0; i < escala; i++) {
+            int id = pedidos.criar(inteiro(1, totalCamarins), "Artista " + to_string(i % 50 + 1));
+            Pedido* pedido = pedidos.buscarPorId(id);
+            int linhas = inteiro(1, 5);
+            for (int l = 0; l < linhas; l++) {
+                Item* item = itens.buscarPorId(inteiro(1, escala));
+                if (item) {
+                    pedido->adicionarItem(item->getId(), item->getNome(), inteiro(1, 12));
+                }
+            }
+            if (inteiro(0, 1) == 1) {
+                pedidos.marcarAtendido(id);  // Pelo gerenciador: mantém o índice de pendentes
+            }
+        }
+    }
+};
+
+/**
+ * @brief Mede o tempo médio de 'repeticoes' execuções de uma operação
+ * @return Nanossegundos por operação
+ */
+double medir(int repeticoes, const function<void(int)>& operacao) {
+    auto inicio = chrono::steady_clock::now();
+    for (int i = 0; i < repeticoes; i++) {
+        operacao(i);
+    }
+    auto fim = chrono::steady_clock::now();
+    double ns = chrono::duration<double, nano>(fim - inicio).count();
+    return ns / repeticoes;
+}
+
+// Imprime uma medição no formato consumido por "make pgo-report"
+void reportar(const string& operacao, double nsPorOp) {
+    cout << left << setw(34) << operacao << " " << fixed << setprecision(1) << nsPorOp << endl;
+}
+
+int main(int argc, char* argv[]) {
+    int escala = 2000;        // Quantidade base de entidades
+    unsigned semente = 42;    // Semente da carga (reprodutível)
+
+    // Lê argumentos opcionais da linha de comando
+    for (int i = 1; i + 1 < argc; i++) {
+        string arg = argv[i];
+        if (arg == "--escala") {
+            escala = stoi(argv[++i]);
+        } else if (arg == "--semente") {
+            semente = static_cast<unsigned>(stoul(argv[++i]));
+        }
+    }
+
+    GeradorCarga carga(semente, escala);
+    cerr << "Benchmark: escala = " << escala << ", semente = " << semente << endl;
+
+    // ==================== Catálogo de Itens ====================
+    GerenciadorItens itens;
+    reportar("item.cadastrar", medir(escala, [&](int i) {
+        sumidouro += itens.cadastrar(carga.nomeItem(i), 1.0 + i % 50);
+    }));
+    reportar("item.buscarPorId", medir(escala, [&](int) {
+        sumidouro += itens.buscarPorId(carga.inteiro(1, escala)) != nullptr;
+    }));
+    reportar("item.buscarPorNome", medir(escala, [&](int) {
+        sumidouro += itens.buscarPorNome(carga.nomeItem(carga.inteiro(0, escala - 1))) != nullptr;
+    }));
+    reportar("item.atualizar", medir(escala, [&](int i) {
+        int id = i + 1;
+        sumidouro += itens.atualizar(id, carga.nomeItem(i), 2.0 + i % 30);
+    }));
+    reportar("item.listar", medir(50, [&](int) {
+        sumidouro += itens.listar().size();
+    }));
+
+    // ==================== Estoque ====================
+    Estoque estoque;
+    reportar("estoque.adicionarItem", medir(escala * 5, [&](int i) {
+        int id = i % escala + 1;
+        estoque.adicionarItem(id, carga.nomeItem(id - 1), 10);
+    }));
+    reportar("estoque.verificarDisponibilidade", medir(escala * 5, [&](int) {
+        sumidouro += estoque.verificarDisponibilidade(carga.inteiro(1, escala), 5);
+    }));
+    reportar("estoque.removerItem", medir(escala * 5, [&](int i) {
+        sumidouro += estoque.removerItem(i % escala + 1, 1);
+    }));
+    reportar("estoque.exibir", medir(20, [&](int) {
+        sumidouro += estoque.exibir().size();
+    }));
+    Estoque perecivel;
+    long long agora = Relogio::agora();
+    reportar("estoque.adicionarLote", medir(escala * 5, [&](int i) {
+        int id = i % escala + 1;
+        long long validade = agora + carga.inteiro(1, 720) * 3600LL * 1000000LL;  // Até 30 dias
+        perecivel.adicionarLote(id, carga.nomeItem(id - 1), 10, validade);
+    }));
+    reportar("estoque.removerItem[FEFO]", medir(escala * 5, [&](int i) {
+        sumidouro += perecivel.removerItem(i % escala + 1, 3);
+    }));
+    reportar("estoque.lotesVencendoEm[24h]", medir(200, [&](int) {
+        sumidouro += perecivel.lotesVencendoEm(24).size();
+    }));
+
+    // ==================== Camarins e Artistas ====================
+    GerenciadorCamarins camarins;
+    GerenciadorArtistas artistas;
+    int totalCamarins = escala / 10 + 1;
+    reportar("camarim.cadastrar", medir(totalCamarins, [&](int i) {
+        sumidouro += camarins.cadastrar("Camarim " + to_string(i + 1), 0);
+    }));
+    reportar("camarim.inserirItem", medir(escala * 2, [&](int) {
+        Camarim* camarim = camarins.buscarPorId(carga.inteiro(1, totalCamarins));
+        int id = carga.inteiro(1, escala);
+        camarim->inserirItem(id, carga.nomeItem(id - 1), 2);
+    }));
+    reportar("camarim.exibir", medir(totalCamarins, [&](int i) {
+        sumidouro += camarins.buscarPorId(i + 1)->exibir().size();
+    }));
+    reportar("artista.cadastrar", medir(escala / 5, [&](int i) {
+        sumidouro += artistas.cadastrar("Artista " + to_string(i + 1), carga.inteiro(0, totalCamarins));
+    }));
+    reportar("artista.buscarPorCamarim", medir(escala, [&](int) {
+        sumidouro += artistas.buscarPorCamarim(carga.inteiro(1, totalCamarins)).size();
+    }));
+
+    // ==================== Pedidos ====================
+    GerenciadorPedidos pedidos;
+    reportar("pedido.criar", medir(escala, [&](int i) {
+        sumidouro += pedidos.criar(carga.inteiro(1, totalCamarins), "Artista " + to_string(i % 50 + 1));
+    }));
+    reportar("pedido.adicionarItem", medir(escala * 3, [&](int i) {
+        Pedido* pedido = pedidos.buscarPorId(i % escala + 1);
+        int id = carga.inteiro(1, escala);
+        pedido->adicionarItem(id, carga.nomeItem(id - 1), carga.inteiro(1, 12));
+    }));
+    reportar("pedido.marcarAtendido", medir(escala / 2, [&](int i) {
+        pedidos.marcarAtendido(i * 2 + 1);
+    }));
+    reportar("pedido.buscarPorCamarim", medir(escala / 2, [&](int) {
+        sumidouro += pedidos.buscarPorCamarim(carga.inteiro(1, totalCamarins)).size();
+    }));
+    reportar("pedido.listarPendentes", medir(50, [&](int) {
+        sumidouro += pedidos.listarPendentes().size();
+    }));
+    reportar("pedido.buscarCriadosEntre", medir(escala, [&](int) {
+        // Janela que cobre 50 pedidos consecutivos (busca binária pelo instante de criação)
+        int primeiro = carga.inteiro(1, escala - 49);
+        sumidouro += pedidos.buscarCriadosEntre(pedidos.buscarPorId(primeiro)->getCriadoEm(),
+                                                pedidos.buscarPorId(primeiro + 49)->getCriadoEm()).size();
+    }));
+
+    // ==================== Listas de Compras ====================
+    GerenciadorListaCompras listas;
+    int totalListas = escala / 20 + 1;
+    reportar("lista.criar", medir(totalListas, [&](int i) {
+        sumidouro += listas.criar("Lista " + to_string(i + 1));
+    }));
+    reportar("lista.adicionarItem", medir(escala * 3, [&](int i) {
+        ListaCompras* lista = listas.buscarPorId(i % totalListas + 1);
+        int id = carga.inteiro(1, escala);
+        lista->adicionarItem(id, carga.nomeItem(id - 1), carga.inteiro(1, 24), 1.5 + id % 20);
+    }));
+    reportar("lista.calcularTotal", medir(escala, [&](int i) {
+        sumidouro += static_cast<long long>(listas.buscarPorId(i % totalListas + 1)->calcularTotal());
+    }));
+
+    // ==================== Visão de camarins ====================
+    reportar("camarim.visao", medir(escala, [&](int) {
+        sumidouro += montarVisaoCamarim(carga.inteiro(1, totalCamarins), camarins, artistas,
+                                        pedidos, itens).conteudo.size();
+    }));
+    reportar("quadro.bastidores", medir(20, [&](int) {
+        sumidouro += montarQuadroBastidores(camarins, artistas, pedidos, itens).size();
+    }));
+
+    // ==================== Painel (contadores materializados) ====================
+    PainelBastidores painel;
+    reportar("painel.conectar", medir(1, [&](int) {
+        painel.conectar(artistas, camarins, pedidos, listas, estoque);
+    }));
+    reportar("painel.obter", medir(escala * 5, [&](int) {
+        sumidouro += painel.obter().pedidosPendentes;
+    }));
+    reportar("pedido.adicionarItem[painel]", medir(escala, [&](int i) {
+        // Mutação observada: cópia do pedido antes + delta no painel
+        int id = carga.inteiro(1, escala);
+        pedidos.adicionarItem(i % (escala / 2) * 2 + 2, id, carga.nomeItem(id - 1), 1);  // Pares: pendentes
+    }));
+    painel.desconectar();  // Remoções abaixo medem os gerenciadores sem observadores
+
+    // ==================== Itens mais pedidos (Space-Saving) ====================
+    ItensMaisPedidos frequentes;
+    frequentes.conectar(pedidos);
+    reportar("pedido.adicionarItem[frequentes]", medir(escala, [&](int i) {
+        // Distribuição enviesada: IDs baixos são pedidos com mais frequência
+        int id = carga.inteiro(1, carga.inteiro(1, escala));
+        pedidos.adicionarItem(i % (escala / 2) * 2 + 2, id, carga.nomeItem(id - 1), 1);
+    }));
+    reportar("frequentes.maisPedidos[60min]", medir(50, [&](int) {
+        sumidouro += frequentes.maisPedidos(10, 60).size();
+    }));
+    frequentes.desconectar();
+
+    // ==================== Histórico (desfazer/refazer) ====================
+    Historico historico(escala);
+    historico.conectar(itens, artistas, camarins, pedidos, listas, estoque);
+    reportar("estoque.atualizar[historico]", medir(escala, [&](int i) {
+        estoque.atualizarQuantidade(i % escala + 1, i % 7);
+    }));
+    reportar("historico.desfazer", medir(escala, [&](int) {
+        sumidouro += historico.desfazer();
+    }));
+    reportar("historico.refazer", medir(escala, [&](int) {
+        sumidouro += historico.refazer();
+    }));
+    historico.desconectar();
+
+    // ==================== Referências de itens (remoção segura) ====================
+    // A cascata recusa itens de pedidos atendidos (precisam ir para o arquivo antes):
+    // os atendidos (ímpares) saem fora da medição
+    for (int id = 1; id <= escala; id += 2) {
+        pedidos.remover(id);
+    }
+    IndiceReferencias referencias;
+    reportar("referencias.conectar", medir(1, [&](int) {
+        referencias.conectar(itens, camarins, pedidos, listas, estoque);
+    }));
+    reportar("referencias.referenciasDe", medir(escala, [&](int) {
+        sumidouro += referencias.referenciasDe(carga.inteiro(1, escala)).total();
+    }));
+    reportar("referencias.removerItem[cascata]", medir(escala / 10, [&](int i) {
+        sumidouro += referencias.removerItem(i * 2 + 2, ModoRemocao::CASCATA);  // IDs pares
+    }));
+    referencias.desconectar();
+
+    // ==================== Agenda de camarins (festival de 3 dias, 300 camarins) ====================
+    {
+        const long long hora = 3600000000LL;  // 1 hora em µs
+        GerenciadorCamarins salas;
+        GerenciadorArtistas bandas;
+        AgendaCamarins agenda;
+        for (int i = 0; i < 300; i++) {
+            salas.cadastrar("Sala " + to_string(i + 1), 0);
+        }
+        for (int i = 0; i < 2000; i++) {
+            bandas.cadastrar("Banda " + to_string(i + 1), 0);
+        }
+        agenda.conectar(bandas, salas);
+        reportar("agenda.reservar", medir(escala, [&](int i) {
+            // Faixas de 1 hora: conflitos são rejeitados (e também medidos)
+            long long inicio = carga.inteiro(0, 71) * hora;
+            try {
+                sumidouro += agenda.reservar(i % 300 + 1, carga.inteiro(1, 2000), inicio, inicio + hora);
+            } catch (const ExcecaoBase&) {
+                sumidouro += 1;
+            }
+        }));
+        reportar("agenda.ocupante", medir(escala, [&](int) {
+            sumidouro += agenda.ocupante(carga.inteiro(1, 300), carga.inteiro(0, 72 * 60) * 60000000LL) != nullptr;
+        }));
+        reportar("agenda.camarinsLivres[300]", medir(escala / 10, [&](int) {
+            long long inicio = carga.inteiro(0, 71) * hora;
+            sumidouro += agenda.camarinsLivres(inicio, inicio + hora).size();
+        }));
+    }
+
+    // ==================== Alocação automática (500 artistas x 500 camarins) ====================
+    {
+        vector<RequisitoArtista> requisitos(500);
+        vector<PerfilCamarim> perfis(500);
+        for (int i = 0; i < 500; i++) {
+            requisitos[i].artistaId = i + 1;
+            requisitos[i].integrantes = carga.inteiro(1, 12);
+            requisitos[i].distanciaMaxima = carga.inteiro(0, 4) * 50.0;
+            perfis[i].camarimId = i + 1;
+            perfis[i].capacidade = carga.inteiro(2, 15);
+            perfis[i].distanciaPalco = carga.inteiro(5, 300);
+        }
+        reportar("alocacao.resolver[500x500]", medir(3, [&](int) {
+            sumidouro += AlocadorCamarins::resolver(requisitos, perfis).pares.size();
+        }));
+    }
+
+    // ==================== Modelos de rider (40 linhas, instâncias compartilham) ====================
+    {
+        GerenciadorModelos modelos;
+        GerenciadorPedidos porModelo, linhaALinha;
+        GerenciadorCamarins salas;
+        int modelo = modelos.criar("Rider festival");
+        for (int i = 1; i <= 40; i++) {
+            modelos.adicionarItem(modelo, i, carga.nomeItem(i), carga.inteiro(1, 12));
+        }
+        const map<int, ItemPedido>& linhas = modelos.buscarPorId(modelo)->getItens();
+        reportar("pedidos.criar+40 adicionarItem", medir(escala, [&](int) {
+            int id = linhaALinha.criar(1, "Banda");
+            for (const auto& par : linhas) {
+                linhaALinha.adicionarItem(id, par.first, par.second.nomeItem, par.second.quantidade);
+            }
+            sumidouro += id;
+        }));
+        reportar("modelos.instanciarPedido[40]", medir(escala, [&](int) {
+            sumidouro += modelos.instanciarPedido(modelo, porModelo, 1, "Banda");
+        }));
+        for (int i = 0; i < escala; i++) {
+            salas.cadastrar("Sala " + to_string(i + 1), 0);
+        }
+        reportar("modelos.instanciarCamarim[40]", medir(escala, [&](int i) {
+            modelos.instanciarCamarim(modelo, salas, i + 1);  // Camarins vazios: compartilham as linhas
+        }));
+        reportar("pedido.adicionarItem[1a escrita]", medir(escala, [&](int i) {
+            porModelo.adicionarItem(i + 1, 1, linhas.at(1).nomeItem, 1);  // Separa-se do modelo
+        }));
+    }
+
+    // ==================== Reposição (300 camarins x 20 níveis, um plano para todos) ====================
+    {
+        GerenciadorCamarins salas;
+        Estoque central;
+        ReposicaoCamarins reposicao;
+        reposicao.conectar(salas, central);
+        for (int i = 1; i <= 100; i++) {
+            central.adicionarItem(i, carga.nomeItem(i), 300 * 24);
+        }
+        for (int c = 1; c <= 300; c++) {
+            salas.cadastrar("Sala " + to_string(c), 0);
+            for (int k = 0; k < 20; k++) {
+                int item = (c * 7 + k * 5) % 100 + 1;
+                reposicao.definirNivel(c, item, carga.nomeItem(item), 24);
+                if (k % 2 == 0) salas.inserirItem(c, item, carga.nomeItem(item), carga.inteiro(1, 24));
+            }
+        }
+        reportar("reposicao.planejar[300x20]", medir(20, [&](int) {
+            sumidouro += reposicao.planejar().totalUnidades();
+        }));
+        reportar("reposicao.repor[300x20]", medir(1, [&](int) {
+            sumidouro += reposicao.repor().totalUnidades();
+        }));
+
+        // Fechamento geral dos mesmos camarins: metade de cada linha sobrou
+        map<int, map<int, int>> contagens;
+        for (const auto& camarim : salas.listar()) {
+            for (const auto& par : camarim.getItens()) {
+                contagens[camarim.getId()][par.first] = par.second.quantidade / 2;
+            }
+        }
+        ResultadoReconciliacao fechamento;
+        reportar("reconciliacao.calcular[300x20]", medir(20, [&](int) {
+            fechamento = ReconciliacaoCamarins::calcularTodos(salas, contagens);
+        }));
+        reportar("reconciliacao.aplicar[300x20]", medir(1, [&](int) {
+            ReconciliacaoCamarins::aplicar(fechamento, salas, central);
+            sumidouro += fechamento.totalDevolvido();
+        }));
+    }
+
+    // ==================== Recebimento por leitor (10 mil itens com EAN-13) ====================
+    {
+        GerenciadorItens etiquetados;
+        Estoque doca;
+        vector<string> codigos;
+        for (int i = 0; i < 10000; i++) {
+            string codigo = to_string(789000000000LL + i);  // 12 dígitos + verificador
+            int soma = 0;
+            for (size_t j = 0; j < codigo.size(); j++) {
+                soma += (codigo[j] - '0') * (j % 2 == 1 ? 3 : 1);
+            }
+            codigo += to_string((10 - soma % 10) % 10);
+            int id = etiquetados.cadastrar(carga.nomeItem(i) + " " + to_string(i), 1.0);
+            etiquetados.definirCodigoBarras(id, codigo);
+            codigos.push_back(codigo);
+        }
+        reportar("item.buscarPorCodigo", medir(escala, [&](int i) {
+            sumidouro += etiquetados.buscarPorCodigo(codigos[carga.inteiro(0, 9999)])->getId() + i;
+        }));
+
+        // Descarga de caminhão: rajadas de caixas iguais seguidas (8 a 24 leituras por produto)
+        string fluxo;
+        for (int i = 0; i < escala * 10; ) {
+            const string& codigo = codigos[carga.inteiro(0, 199)];
+            for (int repeticao = carga.inteiro(8, 24); repeticao > 0; repeticao--, i++) {
+                fluxo += codigo + "\n";
+            }
+        }
+        LeitorCodigos leitor(etiquetados, doca);
+        stringstream entrada(fluxo);
+        double total = medir(1, [&](int) { sumidouro += leitor.lerFluxo(entrada); });
+        ResumoLeitura resumo = leitor.getResumo();
+        reportar("leitor.lerFluxo[por leitura]", total / resumo.leituras);
+    }
+
+    // ==================== Busca aproximada (catálogo de 100 mil nomes) ====================
+    GerenciadorItens catalogoGrande;
+    for (int i = 0; i < 100000; i++) {
+        catalogoGrande.cadastrar(carga.nomeItem(i), 1.0);
+    }
+    reportar("item.buscarAproximado[100k]", medir(escala, [&](int) {
+        // Consulta com erro de digitação: troca uma letra do nome original
+        string consulta = carga.nomeItem(carga.inteiro(0, 99999));
+        consulta[carga.inteiro(0, 5)] = 'x';
+        sumidouro += catalogoGrande.buscarAproximado(consulta).size();
+    }));
+    reportar("item.consultar[contem,100k]", medir(escala, [&](int) {
+        // Trecho do nome via índice de trigramas + faixa de preço + limite
+        Consulta consulta;
+        consulta.ondeTexto(Campo::NOME, Operador::CONTEM, "ral " + to_string(carga.inteiro(100, 999)))
+                .onde(Campo::PRECO, Operador::MENOR_IGUAL, 10.0)
+                .ordenarPor(Campo::NOME)
+                .limitar(20);
+        sumidouro += catalogoGrande.consultar(consulta).registros.size();
+    }));
+
+    // ==================== Catálogo congelado (mesmos 100 mil nomes) ====================
+    reportar("item.buscarPorId[hash,100k]", medir(escala, [&](int) {
+        sumidouro += catalogoGrande.buscarPorId(carga.inteiro(1, 100000)) != nullptr;
+    }));
+    reportar("item.buscarPorNome[hash,100k]", medir(escala, [&](int) {
+        sumidouro += catalogoGrande.buscarPorNome(carga.nomeItem(carga.inteiro(0, 99999))) != nullptr;
+    }));
+    reportar("item.buscarNormalizado[hash,100k]", medir(escala, [&](int) {
+        // Mesma consulta da versão congelada: normaliza e procura no índice do repositório
+        sumidouro += catalogoGrande.buscarPorNomeNormalizado(carga.nomeItem(carga.inteiro(0, 99999))) != nullptr;
+    }));
+    reportar("item.congelar[100k]", medir(1, [&](int) {
+        catalogoGrande.congelar();
+        sumidouro += catalogoGrande.estaCongelado();
+    }));
+    reportar("item.buscarPorId[congelado,100k]", medir(escala, [&](int) {
+        sumidouro += catalogoGrande.buscarPorId(carga.inteiro(1, 100000)) != nullptr;
+    }));
+    reportar("item.buscarNormalizado[cong.,100k]", medir(escala, [&](int) {
+        // Normaliza a consulta e faz uma sonda no hash perfeito
+        sumidouro += catalogoGrande.buscarPorNomeNormalizado(carga.nomeItem(carga.inteiro(0, 99999))) != nullptr;
+    }));
+
+    // ==================== Fornecedores (mesmos 100 mil itens x 10 fornecedores) ====================
+    {
+        TabelaFornecedores tabela;
+        tabela.conectar(catalogoGrande);
+        for (int f = 0; f < 10; f++) {
+            tabela.cadastrarFornecedor("Fornecedor " + to_string(f + 1));
+        }
+        static const int EMBALAGENS[] = {1, 6, 12, 24};
+        reportar("fornecedores.definirOferta[1M]", medir(1000000, [&](int i) {
+            int unidades = EMBALAGENS[carga.inteiro(0, 3)];
+            tabela.definirOferta(i % 10 + 1, i / 10 + 1, unidades * carga.inteiro(80, 300) / 100.0, unidades);
+        }));
+        reportar("fornecedores.cotar[10 ofertas]", medir(escala * 50, [&](int) {
+            sumidouro += tabela.cotar(carga.inteiro(1, 100000), carga.inteiro(1, 60)).custo;
+        }));
+        ListaCompras compra(1, "Compra da semana");
+        for (int i = 0; i < 1000; i++) {
+            int id = carga.inteiro(1, 100000);
+            compra.adicionarItem(id, carga.nomeItem(id - 1), carga.inteiro(1, 60), 1.0);
+        }
+        reportar("fornecedores.dividir[1000 itens]", medir(20, [&](int) {
+            sumidouro += tabela.dividir(compra).pedidos.size();
+        }));
+    }
+
+    // ==================== Esquema (serializadores gerados pelas tabelas de campos) ====================
+    {
+        vector<Item> catalogo = itens.listar();
+        vector<Pedido> todosPedidos = pedidos.listar();
+        ostringstream saida;
+        reportar("esquema.paraCsv[item]", medir(escala, [&](int i) {
+            sumidouro += esquema::paraCsv(catalogo[i % catalogo.size()]).size();
+        }));
+        reportar("esquema.paraJson[pedido]", medir(escala, [&](int i) {
+            sumidouro += esquema::paraJson(todosPedidos[i % todosPedidos.size()]).size();
+        }));
+        reportar("esquema.escreverBinario[item]", medir(escala, [&](int i) {
+            saida.str(string());
+            esquema::escreverBinario(saida, catalogo[i % catalogo.size()]);
+            sumidouro += saida.tellp();
+        }));
+        reportar("esquema.validar[item]", medir(escala, [&](int i) {
+            esquema::validar(catalogo[i % catalogo.size()]);
+            sumidouro += i;
+        }));
+        reportar("esquema.exportarCsv[itens]", medir(5, [&](int) {
+            ostringstream fluxo;
+            esquema::exportarCsv(fluxo, catalogo);
+            sumidouro += fluxo.str().size();
+        }));
+    }
+
+    // ==================== Arquivo de pedidos (colunas delta/varint) ====================
+    {
+        vector<Pedido> historicos = pedidos.listar();
+        ArquivoPedidos arquivo;
+        arquivo.conectar(itens);  // Linhas com o nome do catálogo: só o bit "nome próprio"
+        reportar("arquivo.arquivar", medir(static_cast<int>(historicos.size()), [&](int i) {
+            arquivo.arquivar(historicos[i]);
+        }));
+        reportar("arquivo.quantidadePorItem", medir(20, [&](int) {
+            sumidouro += arquivo.quantidadePorItem().size();
+        }));
+        reportar("vector<Pedido>.quantidadePorItem", medir(20, [&](int) {
+            // A mesma análise sobre os objetos completos (um map por pedido)
+            map<int, long long> total;
+            for (const Pedido& p : historicos) {
+                for (const auto& par : p.getItens()) total[par.first] += par.second.quantidade;
+            }
+            sumidouro += total.size();
+        }));
+        reportar("arquivo.pedidosPorCamarim", medir(20, [&](int) {
+            sumidouro += arquivo.pedidosPorCamarim().size();
+        }));
+        reportar("arquivo.listar", medir(5, [&](int) {
+            sumidouro += arquivo.listar().size();
+        }));
+        reportar("arquivo.buscarPorId", medir(escala, [&](int) {
+            Pedido p;
+            sumidouro += arquivo.buscarPorId(carga.inteiro(1, escala), p);
+        }));
+        cerr << "Arquivo: " << arquivo.bytesComprimidos() << " bytes comprimidos x "
+             << arquivo.bytesDescomprimidos() << " bytes como objetos ("
+             << setprecision(1) << fixed
+             << static_cast<double>(arquivo.bytesDescomprimidos()) / max<size_t>(1, arquivo.bytesComprimidos())
+             << "x)" << endl;
+    }
+
+    // ==================== Alocação de IDs (contador atômico x bloco por thread) ====================
+    {
+        AlocadorIds alocador;
+        reportar("ids.alocar[atomico]", medir(escala * 50, [&](int) {
+            sumidouro += alocador.alocar();
+        }));
+        AlocadorIds::Bloco bloco(alocador);
+        reportar("ids.alocar[bloco de 64]", medir(escala * 50, [&](int) {
+            sumidouro += bloco.alocar();
+        }));
+    }
+
+    // ==================== Escalonador (roubo de trabalho x std::async) ====================
+    {
+        Escalonador escalonador;
+        cerr << "Escalonador: " << escalonador.getParalelismo() << " thread(s)" << endl;
+        // Tarefa pequena típica: somar as quantidades de um pedido
+        vector<Pedido> amostra = pedidos.listar();
+        vector<long long> somas(amostra.size());
+        auto somar = [&](size_t i) {
+            long long total = 0;
+            for (const auto& par : amostra[i].getItens()) total += par.second.quantidade;
+            somas[i] = total;
+        };
+        int tarefas = static_cast<int>(amostra.size());
+        reportar("escalonador.paraCada[por tarefa]", medir(20, [&](int) {
+            escalonador.paraCada(0, amostra.size(), somar);
+        }) / tarefas);
+        reportar("std::async[por tarefa]", medir(20, [&](int) {
+            vector<future<void>> futuros;
+            futuros.reserve(amostra.size());
+            for (size_t i = 0; i < amostra.size(); i++) {
+                futuros.push_back(async(launch::async, somar, i));
+            }
+            for (future<void>& f : futuros) f.get();
+        }) / tarefas);
+        reportar("escalonador.grupo[1000 tarefas]", medir(20, [&](int) {
+            Escalonador::Grupo grupo(escalonador);
+            for (int i = 0; i < 1000; i++) {
+                grupo.enviar([&, i] { somar(static_cast<size_t>(i) % amostra.size()); });
+            }
+            grupo.esperar();
+        }));
+        reportar("relatorio.gerar[sequencial]", medir(5, [&](int) {
+            sumidouro += gerarRelatorio(camarins, pedidos, listas, estoque).size();
+        }));
+        reportar("relatorio.gerar[escalonador]", medir(5, [&](int) {
+            sumidouro += gerarRelatorio(camarins, pedidos, listas, estoque, &escalonador).size();
+        }));
+        EstatisticasEscalonador estatisticas = escalonador.getEstatisticas();
+        cerr << "Escalonador: " << estatisticas.lote << " tarefas de lote, " << estatisticas.roubadas
+             << " roubadas, " << estatisticas.executadasEsperando << " executadas esperando, "
+             << estatisticas.adormecimentos << " adormecimentos" << endl;
+    }
+
+    // ==================== Remoções ====================
+    reportar("pedido.remover", medir(escala / 2, [&](int i) {
+        sumidouro += pedidos.remover(i * 2 + 1);
+    }));
+    reportar("item.remover", medir(escala / 2, [&](int i) {
+        sumidouro += itens.remover(i * 2 + 1);
+    }));
+
+    // ==================== Carga mista (dados gerados pelo GeradorCarga) ====================
+    reportar("carga.completa", medir(1, [&](int) {
+        GerenciadorItens catalogo;
+        Estoque estoqueCarga;
+        GerenciadorCamarins camarinsCarga;
+        GerenciadorArtistas artistasCarga;
+        GerenciadorPedidos pedidosCarga;
+        carga.popularItens(catalogo);
+        carga.popularEstoque(estoqueCarga, catalogo);
+        carga.popularCamarinsEArtistas(camarinsCarga, artistasCarga);
+        carga.popularPedidos(pedidosCarga, catalogo, totalCamarins);
+        sumidouro += pedidosCarga.listarPendentes().size();
+    }));
+
+    cerr << "Checksum: " << sumidouro << endl;
+    return 0;
+}
@@ -9,17 +9,39 @@ if (-not (Test-Path "bin")) {
 }
 
 # Parâmetros de compilação
-$CFLAGS = "-Wall -Wextra -pedantic -std=c++17 -Iheader -Ilib"
+$CFLAGS = "-Wall -Wextra -pedantic -std=c++17 -pthread -Iheader -Ilib"
 
 # Arquivos fonte
 $SOURCES = @(
     "src/pessoa.cpp",
     "src/artista.cpp",
+    "src/busca.cpp",
+    "src/consulta.cpp",
+    "src/indice.cpp",
     "src/item.cpp",
     "src/estoque.cpp",
     "src/camarim.cpp",
     "src/pedido.cpp",
     "src/listacompras.cpp",
+    "src/observador.cpp",
+    "src/painel.cpp",
+    "src/relogio.cpp",
+    "src/frequentes.cpp",
+    "src/historico.cpp",
+    "src/referencias.cpp",
+    "src/agenda.cpp",
+    "src/alocacao.cpp",
+    "src/modelo.cpp",
+    "src/reposicao.cpp",
+    "src/reconciliacao.cpp",
+    "src/leitor.cpp",
+    "src/congelado.cpp",
+    "src/arquivo.cpp",
+    "src/identificadores.cpp",
+    "src/paralelo.cpp",
+    "src/relatorio.cpp",
+    "src/fornecedores.cpp",
+    "src/visao.cpp",
     "src/main.cpp"
 )
 
@@ -0,0 +1,178 @@
+/**
+ * @file agenda.h
+ * @brief Agenda de camarins por faixa de horário (reservas de artistas)
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ *
+ * Cada Artista tem um único camarimId, mas num festival o mesmo camarim
+ * recebe uma banda diferente a cada horário. A agenda guarda RESERVAS:
+ * camarim + artista + intervalo [inicio, fim) em microssegundos (Relogio).
+ *
+ * ESTRUTURA: as reservas de um mesmo camarim nunca se sobrepõem. Intervalos
+ * disjuntos ordenados pelo início também ficam ordenados pelo fim, então uma
+ * árvore de intervalos se reduz a um map inicio -> reserva por camarim (e
+ * outro por artista, que também não pode estar em dois lugares ao mesmo
+ * tempo). Conflito de um novo intervalo = apenas o vizinho anterior ao seu
+ * fim: O(log n).
+ *
+ * Custos (n = reservas do camarim, R = camarins, k = resultados):
+ * - reservar / cancelar / conflito:     O(log n)
+ * - quem está no camarim às 21h30:      O(log n)
+ * - camarins livres entre 19h e 20h:    O(R log n)
+ * - agenda de um camarim num período:   O(log n + k)
+ *
+ * A agenda observa artistas e camarins: remover um deles cancela as suas
+ * reservas e avisa o descarte pelo gerenciador (o histórico deixa de
+ * desfazer essa remoção).
+ */
+
+// Proteção contra inclusão múltipla
+#ifndef AGENDA_H  // Se AGENDA_H não foi definido
+#define AGENDA_H  // Define AGENDA_H
+
+#include <string>          // Para mensagens
+#include <vector>          // Para resultados
+#include <map>             // Para agendas ordenadas por início
+#include <unordered_map>   // Para reservas por ID e agendas por artista
+
+#include "observador.h"    // Interface ObservadorMutacoes
+#include "artista.h"       // GerenciadorArtistas
+#include "camarim.h"       // GerenciadorCamarins
+#include "identificadores.h" // AlocadorIds
+
+using namespace std;
+
+/**
+ * @struct Reserva
+ * @brief Um artista ocupando um camarim no intervalo [inicio, fim)
+ */
+struct Reserva {
+    int id = 0;            // ID da reserva (gerado pela agenda)
+    int camarimId = 0;     // Camarim reservado
+    int artistaId = 0;     // Artista que ocupa o camarim
+    long long inicio = 0;  // Início (µs, incluído)
+    long long fim = 0;     // Fim (µs, excluído: outra reserva pode começar aqui)
+
+    /**
+     * @brief true se a reserva ocupa algum instante de [inicio, fim)
+     */
+    bool sobrepoe(long long inicio, long long fim) const;
+};
+
+/**
+ * @class AgendaCamarins
+ * @brief Reservas de camarins por horário com detecção de conflitos
+ *
+ * Uso:
+ *   AgendaCamarins agenda;
+ *   agenda.conectar(artistas, camarins);
+ *   int id = agenda.reservar(4, 12, inicio, fim);  // Lança se houver conflito
+ *   const Reserva* r = agenda.ocupante(4, instante);
+ *   vector<int> livres = agenda.camarinsLivres(inicio, fim);
+ *
+ * Declare-a DEPOIS dos gerenciadores para que seja destruída antes deles.
+ */
+class AgendaCamarins : public ObservadorMutacoes {
+private:
+    unordered_map<int, Reserva> reservas;                  // ID -> reserva
+    map<int, map<long long, int>> porCamarim;              // camarimId -> (inicio -> ID); todo camarim existente tem entrada
+    unordered_map<int, map<long long, int>> porArtista;    // artistaId -> (inicio -> ID)
+    AlocadorIds ids;                                       // IDs das reservas
+
+    // Gerenciadores conectados
+    GerenciadorArtistas* artistas = nullptr;
+    GerenciadorCamarins* camarins = nullptr;
+
+    /**
+     * @brief Reserva da agenda que se sobrepõe a [inicio, fim) (nullptr = nenhuma)
+     *
+     * Só o último intervalo que começa antes de 'fim' pode se sobrepor.
+     */
+    const Reserva* conflito(const map<long long, int>& agenda, long long inicio, long long fim) const;
+
+    // Cancela todas as reservas de uma agenda (camarim ou artista removido)
+    void cancelarTodas(const map<long long, int>& agenda);
+
+public:
+    AgendaCamarins();
+    ~AgendaCamarins();
+
+    /**
+     * @brief Alocador dos IDs de reserva (blocos por thread, limite a persistir)
+     */
+    AlocadorIds& getAlocadorIds();
+
+    // Não copiável: a cópia não estaria registrada nos gerenciadores
+    AgendaCamarins(const AgendaCamarins&) = delete;
+    AgendaCamarins& operator=(const AgendaCamarins&) = delete;
+
+    /**
+     * @brief Registra a agenda nos gerenciadores (reservas anteriores são descartadas)
+     */
+    void conectar(GerenciadorArtistas& artistas, GerenciadorCamarins& camarins);
+
+    /**
+     * @brief Remove a agenda dos gerenciadores conectados
+     */
+    void desconectar();
+
+    /**
+     * @brief Reserva o camarim para o artista em [inicio, fim)
+     * @param bloco Bloco de IDs da thread (de getAlocadorIds(); nullptr = ID avulso)
+     * @return ID da reserva
+     * @throws ValidacaoException se fim <= inicio
+     * @throws CamarimException se o camarim não existe ou já está reservado no horário
+     * @throws ArtistaException se o artista não existe ou já tem reserva no horário
+     */
+    int reservar(int camarimId, int artistaId, long long inicio, long long fim,
+                 AlocadorIds::Bloco* bloco = nullptr);
+
+    /**
+     * @brief Cancela uma reserva
+     * @return false se a reserva não existe
+     */
+    bool cancelar(int reservaId);
+
+    /**
+     * @brief Busca reserva por ID (nullptr se não existe)
+     */
+    const Reserva* buscarPorId(int reservaId) const;
+
+    /**
+     * @brief Reserva que ocupa o camarim no instante (nullptr = livre)
+     */
+    const Reserva* ocupante(int camarimId, long long instante) const;
+
+    /**
+     * @brief true se o camarim existe e não tem reserva em [inicio, fim)
+     */
+    bool livre(int camarimId, long long inicio, long long fim) const;
+
+    /**
+     * @brief Camarins sem nenhuma reserva em [inicio, fim), em ordem de ID
+     */
+    vector<int> camarinsLivres(long long inicio, long long fim) const;
+
+    /**
+     * @brief Reservas do camarim que se sobrepõem a [inicio, fim), em ordem de início
+     */
+    vector<Reserva> agendaDoCamarim(int camarimId, long long inicio, long long fim) const;
+
+    /**
+     * @brief Todas as reservas do artista, em ordem de início
+     */
+    vector<Reserva> agendaDoArtista(int artistaId) const;
+
+    /**
+     * @brief Todas as reservas em ordem de ID
+     */
+    vector<Reserva> listar() const;
+
+    // ===== Observador (POLIMORFISMO: sobrescreve os avisos) =====
+    void aoMudarArtista(const Artista* antes, const Artista* depois) override;
+    void aoMudarCamarim(const Camarim* antes, const Camarim* depois) override;
+};  // Fim da classe AgendaCamarins
+
+#endif // AGENDA_H
+// Fim do include guard
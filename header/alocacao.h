@@ -0,0 +1,117 @@
+/**
+ * @file alocacao.h
+ * @brief Alocação automática de artistas em camarins (custo mínimo)
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ *
+ * Em vez de escolher à mão o camarim de cada artista, o alocador recebe:
+ * - o que cada artista precisa (integrantes, distância máxima do palco)
+ * - o que cada camarim oferece (capacidade, distância do palco)
+ * - opcionalmente, a agenda e o horário do show (camarim reservado para
+ *   OUTRO artista nesse horário não pode ser usado)
+ *
+ * e devolve a alocação que:
+ *   1) coloca o MAIOR número possível de artistas em camarins compatíveis
+ *   2) entre essas, tem o MENOR custo total
+ *      custo(artista, camarim) = distância do palco + 1 m por lugar sobrando
+ *
+ * ALGORITMO: emparelhamento de custo mínimo (método húngaro com potenciais),
+ * O(n² (n + m)) para n artistas e m camarins: centenas de artistas e
+ * camarins resolvem em frações de segundo. Cada artista ganha uma coluna
+ * "sem camarim" com custo maior que qualquer soma de custos reais, o que
+ * garante o critério 1 antes do 2.
+ *
+ * aplicar() grava o resultado pelos gerenciadores (Artista.camarimId e
+ * Camarim.artistaId) de forma ATÔMICA: confere todos os IDs e valores
+ * antes da primeira escrita, então uma alocação inválida é recusada sem
+ * que observadores ou histórico vejam qualquer gravação parcial.
+ */
+
+// Proteção contra inclusão múltipla
+#ifndef ALOCACAO_H  // Se ALOCACAO_H não foi definido
+#define ALOCACAO_H  // Define ALOCACAO_H
+
+#include <vector>        // Para requisitos, perfis e resultado
+#include <utility>       // Para pair
+
+#include "artista.h"     // GerenciadorArtistas
+#include "camarim.h"     // GerenciadorCamarins
+#include "agenda.h"      // AgendaCamarins (restrição de horário)
+#include "excecoes.h"    // ValidacaoException
+
+using namespace std;
+
+/**
+ * @struct RequisitoArtista
+ * @brief O que um artista precisa do camarim
+ */
+struct RequisitoArtista {
+    int artistaId = 0;
+    int integrantes = 1;            // Lugares necessários (> 0)
+    double distanciaMaxima = 0.0;   // Distância máxima do palco em metros (0 = qualquer)
+};
+
+/**
+ * @struct PerfilCamarim
+ * @brief O que um camarim oferece
+ */
+struct PerfilCamarim {
+    int camarimId = 0;
+    int capacidade = 0;             // Lugares disponíveis
+    double distanciaPalco = 0.0;    // Metros até o palco
+};
+
+/**
+ * @struct ResultadoAlocacao
+ * @brief Alocação calculada (ainda não gravada nos gerenciadores)
+ */
+struct ResultadoAlocacao {
+    vector<pair<int, int>> pares;   // (artistaId, camarimId), na ordem dos requisitos
+    vector<int> artistasSemCamarim; // Artistas sem camarim compatível livre
+    vector<int> camarinsSemArtista; // Camarins que ficaram vazios
+    double custoTotal = 0.0;        // Soma dos custos dos pares (metros)
+};
+
+/**
+ * @class AlocadorCamarins
+ * @brief Resolve e aplica a alocação artistas x camarins
+ */
+class AlocadorCamarins {
+public:
+    /**
+     * @brief Custo de colocar o artista no camarim, em centímetros
+     * @return -1 se o camarim não atende o artista (capacidade ou distância)
+     */
+    static long long custo(const RequisitoArtista& artista, const PerfilCamarim& camarim);
+
+    /**
+     * @brief Calcula a alocação ótima
+     * @param agenda Se informada, camarins reservados para outros artistas em
+     *               [inicio, fim) ficam proibidos (nullptr = ignora horários)
+     * @throws ValidacaoException para IDs repetidos ou valores negativos
+     */
+    static ResultadoAlocacao resolver(const vector<RequisitoArtista>& artistas,
+                                      const vector<PerfilCamarim>& camarins,
+                                      const AgendaCamarins* agenda = nullptr,
+                                      long long inicio = 0, long long fim = 0);
+
+    /**
+     * @brief Grava a alocação nos gerenciadores (tudo ou nada)
+     *
+     * Pares: artista.camarimId = camarim e camarim.artistaId = artista.
+     * Sem par: artistasSemCamarim ficam com camarimId 0 e
+     * camarinsSemArtista com artistaId 0.
+     *
+     * Tudo é validado antes da primeira escrita: se algo falha, nenhum
+     * gerenciador é alterado e nenhum observador é avisado.
+     *
+     * @throws ArtistaException / CamarimException se um ID não existe
+     * @throws ValidacaoException se um camarimId é negativo
+     */
+    static void aplicar(const ResultadoAlocacao& resultado, GerenciadorArtistas& artistas,
+                        GerenciadorCamarins& camarins);
+};  // Fim da classe AlocadorCamarins
+
+#endif // ALOCACAO_H
+// Fim do include guard
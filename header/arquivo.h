@@ -0,0 +1,241 @@
+/**
+ * @file arquivo.h
+ * @brief Arquivo colunar comprimido de pedidos históricos
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ *
+ * Um festival de vários dias acumula centenas de milhares de pedidos já
+ * atendidos. No GerenciadorPedidos cada um custa um objeto Pedido, a string
+ * do artista e um map (um nó alocado por linha, com outra string por nome
+ * de item): centenas de bytes por pedido, só para consulta posterior.
+ *
+ * O ArquivoPedidos guarda esses pedidos em COLUNAS de bytes, uma por campo:
+ * - inteiros em varint (7 bits por byte: valores pequenos ocupam 1 byte);
+ * - IDs, instantes e IDs de item em DELTA (diferença para o anterior);
+ *   sinais em zigzag (0, -1, 1, -2... -> 0, 1, 2, 3...);
+ * - nomes de artista em DICIONÁRIO (cada nome distinto uma vez; a coluna
+ *   guarda só o índice);
+ * - nomes de item vêm do CATÁLOGO pelo ID: cada linha gasta um bit ("nome
+ *   difere do catálogo") e só as que diferem guardam um índice no
+ *   dicionário de nomes de item.
+ *
+ * O arquivo observa o catálogo conectado: antes de um item ser renomeado
+ * ou removido, o nome antigo é guardado para os pedidos já arquivados
+ * (que continuam saindo com o nome da época). Sem catálogo conectado,
+ * todo nome vai para o dicionário.
+ *
+ * Consultas decodificam sob demanda. As análises (quantidade por item,
+ * pedidos por camarim) leem SÓ as colunas de que precisam, em sequência.
+ * A cada bloco de pedidos (128 por padrão) guarda-se um ponto de partida
+ * (posição em cada coluna + valores base dos deltas): buscarPorId decodifica
+ * apenas os blocos cuja faixa de IDs contém o ID procurado.
+ */
+
+// Proteção contra inclusão múltipla
+#ifndef ARQUIVO_H  // Se ARQUIVO_H não foi definido
+#define ARQUIVO_H  // Define ARQUIVO_H
+
+#include <string>         // Para os dicionários de nomes
+#include <vector>         // Para as colunas
+#include <map>            // Para os resultados das análises (ordenados por chave)
+#include <cstdint>        // Para uint8_t, uint32_t, uint64_t
+#include <cstddef>        // Para size_t
+#include <unordered_map>  // Para os nomes anteriores de itens do catálogo
+#include <utility>        // Para pair
+#include "pedido.h"       // Para Pedido e GerenciadorPedidos
+#include "item.h"         // Para GerenciadorItens (nomes de item pelo ID)
+#include "observador.h"   // Interface ObservadorMutacoes
+
+using namespace std;
+
+/**
+ * @class ArquivoPedidos
+ * @brief Pedidos arquivados em colunas delta/varint; nomes pelo catálogo ou em dicionário
+ *
+ * Uso:
+ *   ArquivoPedidos arquivo;
+ *   arquivo.conectar(gerenciadorItens);             // Nomes de item pelo catálogo
+ *   arquivo.arquivarAtendidos(gerenciadorPedidos);  // Sai do gerenciador, entra no arquivo
+ *   map<int, long long> total = arquivo.quantidadePorItem();
+ *
+ * Declare-o DEPOIS do catálogo para que seja destruído antes dele.
+ */
+class ArquivoPedidos : public ObservadorMutacoes {
+private:
+    /**
+     * @struct Cursor
+     * @brief Posição de leitura em cada coluna + bases dos deltas
+     */
+    struct Cursor {
+        size_t pedido = 0;   // Índice do próximo pedido a decodificar
+        size_t ids = 0;
+        size_t camarins = 0;
+        size_t artistas = 0;
+        size_t criados = 0;
+        size_t atualizados = 0;
+        size_t linhas = 0;
+        size_t linha = 0;    // Índice da próxima linha (coluna de bits dos nomes)
+        size_t itens = 0;
+        size_t nomesItens = 0;
+        size_t quantidades = 0;
+        int idAnterior = 0;
+        long long criadoAnterior = 0;
+    };
+
+    /**
+     * @struct Bloco
+     * @brief Ponto de partida de um bloco de pedidos e a faixa de IDs que eles cobrem
+     */
+    struct Bloco {
+        Cursor inicio;
+        int menorId;
+        int maiorId;
+    };
+
+    // ===== Colunas (um vector de bytes por campo) =====
+    vector<uint8_t> colunaIds;          // zigzag(id - id anterior)
+    vector<uint8_t> colunaCamarins;     // zigzag(camarimId)
+    vector<uint8_t> colunaArtistas;     // Índice no dicionário de artistas
+    vector<uint8_t> colunaCriados;      // zigzag(criadoEm - criadoEm anterior)
+    vector<uint8_t> colunaAtualizados;  // zigzag(atualizadoEm - criadoEm)
+    vector<bool> colunaAtendidos;       // Um bit por pedido
+    vector<uint8_t> colunaLinhas;       // Quantidade de linhas do pedido
+    vector<uint8_t> colunaItens;        // zigzag(itemId - itemId anterior no pedido)
+    vector<bool> colunaNomeProprio;     // Um bit por linha: nome difere do catálogo
+    vector<uint8_t> colunaNomesItens;   // Só linhas com nome próprio: índice no dicionário
+    vector<uint8_t> colunaQuantidades;  // zigzag(quantidade)
+
+    /**
+     * @struct Dicionario
+     * @brief Nomes distintos concatenados num só texto + tabela hash de índices
+     *
+     * Um vector<string> com unordered_map<string, ...> custaria ~120 bytes
+     * por nome (objeto string, cópia no heap, nó do map); aqui cada nome
+     * custa seus caracteres, um início (4 bytes) e ~2 posições da tabela.
+     */
+    struct Dicionario {
+        string texto;              // Todos os nomes, um após o outro
+        vector<uint32_t> inicios;  // inicios[i] = começo do nome i (+ sentinela no fim)
+        vector<uint32_t> tabela;   // Endereçamento aberto: 0 = vazio, senão índice + 1
+
+        Dicionario() : inicios(1, 0) {}
+        uint32_t indiceDe(const string& nome);  // Acrescenta o nome se for novo
+        string nome(uint32_t indice) const;
+        size_t tamanho() const { return inicios.size() - 1; }
+        size_t bytes() const;
+    };
+
+    // ===== Dicionários =====
+    Dicionario artistas;
+    Dicionario nomesItens;  // Nomes próprios das linhas e nomes anteriores do catálogo
+
+    // ===== Catálogo =====
+    GerenciadorItens* catalogo = nullptr;
+    // itemId -> (limite, nome): pedidos de posição < limite usavam esse nome do
+    // catálogo (limites crescentes; só itens renomeados/removidos depois de arquivados)
+    unordered_map<int, vector<pair<size_t, uint32_t>>> nomesAnteriores;
+
+    // Faixa de IDs já arquivados (análises acumulam em vetor denso quando cabe)
+    int menorItem, maiorItem;
+    int menorCamarim, maiorCamarim;
+    size_t totalLinhas;
+
+    vector<Bloco> blocos;
+    size_t tamanhoBloco;       // Pedidos por ponto de partida
+    Cursor fim;                // Estado de escrita (posição final de cada coluna)
+    size_t bytesEstimados;     // Custo estimado dos mesmos pedidos como objetos Pedido
+
+    // Decodifica o pedido na posição do cursor e avança todas as colunas
+    Pedido decodificar(Cursor& cursor) const;
+
+    // Avança o cursor um pedido sem montar o objeto (só pula os varints)
+    void pular(Cursor& cursor) const;
+
+    // Nome do item no catálogo na época em que o pedido da posição foi arquivado
+    string nomeDoCatalogo(int itemId, size_t pedido) const;
+
+    // O catálogo vai deixar de ter este nome para o item: guarda-o para os pedidos já arquivados
+    void guardarNomeAnterior(int itemId, const string& nome);
+
+public:
+    /**
+     * @param tamanhoBloco Pedidos por ponto de partida (menor = buscarPorId
+     *        decodifica menos, ao custo de mais pontos guardados)
+     */
+    explicit ArquivoPedidos(size_t tamanhoBloco = 128);
+    ~ArquivoPedidos();
+
+    // Não copiável: a cópia não estaria registrada no catálogo
+    ArquivoPedidos(const ArquivoPedidos&) = delete;
+    ArquivoPedidos& operator=(const ArquivoPedidos&) = delete;
+
+    /**
+     * @brief Passa a resolver os nomes de item pelo catálogo (O(1) por linha)
+     *
+     * Pedidos arquivados antes continuam com os seus nomes.
+     */
+    void conectar(GerenciadorItens& itens);
+
+    /**
+     * @brief Solta o catálogo: guarda os nomes de que os pedidos já arquivados dependem
+     */
+    void desconectar();
+
+    /**
+     * @brief Acrescenta uma cópia do pedido ao arquivo (qualquer status)
+     */
+    void arquivar(const Pedido& pedido);
+
+    /**
+     * @brief Move um pedido ATENDIDO do gerenciador para o arquivo
+     * @return false se o pedido não existe ou ainda está pendente (nada muda)
+     *
+     * A remoção passa pelo gerenciador: observadores recebem aoMudarPedido(p, nullptr)
+     * e, em seguida, aoDescartarDependentes (o histórico não desfaz o arquivamento).
+     */
+    bool arquivar(GerenciadorPedidos& pedidos, int pedidoId);
+
+    /**
+     * @brief Move todos os pedidos atendidos do gerenciador para o arquivo
+     * @return Quantidade de pedidos arquivados (em ordem de ID)
+     */
+    int arquivarAtendidos(GerenciadorPedidos& pedidos);
+
+    // ===== Consultas (decodificam sob demanda) =====
+
+    /**
+     * @brief Todos os pedidos arquivados, na ordem de arquivamento
+     */
+    vector<Pedido> listar() const;
+
+    /**
+     * @brief Pedido arquivado com o ID (o mais recente, se arquivado mais de uma vez)
+     * @param saida Recebe o pedido se encontrado
+     * @return false se nenhum pedido arquivado tem o ID
+     *
+     * Examina só os blocos cuja faixa de IDs contém o ID; neles lê apenas a
+     * coluna de IDs e decodifica só o pedido encontrado.
+     */
+    bool buscarPorId(int id, Pedido& saida) const;
+
+    /**
+     * @brief Quantidade total pedida de cada item (lê só 3 colunas)
+     */
+    map<int, long long> quantidadePorItem() const;
+
+    /**
+     * @brief Quantidade de pedidos arquivados por camarim (lê só 1 coluna)
+     */
+    map<int, int> pedidosPorCamarim() const;
+
+    size_t tamanho() const;             // Pedidos arquivados
+    size_t bytesComprimidos() const;    // Colunas + dicionários + nomes anteriores + pontos de partida
+    size_t bytesDescomprimidos() const; // Estimativa dos mesmos pedidos como objetos Pedido
+
+    // ===== Observador (POLIMORFISMO: sobrescreve o aviso do catálogo) =====
+    void aoMudarItem(const Item* antes, const Item* depois) override;
+};  // Fim da classe ArquivoPedidos
+
+#endif // ARQUIVO_H
+// Fim do include guard
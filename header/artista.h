@@ -17,6 +17,12 @@
 #include "pessoa.h"
 // Inclui biblioteca vector para armazenar lista de artistas
 #include <vector>
+// Inclui o motor de consultas (filtros, ordenação e limite)
+#include "consulta.h"
+// Inclui o repositório genérico (vector por ID + índices declarados)
+#include "repositorio.h"
+// Inclui a base de observadores de mutações
+#include "observador.h"
 
 /**
  * @class Artista
@@ -53,7 +59,9 @@ public:  // Métodos públicos
     // Getters - Métodos para ler atributos
     int getCamarimId() const;  // Retorna o ID do camarim do artista
     
-    // Setters - Métodos para modificar atributos
+    // Setters - Métodos para modificar atributos (validam pelas regras de esquema.h)
+    void setId(int id) override;                 // SOBRESCREVE Pessoa: ID não negativo
+    void setNome(const string& nome) override;   // SOBRESCREVE Pessoa: nome não vazio
     void setCamarimId(int camarimId);  // Define novo camarimId
     
     /**
@@ -69,24 +77,32 @@ public:  // Métodos públicos
  * @class GerenciadorArtistas
  * @brief Gerencia operações CRUD de artistas
  */
-class GerenciadorArtistas {  // Classe gerenciadora para operações com artistas
+class GerenciadorArtistas : public FonteMutacoes {  // Classe gerenciadora para operações com artistas
 private:  // Atributos privados (ENCAPSULAMENTO)
-    vector<Artista> artistas;  // Vetor que armazena todos os artistas cadastrados
-    int proximoId;             // Contador para gerar IDs únicos sequencialmente
+    // Índice: camarimId -> IDs dos artistas
+    using PorCamarim = IndicePorGrupo<&Artista::getCamarimId>;
+    
+    Repositorio<Artista, PorCamarim> artistas;  // Artistas em ordem de ID + índices
     
 public:  // Métodos públicos (interface CRUD)
     /**
      * @brief Construtor
      */
     GerenciadorArtistas();  // Inicializa o gerenciador
+
+    /**
+     * @brief Alocador de IDs: blocos para criação em várias threads e limite a persistir
+     */
+    AlocadorIds& getAlocadorIds();
     
     /**
      * @brief Cadastra novo artista
      * @param nome Nome do artista
      * @param camarimId ID do camarim
+     * @param bloco Bloco de IDs da thread (de getAlocadorIds(); nullptr = ID avulso)
      * @return ID do artista cadastrado
      */
-    int cadastrar(const string& nome, int camarimId);  
+    int cadastrar(const string& nome, int camarimId, AlocadorIds::Bloco* bloco = nullptr);  
     // CREATE: Cria novo artista e retorna o ID gerado
     
     /**
@@ -95,6 +111,9 @@ public:  // Métodos públicos (interface CRUD)
      * @return Ponteiro para o artista ou nullptr se não encontrado
      */
     Artista* buscarPorId(int id);  
+    const Artista* buscarPorId(int id) const;  // Versão somente leitura
+    // ATENÇÃO: mudar o camarim pelo ponteiro (setCamarimId) não atualiza o
+    // índice por camarim; use atualizar()
     // READ: Busca e retorna ponteiro para o artista (ou nullptr)
     
     /**
@@ -120,6 +139,12 @@ public:  // Métodos públicos (interface CRUD)
     vector<Artista> listar() const;  
     // READ: Retorna cópia do vetor com todos os artistas
     
+    /**
+     * @brief Executa uma consulta sobre os artistas (varredura vetorizada)
+     * @param consulta Condições, ordenação e limite
+     */
+    ResultadoConsulta<Artista> consultar(const Consulta& consulta) const;
+    
     /**
      * @brief Atualiza dados de um artista
      * @param id ID do artista
@@ -129,6 +154,12 @@ public:  // Métodos públicos (interface CRUD)
      */
     bool atualizar(int id, const string& nome, int camarimId);  
     // UPDATE: Modifica dados de um artista existente, retorna true se conseguiu
+    
+    /**
+     * @brief Coloca o artista exatamente no estado informado (desfazer/refazer)
+     * @param estado Artista com o ID a restaurar (recriado se foi removido)
+     */
+    void restaurar(const Artista& estado);
 };  // Fim da classe GerenciadorArtistas
 
 #endif // ARTISTA_H - Fim da proteção contra inclusão múltipla
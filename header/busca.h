@@ -0,0 +1,121 @@
+/**
+ * @file busca.h
+ * @brief Normalização de nomes e índice de trigramas para busca aproximada
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ *
+ * Permite encontrar itens mesmo com erros de digitação, acentos ou
+ * abreviações ("agua mineral", "Água Mineral", "Agua Min.").
+ */
+
+// Proteção contra inclusão múltipla
+#ifndef BUSCA_H  // Se BUSCA_H não foi definido
+#define BUSCA_H  // Define BUSCA_H
+
+#include <string>         // Para trabalhar com strings
+#include <vector>         // Para listas de IDs e resultados
+#include <unordered_map>  // Para tabelas hash (trigrama -> IDs)
+#include <cstdint>        // Para uint32_t
+
+using namespace std;
+
+/**
+ * @brief Normaliza um nome para comparação tolerante
+ * @param nome Nome original (UTF-8)
+ * @return Nome em minúsculas, sem acentos, sem pontuação e com espaços simples
+ *
+ * Exemplo: "  Água  Min. " -> "agua min"
+ */
+string normalizarNome(const string& nome);
+
+/**
+ * @struct Candidato
+ * @brief Resultado da busca no índice: ID e similaridade (0.0 a 1.0)
+ */
+struct Candidato {
+    int id;              // ID da entidade encontrada
+    double similaridade; // Coeficiente de Dice entre os trigramas (1.0 = idêntico)
+
+    Candidato() : id(0), similaridade(0.0) {}
+    Candidato(int id, double similaridade) : id(id), similaridade(similaridade) {}
+};
+
+/**
+ * @class IndiceTrigramas
+ * @brief Índice invertido de trigramas sobre nomes normalizados
+ *
+ * Cada nome normalizado é quebrado em trigramas (3 caracteres consecutivos,
+ * com espaços de preenchimento nas bordas). O índice guarda, para cada
+ * trigrama, a lista de IDs que o contêm (LISTA DE POSTAGENS).
+ *
+ * A busca conta quantos trigramas cada ID compartilha com a consulta,
+ * percorrendo apenas as listas dos trigramas da consulta (nunca o catálogo
+ * inteiro), e ordena pelo coeficiente de Dice: 2 * comuns / (|A| + |B|).
+ *
+ * Atualização incremental: inserir/remover custam O(tamanho do nome).
+ *
+ * Buscas (métodos const) podem rodar ao mesmo tempo em várias threads: o
+ * rascunho da contagem é de cada thread. Inserir/remover exigem acesso
+ * exclusivo, como em qualquer contêiner da STL.
+ */
+class IndiceTrigramas {
+private:
+    unordered_map<uint32_t, vector<int>> postagens;  // Trigrama -> IDs que o contêm
+    vector<vector<uint32_t>> trigramasPorId;         // [id] -> seus trigramas (vazio = não indexado)
+    size_t indexados = 0;                            // Quantidade de IDs presentes no índice
+
+    /**
+     * @brief Extrai os trigramas distintos de um nome já normalizado
+     * @param normalizado Nome normalizado
+     * @param comBordas true = inclui trigramas com espaços nas bordas
+     */
+    static vector<uint32_t> extrairTrigramas(const string& normalizado, bool comBordas);
+
+public:
+    /**
+     * @brief Indexa (ou reindexa) um nome
+     * @param id ID da entidade (>= 0)
+     * @param nome Nome original (será normalizado)
+     * @throws ValidacaoException se o ID é negativo
+     */
+    void inserir(int id, const string& nome);
+
+    /**
+     * @brief Remove um ID do índice (sem efeito se não existir)
+     */
+    void remover(int id);
+
+    /**
+     * @brief Remove todos os nomes do índice
+     */
+    void limpar();
+
+    /**
+     * @brief Busca os nomes mais parecidos com a consulta
+     * @param consulta Texto digitado (qualquer grafia)
+     * @param limite Quantidade máxima de resultados
+     * @param similaridadeMinima Descarta candidatos abaixo deste valor
+     * @return Candidatos em ordem decrescente de similaridade (empate: menor ID)
+     */
+    vector<Candidato> buscar(const string& consulta, size_t limite,
+                             double similaridadeMinima = 0.3) const;
+
+    /**
+     * @brief IDs cujo nome pode conter o trecho (filtro para o operador CONTEM)
+     * @param trechoNormalizado Trecho já normalizado (normalizarNome)
+     * @param candidatos Saída: IDs que possuem TODOS os trigramas do trecho
+     * @return false se o trecho é curto demais (< 3 caracteres) para usar o índice
+     *
+     * O resultado é um SUPERCONJUNTO: quem chama deve confirmar a substring.
+     */
+    bool candidatosSubstring(const string& trechoNormalizado, vector<int>& candidatos) const;
+
+    /**
+     * @brief Quantidade de nomes indexados
+     */
+    size_t tamanho() const;
+};  // Fim da classe IndiceTrigramas
+
+#endif // BUSCA_H
+// Fim do include guard
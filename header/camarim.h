@@ -17,6 +17,11 @@
 #include <string>    // Para trabalhar com strings
 #include <vector>    // Para lista dinâmica de camarins
 #include <map>       // Para armazenar itens com chave itemId
+#include "consulta.h"  // Motor de consultas (filtros, ordenação e limite)
+#include "repositorio.h"  // Repositório genérico (vector por ID + índices declarados)
+#include "observador.h"  // Observadores de mutações (painel, históricos)
+#include "relogio.h"     // Carimbos de tempo das alterações
+#include "copianaescrita.h"  // Itens compartilhados entre cópias (modelos de rider)
 #include <iostream>  // Para entrada/saída (cout, cin)
 
 using namespace std;  // Namespace padrão da STL
@@ -64,8 +69,9 @@ private:  // Atributos privados - ENCAPSULAMENTO
     int id;                          // ID único do camarim
     string nome;                     // Nome identificador do camarim
     int artistaId;                   // ID do artista associado (0 = sem artista)
-    map<int, ItemCamarim> itens;    // Map: chave = itemId, valor = ItemCamarim
+    CopiaNaEscrita<map<int, ItemCamarim>> itens;  // Map: chave = itemId, valor = ItemCamarim
     // MAP: acesso rápido O(log n) por itemId, não permite chaves duplicadas
+    // CopiaNaEscrita: cópias do camarim compartilham o map até a primeira alteração
     
 public:  // Métodos públicos
     /**
@@ -88,7 +94,7 @@ public:  // Métodos públicos
     
     // GETTERS: métodos const que retornam cópias/valores (não modificam objeto)
     int getId() const;          // Retorna ID do camarim
-    string getNome() const;     // Retorna nome do camarim
+    const string& getNome() const;  // Retorna nome do camarim
     int getArtistaId() const;   // Retorna ID do artista associado
     
     // SETTERS: métodos que permitem modificar atributos privados
@@ -118,6 +124,20 @@ public:  // Métodos públicos
      */
     bool removerItem(int itemId, int quantidade);
     
+    /**
+     * @brief Acesso somente leitura aos itens do camarim
+     * @return Referência constante ao map (chave = itemId)
+     */
+    const map<int, ItemCamarim>& getItens() const;
+    
+    /**
+     * @brief Substitui os itens pelos de 'origem' SEM copiar o map
+     * 
+     * Camarim e origem compartilham o armazenamento até um dos dois ser
+     * alterado (ex: camarim vazio abastecido por um modelo de rider).
+     */
+    void compartilharItens(const CopiaNaEscrita<map<int, ItemCamarim>>& origem);
+    
     /**
      * @brief Exibe informações completas do camarim
      * @return String formatada com ID, nome, artista e lista de itens
@@ -136,6 +156,31 @@ public:  // Métodos públicos
     friend ostream& operator<<(ostream& os, const Camarim& camarim);
 };  // Fim da classe Camarim
 
+/**
+ * @enum TipoAlteracaoCamarim
+ * @brief O que aconteceu com o camarim
+ */
+enum class TipoAlteracaoCamarim {
+    CRIADO, ATUALIZADO, ITEM_INSERIDO, ITEM_REMOVIDO, REMOVIDO
+};
+
+/**
+ * @struct AlteracaoCamarim
+ * @brief Uma alteração de camarim feita pelo gerenciador, com o instante
+ */
+struct AlteracaoCamarim {
+    long long tempo;            // Instante (Relogio, µs)
+    int camarimId;              // Camarim alterado
+    TipoAlteracaoCamarim tipo;  // Tipo da alteração
+    int itemId;                 // Item movimentado (apenas ITEM_*; 0 nos demais)
+    int quantidade;             // Quantidade movimentada (apenas ITEM_*)
+    
+    /**
+     * @brief Descrição legível (ex: "item 3 inserido (x2)")
+     */
+    string descricao() const;
+};  // Fim da struct AlteracaoCamarim
+
 /**
  * @class GerenciadorCamarins
  * @brief Gerencia operações CRUD de camarins
@@ -143,26 +188,38 @@ public:  // Métodos públicos
  * CRUD = Create, Read, Update, Delete
  * Centraliza todas as operações de gerenciamento de camarins
  */
-class GerenciadorCamarins {
+class GerenciadorCamarins : public FonteMutacoes {
 private:  // Atributos privados
-    vector<Camarim> camarins;  // Vector dinâmico de camarins
-    int proximoId;             // Contador para gerar IDs únicos
+    // Índice: artistaId -> IDs dos camarins
+    using PorArtista = IndicePorGrupo<&Camarim::getArtistaId>;
+    
+    Repositorio<Camarim, PorArtista> camarins;  // Camarins em ordem de ID + índices
+    vector<AlteracaoCamarim> alteracoes;      // Histórico, em ordem crescente de tempo
+    
+    // Anexa uma alteração ao histórico com o instante atual
+    void registrarAlteracao(int camarimId, TipoAlteracaoCamarim tipo, int itemId = 0, int quantidade = 0);
     
 public:  // Métodos públicos (interface CRUD)
     /**
-     * @brief Construtor - inicializa lista vazia e proximoId = 1
+     * @brief Construtor - inicializa lista vazia (IDs a partir de 1)
      */
     GerenciadorCamarins();
+
+    /**
+     * @brief Alocador de IDs: blocos para criação em várias threads e limite a persistir
+     */
+    AlocadorIds& getAlocadorIds();
     
     /**
      * @brief Cadastra novo camarim (CREATE)
      * @param nome Nome do camarim
      * @param artistaId ID do artista (0 = sem artista)
+     * @param bloco Bloco de IDs da thread (de getAlocadorIds(); nullptr = ID avulso)
      * @return ID do camarim cadastrado
      * 
      * Gera ID automático, cria Camarim, adiciona ao vector
      */
-    int cadastrar(const string& nome, int artistaId);
+    int cadastrar(const string& nome, int artistaId, AlocadorIds::Bloco* bloco = nullptr);
     
     /**
      * @brief Busca camarim por ID (READ)
@@ -173,6 +230,9 @@ public:  // Métodos públicos (interface CRUD)
      * nullptr = valor nulo para ponteiros
      */
     Camarim* buscarPorId(int id);
+    const Camarim* buscarPorId(int id) const;  // Versão somente leitura
+    // ATENÇÃO: mudar o artista pelo ponteiro (setArtistaId) não atualiza o
+    // índice por artista; use atualizar()
     
     /**
      * @brief Busca camarim associado a um artista (READ)
@@ -187,8 +247,6 @@ public:  // Métodos públicos (interface CRUD)
      * @brief Remove camarim (DELETE)
      * @param id ID do camarim
      * @return true se removido, false se não encontrado
-     * 
-     * Usa remove_if + erase para remover do vector
      */
     bool remover(int id);
     
@@ -198,6 +256,20 @@ public:  // Métodos públicos (interface CRUD)
      */
     vector<Camarim> listar() const;
     
+    /**
+     * @brief Todos os camarins, sem cópia (somente leitura, em ordem de ID)
+     * 
+     * A referência vale até a próxima alteração do gerenciador: várias
+     * threads podem ler ao mesmo tempo desde que ninguém altere.
+     */
+    const vector<Camarim>& todos() const;
+    
+    /**
+     * @brief Executa uma consulta sobre os camarins (varredura vetorizada)
+     * @param consulta Condições, ordenação e limite
+     */
+    ResultadoConsulta<Camarim> consultar(const Consulta& consulta) const;
+    
     /**
      * @brief Atualiza dados de um camarim (UPDATE)
      * @param id ID do camarim a atualizar
@@ -208,6 +280,59 @@ public:  // Métodos públicos (interface CRUD)
      * Busca por ID e atualiza os campos
      */
     bool atualizar(int id, const string& nome, int artistaId);
+    
+    /**
+     * @brief Adiciona item ao camarim, avisando os observadores
+     * @throws CamarimException se o camarim não existe
+     * 
+     * Prefira este método a buscarPorId(id)->inserirItem(...): o ponteiro
+     * altera o camarim sem avisar painel e históricos.
+     */
+    void inserirItem(int camarimId, int itemId, const string& nomeItem, int quantidade);
+    
+    /**
+     * @brief Remove quantidade de item do camarim, avisando os observadores
+     * @return false se não há quantidade suficiente (nada muda)
+     * @throws CamarimException se o camarim não existe
+     */
+    bool removerItem(int camarimId, int itemId, int quantidade);
+    
+    /**
+     * @brief Adiciona várias linhas de uma vez (ex: modelo de rider)
+     * @param itens Linhas já validadas (ex: ModeloRider::getLinhasCamarim())
+     * @throws CamarimException se o camarim não existe
+     * 
+     * Camarim vazio passa a COMPARTILHAR o map (cópia na escrita, O(1));
+     * camarim com itens soma as linhas. Registra um ITEM_INSERIDO por linha
+     * e avisa os observadores uma única vez.
+     */
+    void abastecer(int camarimId, const CopiaNaEscrita<map<int, ItemCamarim>>& itens);
+    
+    /**
+     * @brief Retira todas as linhas do camarim de uma vez (ex: fechamento do show)
+     * @return As linhas que estavam no camarim
+     * @throws CamarimException se o camarim não existe
+     * 
+     * Registra um ITEM_REMOVIDO por linha e avisa os observadores uma única vez.
+     */
+    map<int, ItemCamarim> esvaziar(int camarimId);
+    
+    /**
+     * @brief Coloca o camarim exatamente no estado informado (desfazer/refazer)
+     * @param estado Camarim com o ID a restaurar (recriado se foi removido)
+     * 
+     * Registra a alteração como CRIADO (recriado) ou ATUALIZADO.
+     */
+    void restaurar(const Camarim& estado);
+    
+    /**
+     * @brief Alterações feitas no período [inicio, fim] (instantes em µs)
+     * @param camarimId Filtra um camarim (0 = todos)
+     * @return Em ordem cronológica
+     * 
+     * O histórico é anexado em ordem de tempo: busca binária, O(log n + k)
+     */
+    vector<AlteracaoCamarim> alteracoesEntre(long long inicio, long long fim, int camarimId = 0) const;
 };  // Fim da classe GerenciadorCamarins
 
 #endif // CAMARIM_H
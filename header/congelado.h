@@ -0,0 +1,120 @@
+/**
+ * @file congelado.h
+ * @brief Catálogo congelado: hash perfeito mínimo por ID e por nome normalizado
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ *
+ * Durante o show o catálogo praticamente não muda. Congelado, ele troca as
+ * tabelas hash genéricas (unordered_map: balde -> nó -> chave) por tabelas
+ * IMUTÁVEIS montadas para as chaves atuais:
+ *
+ * HASH PERFEITO MÍNIMO (hash-and-displace): as n chaves são espalhadas em
+ * ~n/2 grupos; para cada grupo procura-se um deslocamento d que leve todas
+ * as suas chaves a posições livres de uma tabela com EXATAMENTE n entradas.
+ * Na busca: grupo -> deslocamento -> posição, sempre uma única entrada a
+ * conferir, sem colisões e sem listas. As entradas ficam em vector
+ * contíguos (sem ponteiros).
+ *
+ * A tabela guarda só a POSIÇÃO de cada chave no vector de origem (o vector
+ * de itens do GerenciadorItens), então vale enquanto esse vector não muda:
+ * o gerenciador descarta o catálogo congelado na primeira edição.
+ *
+ * Nomes são indexados normalizados (normalizarNome): "Água Min." e
+ * "agua min" são a mesma chave. Se dois itens têm o mesmo nome
+ * normalizado, vale o primeiro do vector.
+ */
+
+// Proteção contra inclusão múltipla
+#ifndef CONGELADO_H  // Se CONGELADO_H não foi definido
+#define CONGELADO_H  // Define CONGELADO_H
+
+#include <string>    // Para nomes
+#include <vector>    // Para as tabelas (contíguas)
+#include <cstdint>   // Para uint32_t, uint64_t
+#include <cstddef>   // Para size_t
+
+using namespace std;
+
+/**
+ * @class CatalogoCongelado
+ * @brief Tabelas imutáveis chave -> posição com hash perfeito mínimo
+ *
+ * Uso:
+ *   CatalogoCongelado c(ids, nomes);           // ids[i] e nomes[i] = item da posição i
+ *   size_t p = c.posicaoDoId(42);              // NAO_ENCONTRADO se não existe
+ *   size_t q = c.posicaoDoNome("Agua Min.");   // Normaliza a consulta
+ */
+class CatalogoCongelado {
+public:
+    static const size_t NAO_ENCONTRADO = static_cast<size_t>(-1);
+
+private:
+    /**
+     * @struct TabelaPerfeita
+     * @brief Deslocamentos por grupo + semente (as entradas ficam com quem usa)
+     *
+     * deslocamentos[g] >= 0: posição = espalhar(hash, d) % n
+     * deslocamentos[g] <  0: grupo de uma chave só, posição = -d - 1
+     */
+    struct TabelaPerfeita {
+        vector<int32_t> deslocamentos;
+        uint64_t semente = 0;
+        size_t tamanho = 0;
+
+        /**
+         * @brief Monta a tabela para hashes DISTINTOS
+         * @param entradaDaChave Saída: posição na tabela de cada chave
+         * @return false se não conseguiu (hashes repetidos)
+         */
+        bool montar(const vector<uint64_t>& hashes, vector<uint32_t>& entradaDaChave);
+
+        // Entrada da tabela onde a chave estaria (a chave ainda precisa ser conferida)
+        size_t entrada(uint64_t hash) const;
+    };
+
+    // Entradas por ID: chave e posição juntas (uma linha de cache)
+    struct EntradaId {
+        int id;
+        uint32_t posicao;
+    };
+
+    // Entradas por nome: hash completo antes da comparação de texto
+    struct EntradaNome {
+        uint64_t hash;
+        uint32_t posicao;
+    };
+
+    TabelaPerfeita tabelaIds;
+    vector<EntradaId> entradasId;
+
+    TabelaPerfeita tabelaNomes;
+    vector<EntradaNome> entradasNome;
+    vector<string> nomesPorEntrada;  // Nome normalizado de cada entrada (conferência final)
+
+public:
+    /**
+     * @brief Congela as chaves informadas
+     * @param ids IDs distintos; ids[i] pertence à posição i
+     * @param nomes Nomes originais (normalizados aqui); nomes[i] pertence à posição i
+     * @throws ValidacaoException se a tabela de IDs não monta (IDs repetidos)
+     */
+    CatalogoCongelado(const vector<int>& ids, const vector<string>& nomes);
+
+    /**
+     * @brief Posição do ID no vector de origem (NAO_ENCONTRADO se não existe)
+     */
+    size_t posicaoDoId(int id) const;
+
+    /**
+     * @brief Posição do item com esse nome normalizado (NAO_ENCONTRADO se não existe)
+     * @param nome Nome em qualquer grafia (normalizado antes da busca)
+     */
+    size_t posicaoDoNome(const string& nome) const;
+
+    size_t tamanho() const;         // Quantidade de IDs
+    size_t nomesDistintos() const;  // Quantidade de nomes normalizados distintos
+};  // Fim da classe CatalogoCongelado
+
+#endif // CONGELADO_H
+// Fim do include guard
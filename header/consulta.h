@@ -0,0 +1,365 @@
+/**
+ * @file consulta.h
+ * @brief Motor de consultas componíveis (filtros, ordenação e limite)
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ *
+ * Em vez de um método dedicado para cada pergunta (buscarPorCamarim,
+ * listarPendentes...), uma Consulta descreve:
+ * - condições sobre campos (preço entre, quantidade acima de, nome contém...)
+ * - critérios de ordenação
+ * - limite de resultados
+ *
+ * Exemplo:
+ *   Consulta c;
+ *   c.onde(Campo::PRECO, Operador::ENTRE, 5.0, 20.0)
+ *    .ondeTexto(Campo::NOME, Operador::CONTEM, "agua")
+ *    .ordenarPor(Campo::PRECO, false)
+ *    .limitar(10);
+ *   ResultadoConsulta<Item> r = gerenciadorItens.consultar(c);
+ *
+ * PLANEJAMENTO: cada gerenciador escolhe, em consultar(), um índice capaz de
+ * reduzir os candidatos (hash por ID, trigramas, faixa do map...). Sem índice
+ * aplicável, faz uma VARREDURA VETORIZADA: cada condição é aplicada de uma
+ * vez sobre um vetor de seleção (posições ainda válidas), uma coluna por vez,
+ * começando pelas condições numéricas (mais baratas).
+ */
+
+// Proteção contra inclusão múltipla
+#ifndef CONSULTA_H  // Se CONSULTA_H não foi definido
+#define CONSULTA_H  // Define CONSULTA_H
+
+#include <string>     // Para trabalhar com strings
+#include <vector>     // Para resultados e vetores de seleção
+#include <algorithm>  // Para remove_if, sort, partial_sort, stable_partition
+#include <numeric>    // Para iota
+#include <cstddef>    // Para size_t
+
+#include "excecoes.h" // Para ValidacaoException
+
+using namespace std;
+
+// Declarações antecipadas: as entidades incluem este header
+class Item;
+class Artista;
+class Camarim;
+class Pedido;
+class ListaCompras;
+struct ItemEstoque;
+
+/**
+ * @enum Campo
+ * @brief Campos que podem ser filtrados/ordenados
+ *
+ * Nem toda entidade possui todos os campos (ver as tabelas em esquema.h).
+ */
+enum class Campo {
+    ID,          // ID da entidade (itemId no estoque)
+    NOME,        // Nome / descrição / nome do artista do pedido
+    PRECO,       // Preço do item ou total da lista de compras
+    QUANTIDADE,  // Quantidade no estoque ou soma das quantidades dos itens
+    CAMARIM,     // ID do camarim (artista, pedido)
+    ARTISTA,     // ID do artista (camarim)
+    ATENDIDO     // Status do pedido (1 = atendido, 0 = pendente)
+};
+
+/**
+ * @enum Operador
+ * @brief Operadores de comparação das condições
+ */
+enum class Operador {
+    IGUAL, DIFERENTE, MENOR, MENOR_IGUAL, MAIOR, MAIOR_IGUAL,
+    ENTRE,   // Faixa fechada [valor, valorFinal]
+    CONTEM   // Apenas texto: substring, ignorando acentos e maiúsculas
+};
+
+/**
+ * @struct Condicao
+ * @brief Uma condição da consulta (campo + operador + valor)
+ */
+struct Condicao {
+    Campo campo;
+    Operador operador;
+    bool textual;        // true = compara texto, false = compara número
+    double valor;        // Valor numérico (início da faixa em ENTRE)
+    double valorFinal;   // Fim da faixa (apenas ENTRE)
+    string texto;        // Texto comparado (já normalizado em CONTEM)
+
+    /**
+     * @brief Avalia a condição para um valor numérico do campo
+     */
+    bool avaliar(double numero) const;
+
+    /**
+     * @brief Avalia a condição para um valor textual do campo
+     */
+    bool avaliarTexto(const string& valorCampo) const;
+};
+
+/**
+ * @struct Ordenacao
+ * @brief Critério de ordenação (campo + sentido)
+ */
+struct Ordenacao {
+    Campo campo;
+    bool crescente;
+};
+
+// ==================== Acesso aos campos das entidades ====================
+// campoNumerico devolve false e campoTexto nullptr quando a entidade não possui o campo;
+// o texto é lido no próprio registro, sem cópia (válido enquanto o registro existir)
+
+bool campoNumerico(const Item& item, Campo campo, double& valor);
+bool campoNumerico(const ItemEstoque& item, Campo campo, double& valor);
+bool campoNumerico(const Artista& artista, Campo campo, double& valor);
+bool campoNumerico(const Camarim& camarim, Campo campo, double& valor);
+bool campoNumerico(const Pedido& pedido, Campo campo, double& valor);
+bool campoNumerico(const ListaCompras& lista, Campo campo, double& valor);
+
+const string* campoTexto(const Item& item, Campo campo);
+const string* campoTexto(const ItemEstoque& item, Campo campo);
+const string* campoTexto(const Artista& artista, Campo campo);
+const string* campoTexto(const Camarim& camarim, Campo campo);
+const string* campoTexto(const Pedido& pedido, Campo campo);
+const string* campoTexto(const ListaCompras& lista, Campo campo);
+
+/**
+ * @brief Nome do campo para mensagens e exibição do plano
+ */
+string nomeCampo(Campo campo);
+
+/**
+ * @brief Converte um valor de condição em int sem comportamento indefinido
+ * @param inteiro Saída: o valor convertido
+ * @return false se o valor não é inteiro ou está fora da faixa de int (ou é NaN)
+ */
+bool valorInteiro(double valor, int& inteiro);
+
+/**
+ * @struct ResultadoConsulta
+ * @brief Registros encontrados e informações do plano executado
+ */
+template <typename T>
+struct ResultadoConsulta {
+    vector<T> registros;   // Cópias dos registros aprovados (ordenados e limitados)
+    string plano;          // Estratégia usada (ex: "índice hash por ID")
+    size_t examinados = 0; // Registros avaliados pelas condições
+};
+
+/**
+ * @class Consulta
+ * @brief Descrição declarativa de uma consulta (interface fluente)
+ */
+class Consulta {
+private:
+    vector<Condicao> condicoes;   // Todas devem ser verdadeiras (E lógico)
+    vector<Ordenacao> ordenacoes; // Critérios em ordem de prioridade
+    size_t limite;                // Máximo de resultados (0 = sem limite)
+
+    // Avalia uma condição sobre um registro
+    template <typename T>
+    static bool aprovar(const T& registro, const Condicao& condicao);
+
+    // Compara dois registros pelos critérios de ordenação (true = a antes de b)
+    template <typename T>
+    bool precede(const T& a, const T& b) const;
+
+    // Núcleo de executar(): 'registro(pos)' dá o registro da posição pos (0..total-1)
+    template <typename T, typename Acesso>
+    ResultadoConsulta<T> executarPor(size_t total, const vector<size_t>* candidatos,
+                                     const Acesso& registro, const string& plano) const;
+
+public:
+    Consulta();
+
+    /**
+     * @brief Adiciona condição numérica
+     * @param valorFinal Fim da faixa (usado apenas com Operador::ENTRE)
+     */
+    Consulta& onde(Campo campo, Operador operador, double valor, double valorFinal = 0.0);
+
+    /**
+     * @brief Adiciona condição textual (IGUAL, DIFERENTE ou CONTEM)
+     * @throws ValidacaoException se o operador não se aplica a texto
+     */
+    Consulta& ondeTexto(Campo campo, Operador operador, const string& texto);
+
+    /**
+     * @brief Adiciona critério de ordenação (aplicados na ordem de chamada)
+     */
+    Consulta& ordenarPor(Campo campo, bool crescente = true);
+
+    /**
+     * @brief Limita a quantidade de resultados (0 = sem limite)
+     */
+    Consulta& limitar(size_t quantidade);
+
+    const vector<Condicao>& getCondicoes() const;  // Condições (para o planejador)
+    size_t getLimite() const;                      // Limite atual
+    
+    /**
+     * @brief Procura condição "campo == inteiro" (candidata a índice)
+     * @param valor Saída: o inteiro comparado
+     * @return true se existe condição numérica IGUAL com valor inteiro no campo
+     */
+    bool igualdadeInteira(Campo campo, int& valor) const;
+
+    /**
+     * @brief Verifica se todos os campos usados existem na entidade T
+     * @throws ValidacaoException com o nome do campo inválido
+     */
+    template <typename T>
+    void validar() const;
+
+    /**
+     * @brief Executa a consulta sobre um vetor de registros
+     * @param dados Registros da entidade (ordem = ordem de cadastro)
+     * @param candidatos Posições sugeridas por um índice (nullptr = todas)
+     * @param plano Descrição da estratégia (copiada para o resultado)
+     *
+     * Os candidatos podem ser um SUPERCONJUNTO: todas as condições são
+     * reavaliadas. Sem ordenação, o resultado segue a ordem de 'dados'.
+     */
+    template <typename T>
+    ResultadoConsulta<T> executar(const vector<T>& dados, const vector<size_t>* candidatos,
+                                  const string& plano) const;
+
+    /**
+     * @brief Executa a consulta sobre registros guardados em outro contêiner
+     * @param registros Endereços dos registros, na ordem do resultado sem ordenação
+     *
+     * Para coleções que não são vector (ex: faixa de um map): só os
+     * aprovados são copiados, como no executar() sobre vector.
+     */
+    template <typename T>
+    ResultadoConsulta<T> executar(const vector<const T*>& registros, const string& plano) const;
+};
+
+// ==================== Implementação dos templates ====================
+
+template <typename T>
+bool Consulta::aprovar(const T& registro, const Condicao& condicao) {
+    if (condicao.textual) {
+        const string* valor = campoTexto(registro, condicao.campo);  // validar() garante o campo
+        return condicao.avaliarTexto(*valor);
+    }
+    double valor = 0.0;
+    campoNumerico(registro, condicao.campo, valor);
+    return condicao.avaliar(valor);
+}
+
+template <typename T>
+bool Consulta::precede(const T& a, const T& b) const {
+    for (const Ordenacao& o : ordenacoes) {
+        double numeroA = 0.0, numeroB = 0.0;
+        if (campoNumerico(a, o.campo, numeroA)) {
+            campoNumerico(b, o.campo, numeroB);
+            if (numeroA != numeroB) {
+                return o.crescente ? numeroA < numeroB : numeroA > numeroB;
+            }
+        } else {
+            const string& textoA = *campoTexto(a, o.campo);
+            const string& textoB = *campoTexto(b, o.campo);
+            if (textoA != textoB) {
+                return o.crescente ? textoA < textoB : textoA > textoB;
+            }
+        }
+    }
+    return false;  // Empate em todos os critérios
+}
+
+template <typename T>
+void Consulta::validar() const {
+    T modelo;  // Registro vazio: só interessa quais campos existem
+    double numero;
+
+    for (const Condicao& c : condicoes) {
+        bool existe = c.textual ? campoTexto(modelo, c.campo) != nullptr
+                                : campoNumerico(modelo, c.campo, numero);
+        if (!existe) {
+            throw ValidacaoException("Campo '" + nomeCampo(c.campo) + "' não pode ser filtrado como "
+                                     + (c.textual ? "texto" : "número") + " nesta entidade");
+        }
+    }
+    for (const Ordenacao& o : ordenacoes) {
+        if (!campoNumerico(modelo, o.campo, numero) && campoTexto(modelo, o.campo) == nullptr) {
+            throw ValidacaoException("Campo '" + nomeCampo(o.campo) + "' não existe nesta entidade");
+        }
+    }
+}
+
+template <typename T>
+ResultadoConsulta<T> Consulta::executar(const vector<T>& dados, const vector<size_t>* candidatos,
+                                        const string& plano) const {
+    return executarPor<T>(dados.size(), candidatos, [&](size_t pos) -> const T& { return dados[pos]; }, plano);
+}
+
+template <typename T>
+ResultadoConsulta<T> Consulta::executar(const vector<const T*>& registros, const string& plano) const {
+    return executarPor<T>(registros.size(), nullptr, [&](size_t pos) -> const T& { return *registros[pos]; },
+                          plano);
+}
+
+template <typename T, typename Acesso>
+ResultadoConsulta<T> Consulta::executarPor(size_t total, const vector<size_t>* candidatos,
+                                           const Acesso& registro, const string& plano) const {
+    ResultadoConsulta<T> resultado;
+    resultado.plano = plano;
+
+    // 1) Vetor de seleção inicial: posições sugeridas pelo índice ou todas
+    vector<size_t> selecao;
+    if (candidatos) {
+        selecao = *candidatos;
+        sort(selecao.begin(), selecao.end());  // Índices devolvem em ordem arbitrária
+    } else {
+        selecao.resize(total);
+        iota(selecao.begin(), selecao.end(), 0);  // 0, 1, 2, ..., n-1
+    }
+    resultado.examinados = selecao.size();
+
+    // 2) Ordem de avaliação: condições numéricas primeiro (baratas), texto por último
+    vector<const Condicao*> ordem;
+    for (const Condicao& c : condicoes) {
+        ordem.push_back(&c);
+    }
+    stable_partition(ordem.begin(), ordem.end(), [](const Condicao* c) { return !c->textual; });
+
+    // 3) Aplica UMA condição por vez sobre toda a seleção (execução vetorizada)
+    for (const Condicao* c : ordem) {
+        if (selecao.empty()) {
+            break;
+        }
+        selecao.erase(remove_if(selecao.begin(), selecao.end(),
+                                [&](size_t pos) { return !aprovar(registro(pos), *c); }),
+                      selecao.end());
+    }
+
+    // 4) Ordenação (empate: ordem original) e limite
+    if (!ordenacoes.empty()) {
+        auto menor = [&](size_t a, size_t b) {
+            if (precede(registro(a), registro(b))) return true;
+            if (precede(registro(b), registro(a))) return false;
+            return a < b;
+        };
+        if (limite > 0 && limite < selecao.size()) {
+            // partial_sort: O(n log limite), ordena apenas os primeiros
+            partial_sort(selecao.begin(), selecao.begin() + limite, selecao.end(), menor);
+        } else {
+            sort(selecao.begin(), selecao.end(), menor);
+        }
+    }
+    if (limite > 0 && limite < selecao.size()) {
+        selecao.resize(limite);
+    }
+
+    // 5) Materializa apenas os registros aprovados
+    resultado.registros.reserve(selecao.size());
+    for (size_t pos : selecao) {
+        resultado.registros.push_back(registro(pos));
+    }
+    return resultado;
+}
+
+#endif // CONSULTA_H
+// Fim do include guard
@@ -0,0 +1,88 @@
+/**
+ * @file copianaescrita.h
+ * @brief Valor compartilhado com cópia na escrita (copy-on-write)
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ *
+ * Copiar um CopiaNaEscrita<T> não copia o T: as duas cópias passam a
+ * apontar para o mesmo valor. A cópia de verdade só acontece quando uma
+ * delas pede para escrever (escrever()) enquanto o valor ainda é
+ * compartilhado.
+ *
+ * Usado nos itens de Pedido e Camarim: mil pedidos criados a partir do
+ * mesmo modelo de rider ocupam a memória de UM map de itens, e as cópias
+ * de Pedido/Camarim feitas para avisar observadores, listar ou guardar no
+ * histórico custam O(1) até alguém alterar os itens.
+ */
+
+// Proteção contra inclusão múltipla
+#ifndef COPIANAESCRITA_H  // Se COPIANAESCRITA_H não foi definido
+#define COPIANAESCRITA_H  // Define COPIANAESCRITA_H
+
+#include <memory>  // Para shared_ptr (contagem de quem compartilha o valor)
+
+using namespace std;
+
+/**
+ * @class CopiaNaEscrita
+ * @brief Guarda um T compartilhado entre cópias até a primeira escrita
+ *
+ * Uso:
+ *   CopiaNaEscrita<map<int, ItemPedido>> a;
+ *   a.escrever()[1] = ItemPedido(1, "Agua", 6);
+ *   CopiaNaEscrita<map<int, ItemPedido>> b = a;  // O(1): mesmo map
+ *   b.escrever().erase(1);                        // b separa-se; a não muda
+ *
+ * TEMPLATE: a classe inteira fica no header (como IndiceGrupos, mas genérica).
+ */
+template <typename T>
+class CopiaNaEscrita {
+private:
+    shared_ptr<T> dados;  // nullptr = T vazio, sem alocação nenhuma
+
+public:
+    CopiaNaEscrita() {}
+
+    /**
+     * @brief Leitura: nunca copia
+     * @return Referência válida até a próxima escrita NESTA instância
+     */
+    const T& ler() const {
+        static const T vazio;  // Compartilhado por todas as instâncias sem dados
+        return dados ? *dados : vazio;
+    }
+
+    /**
+     * @brief Escrita: separa-se das outras cópias antes de devolver o valor
+     *
+     * Único dono: O(1). Valor compartilhado: copia o T uma vez.
+     */
+    T& escrever() {
+        if (!dados) {
+            dados = make_shared<T>();
+        } else if (dados.use_count() > 1) {
+            dados = make_shared<T>(*dados);  // Os outros continuam com o valor antigo
+        }
+        return *dados;
+    }
+
+    /**
+     * @brief true se as duas instâncias usam o mesmo armazenamento
+     *
+     * Mesmo armazenamento => mesmo conteúdo (o inverso não vale).
+     */
+    bool compartilhaCom(const CopiaNaEscrita& outra) const {
+        return &ler() == &outra.ler();
+    }
+
+    /**
+     * @brief Quantas instâncias usam este armazenamento (0 = vazio sem alocação)
+     */
+    long usos() const {
+        return dados.use_count();
+    }
+};  // Fim da classe CopiaNaEscrita
+
+#endif // COPIANAESCRITA_H
+// Fim do include guard
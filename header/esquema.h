@@ -0,0 +1,515 @@
+/**
+ * @file esquema.h
+ * @brief Esquema das entidades em tempo de compilação (campos, regras e serializadores)
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ *
+ * Cada entidade descreve seus campos UMA vez, numa tabela constexpr:
+ *
+ *   template <> struct Esquema<Item> {
+ *       static constexpr auto campos = make_tuple(
+ *           campo("id", Campo::ID, &Item::getId),
+ *           campo("nome", Campo::NOME, &Item::getNome).naoVazio("Nome do item não pode ser vazio"), ...);
+ *   };
+ *
+ * A partir da tabela são gerados, por template:
+ * - acesso por Campo para o motor de consultas (lerNumero / lerTexto)
+ * - validação das regras de cada campo (validar para o registro inteiro,
+ *   validarCampo para um valor antes de atribuí-lo): construtores, setters
+ *   e cadastros das entidades chamam estas funções, então a regra e a
+ *   mensagem existem só aqui
+ * - serializadores CSV, JSON e binário (paraCsv, paraJson, escreverBinario)
+ *
+ * Nada disso é reflexão em tempo de execução: a tupla é percorrida com
+ * fold expressions, cada campo vira uma chamada direta ao getter (inline),
+ * e o teste "é número ou texto?" é if constexpr. Um formato novo é uma
+ * função template aqui, não um método novo em cada entidade.
+ *
+ * Acessos aceitos na tabela: getter (&Item::getNome), membro público
+ * (&ItemEstoque::quantidade) ou função livre (&quantidadeTotal<Camarim>)
+ * para campos derivados.
+ */
+
+// Proteção contra inclusão múltipla
+#ifndef ESQUEMA_H  // Se ESQUEMA_H não foi definido
+#define ESQUEMA_H  // Define ESQUEMA_H
+
+#include <string>       // Para campos de texto
+#include <vector>       // Para exportar coleções
+#include <tuple>        // Para a tabela de campos (make_tuple, apply)
+#include <type_traits>  // Para decay_t, is_same_v, is_arithmetic_v, is_lvalue_reference_v
+#include <ostream>      // Para os serializadores
+#include <sstream>      // Para paraCsv / paraJson em string
+#include <iomanip>      // Para setprecision
+#include <cstdint>      // Para int32_t, int64_t, uint32_t
+#include <cstring>      // Para memcpy (double no binário)
+
+#include "consulta.h"      // Campo
+#include "excecoes.h"      // ValidacaoException
+#include "item.h"
+#include "artista.h"
+#include "camarim.h"
+#include "pedido.h"
+#include "listacompras.h"
+#include "estoque.h"
+
+using namespace std;
+
+namespace esquema {
+
+// ==================== Descrição dos campos ====================
+
+/**
+ * @enum Regra
+ * @brief Validação declarada para um campo
+ */
+enum class Regra {
+    NENHUMA,
+    NAO_VAZIO,     // Texto não pode ser vazio
+    NAO_NEGATIVO   // Número >= 0
+};
+
+/**
+ * @struct DescritorCampo
+ * @brief Um campo da entidade: nome externo, Campo de consulta, acesso e regra
+ * @tparam A Tipo do acesso (ponteiro para getter, membro ou função livre)
+ */
+template <typename A>
+struct DescritorCampo {
+    const char* nome;      // Nome no CSV/JSON
+    Campo campo;           // Campo do motor de consultas (se consultavel)
+    bool consultavel;      // false = só serialização (ex: código de barras)
+    A acesso;
+    Regra regra;
+    const char* mensagem;  // Mensagem da ValidacaoException quando a regra falha
+
+    constexpr DescritorCampo naoVazio(const char* texto) const {
+        return DescritorCampo{nome, campo, consultavel, acesso, Regra::NAO_VAZIO, texto};
+    }
+    constexpr DescritorCampo naoNegativo(const char* texto) const {
+        return DescritorCampo{nome, campo, consultavel, acesso, Regra::NAO_NEGATIVO, texto};
+    }
+};
+
+// Campo filtrável/ordenável pelas consultas
+template <typename A>
+constexpr DescritorCampo<A> campo(const char* nome, Campo campoConsulta, A acesso) {
+    return DescritorCampo<A>{nome, campoConsulta, true, acesso, Regra::NENHUMA, nullptr};
+}
+
+// Campo só de serialização
+template <typename A>
+constexpr DescritorCampo<A> campo(const char* nome, A acesso) {
+    return DescritorCampo<A>{nome, Campo::ID, false, acesso, Regra::NENHUMA, nullptr};
+}
+
+// ===== Leitura do valor (uma sobrecarga por tipo de acesso, tudo inline) =====
+
+template <typename T, typename R, typename C>
+inline R lerCampo(const T& registro, R (C::*getter)() const) {
+    return (registro.*getter)();
+}
+
+template <typename T, typename V, typename C>
+inline const V& lerCampo(const T& registro, V C::*membro) {
+    return registro.*membro;
+}
+
+template <typename T, typename R>
+inline R lerCampo(const T& registro, R (*funcao)(const T&)) {
+    return funcao(registro);
+}
+
+// Campo derivado: soma das quantidades das linhas (Camarim, Pedido, ListaCompras)
+template <typename T>
+long long quantidadeTotal(const T& registro) {
+    long long total = 0;
+    for (const auto& par : registro.getItens()) {
+        total += par.second.quantidade;
+    }
+    return total;
+}
+
+// ==================== Tabelas das entidades ====================
+
+/**
+ * @brief Esquema de uma entidade (sem especialização = não compila)
+ *
+ * Especializações: 'entidade' (nome externo) e 'campos' (tupla constexpr).
+ */
+template <typename T>
+struct Esquema;
+
+template <>
+struct Esquema<Item> {
+    static constexpr const char* entidade = "item";
+    static constexpr auto campos = make_tuple(
+        campo("id", Campo::ID, &Item::getId).naoNegativo("ID do item não pode ser negativo"),
+        campo("nome", Campo::NOME, &Item::getNome).naoVazio("Nome do item não pode ser vazio"),
+        campo("preco", Campo::PRECO, &Item::getPreco).naoNegativo("Preço do item não pode ser negativo"),
+        campo("codigoBarras", &Item::getCodigoBarras));
+};
+
+template <>
+struct Esquema<ItemEstoque> {
+    static constexpr const char* entidade = "estoque";
+    static constexpr auto campos = make_tuple(
+        campo("itemId", Campo::ID, &ItemEstoque::itemId).naoNegativo("ID do item inválido"),
+        campo("nomeItem", Campo::NOME, &ItemEstoque::nomeItem).naoVazio("Nome do item não pode ser vazio"),
+        campo("quantidade", Campo::QUANTIDADE, &ItemEstoque::quantidade)
+            .naoNegativo("Quantidade não pode ser negativa"));
+};
+
+template <>
+struct Esquema<Artista> {
+    static constexpr const char* entidade = "artista";
+    static constexpr auto campos = make_tuple(
+        campo("id", Campo::ID, &Artista::getId).naoNegativo("ID do artista não pode ser negativo"),
+        campo("nome", Campo::NOME, &Artista::getNome).naoVazio("Nome do artista não pode ser vazio"),
+        campo("camarimId", Campo::CAMARIM, &Artista::getCamarimId).naoNegativo("ID de camarim inválido"));
+};
+
+template <>
+struct Esquema<Camarim> {
+    static constexpr const char* entidade = "camarim";
+    static constexpr auto campos = make_tuple(
+        campo("id", Campo::ID, &Camarim::getId).naoNegativo("ID do camarim inválido"),
+        campo("nome", Campo::NOME, &Camarim::getNome).naoVazio("Nome do camarim não pode ser vazio"),
+        campo("artistaId", Campo::ARTISTA, &Camarim::getArtistaId),
+        campo("quantidade", Campo::QUANTIDADE, &quantidadeTotal<Camarim>));
+};
+
+template <>
+struct Esquema<Pedido> {
+    static constexpr const char* entidade = "pedido";
+    static constexpr auto campos = make_tuple(
+        campo("id", Campo::ID, &Pedido::getId).naoNegativo("ID do pedido inválido"),
+        campo("camarimId", Campo::CAMARIM, &Pedido::getCamarimId).naoNegativo("ID do camarim inválido"),
+        campo("nomeArtista", Campo::NOME, &Pedido::getNomeArtista).naoVazio("Nome do artista não pode ser vazio"),
+        campo("atendido", Campo::ATENDIDO, &Pedido::isAtendido),
+        campo("quantidade", Campo::QUANTIDADE, &quantidadeTotal<Pedido>),
+        campo("criadoEm", &Pedido::getCriadoEm),
+        campo("atualizadoEm", &Pedido::getAtualizadoEm));
+};
+
+template <>
+struct Esquema<ListaCompras> {
+    static constexpr const char* entidade = "lista";
+    static constexpr auto campos = make_tuple(
+        campo("id", Campo::ID, &ListaCompras::getId).naoNegativo("ID da lista inválido"),
+        campo("descricao", Campo::NOME, &ListaCompras::getDescricao).naoVazio("Descrição não pode ser vazia"),
+        campo("total", Campo::PRECO, &ListaCompras::calcularTotal),
+        campo("quantidade", Campo::QUANTIDADE, &quantidadeTotal<ListaCompras>));
+};
+
+// ==================== Percurso dos campos ====================
+
+/**
+ * @brief Chama f(descritor) para cada campo, na ordem da tabela (desenrolado em compilação)
+ */
+template <typename T, typename F>
+inline void paraCadaCampo(F&& f) {
+    apply([&](const auto&... descritores) { (f(descritores), ...); }, Esquema<T>::campos);
+}
+
+// Tipo do valor de um campo (sem referência/const)
+template <typename T, typename D>
+using ValorCampo = decay_t<decltype(lerCampo(declval<const T&>(), declval<D>().acesso))>;
+
+// Quantidade de campos (constante de compilação)
+template <typename T>
+constexpr size_t totalCampos() {
+    return tuple_size<decay_t<decltype(Esquema<T>::campos)>>::value;
+}
+
+// ==================== Acesso por Campo (motor de consultas) ====================
+
+/**
+ * @brief Valor numérico do Campo de consulta
+ * @return false se a entidade não tem esse campo numérico
+ */
+template <typename T>
+bool lerNumero(const T& registro, Campo campoConsulta, double& valor) {
+    bool achou = false;
+    paraCadaCampo<T>([&](const auto& d) {
+        using V = ValorCampo<T, decay_t<decltype(d)>>;
+        if constexpr (is_arithmetic_v<V>) {
+            if (!achou && d.consultavel && d.campo == campoConsulta) {
+                valor = static_cast<double>(lerCampo(registro, d.acesso));
+                achou = true;
+            }
+        }
+    });
+    return achou;
+}
+
+/**
+ * @brief Valor textual do Campo de consulta, sem cópia
+ * @return Endereço da string dentro do registro; nullptr se a entidade não
+ *         tem esse campo de texto
+ */
+template <typename T>
+const string* lerTexto(const T& registro, Campo campoConsulta) {
+    const string* valor = nullptr;
+    paraCadaCampo<T>([&](const auto& d) {
+        using V = ValorCampo<T, decay_t<decltype(d)>>;
+        if constexpr (is_same_v<V, string>) {
+            static_assert(is_lvalue_reference_v<decltype(lerCampo(registro, d.acesso))>,
+                          "Campo de texto deve ser lido por referência (getter const string&)");
+            if (valor == nullptr && d.consultavel && d.campo == campoConsulta) {
+                valor = &lerCampo(registro, d.acesso);
+            }
+        }
+    });
+    return valor;
+}
+
+// ==================== Validação ====================
+
+/**
+ * @brief Regra do campo aplicada a um valor do tipo do campo (V)
+ * @return Mensagem da regra violada; nullptr se o valor é válido
+ */
+template <typename V, typename D>
+inline const char* violacao(const D& d, const V& valor) {
+    if constexpr (is_same_v<V, string>) {
+        if (d.regra == Regra::NAO_VAZIO && valor.empty()) {
+            return d.mensagem;
+        }
+    } else if constexpr (is_arithmetic_v<V> && !is_same_v<V, bool>) {
+        if (d.regra == Regra::NAO_NEGATIVO && valor < 0) {
+            return d.mensagem;
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * @brief Confere as regras da tabela, campo a campo
+ * @throws ValidacaoException com a mensagem do primeiro campo inválido
+ */
+template <typename T>
+void validar(const T& registro) {
+    const char* erro = nullptr;
+    paraCadaCampo<T>([&](const auto& d) {
+        using V = ValorCampo<T, decay_t<decltype(d)>>;
+        if (erro == nullptr && d.regra != Regra::NENHUMA) {
+            erro = violacao<V>(d, lerCampo(registro, d.acesso));
+        }
+    });
+    if (erro != nullptr) {
+        throw ValidacaoException(erro);
+    }
+}
+
+/**
+ * @brief Confere um valor contra a regra do campo consultável antes de atribuí-lo
+ * @param campoConsulta Campo da tabela de T (ex: Campo::NOME)
+ * @throws ValidacaoException com a mensagem da tabela se a regra falha
+ *
+ * Usado pelos setters e cadastros: a tabela é a única fonte das regras.
+ * As comparações são com constantes da tabela, resolvidas na compilação.
+ */
+template <typename T, typename V>
+void validarCampo(Campo campoConsulta, const V& valor) {
+    const char* erro = nullptr;
+    paraCadaCampo<T>([&](const auto& d) {
+        using VC = ValorCampo<T, decay_t<decltype(d)>>;
+        if constexpr (is_convertible_v<const V&, VC>) {
+            if (erro == nullptr && d.consultavel && d.campo == campoConsulta && d.regra != Regra::NENHUMA) {
+                erro = violacao<VC>(d, valor);
+            }
+        }
+    });
+    if (erro != nullptr) {
+        throw ValidacaoException(erro);
+    }
+}
+
+// ==================== Serializadores ====================
+
+// ===== Valores: uma sobrecarga por tipo, escolhida em compilação =====
+
+inline void escreverValorCsv(ostream& saida, const string& texto) {
+    // RFC 4180: aspas só quando preciso, aspas internas duplicadas
+    if (texto.find_first_of(",\"\r\n") == string::npos) {
+        saida << texto;
+        return;
+    }
+    saida << '"';
+    for (char c : texto) {
+        if (c == '"') saida << '"';
+        saida << c;
+    }
+    saida << '"';
+}
+
+inline void escreverValorJson(ostream& saida, const string& texto) {
+    static const char* const HEX = "0123456789abcdef";
+    saida << '"';
+    for (unsigned char c : texto) {
+        switch (c) {
+            case '"':  saida << "\\\""; break;
+            case '\\': saida << "\\\\"; break;
+            case '\n': saida << "\\n"; break;
+            case '\r': saida << "\\r"; break;
+            case '\t': saida << "\\t"; break;
+            default:
+                if (c < 0x20) {
+                    saida << "\\u00" << HEX[c >> 4] << HEX[c & 15];
+                } else {
+                    saida << static_cast<char>(c);  // UTF-8 passa direto
+                }
+        }
+    }
+    saida << '"';
+}
+
+// Números: inteiros como estão, reais com 2 casas (preços e totais), lógicos true/false
+template <typename V>
+inline void escreverNumero(ostream& saida, V valor) {
+    if constexpr (is_same_v<V, bool>) {
+        saida << (valor ? "true" : "false");
+    } else if constexpr (is_floating_point_v<V>) {
+        ios::fmtflags formato = saida.flags();  // Não altera o formato de quem chamou
+        streamsize precisao = saida.precision();
+        saida << fixed << setprecision(2) << valor;
+        saida.flags(formato);
+        saida.precision(precisao);
+    } else {
+        saida << valor;
+    }
+}
+
+template <typename V>
+inline void escreverValorCsv(ostream& saida, V valor) { escreverNumero(saida, valor); }
+
+template <typename V>
+inline void escreverValorJson(ostream& saida, V valor) { escreverNumero(saida, valor); }
+
+// Binário little-endian: inteiros de 4 ou 8 bytes, double IEEE de 8, texto = tamanho (4) + bytes
+inline void escreverBytes(ostream& saida, uint64_t valor, int bytes) {
+    for (int i = 0; i < bytes; i++) {
+        saida.put(static_cast<char>((valor >> (8 * i)) & 0xFF));
+    }
+}
+
+inline void escreverValorBinario(ostream& saida, const string& texto) {
+    escreverBytes(saida, static_cast<uint32_t>(texto.size()), 4);
+    saida.write(texto.data(), static_cast<streamsize>(texto.size()));
+}
+
+template <typename V>
+inline void escreverValorBinario(ostream& saida, V valor) {
+    if constexpr (is_same_v<V, bool>) {
+        saida.put(valor ? 1 : 0);
+    } else if constexpr (is_floating_point_v<V>) {
+        double real = valor;
+        uint64_t bits;
+        memcpy(&bits, &real, sizeof(bits));
+        escreverBytes(saida, bits, 8);
+    } else if constexpr (sizeof(V) <= 4) {
+        escreverBytes(saida, static_cast<uint32_t>(static_cast<int32_t>(valor)), 4);
+    } else {
+        escreverBytes(saida, static_cast<uint64_t>(static_cast<int64_t>(valor)), 8);
+    }
+}
+
+// ===== Registros =====
+
+/**
+ * @brief Cabeçalho CSV (nomes dos campos, sem quebra de linha)
+ */
+template <typename T>
+string cabecalhoCsv() {
+    string cabecalho;
+    paraCadaCampo<T>([&](const auto& d) {
+        if (!cabecalho.empty()) cabecalho += ',';
+        cabecalho += d.nome;
+    });
+    return cabecalho;
+}
+
+/**
+ * @brief Uma linha CSV do registro (sem quebra de linha)
+ */
+template <typename T>
+void escreverCsv(ostream& saida, const T& registro) {
+    bool primeiro = true;
+    paraCadaCampo<T>([&](const auto& d) {
+        if (!primeiro) saida << ',';
+        primeiro = false;
+        escreverValorCsv(saida, lerCampo(registro, d.acesso));
+    });
+}
+
+/**
+ * @brief Objeto JSON do registro ({"campo":valor,...})
+ */
+template <typename T>
+void escreverJson(ostream& saida, const T& registro) {
+    bool primeiro = true;
+    saida << '{';
+    paraCadaCampo<T>([&](const auto& d) {
+        if (!primeiro) saida << ',';
+        primeiro = false;
+        saida << '"' << d.nome << "\":";
+        escreverValorJson(saida, lerCampo(registro, d.acesso));
+    });
+    saida << '}';
+}
+
+/**
+ * @brief Registro em binário: os campos em sequência, na ordem da tabela
+ */
+template <typename T>
+void escreverBinario(ostream& saida, const T& registro) {
+    paraCadaCampo<T>([&](const auto& d) { escreverValorBinario(saida, lerCampo(registro, d.acesso)); });
+}
+
+template <typename T>
+string paraCsv(const T& registro) {
+    stringstream ss;
+    escreverCsv(ss, registro);
+    return ss.str();
+}
+
+template <typename T>
+string paraJson(const T& registro) {
+    stringstream ss;
+    escreverJson(ss, registro);
+    return ss.str();
+}
+
+// ===== Coleções =====
+
+/**
+ * @brief Cabeçalho + uma linha por registro
+ */
+template <typename T>
+void exportarCsv(ostream& saida, const vector<T>& registros) {
+    saida << cabecalhoCsv<T>() << '\n';
+    for (const T& registro : registros) {
+        escreverCsv(saida, registro);
+        saida << '\n';
+    }
+}
+
+/**
+ * @brief Array JSON com um objeto por registro
+ */
+template <typename T>
+void exportarJson(ostream& saida, const vector<T>& registros) {
+    saida << '[';
+    for (size_t i = 0; i < registros.size(); i++) {
+        saida << (i == 0 ? "\n  " : ",\n  ");
+        escreverJson(saida, registros[i]);
+    }
+    saida << (registros.empty() ? "]" : "\n]") << '\n';
+}
+
+}  // namespace esquema
+
+#endif // ESQUEMA_H
+// Fim do include guard
@@ -7,6 +7,15 @@
  * 
  * Gerencia o estoque centralizado de itens no sistema.
  * Controla entradas, saídas e disponibilidade de itens.
+ *
+ * LOTES E VALIDADE: a quantidade de cada item é a soma dos seus lotes
+ * (LoteEstoque: quantidade + vencimento). Toda saída (removerItem,
+ * atualizarQuantidade para menos, reposição dos camarins) consome primeiro
+ * o lote que vence antes (FEFO), por um heap de mínimo por item. Entradas
+ * sem validade (adicionarItem, leitor, sobras do fechamento) formam um lote
+ * SEM_VALIDADE, que sai por último. Os lotes com validade também ficam num
+ * índice ordenado por vencimento: "o que vence nas próximas N horas" custa
+ * O(log n + k).
  */
 
 // Proteção contra inclusão múltipla
@@ -19,6 +28,8 @@
 #include <map>
 // Vector para retornar listas de itens
 #include <vector>
+// Carimbos de tempo das movimentações
+#include "relogio.h"
 
 /**
  * @struct ItemEstoque
@@ -42,8 +53,27 @@ struct ItemEstoque {
      */
     ItemEstoque(int id, const string& nome, int qtd) 
         : itemId(id), nomeItem(nome), quantidade(qtd) {}
+    
+    /**
+     * @brief Linha da tabela de Estoque::exibir() (com a quebra de linha)
+     */
+    string exibir() const;
 };  // Fim da struct ItemEstoque
 
+/**
+ * @struct MovimentoEstoque
+ * @brief Uma entrada ou saída do estoque, com o instante em que ocorreu
+ */
+struct MovimentoEstoque {
+    long long tempo;       // Instante (Relogio, µs)
+    int itemId;            // ID do item movimentado
+    string nomeItem;       // Nome do item no momento da movimentação
+    int quantidadeAntes;   // Quantidade antes (0 = não estava no estoque)
+    int quantidadeDepois;  // Quantidade depois (0 = saiu do estoque)
+    
+    int variacao() const { return quantidadeDepois - quantidadeAntes; }  // > 0 = entrada
+};  // Fim da struct MovimentoEstoque
+
 /**
  * @class Estoque
  * @brief Gerencia o estoque centralizado de itens
@@ -55,10 +85,31 @@ struct ItemEstoque {
  * - Controlar quantidades
  * - Listar itens disponíveis
  */
-class Estoque {
+class Estoque : public FonteMutacoes {  // Avisa observadores a cada entrada/saída
 private:  // ENCAPSULAMENTO: atributo privado
     map<int, ItemEstoque> itens;  // Map: chave = itemId, valor = ItemEstoque
     // MAP: acesso O(log n), sem chaves duplicadas, ordenado por chave
+    map<int, int> minimos;        // Estoque mínimo por itemId (ausente = sem mínimo)
+    // Mínimos sobrevivem à saída do item: quantidade 0 fica abaixo do mínimo
+    vector<MovimentoEstoque> movimentos;  // Histórico, em ordem crescente de tempo
+    map<int, vector<LoteEstoque>> lotes;  // Heap de mínimo por itemId (topo = vence primeiro)
+    // Soma dos lotes de um item = itens[itemId].quantidade (item sem lotes = quantidade 0)
+    map<pair<long long, int>, LoteEstoque> vencimentos;  // (validade, número) -> lote; só lotes com validade
+    int proximoLote;  // Número do próximo lote recebido
+    
+    // Lotes do item em ordem de saída, só se alguém for avisado (evita a cópia)
+    vector<LoteEstoque> lotesParaAviso(int itemId) const;
+    // Registra a movimentação (se a quantidade mudou) e avisa os observadores
+    void registrarMudanca(int itemId, const string& nomeItem, int quantidadeAntes, int minimoAntes,
+                          vector<LoteEstoque> lotesAntes);
+    // Soma 'quantidade' ao lote do item com esta validade (ou cria um lote)
+    void receberLote(int itemId, int quantidade, long long validade);
+    // Retira 'quantidade' dos lotes do item, do que vence antes para o que vence depois
+    void consumirLotes(int itemId, int quantidade);
+    // Leva o estoque (já conferido) de 'antes' para 'depois': consome FEFO ou recebe sem validade
+    void ajustarLotes(int itemId, int antes, int depois);
+    // Descarta todos os lotes do item (e suas entradas no índice de vencimentos)
+    void descartarLotes(int itemId);
     
 public:  // Interface pública
     /**
@@ -82,6 +133,15 @@ public:  // Interface pública
      */
     void adicionarItem(int itemId, const string& nomeItem, int quantidade);
     
+    /**
+     * @brief Entrada de um lote com validade
+     * @param validade Vencimento (Relogio, µs); LoteEstoque::SEM_VALIDADE = não vence
+     * @throws ValidacaoException nas mesmas condições de adicionarItem
+     * 
+     * Quantidade do mesmo item com a mesma validade entra no lote já existente.
+     */
+    void adicionarLote(int itemId, const string& nomeItem, int quantidade, long long validade);
+    
     /**
      * @brief Remove quantidade de um item do estoque (SAÍDA)
      * @param itemId ID do item
@@ -91,6 +151,7 @@ public:  // Interface pública
      * 
      * Verifica disponibilidade antes de remover
      * Se quantidade ficar 0: remove item do map
+     * Retira dos lotes que vencem primeiro (FEFO), O(log L) por lote esgotado
      */
     bool removerItem(int itemId, int quantidade);
     
@@ -117,21 +178,110 @@ public:  // Interface pública
      */
     vector<ItemEstoque> listar() const;
     
+    /**
+     * @brief Executa uma consulta sobre o estoque
+     * @param consulta Condições, ordenação e limite
+     * 
+     * Planejador: condições sobre ID viram uma faixa [menor, maior] percorrida
+     * diretamente no map ordenado (lower_bound/upper_bound).
+     */
+    ResultadoConsulta<ItemEstoque> consultar(const Consulta& consulta) const;
+    
     /**
      * @brief Atualiza quantidade de um item (UPDATE)
      * @param itemId ID do item
      * @param novaQuantidade Nova quantidade (substitui valor anterior)
      * 
      * Diferente de adicionarItem: SUBSTITUI ao invés de somar
+     * Para menos: retira dos lotes que vencem primeiro; para mais: a
+     * diferença entra no lote sem validade.
      */
     void atualizarQuantidade(int itemId, int novaQuantidade);
     
+    /**
+     * @brief Define o estoque mínimo de um item (0 = remove o mínimo)
+     * @param itemId ID do item (não precisa estar no estoque)
+     * @param minimo Quantidade mínima desejada
+     * @throws ValidacaoException se itemId ou minimo forem negativos
+     * 
+     * Item com quantidade < mínimo aparece como "abaixo do mínimo" no painel
+     */
+    void definirMinimo(int itemId, int minimo);
+    
+    /**
+     * @brief Estoque mínimo de um item (0 se não definido)
+     */
+    int obterMinimo(int itemId) const;
+    
+    /**
+     * @brief Todos os mínimos definidos (chave = itemId)
+     */
+    map<int, int> listarMinimos() const;
+    
+    /**
+     * @brief Coloca quantidade e mínimo de um item nos valores informados
+     * @param nomeItem Nome usado se o item precisar voltar ao estoque
+     * @param quantidade 0 = item sai do estoque
+     * @param minimo 0 = sem mínimo
+     * 
+     * Usado para desfazer/refazer: registra UMA movimentação e um aviso.
+     */
+    void restaurar(int itemId, const string& nomeItem, int quantidade, int minimo);
+    
+    /**
+     * @brief Coloca os lotes e o mínimo de um item exatamente nos valores informados
+     * @param lotes Lotes do item (quantidade = soma; vazio = item sai do estoque)
+     * 
+     * Usado para desfazer/refazer: validades e números dos lotes voltam
+     * como eram. Registra UMA movimentação e um aviso.
+     */
+    void restaurarLotes(int itemId, const string& nomeItem, const vector<LoteEstoque>& lotes, int minimo);
+    
+    /**
+     * @brief Lotes de um item, na ordem em que sairão (validade, depois número)
+     */
+    vector<LoteEstoque> listarLotes(int itemId) const;
+    
+    /**
+     * @brief Lotes que vencem no período [inicio, fim] (instantes em µs)
+     * @return Em ordem de vencimento (empates pelo número do lote)
+     * 
+     * Percorre só a faixa do índice de vencimentos: O(log n + k)
+     */
+    vector<LoteEstoque> lotesVencendo(long long inicio, long long fim) const;
+    
+    /**
+     * @brief Lotes que vencem nas próximas 'horas' horas (a partir de agora)
+     */
+    vector<LoteEstoque> lotesVencendoEm(int horas) const;
+    
+    /**
+     * @brief Movimentações ocorridas no período [inicio, fim] (instantes em µs)
+     * @return Em ordem cronológica
+     * 
+     * O histórico é anexado em ordem de tempo: busca binária, O(log n + k)
+     */
+    vector<MovimentoEstoque> movimentosEntre(long long inicio, long long fim) const;
+    
+    /**
+     * @brief Quantidade de movimentações registradas desde o início
+     */
+    size_t totalMovimentos() const;
+    
     /**
      * @brief Exibe informações do estoque formatadas
      * @return String com tabela de todos os itens e quantidades
      */
     string exibir() const;
     
+    /**
+     * @brief Título e cabeçalho da tabela de exibir() (estoque com itens)
+     * 
+     * exibir() = cabecalhoExibicao() + item.exibir() de cada item; o
+     * relatório geral monta a mesma tabela em partes, em paralelo.
+     */
+    static string cabecalhoExibicao();
+    
     /**
      * @brief Sobrecarga do operador << para cout
      * @param os Stream de saída
@@ -203,6 +203,24 @@ public:  // Construtor público
     // Formata mensagem: "Erro com Pedido: " + detalhes
 };  // Fim da classe PedidoException
 
+/**
+ * @class ModeloException
+ * @brief Exceção relacionada a modelos de rider
+ * 
+ * Lançada quando ocorrem erros em operações de modelos
+ * (ex: modelo não encontrado)
+ */
+class ModeloException : public ExcecaoBase {  // HERDA de ExcecaoBase
+public:  // Construtor público
+    /**
+     * @brief Construtor que formata mensagem de erro de modelo
+     * @param msg Descrição do erro
+     */
+    explicit ModeloException(const string& msg)
+        : ExcecaoBase("Erro com Modelo: " + msg) {}
+    // Formata mensagem: "Erro com Modelo: " + detalhes
+};  // Fim da classe ModeloException
+
 /**
  * @class ListaComprasException
  * @brief Exceção relacionada a operações com lista de compras
@@ -0,0 +1,262 @@
+/**
+ * @file fornecedores.h
+ * @brief Ofertas de fornecedores por item e escolha do melhor preço
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ *
+ * O Item tem um único preço de catálogo, mas o mesmo item é comprado de
+ * vários fornecedores, com preços e embalagens diferentes ("água: 1,50 a
+ * unidade no mercado, 15,00 o fardo de 12 na distribuidora"). A tabela
+ * guarda uma OFERTA por (fornecedor, item) e escolhe, para a quantidade
+ * pedida, a oferta de MENOR CUSTO: embalagens inteiras, então comprar 13
+ * águas em fardos de 12 custa dois fardos.
+ *
+ * ESTRUTURA: tabela hash itemId -> ofertas do item em ordem de preço por
+ * unidade (empate: ID do fornecedor). O custo de uma oferta nunca é menor
+ * que quantidade x preço por unidade, então cotar() percorre as ofertas
+ * nessa ordem e para assim que esse limite passa do melhor custo já
+ * encontrado. Custos (s = ofertas do item, poucas; F = total de ofertas):
+ * - cotar / definirOferta / removerOferta:  O(s)
+ * - dividir uma lista de n itens:           O(n s + n log f), f = fornecedores
+ * - removerFornecedor:                      O(F)
+ *
+ * A tabela observa o catálogo: remover um item descarta as suas ofertas
+ * (e avisa o descarte pelo GerenciadorItens).
+ */
+
+// Proteção contra inclusão múltipla
+#ifndef FORNECEDORES_H  // Se FORNECEDORES_H não foi definido
+#define FORNECEDORES_H  // Define FORNECEDORES_H
+
+#include <string>          // Para nomes
+#include <vector>          // Para ofertas e pedidos
+#include <map>             // Para fornecedores em ordem de ID
+#include <unordered_map>   // Para ofertas por item
+
+#include "observador.h"    // Interface ObservadorMutacoes
+#include "item.h"          // GerenciadorItens (preço de catálogo)
+#include "listacompras.h"  // ItemCompra, ListaCompras, GerenciadorListaCompras
+#include "reposicao.h"     // TransferenciaReposicao (faltas do plano de reposição)
+#include "excecoes.h"      // ItemException, ValidacaoException, ListaComprasException
+#include "identificadores.h"  // AlocadorIds
+
+using namespace std;
+
+/**
+ * @struct Fornecedor
+ * @brief Fornecedor cadastrado na tabela
+ */
+struct Fornecedor {
+    int id = 0;
+    string nome;
+};
+
+/**
+ * @struct OfertaFornecedor
+ * @brief Preço de uma embalagem de um item em um fornecedor
+ */
+struct OfertaFornecedor {
+    int fornecedorId = 0;
+    int itemId = 0;
+    double precoEmbalagem = 0.0;  // Preço de UMA embalagem
+    int unidadesEmbalagem = 1;    // Unidades por embalagem (1 = vendido avulso)
+
+    double precoUnitario() const;  // precoEmbalagem / unidadesEmbalagem
+};
+
+/**
+ * @struct CotacaoCompra
+ * @brief Oferta mais barata para comprar uma quantidade de um item
+ */
+struct CotacaoCompra {
+    int fornecedorId = 0;        // 0 = nenhuma oferta (preço do catálogo)
+    int itemId = 0;
+    int quantidade = 0;          // Quantidade pedida
+    int embalagens = 0;          // Embalagens a comprar (0 sem oferta)
+    int unidades = 0;            // Unidades compradas (>= quantidade: embalagens inteiras)
+    double precoUnitario = 0.0;  // Preço por unidade da oferta escolhida (ou do catálogo)
+    double custo = 0.0;          // embalagens x preço da embalagem (sem oferta: quantidade x catálogo)
+};
+
+/**
+ * @struct PedidoFornecedor
+ * @brief Parte de uma lista de compras que vai para um fornecedor
+ */
+struct PedidoFornecedor {
+    int fornecedorId = 0;
+    string nomeFornecedor;
+    vector<ItemCompra> itens;  // Em ordem de itemId; quantidade em unidades já arredondadas
+
+    double total() const;
+};
+
+/**
+ * @struct DivisaoCompras
+ * @brief Resultado de dividir(): um pedido por fornecedor e o que ninguém oferece
+ */
+struct DivisaoCompras {
+    vector<PedidoFornecedor> pedidos;  // Em ordem de fornecedorId
+    vector<ItemCompra> semOferta;      // Itens da lista sem nenhuma oferta (como estavam na lista)
+
+    double total() const;  // Soma dos pedidos e dos itens sem oferta
+};
+
+/**
+ * @struct ListasPorFornecedor
+ * @brief Resultado de dividirEmListas(): listas criadas por fornecedor e a dos itens sem oferta
+ */
+struct ListasPorFornecedor {
+    vector<int> porFornecedor;  // IDs das listas criadas, em ordem de fornecedorId
+    int semOferta = 0;          // ID da lista com os itens sem oferta (0 = todos têm oferta)
+};
+
+/**
+ * @class TabelaFornecedores
+ * @brief Fornecedores, ofertas por item e cotação pelo menor custo
+ *
+ * Uso:
+ *   TabelaFornecedores fornecedores;
+ *   fornecedores.conectar(itens);
+ *   int distribuidora = fornecedores.cadastrarFornecedor("Distribuidora");
+ *   fornecedores.definirOferta(distribuidora, 1, 15.00, 12);  // Fardo com 12
+ *   CotacaoCompra c = fornecedores.cotar(1, 30);               // 3 fardos
+ *   DivisaoCompras d = fornecedores.dividir(*listas.buscarPorId(2));
+ *
+ * Declare-a DEPOIS dos gerenciadores para que seja destruída antes deles.
+ */
+class TabelaFornecedores : public ObservadorMutacoes {
+private:
+    map<int, string> fornecedores;                          // ID -> nome
+    AlocadorIds ids;                                        // IDs dos fornecedores (nunca reutilizados)
+    unordered_map<int, vector<OfertaFornecedor>> ofertas;  // itemId -> ofertas (menor preço por unidade primeiro)
+
+    // Catálogo conectado
+    GerenciadorItens* itens = nullptr;
+
+    // Lança ItemException se não conectada
+    void exigirConexao() const;
+
+    // Nome do fornecedor; lança ValidacaoException se não existe
+    const string& exigirFornecedor(int fornecedorId) const;
+
+public:
+    TabelaFornecedores();
+    ~TabelaFornecedores();
+
+    // Não copiável: a cópia não estaria registrada no catálogo
+    TabelaFornecedores(const TabelaFornecedores&) = delete;
+    TabelaFornecedores& operator=(const TabelaFornecedores&) = delete;
+
+    /**
+     * @brief Registra a tabela no catálogo
+     *
+     * Fornecedores e ofertas são mantidos; só as ofertas de itens que não
+     * estão no novo catálogo são descartadas (O(total de ofertas)).
+     */
+    void conectar(GerenciadorItens& itens);
+
+    /**
+     * @brief Remove a tabela do catálogo conectado
+     */
+    void desconectar();
+
+    // ===== Fornecedores =====
+
+    /**
+     * @brief Alocador dos IDs de fornecedor (blocos por thread, limite a persistir)
+     */
+    AlocadorIds& getAlocadorIds();
+
+    /**
+     * @brief Cadastra um fornecedor
+     * @param bloco Bloco de IDs da thread (de getAlocadorIds(); nullptr = ID avulso)
+     * @return ID do fornecedor (a partir de 1)
+     * @throws ValidacaoException se o nome é vazio
+     */
+    int cadastrarFornecedor(const string& nome, AlocadorIds::Bloco* bloco = nullptr);
+
+    /**
+     * @brief Remove o fornecedor e todas as suas ofertas (O(total de ofertas))
+     * @return false se o fornecedor não existe
+     */
+    bool removerFornecedor(int fornecedorId);
+
+    /**
+     * @brief Fornecedores em ordem de ID
+     */
+    vector<Fornecedor> listarFornecedores() const;
+
+    // ===== Ofertas =====
+
+    /**
+     * @brief Cria ou substitui a oferta do fornecedor para o item
+     * @throws ItemException se não conectada ou o item não está no catálogo
+     * @throws ValidacaoException se o fornecedor não existe, o preço é
+     *         negativo ou a embalagem tem menos de 1 unidade
+     */
+    void definirOferta(int fornecedorId, int itemId, double precoEmbalagem, int unidadesEmbalagem);
+
+    /**
+     * @brief Remove a oferta do fornecedor para o item
+     * @return false se não havia oferta
+     */
+    bool removerOferta(int fornecedorId, int itemId);
+
+    /**
+     * @brief Ofertas do item, da menor para a maior preço por unidade (empate: fornecedorId)
+     */
+    vector<OfertaFornecedor> ofertasDe(int itemId) const;
+
+    /**
+     * @brief Oferta de menor custo para comprar 'quantidade' unidades do item
+     * @return Cotação; fornecedorId = 0 se nenhum fornecedor oferece o item
+     *         (preço do catálogo, ou 0 se o item não está no catálogo)
+     * @throws ItemException se não conectada
+     * @throws ValidacaoException para ID de item negativo ou quantidade <= 0
+     *
+     * Empate de custo: vence a oferta de menor preço por unidade, depois o
+     * menor fornecedorId.
+     */
+    CotacaoCompra cotar(int itemId, int quantidade) const;
+
+    // ===== Listas de compras =====
+
+    /**
+     * @brief Cria uma lista de compras com as faltas da reposição, já no melhor preço
+     * @param faltas PlanoReposicao::faltas (somadas por item)
+     * @return ID da lista criada
+     * @throws ValidacaoException se não há faltas ou a descrição é vazia
+     *
+     * Cada item entra com as unidades arredondadas para embalagens inteiras
+     * e o preço por unidade da oferta escolhida. A lista é criada de uma vez
+     * (um único aviso aos observadores).
+     */
+    int gerarListaCompras(GerenciadorListaCompras& listas, const string& descricao,
+                          const vector<TransferenciaReposicao>& faltas) const;
+
+    /**
+     * @brief Divide uma lista em pedidos por fornecedor (nada é alterado)
+     *
+     * Cada item vai para o fornecedor da sua melhor cotação.
+     */
+    DivisaoCompras dividir(const ListaCompras& lista) const;
+
+    /**
+     * @brief Cria uma lista de compras por fornecedor a partir de uma lista
+     * @return IDs das listas criadas por fornecedor e o da lista dos itens sem oferta
+     * @throws ListaComprasException se a lista não existe
+     *
+     * Descrição de cada lista: "<descrição da original> - <fornecedor>".
+     * Os itens que ninguém oferece vão, como estavam na original, para uma
+     * lista "<descrição da original> - Sem oferta", criada por último. A
+     * lista original não muda.
+     */
+    ListasPorFornecedor dividirEmListas(GerenciadorListaCompras& listas, int listaId) const;
+
+    // ===== Observador (POLIMORFISMO: sobrescreve os avisos) =====
+    void aoMudarItem(const Item* antes, const Item* depois) override;
+};  // Fim da classe TabelaFornecedores
+
+#endif // FORNECEDORES_H
+// Fim do include guard
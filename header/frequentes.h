@@ -0,0 +1,168 @@
+/**
+ * @file frequentes.h
+ * @brief Itens mais pedidos em tempo real (algoritmo Space-Saving)
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ *
+ * Durante o show queremos saber, a qualquer instante, quais itens estão
+ * sendo mais pedidos (geral, últimos 15 minutos, última hora), com
+ * MEMÓRIA LIMITADA e custo O(1) por pedido.
+ *
+ * SPACE-SAVING: guarda no máximo K contadores. Item já monitorado: +1.
+ * Item novo com espaço livre: novo contador. Item novo sem espaço: ocupa
+ * o contador de MENOR contagem m, herdando m como erro (contagem = m + 1).
+ * Garantias: contagem - erro <= frequência real <= contagem, e todo item
+ * com frequência > total / K está entre os monitorados.
+ *
+ * JANELAS DESLIZANTES: um anel de resumos, um por intervalo de tempo
+ * (balde de 1 minuto por padrão). A consulta "últimos N minutos" junta os
+ * N baldes mais recentes; baldes antigos são reaproveitados.
+ */
+
+// Proteção contra inclusão múltipla
+#ifndef FREQUENTES_H  // Se FREQUENTES_H não foi definido
+#define FREQUENTES_H  // Define FREQUENTES_H
+
+#include <string>         // Para nomes de itens
+#include <vector>         // Para os contadores e o anel de baldes
+#include <unordered_map>  // Para chave -> posição
+
+#include "observador.h"   // Interface ObservadorMutacoes
+#include "pedido.h"       // GerenciadorPedidos
+
+using namespace std;
+
+/**
+ * @struct ItemFrequente
+ * @brief Item monitorado e sua contagem estimada
+ */
+struct ItemFrequente {
+    int itemId;          // ID do item
+    string nomeItem;     // Nome informado no pedido
+    long long contagem;  // Estimativa (limite SUPERIOR da frequência real)
+    long long erro;      // Superestimação máxima
+
+    long long minimoGarantido() const { return contagem - erro; }  // Limite inferior
+};
+
+/**
+ * @class ResumoFrequencias
+ * @brief Resumo Space-Saving com K contadores e atualização O(1)
+ *
+ * Os contadores ficam em um vector em ORDEM DECRESCENTE de contagem. Para
+ * cada contagem guarda-se a primeira posição do grupo de empatados:
+ * incrementar = trocar com o primeiro do grupo e somar 1, o que mantém a
+ * ordem sem reordenar nada. O menor contador é sempre o último.
+ */
+class ResumoFrequencias {
+private:
+    vector<ItemFrequente> contadores;            // Ordem decrescente de contagem
+    unordered_map<int, size_t> posicao;          // itemId -> posição em 'contadores'
+    unordered_map<long long, size_t> inicioGrupo; // contagem -> primeira posição com ela
+    size_t capacidade;                           // K (máximo de contadores)
+    long long total;                             // Eventos registrados
+
+    // Soma 1 ao contador da posição p mantendo a ordem decrescente
+    void incrementar(size_t p);
+
+public:
+    /**
+     * @param capacidade Quantidade de contadores (K >= 1)
+     */
+    explicit ResumoFrequencias(size_t capacidade = 64);
+
+    /**
+     * @brief Registra uma ocorrência do item (O(1))
+     */
+    void registrar(int itemId, const string& nomeItem);
+
+    /**
+     * @brief Contadores em ordem decrescente de contagem
+     */
+    const vector<ItemFrequente>& getContadores() const;
+
+    /**
+     * @brief Menor contagem se o resumo está cheio (0 caso contrário)
+     *
+     * É o limite superior da frequência de qualquer item NÃO monitorado.
+     */
+    long long minimo() const;
+
+    /**
+     * @brief true se o item tem contador neste resumo
+     */
+    bool monitora(int itemId) const;
+
+    long long getTotal() const;  // Eventos registrados
+    void limpar();               // Esvazia (mantém a capacidade)
+};  // Fim da classe ResumoFrequencias
+
+/**
+ * @class ItensMaisPedidos
+ * @brief Observador dos pedidos que mantém os itens mais pedidos
+ *
+ * Cada chamada de GerenciadorPedidos::adicionarItem conta como um pedido
+ * do item (no instante atualizadoEm do pedido).
+ *
+ * Memória: (baldes + 1) * capacidade contadores, independente do volume.
+ */
+class ItensMaisPedidos : public ObservadorMutacoes {
+private:
+    ResumoFrequencias geral;             // Desde o início
+    vector<ResumoFrequencias> baldes;    // Anel: um resumo por intervalo
+    vector<long long> numeroBalde;       // Intervalo guardado em cada posição (-1 = vazio)
+    long long larguraBalde;              // Duração de um balde (µs)
+    GerenciadorPedidos* pedidos = nullptr;
+
+public:
+    /**
+     * @param capacidade Contadores por resumo (K)
+     * @param quantidadeBaldes Tamanho do anel (janela máxima, em baldes)
+     * @param larguraBalde Duração de cada balde em µs (padrão: 1 minuto)
+     */
+    explicit ItensMaisPedidos(size_t capacidade = 64, int quantidadeBaldes = 60,
+                              long long larguraBalde = 60000000LL);
+    ~ItensMaisPedidos();
+
+    // Não copiável: a cópia não estaria registrada no gerenciador
+    ItensMaisPedidos(const ItensMaisPedidos&) = delete;
+    ItensMaisPedidos& operator=(const ItensMaisPedidos&) = delete;
+
+    /**
+     * @brief Passa a receber os itens adicionados aos pedidos
+     */
+    void conectar(GerenciadorPedidos& pedidos);
+    void desconectar();
+
+    /**
+     * @brief Registra um pedido do item no instante informado (µs)
+     */
+    void registrar(int itemId, const string& nomeItem, long long instante);
+
+    /**
+     * @brief Os k itens mais pedidos desde o início
+     */
+    vector<ItemFrequente> maisPedidos(size_t k) const;
+
+    /**
+     * @brief Os k itens mais pedidos nos últimos 'ultimosBaldes' baldes
+     * @param ultimosBaldes Ex: 15 = últimos 15 minutos (balde atual incluído)
+     *
+     * Junta os resumos dos baldes: contagem continua sendo limite superior
+     * e contagem - erro limite inferior da frequência real na janela.
+     */
+    vector<ItemFrequente> maisPedidos(size_t k, int ultimosBaldes) const;
+
+    /**
+     * @brief Pedidos de itens registrados desde o início
+     */
+    long long getTotal() const;
+
+    // Observador: cada item adicionado a um pedido
+    void aoAdicionarItemPedido(const Pedido& pedido, int itemId, const string& nomeItem,
+                               int quantidade) override;
+};  // Fim da classe ItensMaisPedidos
+
+#endif // FREQUENTES_H
+// Fim do include guard
@@ -0,0 +1,176 @@
+/**
+ * @file historico.h
+ * @brief Histórico de alterações com desfazer/refazer (padrão Command)
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ *
+ * Cada mutação avisada pelos gerenciadores vira um COMANDO com o estado
+ * antes e depois da entidade alterada (apenas dela, não do sistema todo).
+ * Desfazer = colocar a entidade de volta no estado "antes"; refazer =
+ * colocá-la no estado "depois". Cada passo custa O(1) no histórico, mais
+ * uma operação do gerenciador (restaurar ou remover).
+ *
+ * O histórico é LIMITADO: guardados 'capacidade' comandos, o mais antigo é
+ * descartado. Um MARCADOR registra o ponto atual; desfazerAte() reverte
+ * tudo o que foi feito depois dele.
+ *
+ * REMOÇÕES IRREVERSÍVEIS: quando uma remoção leva um módulo a descartar
+ * dados que o histórico não guarda (reservas da agenda, níveis de
+ * reposição, ofertas de fornecedores, pedido movido para o arquivo), o
+ * módulo avisa o descarte (aoDescartarDependentes) e o comando que removeu
+ * a entidade fica BLOQUEADO: desfazê-lo (ou refazê-lo, se o descarte veio
+ * de um desfazer) lança ValidacaoException e nada muda. Restaurar só a
+ * entidade deixaria reservas/níveis perdidos ou o pedido em dobro.
+ *
+ * Uso:
+ *   Historico historico(100);
+ *   historico.conectar(itens, artistas, camarins, pedidos, listas, estoque);
+ *   long long marca = historico.marcar();
+ *   ... alterações ...
+ *   historico.desfazerAte(marca);
+ */
+
+// Proteção contra inclusão múltipla
+#ifndef HISTORICO_H  // Se HISTORICO_H não foi definido
+#define HISTORICO_H  // Define HISTORICO_H
+
+#include <string>   // Para descrições
+#include <vector>   // Para a pilha de refazer e listagens
+#include <deque>    // Para a pilha de desfazer (descarta o mais antigo em O(1))
+#include <memory>   // Para unique_ptr
+
+#include "observador.h"    // Interface ObservadorMutacoes
+#include "item.h"          // GerenciadorItens
+#include "artista.h"       // GerenciadorArtistas
+#include "camarim.h"       // GerenciadorCamarins
+#include "pedido.h"        // GerenciadorPedidos
+#include "listacompras.h"  // GerenciadorListaCompras
+#include "estoque.h"       // Estoque
+
+using namespace std;
+
+/**
+ * @class Historico
+ * @brief Observador que registra comandos reversíveis e os desfaz/refaz
+ */
+class Historico : public ObservadorMutacoes {
+private:
+    // Comandos (definidos em historico.cpp): estado antes/depois de UMA entidade
+    struct Comando;
+    template <typename T> struct ComandoEntidade;
+    struct ComandoEstoque;
+
+    deque<unique_ptr<Comando>> paraDesfazer;  // Mais antigo na frente, mais recente atrás
+    vector<unique_ptr<Comando>> paraRefazer;  // Último desfeito no fim
+    size_t capacidade;                        // Máximo de comandos guardados
+    long long proximoNumero = 0;              // Número do próximo comando (marcadores)
+    long long ultimoDescartado = -1;          // Maior número já descartado por falta de espaço
+    bool aplicando = false;                   // true durante desfazer/refazer (ignora avisos)
+    Comando* emAplicacao = nullptr;           // Comando sendo desfeito/refeito (recebe os descartes)
+    vector<DescarteDependentes> pendentes;    // Descartes avisados antes do comando da remoção
+
+    // Gerenciadores conectados
+    GerenciadorItens* itens = nullptr;
+    GerenciadorArtistas* artistas = nullptr;
+    GerenciadorCamarins* camarins = nullptr;
+    GerenciadorPedidos* pedidos = nullptr;
+    GerenciadorListaCompras* listas = nullptr;
+    Estoque* estoque = nullptr;
+
+    // Guarda um novo comando (descarta o refazer e, se cheio, o mais antigo)
+    void registrar(unique_ptr<Comando> comando);
+    
+    // Cria o comando de uma entidade (ignora avisos sem mudança real)
+    template <typename T>
+    void registrarEntidade(const T* antes, const T* depois);
+
+    // Aplica um comando no sentido pedido, sem registrar os avisos gerados
+    // Lança ValidacaoException, sem aplicar, se o comando está bloqueado
+    void aplicar(Comando& comando, bool desfazendo);
+
+    // Lança ValidacaoException se o comando está bloqueado por um descarte
+    static void exigirReversivel(const Comando& comando, bool desfazendo);
+
+    // Coloca uma entidade no estado informado (nullptr = entidade não existe)
+    void colocarEm(int id, const Item* estado);
+    void colocarEm(int id, const Artista* estado);
+    void colocarEm(int id, const Camarim* estado);
+    void colocarEm(int id, const Pedido* estado);
+    void colocarEm(int id, const ListaCompras* estado);
+
+public:
+    /**
+     * @param capacidade Quantidade máxima de comandos guardados (>= 1)
+     */
+    explicit Historico(size_t capacidade = 100);
+    ~Historico();
+
+    // Não copiável: a cópia não estaria registrada nos gerenciadores
+    Historico(const Historico&) = delete;
+    Historico& operator=(const Historico&) = delete;
+
+    /**
+     * @brief Passa a registrar as mutações dos gerenciadores
+     */
+    void conectar(GerenciadorItens& itens, GerenciadorArtistas& artistas, GerenciadorCamarins& camarins,
+                  GerenciadorPedidos& pedidos, GerenciadorListaCompras& listas, Estoque& estoque);
+    void desconectar();
+
+    /**
+     * @brief Desfaz o comando mais recente
+     * @return false se não há o que desfazer
+     * @throws ValidacaoException se a remoção descartou dados de um módulo
+     *
+     * Se o gerenciador recusar (ex: nome já usado por outro item), a exceção
+     * é propagada e o comando continua no histórico.
+     */
+    bool desfazer();
+
+    /**
+     * @brief Refaz o último comando desfeito
+     * @return false se não há o que refazer (ou uma nova alteração descartou o refazer)
+     * @throws ValidacaoException se, ao ser desfeito, o comando descartou dados de um módulo
+     */
+    bool refazer();
+
+    /**
+     * @brief Descrição do comando que desfazer()/refazer() aplicaria ("" se nenhum)
+     */
+    string proximoDesfazer() const;
+    string proximoRefazer() const;
+
+    /**
+     * @brief Marca o ponto atual do histórico
+     * @return Marcador para desfazerAte()
+     */
+    long long marcar() const;
+
+    /**
+     * @brief Desfaz todos os comandos feitos depois do marcador
+     * @return Quantidade de comandos desfeitos
+     * @throws ValidacaoException se o marcador é inválido ou já saiu do histórico,
+     *         ou se algum desses comandos está bloqueado (nada é desfeito)
+     */
+    int desfazerAte(long long marcador);
+
+    /**
+     * @brief Descrições dos comandos que podem ser desfeitos (mais recente primeiro)
+     */
+    vector<string> listar() const;
+
+    size_t totalDesfazer() const;  // Comandos que podem ser desfeitos
+    size_t totalRefazer() const;   // Comandos que podem ser refeitos
+
+    // Avisos dos gerenciadores
+    void aoMudarItem(const Item* antes, const Item* depois) override;
+    void aoMudarArtista(const Artista* antes, const Artista* depois) override;
+    void aoMudarCamarim(const Camarim* antes, const Camarim* depois) override;
+    void aoMudarPedido(const Pedido* antes, const Pedido* depois) override;
+    void aoMudarLista(const ListaCompras* antes, const ListaCompras* depois) override;
+    void aoMudarEstoque(const MudancaEstoque& mudanca) override;
+    void aoDescartarDependentes(const DescarteDependentes& descarte) override;
+};  // Fim da classe Historico
+
+#endif // HISTORICO_H
+// Fim do include guard
@@ -0,0 +1,138 @@
+/**
+ * @file identificadores.h
+ * @brief Alocação de IDs segura entre threads, entregue em blocos
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ *
+ * Cada gerenciador gerava IDs com um "int proximoId" incrementado no
+ * cadastro: duas threads cadastrando ao mesmo tempo podiam receber o mesmo
+ * ID. Trocar o int por um atômico resolve, mas toda criação passaria a
+ * disputar a mesma linha de cache.
+ *
+ * O AlocadorIds guarda um único contador atômico (limite = primeiro ID
+ * nunca entregue). Quem cria muitos registros pega um BLOCO de IDs com um
+ * único fetch_add e depois gera IDs localmente, sem sincronização:
+ *
+ *   AlocadorIds::Bloco bloco(gerenciador.getAlocadorIds());  // Um por thread
+ *   int id = bloco.alocar();  // Só toca o contador a cada 'tamanhoBloco' IDs
+ *
+ * Os cadastros dos gerenciadores (cadastrar/criar) aceitam o bloco da
+ * thread: gerenciador.cadastrar(..., &bloco) tira o ID dele em vez do
+ * contador compartilhado (a escrita continua sob a trava de quem grava).
+ *
+ * IDs continuam ÚNICOS (faixas disjuntas) e DENSOS: um bloco encerrado
+ * devolve a sobra se ainda for o último entregue; IDs devolvidos
+ * com devolver() voltam pelo mesmo critério.
+ *
+ * Reinício com dados salvos: persista getLimite() junto com os registros e
+ * chame observar(limite - 1) ao carregar. Assim nem os IDs de registros
+ * removidos antes de salvar são reutilizados. O Repositorio também observa
+ * o ID de todo registro inserido (restauração do histórico, carga).
+ */
+
+// Proteção contra inclusão múltipla
+#ifndef IDENTIFICADORES_H  // Se IDENTIFICADORES_H não foi definido
+#define IDENTIFICADORES_H  // Define IDENTIFICADORES_H
+
+#include <atomic>   // Para o contador compartilhado
+#include <utility>  // Para pair
+
+using namespace std;
+
+/**
+ * @class AlocadorIds
+ * @brief Contador atômico de IDs com entrega em blocos e devolução da sobra
+ *
+ * Não copiável: dois alocadores com o mesmo limite entregariam IDs repetidos.
+ */
+class AlocadorIds {
+private:
+    atomic<int> limite;  // Primeiro ID ainda não entregue
+    int tamanhoBloco;    // IDs por bloco (Bloco::alocar)
+
+public:
+    /**
+     * @class Bloco
+     * @brief Faixa de IDs de uso exclusivo de uma thread
+     *
+     * Não é thread-safe: cada thread usa o SEU bloco. Ao ser destruído,
+     * devolve os IDs não usados se ninguém pegou IDs depois dele.
+     */
+    class Bloco {
+    private:
+        AlocadorIds& origem;
+        int proximo;  // Próximo ID da faixa
+        int fim;      // Primeiro ID fora da faixa
+
+    public:
+        explicit Bloco(AlocadorIds& origem);
+        ~Bloco();
+
+        Bloco(const Bloco&) = delete;
+        Bloco& operator=(const Bloco&) = delete;
+
+        /**
+         * @brief Próximo ID da faixa (pega outra faixa quando esta acaba)
+         */
+        int alocar();
+
+        /**
+         * @brief Devolve o último ID entregue pelo bloco (ex: cadastro que falhou)
+         * @return false se o ID não é o último deste bloco (vira lacuna)
+         */
+        bool devolver(int id);
+
+        int restantes() const;  // IDs ainda disponíveis na faixa atual
+    };
+
+    /**
+     * @param primeiro Primeiro ID entregue
+     * @param tamanhoBloco IDs reservados por vez em Bloco::alocar (>= 1)
+     */
+    explicit AlocadorIds(int primeiro = 1, int tamanhoBloco = 64);
+
+    AlocadorIds(const AlocadorIds&) = delete;
+    AlocadorIds& operator=(const AlocadorIds&) = delete;
+
+    /**
+     * @brief Um ID avulso (um fetch_add no contador compartilhado)
+     */
+    int alocar();
+
+    /**
+     * @brief Reserva 'quantidade' IDs consecutivos
+     * @return Faixa [inicio, fim)
+     */
+    pair<int, int> reservar(int quantidade);
+
+    /**
+     * @brief Devolve a faixa [inicio, fim) se ela ainda for a última entregue
+     * @return false se outros IDs já foram entregues depois (a faixa vira lacuna)
+     */
+    bool devolver(int inicio, int fim);
+
+    /**
+     * @brief Devolve um ID avulso (ex: cadastro que falhou depois de alocar)
+     */
+    bool devolver(int id);
+
+    /**
+     * @brief Garante que nenhum ID <= id será entregue daqui em diante
+     *
+     * Usado ao inserir registros com ID conhecido (desfazer, carga de dados).
+     * O ID deve ser de um registro carregado ou já entregue antes: faixas
+     * que outras threads já reservaram não são recolhidas.
+     */
+    void observar(int id);
+
+    /**
+     * @brief Primeiro ID ainda não entregue (valor a persistir)
+     */
+    int getLimite() const;
+
+    int getTamanhoBloco() const;
+};  // Fim da classe AlocadorIds
+
+#endif // IDENTIFICADORES_H
+// Fim do include guard
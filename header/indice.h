@@ -0,0 +1,58 @@
+/**
+ * @file indice.h
+ * @brief Índice secundário de agrupamento (chave -> IDs ordenados)
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ *
+ * Usado pelos gerenciadores para responder "todos os X do camarim Y"
+ * sem percorrer o vetor inteiro (ex: artistas por camarim, pedidos por
+ * camarim, camarins por artista).
+ */
+
+// Proteção contra inclusão múltipla
+#ifndef INDICE_H  // Se INDICE_H não foi definido
+#define INDICE_H  // Define INDICE_H
+
+#include <vector>         // Para as listas de IDs
+#include <unordered_map>  // Para a tabela hash chave -> IDs
+
+using namespace std;
+
+/**
+ * @class IndiceGrupos
+ * @brief Mapeia uma chave (ex: camarimId) para os IDs que a possuem
+ *
+ * Os IDs de cada grupo ficam em ORDEM CRESCENTE, que é a mesma ordem de
+ * cadastro dos vetores dos gerenciadores. Assim, percorrer um grupo devolve
+ * os registros na mesma ordem que uma varredura linear devolveria.
+ */
+class IndiceGrupos {
+private:
+    unordered_map<int, vector<int>> grupos;  // Chave -> IDs ordenados
+
+public:
+    /**
+     * @brief Adiciona um ID ao grupo da chave (mantém a ordem crescente)
+     */
+    void inserir(int chave, int id);
+
+    /**
+     * @brief Remove um ID do grupo da chave (grupo vazio é descartado)
+     */
+    void remover(int chave, int id);
+
+    /**
+     * @brief IDs do grupo da chave (vazio se não existir)
+     * @return Referência constante: válida até a próxima alteração do índice
+     */
+    const vector<int>& buscar(int chave) const;
+
+    /**
+     * @brief Remove todos os grupos
+     */
+    void limpar();
+};  // Fim da classe IndiceGrupos
+
+#endif // INDICE_H
+// Fim do include guard
@@ -19,6 +19,20 @@
 #include <iostream>
 // Inclui biblioteca para trabalhar com vetores (arrays dinâmicos)
 #include <vector>
+// Inclui o repositório genérico (vector por ID + índices declarados)
+#include "repositorio.h"
+// Inclui o índice de trigramas (busca aproximada por nome)
+#include "busca.h"
+// Inclui o motor de consultas (filtros, ordenação e limite)
+#include "consulta.h"
+// Inclui a base de observadores de mutações
+#include "observador.h"
+// Inclui o catálogo congelado (hash perfeito mínimo)
+#include "congelado.h"
+// Inclui shared_ptr (o catálogo congelado é imutável e compartilhável)
+#include <memory>
+// Inclui tabela hash (índice por nome normalizado)
+#include <unordered_map>
 
 // Usa o namespace padrão para evitar escrever std:: antes de cada tipo
 using namespace std;
@@ -35,6 +49,7 @@ private:  // Modificador de acesso: só acessível dentro da própria classe (EN
     int id;           // Identificador único do item (número inteiro)
     string nome;      // Nome do item (texto/string)
     double preco;     // Preço unitário do item (número decimal de precisão dupla)
+    string codigoBarras;  // EAN/GTIN lido pelo leitor no recebimento (vazio = sem código)
     
 public:  // Modificador de acesso: acessível de qualquer lugar do programa
     /**
@@ -58,13 +73,21 @@ public:  // Modificador de acesso: acessível de qualquer lugar do programa
     
     // Getters - Métodos para LER os valores dos atributos privados
     int getId() const;  // Retorna o ID do item (const = não modifica o objeto)
-    string getNome() const;  // Retorna o nome do item
+    const string& getNome() const;  // Retorna o nome do item
     double getPreco() const;  // Retorna o preço do item
+    const string& getCodigoBarras() const;  // Retorna o código de barras (vazio = sem código)
     
     // Setters com validação - Métodos para MODIFICAR os valores dos atributos
     void setId(int id);  // Define um novo ID (com validação)
     void setNome(const string& nome);  // Define um novo nome (com validação)
     void setPreco(double preco);  // Define um novo preço (com validação)
+    void setCodigoBarras(const string& codigo);  // Define o código de barras (vazio remove)
+    
+    /**
+     * @brief Verifica um código EAN-8, UPC-A (12), EAN-13 ou GTIN-14
+     * @return true se só tem dígitos, tamanho válido e dígito verificador correto
+     */
+    static bool codigoBarrasValido(const string& codigo);
     
     /**
      * @brief Exibe informações do item
@@ -93,28 +116,107 @@ public:  // Modificador de acesso: acessível de qualquer lugar do programa
     // Retorna true se forem iguais, false caso contrário
 };  // Fim da classe Item
 
+/**
+ * @struct ResultadoBusca
+ * @brief Item encontrado pela busca aproximada e sua similaridade com a consulta
+ */
+struct ResultadoBusca {
+    Item item;            // Cópia do item encontrado
+    double similaridade;  // 0.0 (nada em comum) a 1.0 (nome equivalente)
+    
+    ResultadoBusca(const Item& item, double similaridade) 
+        : item(item), similaridade(similaridade) {}
+};  // Fim da struct ResultadoBusca
+
+/**
+ * @class IndiceAproximado
+ * @brief Índice de trigramas dos nomes, no formato de índice do Repositorio
+ * 
+ * Chave = nome do item; o repositório reindexa o ID quando o nome muda.
+ */
+class IndiceAproximado {
+private:
+    IndiceTrigramas trigramas;
+
+public:
+    using TipoChave = string;
+    
+    static string chave(const Item& item) { return item.getNome(); }
+    void inserir(const string& nome, int id) { trigramas.inserir(id, nome); }
+    void remover(const string&, int id) { trigramas.remover(id); }
+    
+    const IndiceTrigramas& getTrigramas() const { return trigramas; }
+};  // Fim da classe IndiceAproximado
+
+/**
+ * @class IndiceNomeNormalizado
+ * @brief Nome normalizado -> IDs em ordem crescente, no formato de índice do Repositorio
+ * 
+ * Como IndiceUnico, mas nomes distintos podem ter o mesmo nome normalizado
+ * ("Água" e "agua"): o grupo guarda todos os IDs e buscar() devolve o
+ * menor, o mesmo item que o catálogo congelado encontra.
+ */
+class IndiceNomeNormalizado {
+private:
+    unordered_map<string, vector<int>> idsPorNome;  // Quase sempre um ID por nome
+
+public:
+    using TipoChave = string;
+    
+    static string chave(const Item& item) { return normalizarNome(item.getNome()); }
+    void inserir(const string& normalizado, int id);
+    void remover(const string& normalizado, int id);
+    
+    /**
+     * @brief Menor ID com o nome normalizado (0 se nenhum)
+     */
+    int buscar(const string& normalizado) const;
+};  // Fim da classe IndiceNomeNormalizado
+
 /**
  * @class GerenciadorItens
  * @brief Gerencia operações CRUD de itens
+ * 
+ * ÍNDICES: o repositório mantém, além do vetor, tabelas hash por ID, por
+ * nome exato, por nome normalizado e por código de barras (buscas em O(1))
+ * e um índice de trigramas para busca aproximada, em toda inserção,
+ * remoção e alteração.
+ * ATENÇÃO: alterar o nome pelo ponteiro de buscarPorId() (setNome) não
+ * atualiza os índices; use atualizar().
+ * 
+ * CONGELAMENTO: congelar() monta um CatalogoCongelado (hash perfeito
+ * mínimo por ID e por nome normalizado) e buscarPorId() passa a usá-lo.
+ * Qualquer mutação (cadastrar, atualizar, remover, restaurar,
+ * definirCodigoBarras) descongela antes de alterar o vetor.
  */
-class GerenciadorItens {  // Classe que gerencia todos os itens do sistema
+class GerenciadorItens : public FonteMutacoes {  // Classe que gerencia todos os itens do sistema
+    // : public FonteMutacoes = herda a lista de observadores (avisados em cada mutação)
 private:  // Atributos privados (ENCAPSULAMENTO)
-    vector<Item> itens;    // Vetor (array dinâmico) que armazena todos os itens cadastrados
-    int proximoId;         // Contador para gerar próximo ID único disponível
+    using PorNome = IndiceUnico<&Item::getNome>;            // Nome exato -> ID
+    using PorCodigo = IndiceUnico<&Item::getCodigoBarras>;  // Código de barras -> ID
+    
+    Repositorio<Item, PorNome, PorCodigo, IndiceAproximado, IndiceNomeNormalizado> itens;  // Itens em ordem de ID + índices
+    shared_ptr<const CatalogoCongelado> congelado;  // Tabelas perfeitas (nullptr = descongelado)
     
 public:  // Métodos públicos (interface da classe)
     /**
      * @brief Construtor
      */
     GerenciadorItens();  // Construtor, inicializa o gerenciador
+
+    /**
+     * @brief Alocador de IDs: blocos para criação em várias threads e limite a persistir
+     */
+    AlocadorIds& getAlocadorIds();
     
     /**
      * @brief Cadastra novo item
      * @param nome Nome do item
      * @param preco Preço do item
+     * @param bloco Bloco de IDs da thread (de getAlocadorIds(); nullptr = ID avulso)
      * @return ID do item cadastrado
      */
-    int cadastrar(const string& nome, double preco);  
+    int cadastrar(const string& nome, double preco, AlocadorIds::Bloco* bloco = nullptr);  
     // Cria um novo item e adiciona ao vetor
     // Retorna o ID gerado para o item criado
     
@@ -127,6 +229,9 @@ public:  // Métodos públicos (interface da classe)
     // Procura um item pelo seu ID
     // Retorna ponteiro para o item se encontrado, ou nullptr (ponteiro nulo) se não encontrado
     
+    const Item* buscarPorId(int id) const;  
+    // Versão somente leitura (usada por quem recebe o gerenciador como const)
+    
     /**
      * @brief Busca item por nome
      * @param nome Nome do item
@@ -136,6 +241,29 @@ public:  // Métodos públicos (interface da classe)
     // Procura um item pelo seu nome
     // Retorna ponteiro para o item se encontrado, ou nullptr se não encontrado
     
+    /**
+     * @brief Busca item pelo código de barras (O(1) em média)
+     * @param codigo Código lido (EAN/GTIN)
+     * @return Ponteiro para o item ou nullptr se nenhum item usa o código
+     */
+    Item* buscarPorCodigo(const string& codigo);
+    const Item* buscarPorCodigo(const string& codigo) const;
+    
+    /**
+     * @brief Associa um código de barras ao item (vazio remove o código)
+     * @throws ItemException se o item não existe ou o código já é de outro item
+     * @throws ValidacaoException se o código não é um EAN/GTIN válido
+     */
+    void definirCodigoBarras(int id, const string& codigo);
+    
+    /**
+     * @brief Busca aproximada por nome (tolerante a acentos, caixa e erros de digitação)
+     * @param consulta Nome digitado (ex: "agua min.")
+     * @param limite Quantidade máxima de resultados
+     * @return Itens mais parecidos, do mais para o menos similar
+     */
+    vector<ResultadoBusca> buscarAproximado(const string& consulta, size_t limite = 5) const;
+    
     /**
      * @brief Remove item por ID
      * @param id ID do item
@@ -153,6 +281,16 @@ public:  // Métodos públicos (interface da classe)
     // Retorna uma cópia do vetor com todos os itens cadastrados
     // const = não modifica o estado do gerenciador
     
+    /**
+     * @brief Executa uma consulta sobre o catálogo
+     * @param consulta Condições, ordenação e limite
+     * @return Itens aprovados e plano usado
+     * 
+     * Planejador: ID igual -> índice hash por ID; nome igual -> índice hash
+     * por nome; nome contém -> índice de trigramas; senão, varredura.
+     */
+    ResultadoConsulta<Item> consultar(const Consulta& consulta) const;
+    
     /**
      * @brief Atualiza dados de um item
      * @param id ID do item
@@ -163,6 +301,37 @@ public:  // Métodos públicos (interface da classe)
     bool atualizar(int id, const string& nome, double preco);  
     // Busca um item pelo ID e atualiza seus dados (nome e preço)
     // Retorna true se atualizou com sucesso, false se não encontrou
+    
+    /**
+     * @brief Coloca o item exatamente no estado informado (desfazer/refazer)
+     * @param estado Item com o ID a restaurar (recriado se foi removido)
+     * @throws ItemException se outro item já usa o nome ou o código de barras
+     */
+    void restaurar(const Item& estado);
+    
+    /**
+     * @brief Congela o catálogo: buscas por ID e por nome normalizado em uma sonda
+     * 
+     * Custa O(n) para montar; vale até a próxima mutação. Congelar um
+     * catálogo já congelado não faz nada.
+     */
+    void congelar();
+    
+    /**
+     * @brief Descarta o catálogo congelado (volta aos índices mutáveis)
+     */
+    void descongelar();
+    
+    bool estaCongelado() const;
+    
+    /**
+     * @brief Busca por nome normalizado ("AGUA min." encontra "Água Min.")
+     * @return O primeiro item (em ordem de ID) com esse nome normalizado, ou nullptr
+     * 
+     * Congelado: uma sonda no hash perfeito. Descongelado: tabela hash do
+     * repositório (IndiceNomeNormalizado). Os dois em O(1).
+     */
+    const Item* buscarPorNomeNormalizado(const string& nome) const;
 };  // Fim da classe GerenciadorItens
 
 #endif // ITEM_H - Fim da proteção contra inclusão múltipla
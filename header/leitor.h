@@ -0,0 +1,127 @@
+/**
+ * @file leitor.h
+ * @brief Recebimento por leitor de código de barras (entradas de estoque em lote)
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ *
+ * Na descarga do caminhão, cada caixa passa pelo leitor: centenas de
+ * leituras por minuto, milhares por segundo quando o leitor despeja a
+ * memória de um coletor. Uma entrada de estoque por leitura avisaria
+ * painel, histórico e índices a cada bipe.
+ *
+ * O LeitorCodigos acumula as leituras: cada código é resolvido pelo índice
+ * hash do catálogo (GerenciadorItens::buscarPorCodigo, O(1)) e somado ao
+ * item pendente. A cada 'limiteLote' leituras (ou em descarregar()), o
+ * lote vira UMA Estoque::adicionarItem por item, em ordem de ID.
+ *
+ * Código desconhecido ou inválido não interrompe a leitura: é contado
+ * como rejeitado e guardado em ultimosRejeitados() para conferência.
+ *
+ * lerFluxo() lê de qualquer istream (cin, arquivo, ou um socket exposto
+ * como stream): uma leitura por linha, "codigo" ou "codigo quantidade"
+ * (caixa fechada).
+ */
+
+// Proteção contra inclusão múltipla
+#ifndef LEITOR_H  // Se LEITOR_H não foi definido
+#define LEITOR_H  // Define LEITOR_H
+
+#include <string>    // Para códigos
+#include <vector>    // Para os rejeitados
+#include <map>       // Para o lote (ordenado por itemId)
+#include <istream>   // Para lerFluxo
+
+#include "item.h"      // GerenciadorItens (índice por código)
+#include "estoque.h"   // Estoque, ItemEstoque
+#include "excecoes.h"  // ValidacaoException
+
+using namespace std;
+
+/**
+ * @struct ResumoLeitura
+ * @brief Contadores desde a criação do leitor
+ */
+struct ResumoLeitura {
+    long long leituras = 0;     // Todas as leituras recebidas
+    long long aceitas = 0;      // Leituras de itens do catálogo
+    long long rejeitadas = 0;   // Código inválido, desconhecido ou linha mal formada
+    long long lotes = 0;        // Vezes que o lote foi gravado no estoque
+    long long entradas = 0;     // Chamadas a Estoque::adicionarItem
+    long long unidades = 0;     // Unidades gravadas no estoque
+};
+
+/**
+ * @class LeitorCodigos
+ * @brief Converte leituras de código de barras em entradas de estoque agrupadas
+ *
+ * Uso:
+ *   LeitorCodigos leitor(itens, estoque);
+ *   leitor.ler("7891000315507");       // Pendente, nada gravado ainda
+ *   leitor.ler("7891000315507", 12);   // Caixa com 12
+ *   leitor.descarregar();              // Uma entrada de 13 unidades
+ *
+ * Declare-o DEPOIS do catálogo e do estoque: guarda referências para eles.
+ */
+class LeitorCodigos {
+private:
+    const GerenciadorItens& itens;
+    Estoque& estoque;
+    size_t limiteLote;              // Leituras aceitas por lote
+
+    map<int, ItemEstoque> pendentes;  // itemId -> nome e quantidade acumulada
+    size_t leiturasPendentes = 0;
+    ResumoLeitura resumo;
+    vector<string> rejeitados;      // Últimos códigos rejeitados (no máximo MAX_REJEITADOS)
+
+    void rejeitar(const string& codigo);
+
+public:
+    static const size_t MAX_REJEITADOS = 20;
+
+    /**
+     * @param limiteLote Leituras aceitas que disparam a gravação (> 0)
+     * @throws ValidacaoException se limiteLote é 0
+     */
+    LeitorCodigos(const GerenciadorItens& itens, Estoque& estoque, size_t limiteLote = 512);
+
+    // Não copiável: duas cópias gravariam o mesmo lote
+    LeitorCodigos(const LeitorCodigos&) = delete;
+    LeitorCodigos& operator=(const LeitorCodigos&) = delete;
+
+    /**
+     * @brief Registra uma leitura
+     * @return false se o código é inválido ou não está no catálogo (rejeitado)
+     * @throws ValidacaoException se quantidade <= 0
+     */
+    bool ler(const string& codigo, int quantidade = 1);
+
+    /**
+     * @brief Lê uma leitura por linha até o fim do stream (ou a linha 'fim')
+     * @param fim Linha que encerra a leitura (vazio = só o fim do stream)
+     * @return Quantidade de linhas lidas (linhas vazias não contam)
+     *
+     * Descarrega ao terminar: nada fica pendente.
+     */
+    long long lerFluxo(istream& entrada, const string& fim = "");
+
+    /**
+     * @brief Grava o lote pendente: uma entrada de estoque por item
+     */
+    void descarregar();
+
+    /**
+     * @brief Itens ainda não gravados, em ordem de ID
+     */
+    vector<ItemEstoque> listarPendentes() const;
+
+    ResumoLeitura getResumo() const;
+
+    /**
+     * @brief Códigos rejeitados mais recentes (o mais antigo primeiro)
+     */
+    const vector<string>& ultimosRejeitados() const;
+};  // Fim da classe LeitorCodigos
+
+#endif // LEITOR_H
+// Fim do include guard
@@ -17,6 +17,9 @@
 #include <string>    // Para trabalhar com strings
 #include <vector>    // Para lista de ListaCompras
 #include <map>       // Para armazenar itens com chave itemId
+#include "consulta.h"  // Motor de consultas (filtros, ordenação e limite)
+#include "observador.h"  // Observadores de mutações (painel, históricos)
+#include "repositorio.h"  // Repositório genérico (vector por ID + índice hash por ID)
 #include <iostream>  // Para entrada/saída
 
 using namespace std;  // Namespace padrão
@@ -90,7 +93,7 @@ public:  // Interface pública
     
     // ==================== GETTERS ====================
     int getId() const;             // Retorna ID da lista
-    string getDescricao() const;   // Retorna descrição da lista
+    const string& getDescricao() const;  // Retorna descrição da lista
     
     // ==================== SETTERS ====================
     void setId(int id);                           // Define ID
@@ -141,6 +144,12 @@ public:  // Interface pública
      */
     void limpar();
     
+    /**
+     * @brief Acesso somente leitura aos itens da lista
+     * @return Referência constante ao map (chave = itemId)
+     */
+    const map<int, ItemCompra>& getItens() const;
+    
     /**
      * @brief Exibe informações da lista formatada
      * @return String com tabela de itens e valor total
@@ -166,25 +175,42 @@ public:  // Interface pública
  * Permite ter múltiplas listas de compras
  * (ex: "Compras Semanais", "Compras Mensais", etc)
  */
-class GerenciadorListaCompras {
+class GerenciadorListaCompras : public FonteMutacoes {
 private:  // Atributos privados
-    vector<ListaCompras> listas;  // Vector de listas de compras
-    int proximoId;                // Contador para gerar IDs únicos
+    Repositorio<ListaCompras> listas;  // Listas em ordem de ID (sem índices secundários)
     
 public:  // Interface pública CRUD
     /**
-     * @brief Construtor - inicializa vazio e proximoId = 1
+     * @brief Construtor - inicializa vazio (IDs a partir de 1)
      */
     GerenciadorListaCompras();
+
+    /**
+     * @brief Alocador de IDs: blocos para criação em várias threads e limite a persistir
+     */
+    AlocadorIds& getAlocadorIds();
     
     /**
      * @brief Cria nova lista de compras (CREATE)
      * @param descricao Descrição/título da lista
+     * @param bloco Bloco de IDs da thread (de getAlocadorIds(); nullptr = ID avulso)
      * @return ID da lista criada
      * 
      * Gera ID automático, cria lista vazia
      */
-    int criar(const string& descricao);
+    int criar(const string& descricao, AlocadorIds::Bloco* bloco = nullptr);
+    
+    /**
+     * @brief Cria lista já com itens (ex: lista gerada pelas faltas da reposição)
+     * @param itens Itens da lista (repetidos somam, como em adicionarItem)
+     * @param bloco Bloco de IDs da thread (de getAlocadorIds(); nullptr = ID avulso)
+     * @return ID da lista criada
+     * @throws ValidacaoException se a descrição ou algum item é inválido (nada é criado)
+     * 
+     * Os observadores recebem só a criação, com a lista completa.
+     */
+    int criarComItens(const string& descricao, const vector<ItemCompra>& itens,
+                      AlocadorIds::Bloco* bloco = nullptr);
     
     /**
      * @brief Busca lista por ID (READ)
@@ -194,6 +220,7 @@ public:  // Interface pública CRUD
      * PONTEIRO: permite adicionar/remover itens da lista
      */
     ListaCompras* buscarPorId(int id);
+    const ListaCompras* buscarPorId(int id) const;  // Versão somente leitura
     
     /**
      * @brief Remove lista de compras (DELETE)
@@ -209,6 +236,34 @@ public:  // Interface pública CRUD
      * @return Vector com cópias de todas as listas
      */
     vector<ListaCompras> listar() const;
+    
+    /**
+     * @brief Todas as listas, sem cópia (somente leitura, em ordem de ID)
+     * 
+     * A referência vale até a próxima alteração do gerenciador: várias
+     * threads podem ler ao mesmo tempo desde que ninguém altere.
+     */
+    const vector<ListaCompras>& todos() const;
+    
+    /**
+     * @brief Executa uma consulta sobre as listas (índice por ID ou varredura vetorizada)
+     * @param consulta Condições, ordenação e limite
+     */
+    ResultadoConsulta<ListaCompras> consultar(const Consulta& consulta) const;
+    
+    // ===== Alterações de uma lista (avisam os observadores) =====
+    // Todas lançam ListaComprasException se a lista não existe.
+    
+    void adicionarItem(int listaId, int itemId, const string& nomeItem, int quantidade, double preco);
+    bool removerItem(int listaId, int itemId);  // false se o item não está na lista
+    void atualizarQuantidade(int listaId, int itemId, int quantidade);
+    void limpar(int listaId);                   // Remove todos os itens da lista
+    
+    /**
+     * @brief Coloca a lista exatamente no estado informado (desfazer/refazer)
+     * @param estado Lista com o ID a restaurar (recriada se foi removida)
+     */
+    void restaurar(const ListaCompras& estado);
 };  // Fim da classe GerenciadorListaCompras
 
 #endif // LISTACOMPRAS_H
@@ -0,0 +1,203 @@
+/**
+ * @file modelo.h
+ * @brief Modelos de rider: conjuntos de itens reutilizáveis
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ *
+ * Um rider técnico/camarim se repete de show em show ("6 águas, 4 toalhas,
+ * 1 fruteira"). Em vez de digitar os itens a cada pedido, cadastra-se um
+ * MODELO e instancia-se o modelo:
+ * - em um PEDIDO novo (GerenciadorPedidos::criarComItens)
+ * - no estoque de um CAMARIM (GerenciadorCamarins::abastecer)
+ *
+ * CÓPIA NA ESCRITA: a instância não copia as linhas do modelo, passa a
+ * compartilhar o mesmo map (CopiaNaEscrita). Milhares de pedidos criados
+ * do mesmo modelo ocupam a memória de um único map; o pedido só ganha
+ * uma cópia própria quando é alterado. Alterar o modelo depois também
+ * não afeta as instâncias já criadas (o modelo é que se separa delas).
+ */
+
+// Proteção contra inclusão múltipla
+#ifndef MODELO_H  // Se MODELO_H não foi definido
+#define MODELO_H  // Define MODELO_H
+
+#include <string>          // Para nomes
+#include <vector>          // Para a lista de modelos
+#include <map>             // Para as linhas (chave = itemId)
+
+#include "copianaescrita.h"  // Linhas compartilhadas com as instâncias
+#include "repositorio.h"     // Repositorio (vector por ID + índices)
+#include "indice.h"          // IndiceGrupos (item -> modelos que o usam)
+#include "pedido.h"          // ItemPedido e GerenciadorPedidos
+#include "camarim.h"         // ItemCamarim e GerenciadorCamarins
+#include "excecoes.h"        // ModeloException, ValidacaoException
+
+using namespace std;
+
+/**
+ * @class ModeloRider
+ * @brief Conjunto nomeado de itens (itemId -> quantidade)
+ *
+ * As linhas são guardadas nos dois formatos de destino (ItemPedido e
+ * ItemCamarim) para que instanciar seja apenas compartilhar um map já
+ * pronto, sem conversão.
+ */
+class ModeloRider {
+private:
+    int id;
+    string nome;
+    CopiaNaEscrita<map<int, ItemPedido>> linhasPedido;    // Linhas no formato de pedido
+    CopiaNaEscrita<map<int, ItemCamarim>> linhasCamarim;  // As mesmas linhas no formato de camarim
+
+public:
+    ModeloRider();
+    ModeloRider(int id, const string& nome);
+
+    int getId() const;
+    string getNome() const;
+
+    /**
+     * @brief Adiciona linha ao modelo (item repetido: soma a quantidade)
+     * @throws ValidacaoException para ID, nome ou quantidade inválidos
+     *
+     * Instâncias já criadas não mudam.
+     */
+    void adicionarItem(int itemId, const string& nomeItem, int quantidade);
+
+    /**
+     * @brief Remove a linha do item
+     * @return false se o item não está no modelo
+     */
+    bool removerItem(int itemId);
+
+    /**
+     * @brief Linhas do modelo (chave = itemId)
+     */
+    const map<int, ItemPedido>& getItens() const;
+
+    // Armazenamentos compartilhados com as instâncias
+    const CopiaNaEscrita<map<int, ItemPedido>>& getLinhasPedido() const;
+    const CopiaNaEscrita<map<int, ItemCamarim>>& getLinhasCamarim() const;
+
+    /**
+     * @brief Exibe o modelo com suas linhas
+     */
+    string exibir() const;
+};  // Fim da classe ModeloRider
+
+/**
+ * @class IndiceModelosPorItem
+ * @brief itemId -> modelos com linha do item, no formato de índice do Repositorio
+ *
+ * Um modelo tem várias linhas: a chave é a lista dos seus itemIds e o
+ * modelo entra no grupo de cada um. Adicionar quantidade a uma linha
+ * existente não muda a chave (o repositório não mexe no índice).
+ */
+class IndiceModelosPorItem {
+private:
+    IndiceGrupos grupos;
+
+public:
+    using TipoChave = vector<int>;
+
+    static vector<int> chave(const ModeloRider& modelo);
+    void inserir(const vector<int>& itens, int id);
+    void remover(const vector<int>& itens, int id);
+
+    /**
+     * @brief Modelos com linha do item, em ordem crescente de ID
+     */
+    const vector<int>& buscar(int itemId) const { return grupos.buscar(itemId); }
+};  // Fim da classe IndiceModelosPorItem
+
+/**
+ * @class GerenciadorModelos
+ * @brief CRUD de modelos de rider e instanciação em pedidos/camarins
+ *
+ * Uso:
+ *   int m = modelos.criar("Rider banda");
+ *   modelos.adicionarItem(m, 3, "Agua", 6);
+ *   int pedidoId = modelos.instanciarPedido(m, pedidos, 4, "Banda X");  // O(1) em memória
+ *   modelos.instanciarCamarim(m, camarins, 4);
+ */
+class GerenciadorModelos {
+private:
+    Repositorio<ModeloRider, IndiceModelosPorItem> modelos;  // Modelos em ordem de ID + itemId -> modelos
+
+    // Localiza modelo ou lança ModeloException
+    const ModeloRider& exigir(int id) const;
+
+public:
+    /**
+     * @brief Cria modelo vazio
+     * @param bloco Bloco de IDs da thread (de getAlocadorIds(); nullptr = ID avulso)
+     * @return ID do modelo
+     * @throws ValidacaoException se o nome é vazio
+     */
+    int criar(const string& nome, AlocadorIds::Bloco* bloco = nullptr);
+
+    /**
+     * @brief Alocador dos IDs de modelo (blocos por thread, limite a persistir)
+     */
+    AlocadorIds& getAlocadorIds();
+
+    /**
+     * @brief Busca modelo por ID (nullptr se não existe)
+     *
+     * Somente leitura: altere as linhas pelos métodos do gerenciador.
+     */
+    const ModeloRider* buscarPorId(int id) const;
+
+    /**
+     * @brief Remove modelo (instâncias já criadas continuam intactas)
+     * @return false se não existe
+     */
+    bool remover(int id);
+
+    /**
+     * @brief Todos os modelos em ordem de ID
+     */
+    vector<ModeloRider> listar() const;
+
+    /**
+     * @brief Modelos com linha do item, em ordem crescente de ID (O(1))
+     * @return Referência constante: válida até a próxima alteração dos modelos
+     */
+    const vector<int>& modelosComItem(int itemId) const;
+
+    /**
+     * @brief Adiciona linha ao modelo
+     * @throws ModeloException se o modelo não existe
+     */
+    void adicionarItem(int modeloId, int itemId, const string& nomeItem, int quantidade);
+
+    /**
+     * @brief Remove linha do modelo
+     * @return false se o item não está no modelo
+     * @throws ModeloException se o modelo não existe
+     */
+    bool removerItem(int modeloId, int itemId);
+
+    /**
+     * @brief Cria pedido pendente com as linhas do modelo (compartilhadas)
+     * @return ID do pedido criado
+     * @throws ModeloException se o modelo não existe
+     * @throws ValidacaoException nas mesmas condições de GerenciadorPedidos::criar
+     */
+    int instanciarPedido(int modeloId, GerenciadorPedidos& pedidos, int camarimId,
+                         const string& nomeArtista) const;
+
+    /**
+     * @brief Abastece o camarim com as linhas do modelo
+     *
+     * Camarim vazio passa a compartilhar as linhas; com itens, soma-as.
+     *
+     * @throws ModeloException se o modelo não existe
+     * @throws CamarimException se o camarim não existe
+     */
+    void instanciarCamarim(int modeloId, GerenciadorCamarins& camarins, int camarimId) const;
+};  // Fim da classe GerenciadorModelos
+
+#endif // MODELO_H
+// Fim do include guard
@@ -0,0 +1,181 @@
+/**
+ * @file observador.h
+ * @brief Observadores de mutações dos gerenciadores (padrão Observer)
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ *
+ * Toda alteração feita ATRAVÉS DOS GERENCIADORES (cadastrar, atualizar,
+ * remover, adicionarItem, marcarAtendido...) é avisada aos observadores
+ * registrados, com o estado ANTES e DEPOIS da entidade:
+ * - antes == nullptr  -> entidade criada
+ * - depois == nullptr -> entidade removida
+ * - ambos preenchidos -> entidade alterada
+ *
+ * Isso permite manter agregados (painel), índices e históricos sempre
+ * consistentes sem varrer os gerenciadores.
+ *
+ * Módulos que observam um gerenciador (agenda, reposição, fornecedores,
+ * arquivo) avisam pelo próprio gerenciador, com avisarDescarte(), o que
+ * descartaram por causa de uma remoção: o histórico não sabe restaurar
+ * esses dados e passa a recusar desfazer/refazer a remoção.
+ *
+ * ATENÇÃO: alterações feitas diretamente pelo ponteiro de buscarPorId()
+ * NÃO são avisadas. Use os métodos dos gerenciadores.
+ */
+
+// Proteção contra inclusão múltipla
+#ifndef OBSERVADOR_H  // Se OBSERVADOR_H não foi definido
+#define OBSERVADOR_H  // Define OBSERVADOR_H
+
+#include <string>  // Para nomes de itens
+#include <vector>  // Para a lista de observadores
+#include <limits>  // Para numeric_limits (lote sem validade)
+
+using namespace std;
+
+// Declarações antecipadas: os gerenciadores incluem este header
+class Item;
+class Artista;
+class Camarim;
+class Pedido;
+class ListaCompras;
+
+/**
+ * @struct LoteEstoque
+ * @brief Parte do estoque de um item que vence no mesmo instante
+ */
+struct LoteEstoque {
+    static constexpr long long SEM_VALIDADE = numeric_limits<long long>::max();  // Não vence
+
+    int itemId;          // ID do item
+    int numero;          // Número do lote no estoque (ordem de entrada, nunca reutilizado)
+    int quantidade;      // Quantidade restante do lote
+    long long validade;  // Vencimento (Relogio, µs) ou SEM_VALIDADE
+};
+
+/**
+ * @struct MudancaEstoque
+ * @brief Alteração de um item do estoque (quantidade e/ou mínimo)
+ */
+struct MudancaEstoque {
+    int itemId;            // ID do item
+    string nomeItem;       // Nome do item (vazio se nunca esteve no estoque)
+    int quantidadeAntes;   // 0 = não estava no estoque
+    int quantidadeDepois;  // 0 = saiu do estoque
+    int minimoAntes;       // Estoque mínimo antes (0 = sem mínimo)
+    int minimoDepois;      // Estoque mínimo depois
+    vector<LoteEstoque> lotesAntes;   // Lotes do item antes (ordem de saída)
+    vector<LoteEstoque> lotesDepois;  // Lotes do item depois
+};
+
+/**
+ * @enum TipoEntidade
+ * @brief Tipo da entidade removida em um DescarteDependentes
+ */
+enum class TipoEntidade {
+    ITEM, ARTISTA, CAMARIM, PEDIDO, LISTA
+};
+
+/**
+ * @struct DescarteDependentes
+ * @brief Dados de um módulo descartados porque uma entidade saiu do gerenciador
+ *
+ * Ex: a agenda cancela as reservas de um camarim removido. Só é avisado se
+ * algo foi de fato descartado.
+ */
+struct DescarteDependentes {
+    TipoEntidade tipo;  // Tipo da entidade removida
+    int id;             // ID da entidade removida
+    string motivo;      // O que se perdeu ("reservas do camarim descartadas")
+};
+
+/**
+ * @class ObservadorMutacoes
+ * @brief Interface dos observadores (todos os métodos têm implementação vazia)
+ *
+ * POLIMORFISMO: cada observador sobrescreve apenas o que lhe interessa.
+ */
+class ObservadorMutacoes {
+public:
+    virtual ~ObservadorMutacoes();
+
+    virtual void aoMudarItem(const Item* antes, const Item* depois);
+    virtual void aoMudarArtista(const Artista* antes, const Artista* depois);
+    virtual void aoMudarCamarim(const Camarim* antes, const Camarim* depois);
+    virtual void aoMudarPedido(const Pedido* antes, const Pedido* depois);
+    virtual void aoMudarLista(const ListaCompras* antes, const ListaCompras* depois);
+    virtual void aoMudarEstoque(const MudancaEstoque& mudanca);
+
+    /**
+     * @brief Item adicionado a um pedido (GerenciadorPedidos::adicionarItem)
+     *
+     * Avisado logo após aoMudarPedido, com o pedido já alterado. Permite
+     * contar pedidos de itens em O(1), sem comparar antes/depois.
+     */
+    virtual void aoAdicionarItemPedido(const Pedido& pedido, int itemId, const string& nomeItem,
+                                       int quantidade);
+
+    /**
+     * @brief Um módulo descartou dados por causa de uma remoção
+     *
+     * Avisado durante ou logo após o aoMudar* da remoção que o causou.
+     */
+    virtual void aoDescartarDependentes(const DescarteDependentes& descarte);
+};  // Fim da classe ObservadorMutacoes
+
+/**
+ * @class FonteMutacoes
+ * @brief Classe base dos gerenciadores: guarda e avisa os observadores
+ *
+ * HERANÇA: os gerenciadores herdam a lista de observadores e o notificar().
+ * Cópias de um gerenciador NÃO herdam os observadores do original.
+ */
+class FonteMutacoes {
+protected:
+    vector<ObservadorMutacoes*> observadores;  // Observadores registrados (não são donos)
+
+    /**
+     * @brief Chama 'aviso' para cada observador
+     * @param aviso Função/lambda que recebe ObservadorMutacoes*
+     */
+    template <typename Aviso>
+    void notificar(Aviso aviso) const {
+        for (ObservadorMutacoes* observador : observadores) {
+            aviso(observador);
+        }
+    }
+
+public:
+    FonteMutacoes();
+    FonteMutacoes(const FonteMutacoes& outra);             // Não copia observadores
+    FonteMutacoes& operator=(const FonteMutacoes& outra);  // Mantém os próprios observadores
+    virtual ~FonteMutacoes();
+
+    /**
+     * @brief Registra observador (ignorado se já registrado)
+     * @param observador Deve viver mais que o gerenciador ou ser removido antes
+     */
+    void adicionarObservador(ObservadorMutacoes* observador);
+
+    /**
+     * @brief Remove observador registrado
+     */
+    void removerObservador(ObservadorMutacoes* observador);
+
+    /**
+     * @brief true se há observadores (evita copiar estados sem necessidade)
+     */
+    bool temObservadores() const;
+
+    /**
+     * @brief Avisa os observadores que um módulo descartou dados ligados a este gerenciador
+     *
+     * Chamado pelos módulos que observam o gerenciador (não pelo próprio
+     * gerenciador), logo depois de descartar.
+     */
+    void avisarDescarte(const DescarteDependentes& descarte) const;
+};  // Fim da classe FonteMutacoes
+
+#endif // OBSERVADOR_H
+// Fim do include guard
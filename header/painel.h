@@ -0,0 +1,127 @@
+/**
+ * @file painel.h
+ * @brief Painel de bastidores com contadores materializados
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ *
+ * O painel responde perguntas como "quantos pedidos pendentes?" ou
+ * "quantos itens estão abaixo do mínimo?" SEM varrer os gerenciadores.
+ *
+ * Ele é um OBSERVADOR: cada mutação feita pelos gerenciadores chega com o
+ * estado antes/depois e o painel aplica apenas a diferença (delta) nos
+ * contadores. Ler os indicadores custa O(1); cada mutação custa O(1)
+ * (listas de compras: O(itens da lista), para recalcular o total).
+ *
+ * Definições:
+ * - camarim ocupado: existe e há pelo menos um artista com esse camarimId
+ * - artista sem camarim: camarimId aponta para camarim inexistente (ou 0)
+ * - item abaixo do mínimo: mínimo definido (> 0) e quantidade < mínimo
+ */
+
+// Proteção contra inclusão múltipla
+#ifndef PAINEL_H  // Se PAINEL_H não foi definido
+#define PAINEL_H  // Define PAINEL_H
+
+#include <string>          // Para exibição
+#include <unordered_map>   // Para artistas por camarim
+#include <unordered_set>   // Para camarins existentes
+
+#include "observador.h"    // Interface ObservadorMutacoes
+#include "artista.h"       // GerenciadorArtistas
+#include "camarim.h"       // GerenciadorCamarins
+#include "pedido.h"        // GerenciadorPedidos
+#include "listacompras.h"  // GerenciadorListaCompras
+#include "estoque.h"       // Estoque
+
+using namespace std;
+
+/**
+ * @struct IndicadoresPainel
+ * @brief Fotografia dos contadores do painel
+ */
+struct IndicadoresPainel {
+    int pedidosPendentes = 0;     // Pedidos ainda não atendidos
+    int pedidosAtendidos = 0;     // Pedidos atendidos
+    int camarinsOcupados = 0;     // Camarins com pelo menos um artista
+    int artistasSemCamarim = 0;   // Artistas sem camarim existente
+    int itensAbaixoMinimo = 0;    // Itens com quantidade < mínimo
+    long long unidadesEstoque = 0;  // Soma das quantidades do estoque central
+    double valorListas = 0.0;     // Soma dos totais das listas de compras
+};
+
+/**
+ * @class PainelBastidores
+ * @brief Observador que mantém os indicadores sempre atualizados
+ *
+ * Uso:
+ *   PainelBastidores painel;
+ *   painel.conectar(artistas, camarins, pedidos, listas, estoque);
+ *   IndicadoresPainel i = painel.obter();  // O(1)
+ *
+ * O painel se desconecta sozinho no destrutor: declare-o DEPOIS dos
+ * gerenciadores para que seja destruído antes deles.
+ */
+class PainelBastidores : public ObservadorMutacoes {
+private:
+    IndicadoresPainel indicadores;
+
+    // Estado auxiliar para camarins ocupados / artistas sem camarim
+    unordered_map<int, int> artistasPorCamarim;  // camarimId -> artistas apontando para ele
+    unordered_set<int> camarinsExistentes;       // IDs dos camarins cadastrados
+    int totalArtistas = 0;
+    int artistasAlocados = 0;                    // Artistas em camarim existente
+    int totalListas = 0;                         // Listas de compras cadastradas
+
+    // Gerenciadores conectados (para desconectar no destrutor)
+    GerenciadorArtistas* artistas = nullptr;
+    GerenciadorCamarins* camarins = nullptr;
+    GerenciadorPedidos* pedidos = nullptr;
+    GerenciadorListaCompras* listas = nullptr;
+    Estoque* estoque = nullptr;
+
+    // Aplica +1/-1 de um artista no camarim informado
+    void contarArtista(int camarimId, int delta);
+
+public:
+    PainelBastidores();
+    ~PainelBastidores();
+
+    // Não copiável: a cópia não estaria registrada nos gerenciadores
+    PainelBastidores(const PainelBastidores&) = delete;
+    PainelBastidores& operator=(const PainelBastidores&) = delete;
+
+    /**
+     * @brief Registra o painel nos gerenciadores e calcula o estado inicial
+     *
+     * Pode ser chamado de novo (ex: depois de trocar os gerenciadores):
+     * desconecta dos anteriores e recalcula do zero.
+     */
+    void conectar(GerenciadorArtistas& artistas, GerenciadorCamarins& camarins,
+                  GerenciadorPedidos& pedidos, GerenciadorListaCompras& listas, Estoque& estoque);
+
+    /**
+     * @brief Remove o painel dos gerenciadores conectados
+     */
+    void desconectar();
+
+    /**
+     * @brief Indicadores atuais (O(1), nenhuma varredura)
+     */
+    const IndicadoresPainel& obter() const;
+
+    /**
+     * @brief Exibe os indicadores formatados
+     */
+    string exibir() const;
+
+    // ===== Observador (POLIMORFISMO: sobrescreve os avisos) =====
+    void aoMudarArtista(const Artista* antes, const Artista* depois) override;
+    void aoMudarCamarim(const Camarim* antes, const Camarim* depois) override;
+    void aoMudarPedido(const Pedido* antes, const Pedido* depois) override;
+    void aoMudarLista(const ListaCompras* antes, const ListaCompras* depois) override;
+    void aoMudarEstoque(const MudancaEstoque& mudanca) override;
+};  // Fim da classe PainelBastidores
+
+#endif // PAINEL_H
+// Fim do include guard
@@ -0,0 +1,200 @@
+/**
+ * @file paralelo.h
+ * @brief Escalonador de tarefas com roubo de trabalho, compartilhado pelo sistema
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ *
+ * Importação em lote, atendimento, relatórios e cópias de segurança podem
+ * rodar em paralelo. Se cada um criasse as próprias threads, a máquina
+ * ficaria com threads demais disputando os mesmos núcleos. Todos usam o
+ * mesmo Escalonador (Escalonador::compartilhado()).
+ *
+ * Cada thread do escalonador tem a sua fila dupla (deque). Quem envia uma
+ * tarefa de dentro do escalonador a coloca no FIM da própria fila, e a
+ * própria thread também retira do fim (LIFO: os dados ainda estão no
+ * cache). Uma thread sem trabalho ROUBA do INÍCIO da fila de outra
+ * thread: as tarefas mais antigas, normalmente as maiores. Threads de fora
+ * (ex: o menu) usam uma fila extra, da qual o escalonador também rouba.
+ *
+ *   Escalonador& escalonador = Escalonador::compartilhado();
+ *   escalonador.paraCada(0, n, [&](size_t i) { saidas[i] = renderizar(i); });
+ *
+ *   Escalonador::Grupo grupo(escalonador);  // Tarefas avulsas aguardadas juntas
+ *   grupo.enviar([&] { importar(); }, Prioridade::LOTE);
+ *   grupo.enviar([&] { atender(); }, Prioridade::INTERATIVA);
+ *   grupo.esperar();  // Quem espera também executa tarefas
+ *
+ * Prioridades: nenhuma thread pega uma tarefa de LOTE enquanto houver
+ * tarefa INTERATIVA em alguma fila. Uma tarefa de lote já em execução não
+ * é interrompida (tarefas de lote devem ser divididas em partes pequenas,
+ * como faz paraCada()).
+ */
+
+// Proteção contra inclusão múltipla
+#ifndef PARALELO_H  // Se PARALELO_H não foi definido
+#define PARALELO_H  // Define PARALELO_H
+
+#include <vector>              // Para as threads e as filas
+#include <deque>               // Para a fila dupla de cada thread
+#include <thread>              // Para thread
+#include <mutex>               // Para mutex
+#include <condition_variable>  // Para adormecer e acordar threads
+#include <atomic>              // Para os contadores
+#include <functional>          // Para function
+#include <memory>              // Para unique_ptr (filas com endereço fixo)
+#include <exception>           // Para exception_ptr
+#include <cstddef>             // Para size_t
+
+using namespace std;
+
+/**
+ * @enum Prioridade
+ * @brief Ordem em que as tarefas enfileiradas são escolhidas
+ */
+enum class Prioridade {
+    INTERATIVA,  // Alguém está esperando na tela (consultas, menu)
+    LOTE         // Trabalho de fundo (importação, relatórios, cópias)
+};
+
+/**
+ * @struct EstatisticasEscalonador
+ * @brief Contadores acumulados desde a criação do escalonador
+ */
+struct EstatisticasEscalonador {
+    unsigned long long interativas = 0;       // Tarefas INTERATIVA executadas
+    unsigned long long lote = 0;              // Tarefas LOTE executadas
+    unsigned long long roubadas = 0;          // Tiradas da fila de outra thread
+    unsigned long long executadasEsperando = 0;  // Executadas dentro de Grupo::esperar()
+    unsigned long long adormecimentos = 0;    // Vezes que uma thread dormiu sem trabalho
+    vector<unsigned long long> porFila;       // Executadas por thread (a última = threads de fora)
+};
+
+/**
+ * @class Escalonador
+ * @brief Threads fixas com uma fila dupla cada e roubo de trabalho
+ *
+ * Tarefas podem enviar outras tarefas e chamar paraCada() (paralelismo
+ * aninhado): quem espera um grupo executa tarefas pendentes em vez de
+ * bloquear a thread.
+ */
+class Escalonador {
+public:
+    /**
+     * @class Grupo
+     * @brief Conjunto de tarefas aguardado por esperar()
+     *
+     * O grupo deve viver até as suas tarefas terminarem: o destrutor
+     * espera as que ainda faltam (descartando a exceção, se houver).
+     */
+    class Grupo {
+    private:
+        friend class Escalonador;
+
+        Escalonador& escalonador;
+        atomic<size_t> pendentes;  // Enviadas e ainda não concluídas
+        mutex travaErro;
+        exception_ptr erro;        // Primeira exceção capturada
+
+        void registrarErro(exception_ptr e);
+
+    public:
+        explicit Grupo(Escalonador& escalonador);
+        ~Grupo();
+
+        Grupo(const Grupo&) = delete;
+        Grupo& operator=(const Grupo&) = delete;
+
+        /**
+         * @brief Enfileira uma tarefa na fila da thread atual
+         */
+        void enviar(function<void()> tarefa, Prioridade prioridade = Prioridade::LOTE);
+
+        /**
+         * @brief Espera todas as tarefas do grupo, executando tarefas enquanto isso
+         * @throws A primeira exceção lançada por uma tarefa do grupo
+         */
+        void esperar();
+    };
+
+private:
+    static const int TOTAL_PRIORIDADES = 2;
+
+    struct Tarefa {
+        function<void()> corpo;
+        Grupo* grupo;
+    };
+
+    /**
+     * @struct Fila
+     * @brief Fila dupla de uma thread (uma deque por prioridade) e seus contadores
+     */
+    struct Fila {
+        mutex trava;
+        deque<Tarefa> tarefas[TOTAL_PRIORIDADES];
+        atomic<unsigned long long> executadas[TOTAL_PRIORIDADES];
+        atomic<unsigned long long> roubadas{0};
+        atomic<unsigned long long> executadasEsperando{0};
+
+        Fila();
+    };
+
+    vector<unique_ptr<Fila>> filas;  // [0, threads): trabalhadores; a última: threads de fora
+    vector<thread> trabalhadores;
+    atomic<size_t> enfileiradas[TOTAL_PRIORIDADES];  // Tarefas em alguma fila, por prioridade
+    atomic<int> dormindo;            // Threads esperando em 'acordar'
+    atomic<unsigned long long> adormecimentos;
+    mutex travaSono;                 // Protege encerrando; usado com 'acordar'
+    condition_variable acordar;      // Nova tarefa, grupo concluído ou encerramento
+    bool encerrando;
+
+    size_t filaAtual() const;  // Fila da thread atual (a de fora, se não for do escalonador)
+    bool haTarefas() const;    // Alguma tarefa enfileirada (de qualquer prioridade)
+    void empilhar(Tarefa tarefa, Prioridade prioridade);
+    bool retirar(size_t fila, Tarefa& tarefa, int& prioridade, bool& roubada);
+    bool executarUma(size_t fila, bool esperando);  // false se não havia tarefa
+    void avisar(bool todos);   // Acorda threads adormecidas (se houver)
+    void laco(size_t fila);    // Corpo de cada thread do escalonador
+    void dividir(Grupo& grupo, const function<void(size_t)>& corpo, size_t inicio, size_t fim,
+                 size_t porTarefa, Prioridade prioridade);
+
+public:
+    /**
+     * @param threads Threads do escalonador além das que esperam grupos
+     *        (padrão: núcleos da máquina - 1; 0 = tudo na thread que espera)
+     */
+    explicit Escalonador(size_t threads = padraoThreads());
+    ~Escalonador();
+
+    Escalonador(const Escalonador&) = delete;
+    Escalonador& operator=(const Escalonador&) = delete;
+
+    /**
+     * @brief Escalonador único do sistema (criado no primeiro uso)
+     */
+    static Escalonador& compartilhado();
+
+    /**
+     * @brief corpo(i) para todo i em [inicio, fim), em paralelo, e espera
+     *
+     * A faixa é dividida ao meio até ter no máximo 'porTarefa' índices:
+     * metade fica na fila (para ser roubada) e a outra segue na thread.
+     * Se corpo lançar, os índices seguintes da mesma parte não rodam; as
+     * outras partes terminam antes de a exceção sair daqui.
+     * @throws A primeira exceção lançada por corpo
+     */
+    void paraCada(size_t inicio, size_t fim, const function<void(size_t)>& corpo,
+                  size_t porTarefa = 1, Prioridade prioridade = Prioridade::LOTE);
+
+    /**
+     * @brief Threads que executam tarefas (escalonador + a que espera)
+     */
+    size_t getParalelismo() const;
+
+    EstatisticasEscalonador getEstatisticas() const;
+
+    static size_t padraoThreads();  // hardware_concurrency() - 1 (0 se desconhecido)
+};  // Fim da classe Escalonador
+
+#endif // PARALELO_H
+// Fim do include guard
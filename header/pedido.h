@@ -17,6 +17,11 @@
 #include <string>    // Para trabalhar com strings
 #include <vector>    // Para lista de pedidos
 #include <map>       // Para armazenar itens do pedido
+#include "consulta.h"  // Motor de consultas (filtros, ordenação e limite)
+#include "repositorio.h"  // Repositório genérico (vector por ID + índices declarados)
+#include "observador.h"  // Observadores de mutações (painel, históricos)
+#include "relogio.h"     // Carimbos de tempo
+#include "copianaescrita.h"  // Itens compartilhados entre cópias (modelos de rider)
 #include <iostream>  // Para entrada/saída
 
 using namespace std;  // Namespace padrão
@@ -60,8 +65,11 @@ private:  // ENCAPSULAMENTO: atributos privados
     int id;                         // ID único do pedido
     int camarimId;                  // ID do camarim que fez o pedido
     string nomeArtista;             // Nome do artista (para facilitar exibição)
-    map<int, ItemPedido> itens;    // Map: chave = itemId, valor = ItemPedido
+    CopiaNaEscrita<map<int, ItemPedido>> itens;  // Map: chave = itemId, valor = ItemPedido
+    // CopiaNaEscrita: cópias do pedido compartilham o map até a primeira alteração
     bool atendido;                  // Status: true = atendido, false = pendente
+    long long criadoEm;             // Carimbo de criação (Relogio, µs; 0 = desconhecido)
+    long long atualizadoEm;         // Carimbo da última alteração pelo gerenciador
     
 public:  // Interface pública
     /**
@@ -85,14 +93,18 @@ public:  // Interface pública
     // ==================== GETTERS (retornam valores) ====================
     int getId() const;              // Retorna ID do pedido
     int getCamarimId() const;       // Retorna ID do camarim
-    string getNomeArtista() const;  // Retorna nome do artista
+    const string& getNomeArtista() const;  // Retorna nome do artista
     bool isAtendido() const;        // Retorna status (atendido ou não)
+    long long getCriadoEm() const;      // Retorna instante de criação (µs)
+    long long getAtualizadoEm() const;  // Retorna instante da última alteração (µs)
     
     // ==================== SETTERS (modificam atributos) ====================
     void setId(int id);                              // Define ID
     void setCamarimId(int camarimId);                // Define camarim
     void setNomeArtista(const string& nomeArtista);  // Define artista
     void setAtendido(bool atendido);                 // Define status
+    void setCriadoEm(long long criadoEm);            // Define instante de criação
+    void setAtualizadoEm(long long atualizadoEm);    // Define instante da última alteração
     
     /**
      * @brief Adiciona item ao pedido
@@ -122,6 +134,20 @@ public:  // Interface pública
      */
     void marcarAtendido();
     
+    /**
+     * @brief Acesso somente leitura aos itens do pedido
+     * @return Referência constante ao map (chave = itemId)
+     */
+    const map<int, ItemPedido>& getItens() const;
+    
+    /**
+     * @brief Substitui os itens pelos de 'origem' SEM copiar o map
+     * 
+     * Pedido e origem compartilham o armazenamento até um dos dois ser
+     * alterado (ex: pedido criado a partir de um modelo de rider).
+     */
+    void compartilharItens(const CopiaNaEscrita<map<int, ItemPedido>>& origem);
+    
     /**
      * @brief Exibe informações completas do pedido
      * @return String formatada com ID, camarim, artista, status e itens
@@ -147,36 +173,66 @@ public:  // Interface pública
  * CRUD: Create (criar), Read (buscar/listar), Update (atender), Delete (remover)
  * Centraliza gerenciamento de todos os pedidos do sistema
  */
-class GerenciadorPedidos {
+class GerenciadorPedidos : public FonteMutacoes {
 private:  // Atributos privados
-    vector<Pedido> pedidos;  // Vector dinâmico de pedidos
-    int proximoId;           // Contador para gerar IDs únicos
+    using PorCamarim = IndicePorGrupo<&Pedido::getCamarimId>;         // camarimId -> IDs
+    using PorStatus = IndicePorGrupo<&Pedido::isAtendido>;            // 0 = pendentes, 1 = atendidos
+    using PorAtualizacao = IndiceOrdenado<&Pedido::getAtualizadoEm>;  // (atualizadoEm, ID) em ordem
+    
+    // Pedidos em ordem de ID + índices. Não há índice de criação: a ordem
+    // de ID já é a ordem de criadoEm
+    Repositorio<Pedido, PorCamarim, PorStatus, PorAtualizacao> pedidos;
+    
+    // Carimba atualizadoEm com Relogio::agora() (o repositório move o índice por tempo)
+    void registrarAtualizacao(Pedido& pedido);
     
 public:  // Interface pública (métodos CRUD)
     /**
-     * @brief Construtor - inicializa lista vazia e proximoId = 1
+     * @brief Construtor - inicializa lista vazia (IDs a partir de 1)
      */
     GerenciadorPedidos();
+
+    /**
+     * @brief Alocador de IDs: blocos para criação em várias threads e limite a persistir
+     */
+    AlocadorIds& getAlocadorIds();
     
     /**
      * @brief Cria novo pedido (CREATE)
      * @param camarimId ID do camarim solicitante
      * @param nomeArtista Nome do artista
+     * @param bloco Bloco de IDs da thread (de getAlocadorIds(); nullptr = ID avulso)
      * @return ID do pedido criado
      * 
      * Gera ID automático, cria Pedido vazio (sem itens ainda)
      * Itens são adicionados depois com adicionarItem()
      */
-    int criar(int camarimId, const string& nomeArtista);
+    int criar(int camarimId, const string& nomeArtista, AlocadorIds::Bloco* bloco = nullptr);
+    
+    /**
+     * @brief Cria pedido já com itens, compartilhando o map (cópia na escrita)
+     * @param itens Linhas já validadas (ex: ModeloRider::getLinhasPedido())
+     * @param bloco Bloco de IDs da thread (de getAlocadorIds(); nullptr = ID avulso)
+     * @return ID do pedido criado
+     * 
+     * Não copia as linhas: o pedido só ganha um map próprio quando for
+     * alterado. Os observadores recebem a criação e um aoAdicionarItemPedido
+     * por linha, como se os itens tivessem sido adicionados um a um.
+     */
+    int criarComItens(int camarimId, const string& nomeArtista,
+                      const CopiaNaEscrita<map<int, ItemPedido>>& itens, AlocadorIds::Bloco* bloco = nullptr);
     
     /**
      * @brief Busca pedido por ID (READ)
      * @param id ID do pedido
      * @return Ponteiro para o pedido ou nullptr se não encontrado
      * 
-     * PONTEIRO: permite modificar pedido original (adicionar itens, marcar atendido)
+     * PONTEIRO: permite modificar pedido original (adicionar itens)
+     * ATENÇÃO: marcar atendido pelo ponteiro não atualiza o índice de
+     * pendentes; use marcarAtendido(id)
      */
     Pedido* buscarPorId(int id);
+    const Pedido* buscarPorId(int id) const;  // Versão somente leitura
     
     /**
      * @brief Busca todos os pedidos de um camarim (READ)
@@ -191,16 +247,20 @@ public:  // Interface pública (métodos CRUD)
      * @brief Lista pedidos pendentes (READ com filtro)
      * @return Vector com pedidos que ainda não foram atendidos
      * 
-     * Útil para gerenciar fila de pedidos a processar
+     * Útil para gerenciar fila de pedidos a processar. Usa o índice por
+     * status: percorre só os pendentes.
      */
     vector<Pedido> listarPendentes() const;
     
+    /**
+     * @brief Lista pedidos atendidos, em ordem de criação (ex: para arquivar)
+     */
+    vector<Pedido> listarAtendidos() const;
+    
     /**
      * @brief Remove pedido (DELETE)
      * @param id ID do pedido
      * @return true se removido, false se não encontrado
-     * 
-     * Usa remove_if + erase
      */
     bool remover(int id);
     
@@ -209,6 +269,71 @@ public:  // Interface pública (métodos CRUD)
      * @return Vector com cópias de todos os pedidos
      */
     vector<Pedido> listar() const;
+    
+    /**
+     * @brief Todos os pedidos, sem cópia (somente leitura, em ordem de ID)
+     * 
+     * A referência vale até a próxima alteração do gerenciador: várias
+     * threads podem ler ao mesmo tempo desde que ninguém altere.
+     */
+    const vector<Pedido>& todos() const;
+    
+    /**
+     * @brief Executa uma consulta sobre os pedidos (varredura vetorizada)
+     * @param consulta Condições, ordenação e limite
+     * 
+     * Ex: pendentes do camarim 3 com mais de 10 unidades, mais recentes primeiro
+     */
+    ResultadoConsulta<Pedido> consultar(const Consulta& consulta) const;
+    
+    // ===== Alterações de um pedido (avisam os observadores) =====
+    // Prefira estes métodos a buscarPorId(id)->...: o ponteiro altera o
+    // pedido sem avisar painel e históricos.
+    
+    /**
+     * @brief Adiciona item ao pedido
+     * @throws PedidoException se o pedido não existe
+     */
+    void adicionarItem(int pedidoId, int itemId, const string& nomeItem, int quantidade);
+    
+    /**
+     * @brief Remove item do pedido
+     * @return false se o item não está no pedido
+     * @throws PedidoException se o pedido não existe
+     */
+    bool removerItem(int pedidoId, int itemId);
+    
+    /**
+     * @brief Marca pedido como atendido
+     * @throws PedidoException se o pedido não existe
+     */
+    void marcarAtendido(int pedidoId);
+    
+    /**
+     * @brief Coloca o pedido exatamente no estado informado (desfazer/refazer)
+     * @param estado Pedido com o ID a restaurar (recriado se foi removido)
+     * 
+     * Mantém o criadoEm do estado e carimba atualizadoEm com o instante atual.
+     */
+    void restaurar(const Pedido& estado);
+    
+    // ===== Consultas por período (instantes em µs, ver Relogio) =====
+    
+    /**
+     * @brief Pedidos criados no período [inicio, fim], em ordem de criação
+     * 
+     * Busca binária no vector (já ordenado por criação): O(log n + k)
+     */
+    vector<Pedido> buscarCriadosEntre(long long inicio, long long fim) const;
+    
+    /**
+     * @brief Pedidos cuja última alteração está em [inicio, fim]
+     * @return Em ordem de alteração (empate: menor ID)
+     * 
+     * Só conta alterações feitas pelo gerenciador (criar, adicionarItem,
+     * removerItem, marcarAtendido). O(log n + k).
+     */
+    vector<Pedido> buscarAtualizadosEntre(long long inicio, long long fim) const;
 };  // Fim da classe GerenciadorPedidos
 
 #endif // PEDIDO_H
@@ -55,11 +55,12 @@ public: // Modificador de acesso: acessível de qualquer parte do programa
     
     // Getters - Métodos para ler os valores dos atributos (const = não modificam o objeto)
     int getId() const; // Retorna o id da pessoa
-    string getNome() const; // Retorna o nome da pessoa
+    const string& getNome() const; // Retorna o nome da pessoa
     
     // Setters - Métodos para modificar os valores dos atributos
-    void setId(int id); // Define um novo id para a pessoa
-    void setNome(const string& nome); // Define um novo nome para a pessoa
+    // virtual: as classes derivadas acrescentam as regras dos seus campos
+    virtual void setId(int id); // Define um novo id para a pessoa
+    virtual void setNome(const string& nome); // Define um novo nome para a pessoa
     
     /**
      * @brief Método virtual puro para exibir informações (polimorfismo)
@@ -0,0 +1,103 @@
+/**
+ * @file reconciliacao.h
+ * @brief Fechamento de camarins: o que sobrou volta ao estoque, o resto foi consumido
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ *
+ * Depois do show, a produção conta o que SOBROU em cada camarim. A
+ * reconciliação compara a contagem com as linhas do camarim:
+ *   devolvido = contado          (volta ao estoque)
+ *   consumido = no camarim - contado
+ * e o camarim fica vazio.
+ *
+ * Item do camarim que não aparece na contagem foi todo consumido. No
+ * fechamento geral (calcularTodos), camarim sem contagem também.
+ *
+ * calcular() não altera nada: devolve o resultado para conferência.
+ * aplicar() grava em lote: UM aviso por camarim
+ * (GerenciadorCamarins::esvaziar) e UMA entrada de estoque por item (soma
+ * das devoluções de todos os camarins). Tudo é validado antes da primeira
+ * escrita.
+ */
+
+// Proteção contra inclusão múltipla
+#ifndef RECONCILIACAO_H  // Se RECONCILIACAO_H não foi definido
+#define RECONCILIACAO_H  // Define RECONCILIACAO_H
+
+#include <string>   // Para nomes
+#include <vector>   // Para as linhas do resultado
+#include <map>      // Para contagens ordenadas por camarim e item
+
+#include "camarim.h"     // GerenciadorCamarins
+#include "estoque.h"     // Estoque
+#include "excecoes.h"    // CamarimException, ValidacaoException
+
+using namespace std;
+
+/**
+ * @struct LinhaReconciliacao
+ * @brief Destino de uma linha do camarim no fechamento
+ */
+struct LinhaReconciliacao {
+    int camarimId = 0;
+    int itemId = 0;
+    string nomeItem;
+    int quantidade = 0;  // O que estava no camarim
+    int devolvido = 0;   // Contado: volta ao estoque
+    int consumido = 0;   // quantidade - devolvido
+};
+
+/**
+ * @struct ResultadoReconciliacao
+ * @brief Reconciliação calculada (ainda não gravada)
+ */
+struct ResultadoReconciliacao {
+    vector<LinhaReconciliacao> linhas;  // Em ordem (camarimId, itemId), todas as linhas de cada camarim
+
+    int totalDevolvido() const;
+    int totalConsumido() const;
+};
+
+/**
+ * @class ReconciliacaoCamarins
+ * @brief Calcula e aplica o fechamento de camarins
+ *
+ * Uso:
+ *   map<int, map<int, int>> contagens;   // camarimId -> (itemId -> sobrou)
+ *   contagens[4][1] = 3;                 // 3 águas sobraram no camarim 4
+ *   ResultadoReconciliacao r = ReconciliacaoCamarins::calcular(camarins, contagens);
+ *   ReconciliacaoCamarins::aplicar(r, camarins, estoque);
+ */
+class ReconciliacaoCamarins {
+public:
+    /**
+     * @brief Reconcilia os camarins que aparecem nas contagens
+     * @param contagens camarimId -> (itemId -> quantidade que sobrou)
+     * @throws CamarimException se um camarim não existe ou um item contado não está nele
+     * @throws ValidacaoException se a contagem é negativa ou maior que a quantidade
+     */
+    static ResultadoReconciliacao calcular(const GerenciadorCamarins& camarins,
+                                           const map<int, map<int, int>>& contagens);
+
+    /**
+     * @brief Fechamento geral: reconcilia TODOS os camarins com itens
+     *
+     * Camarim sem contagem teve tudo consumido.
+     *
+     * @throws As mesmas exceções de calcular()
+     */
+    static ResultadoReconciliacao calcularTodos(const GerenciadorCamarins& camarins,
+                                                const map<int, map<int, int>>& contagens);
+
+    /**
+     * @brief Esvazia os camarins do resultado e devolve as sobras ao estoque (tudo ou nada)
+     * @throws CamarimException se algum camarim não existe ou mudou desde o cálculo
+     * @throws ValidacaoException se devolvido/consumido não fecham com a quantidade
+     */
+    static void aplicar(const ResultadoReconciliacao& resultado, GerenciadorCamarins& camarins,
+                        Estoque& estoque);
+};  // Fim da classe ReconciliacaoCamarins
+
+#endif // RECONCILIACAO_H
+// Fim do include guard
@@ -0,0 +1,201 @@
+/**
+ * @file referencias.h
+ * @brief Índice reverso item -> onde é usado (remoção segura do catálogo)
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ *
+ * GerenciadorItens::remover apaga o item do catálogo mesmo que o estoque,
+ * camarins, pedidos, listas de compras, modelos de rider e níveis de
+ * reposição ainda guardem o seu ID. Descobrir essas referências exigiria
+ * varrer todos os gerenciadores.
+ *
+ * O IndiceReferencias é um OBSERVADOR que mantém, para cada item, os IDs
+ * das entidades que o citam. Cada aviso compara os itens de antes/depois
+ * da entidade alterada (O(itens da entidade)). Com isso:
+ * - "onde este item é usado?" custa O(referências)
+ * - remover o item pode ser BLOQUEADO (se estiver em uso) ou feito em
+ *   CASCATA, retirando-o de cada entidade que o cita: O(referências)
+ *
+ * Modelos de rider e níveis de reposição não avisam observadores: mantêm
+ * o próprio índice item -> IDs (modelosComItem, camarinsComNivel), que o
+ * índice consulta em O(1).
+ *
+ * Pedidos já atendidos são registros do que foi entregue e não podem ser
+ * alterados: enquanto um deles citar o item, a remoção é recusada nos dois
+ * modos (arquive o pedido antes). A cascata confere tudo antes do primeiro
+ * passo: ou retira o item de todos os lugares, ou não muda nada.
+ *
+ * Só enxerga alterações feitas pelos gerenciadores (ver observador.h).
+ */
+
+// Proteção contra inclusão múltipla
+#ifndef REFERENCIAS_H  // Se REFERENCIAS_H não foi definido
+#define REFERENCIAS_H  // Define REFERENCIAS_H
+
+#include <string>          // Para mensagens
+#include <vector>          // Para as listas devolvidas
+#include <set>             // Para IDs ordenados por tipo de entidade
+#include <map>             // Para os itens das entidades
+#include <unordered_map>   // Para item -> referências
+
+#include "observador.h"    // Interface ObservadorMutacoes
+#include "item.h"          // GerenciadorItens
+#include "camarim.h"       // GerenciadorCamarins
+#include "pedido.h"        // GerenciadorPedidos
+#include "listacompras.h"  // GerenciadorListaCompras
+#include "estoque.h"       // Estoque
+#include "modelo.h"        // GerenciadorModelos
+#include "reposicao.h"     // ReposicaoCamarins
+
+using namespace std;
+
+/**
+ * @struct ReferenciasItem
+ * @brief Onde um item do catálogo é usado
+ */
+struct ReferenciasItem {
+    bool noEstoque = false;  // Quantidade > 0 ou mínimo definido no estoque central
+    vector<int> camarins;    // IDs dos camarins que têm o item (ordem crescente)
+    vector<int> pedidos;     // IDs dos pedidos que contêm o item
+    vector<int> listas;      // IDs das listas de compras que contêm o item
+    vector<int> modelos;     // IDs dos modelos de rider com linha do item
+    vector<int> niveis;      // IDs dos camarins com nível de reposição do item
+
+    /**
+     * @brief Quantidade total de referências (estoque conta como uma)
+     */
+    size_t total() const;
+
+    /**
+     * @brief Descrição curta (ex: "2 camarim(ns), 1 pedido(s), estoque")
+     */
+    string descrever() const;
+};
+
+/**
+ * @enum ModoRemocao
+ * @brief O que fazer ao remover um item que ainda é usado
+ */
+enum class ModoRemocao {
+    BLOQUEAR,  // Lança ItemException se houver qualquer referência
+    CASCATA    // Retira o item de camarins, pedidos pendentes, listas, modelos, níveis e estoque
+};
+
+/**
+ * @class IndiceReferencias
+ * @brief Observador que mantém o índice reverso item -> referências
+ *
+ * Uso:
+ *   IndiceReferencias referencias;
+ *   referencias.conectar(itens, camarins, pedidos, listas, estoque);
+ *   ReferenciasItem r = referencias.referenciasDe(7);   // O(referências)
+ *   referencias.removerItem(7, ModoRemocao::CASCATA);   // O(referências)
+ *
+ * Declare-o DEPOIS dos gerenciadores para que seja destruído antes deles.
+ */
+class IndiceReferencias : public ObservadorMutacoes {
+private:
+    // Referências de um item (conjuntos: inserção/remoção O(log k))
+    struct Referencias {
+        bool noEstoque = false;
+        set<int> camarins;
+        set<int> pedidos;
+        set<int> listas;
+
+        bool vazia() const { return !noEstoque && camarins.empty() && pedidos.empty() && listas.empty(); }
+    };
+
+    unordered_map<int, Referencias> porItem;  // itemId -> referências (só itens usados)
+
+    // Gerenciadores conectados
+    GerenciadorItens* itens = nullptr;
+    GerenciadorCamarins* camarins = nullptr;
+    GerenciadorPedidos* pedidos = nullptr;
+    GerenciadorListaCompras* listas = nullptr;
+    Estoque* estoque = nullptr;
+
+    // Módulos consultados (não observados); nullptr = não acompanhados
+    GerenciadorModelos* modelos = nullptr;
+    ReposicaoCamarins* reposicao = nullptr;
+
+    /**
+     * @brief Aplica a diferença entre os itens de antes e depois de uma entidade
+     * @param membro Conjunto de Referencias que guarda esse tipo de entidade
+     *
+     * Percorre os dois maps ordenados em paralelo: O(itens antes + depois).
+     */
+    template <typename ItemMapa>
+    void atualizar(int entidadeId, const map<int, ItemMapa>* antes, const map<int, ItemMapa>* depois,
+                   set<int> Referencias::*membro);
+
+    // Remove a entrada do item quando não sobra nenhuma referência
+    void descartarSeVazia(int itemId);
+
+public:
+    IndiceReferencias();
+    ~IndiceReferencias();
+
+    // Não copiável: a cópia não estaria registrada nos gerenciadores
+    IndiceReferencias(const IndiceReferencias&) = delete;
+    IndiceReferencias& operator=(const IndiceReferencias&) = delete;
+
+    /**
+     * @brief Registra o índice nos gerenciadores e indexa o estado atual
+     *
+     * O catálogo (itens) não é observado: é usado apenas por removerItem().
+     */
+    void conectar(GerenciadorItens& itens, GerenciadorCamarins& camarins, GerenciadorPedidos& pedidos,
+                  GerenciadorListaCompras& listas, Estoque& estoque);
+
+    /**
+     * @brief Passa a considerar as linhas dos modelos e os níveis de reposição
+     *
+     * Os módulos não são observados (mantêm o próprio índice por item) e
+     * continuam acompanhados depois de desconectar()/conectar().
+     */
+    void acompanharModulos(GerenciadorModelos& modelos, ReposicaoCamarins& reposicao);
+
+    /**
+     * @brief Remove o índice dos gerenciadores conectados
+     */
+    void desconectar();
+
+    /**
+     * @brief Onde o item é usado (vale também para IDs fora do catálogo)
+     */
+    ReferenciasItem referenciasDe(int itemId) const;
+
+    /**
+     * @brief true se alguma entidade ainda cita o item (O(1))
+     */
+    bool emUso(int itemId) const;
+
+    /**
+     * @brief Remove o item do catálogo respeitando as referências
+     * @return false se o item não existe no catálogo
+     * @throws ItemException em BLOQUEAR, se o item estiver em uso; nos dois
+     *         modos, se um pedido atendido cita o item (nada muda)
+     *
+     * CASCATA retira o item de cada camarim, pedido pendente, lista, modelo
+     * e nível de reposição que o contém e zera sua quantidade e mínimo no
+     * estoque, depois remove do catálogo. Cada passo passa pelos
+     * gerenciadores (avisa os observadores). Linhas de modelos e níveis
+     * descartados são avisados pelo GerenciadorItens (aoDescartarDependentes).
+     */
+    bool removerItem(int itemId, ModoRemocao modo = ModoRemocao::BLOQUEAR);
+
+    /**
+     * @brief Quantidade de itens com pelo menos uma referência
+     */
+    size_t totalItensReferenciados() const;
+
+    // ===== Observador (POLIMORFISMO: sobrescreve os avisos) =====
+    void aoMudarCamarim(const Camarim* antes, const Camarim* depois) override;
+    void aoMudarPedido(const Pedido* antes, const Pedido* depois) override;
+    void aoMudarLista(const ListaCompras* antes, const ListaCompras* depois) override;
+    void aoMudarEstoque(const MudancaEstoque& mudanca) override;
+};  // Fim da classe IndiceReferencias
+
+#endif // REFERENCIAS_H
+// Fim do include guard
@@ -0,0 +1,49 @@
+/**
+ * @file relatorio.h
+ * @brief Relatório geral de fechamento gerado em paralelo
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ *
+ * O relatório do fim da noite junta exibir() de todos os camarins, pedidos
+ * e listas de compras e a tabela do estoque. Cada registro é formatado de
+ * forma independente dos outros, então as seções são divididas em partes
+ * de 'porTarefa' registros, cada parte é renderizada por uma thread do
+ * escalonador em um buffer próprio e os buffers são concatenados na ordem
+ * das seções e dos IDs. O texto sai idêntico ao da geração sequencial, com
+ * qualquer número de threads.
+ *
+ *   string texto = gerarRelatorio(camarins, pedidos, listas, estoque,
+ *                                 &Escalonador::compartilhado());
+ *
+ * Os gerenciadores são só lidos (todos(), sem cópia): ninguém pode
+ * alterá-los enquanto o relatório é gerado.
+ */
+
+// Proteção contra inclusão múltipla
+#ifndef RELATORIO_H  // Se RELATORIO_H não foi definido
+#define RELATORIO_H  // Define RELATORIO_H
+
+#include <string>          // Para o texto do relatório
+#include <cstddef>         // Para size_t
+#include "camarim.h"       // GerenciadorCamarins
+#include "pedido.h"        // GerenciadorPedidos
+#include "listacompras.h"  // GerenciadorListaCompras
+#include "estoque.h"       // Estoque
+#include "paralelo.h"      // Escalonador
+
+using namespace std;
+
+/**
+ * @brief Relatório geral: camarins, pedidos, listas de compras e estoque
+ * @param escalonador Threads que renderizam as partes (nullptr = tudo na thread atual)
+ * @param porTarefa Registros por parte (partes menores equilibram melhor a
+ *        carga; maiores custam menos para distribuir)
+ * @return Texto completo, sempre na mesma ordem (seção, depois ID)
+ */
+string gerarRelatorio(const GerenciadorCamarins& camarins, const GerenciadorPedidos& pedidos,
+                      const GerenciadorListaCompras& listas, const Estoque& estoque,
+                      Escalonador* escalonador = nullptr, size_t porTarefa = 64);
+
+#endif // RELATORIO_H
+// Fim do include guard
@@ -0,0 +1,88 @@
+/**
+ * @file relogio.h
+ * @brief Relógio monotônico em microssegundos e registros ordenados por tempo
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ *
+ * Todo carimbo de tempo do sistema (criação/alteração de pedidos,
+ * movimentações de estoque, alterações de camarins) vem de Relogio::agora().
+ *
+ * MONOTÔNICO: o valor nunca diminui, mesmo se o relógio do computador for
+ * ajustado. Por isso os registros anexados em ordem de acontecimento já
+ * ficam ORDENADOS POR TEMPO e uma consulta por período vira uma busca
+ * binária (lower_bound/upper_bound): O(log n + k).
+ */
+
+// Proteção contra inclusão múltipla
+#ifndef RELOGIO_H  // Se RELOGIO_H não foi definido
+#define RELOGIO_H  // Define RELOGIO_H
+
+#include <string>     // Para formatação
+#include <vector>     // Para os registros
+#include <algorithm>  // Para lower_bound e upper_bound
+
+using namespace std;
+
+/**
+ * @class Relogio
+ * @brief Fonte única de carimbos de tempo (microssegundos desde 1970, UTC)
+ *
+ * Modo real: relógio do sistema no início + tempo decorrido do relógio
+ * estável (steady_clock); valores estritamente crescentes.
+ *
+ * Modo simulado (testes): devolve o instante fixado por simular(), que
+ * só pode avançar. Dois sistemas executando a mesma operação recebem o
+ * mesmo carimbo.
+ */
+class Relogio {
+public:
+    /**
+     * @brief Instante atual em microssegundos (nunca menor que o anterior)
+     */
+    static long long agora();
+
+    /**
+     * @brief Fixa o relógio em um instante (valores anteriores ao último são ignorados)
+     */
+    static void simular(long long micros);
+
+    /**
+     * @brief Volta a usar o relógio real
+     */
+    static void usarRelogioReal();
+
+    /**
+     * @brief Instante de hoje no horário local informado (ex: 18h00)
+     * @throws ValidacaoException se hora/minuto forem inválidos
+     */
+    static long long horarioDeHoje(int hora, int minuto);
+
+    /**
+     * @brief Formata como "DD/MM/AAAA HH:MM:SS" (horário local)
+     */
+    static string formatar(long long micros);
+};  // Fim da classe Relogio
+
+/**
+ * @brief Faixa [inicio, fim] de um vetor ordenado pelo campo 'tempo'
+ * @param registros Vetor em ordem crescente de tempo (ex: anexado com Relogio::agora())
+ * @param tempo Função que extrai o carimbo de um registro
+ * @return Cópias dos registros no período (vazio se inicio > fim)
+ *
+ * Busca binária nas duas pontas: O(log n + k).
+ */
+template <typename T, typename Tempo>
+vector<T> registrosEntre(const vector<T>& registros, long long inicio, long long fim, Tempo tempo) {
+    if (inicio > fim) {
+        return {};
+    }
+    auto primeiro = lower_bound(registros.begin(), registros.end(), inicio,
+                                [&](const T& r, long long t) { return tempo(r) < t; });
+    auto ultimo = upper_bound(primeiro, registros.end(), fim,
+                              [&](long long t, const T& r) { return t < tempo(r); });
+    return vector<T>(primeiro, ultimo);
+}
+
+#endif // RELOGIO_H
+// Fim do include guard
@@ -0,0 +1,156 @@
+/**
+ * @file reposicao.h
+ * @brief Níveis de reposição (par) por camarim e plano de transferência do estoque
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ *
+ * Cada camarim pode ter quantidades-padrão ("24 águas, 12 toalhas"). A
+ * reposição compara o que o camarim tem com o padrão e monta um PLANO de
+ * transferências Estoque -> Camarim para todos os camarins de uma vez.
+ *
+ * ESTRUTURA: níveis em map camarimId -> (itemId -> nível). Os itens do
+ * camarim também estão em um map ordenado por itemId, então a diferença
+ * de cada camarim é um merge de duas listas ordenadas: O(p + k) por camarim
+ * (p = níveis, k = itens do camarim), sem buscas.
+ *
+ * O estoque é dividido em ordem de ID de camarim: o que não couber vira
+ * FALTA no plano (para a lista de compras), não erro.
+ *
+ * executar() grava o plano em lote: UMA saída de estoque por item (soma de
+ * todos os camarins) e UMA alteração por camarim (GerenciadorCamarins::
+ * abastecer). Tudo é validado antes da primeira escrita.
+ */
+
+// Proteção contra inclusão múltipla
+#ifndef REPOSICAO_H  // Se REPOSICAO_H não foi definido
+#define REPOSICAO_H  // Define REPOSICAO_H
+
+#include <string>   // Para nomes
+#include <vector>   // Para o plano
+#include <map>      // Para níveis ordenados por camarim e item
+
+#include "observador.h"  // Interface ObservadorMutacoes
+#include "indice.h"      // IndiceGrupos (item -> camarins com nível)
+#include "camarim.h"     // GerenciadorCamarins, ItemCamarim
+#include "estoque.h"     // Estoque
+#include "excecoes.h"    // CamarimException, ValidacaoException
+
+using namespace std;
+
+/**
+ * @struct TransferenciaReposicao
+ * @brief Quantidade de um item a levar do estoque para um camarim
+ */
+struct TransferenciaReposicao {
+    int camarimId = 0;
+    int itemId = 0;
+    string nomeItem;
+    int quantidade = 0;
+};
+
+/**
+ * @struct PlanoReposicao
+ * @brief Resultado de planejar(): o que transferir e o que falta comprar
+ */
+struct PlanoReposicao {
+    vector<TransferenciaReposicao> transferencias;  // Em ordem (camarimId, itemId)
+    vector<TransferenciaReposicao> faltas;          // Parte que o estoque não cobre, mesma ordem
+
+    /**
+     * @brief Soma das quantidades a transferir
+     */
+    int totalUnidades() const;
+};
+
+/**
+ * @class ReposicaoCamarins
+ * @brief Guarda os níveis de cada camarim e monta/executa o plano de reposição
+ *
+ * Uso:
+ *   ReposicaoCamarins reposicao;
+ *   reposicao.conectar(camarins, estoque);
+ *   reposicao.definirNivel(4, 1, "Agua", 24);
+ *   PlanoReposicao plano = reposicao.planejar();  // Nada muda ainda
+ *   reposicao.executar(plano);
+ *
+ * Observa os camarins: remover um camarim descarta os seus níveis (e avisa
+ * o descarte pelo GerenciadorCamarins).
+ * Declare-a DEPOIS dos gerenciadores para que seja destruída antes deles.
+ */
+class ReposicaoCamarins : public ObservadorMutacoes {
+private:
+    map<int, map<int, ItemCamarim>> niveis;  // camarimId -> (itemId -> nível em 'quantidade')
+    IndiceGrupos camarinsPorItem;            // itemId -> camarins com nível do item (referências)
+
+    // Gerenciadores conectados
+    GerenciadorCamarins* camarins = nullptr;
+    Estoque* estoque = nullptr;
+
+    // Lança CamarimException se não conectado
+    void exigirConexao() const;
+
+public:
+    ReposicaoCamarins();
+    ~ReposicaoCamarins();
+
+    // Não copiável: a cópia não estaria registrada nos gerenciadores
+    ReposicaoCamarins(const ReposicaoCamarins&) = delete;
+    ReposicaoCamarins& operator=(const ReposicaoCamarins&) = delete;
+
+    /**
+     * @brief Registra a reposição nos gerenciadores (níveis anteriores são descartados)
+     */
+    void conectar(GerenciadorCamarins& camarins, Estoque& estoque);
+
+    /**
+     * @brief Remove a reposição dos gerenciadores conectados
+     */
+    void desconectar();
+
+    /**
+     * @brief Define o nível do item no camarim (0 = remove o nível)
+     * @throws CamarimException se não conectado ou o camarim não existe
+     * @throws ValidacaoException para ID, nome ou quantidade inválidos
+     */
+    void definirNivel(int camarimId, int itemId, const string& nomeItem, int quantidade);
+
+    /**
+     * @brief Níveis do camarim em ordem de itemId (quantidade = nível)
+     */
+    vector<ItemCamarim> niveisDe(int camarimId) const;
+
+    /**
+     * @brief Camarins com nível definido para o item, em ordem crescente (O(1))
+     * @return Referência constante: válida até a próxima alteração dos níveis
+     */
+    const vector<int>& camarinsComNivel(int itemId) const;
+
+    /**
+     * @brief Compara todos os camarins com seus níveis e divide o estoque
+     * @throws CamarimException se não conectado
+     *
+     * O(soma de níveis e itens dos camarins com nível + log n por item do estoque).
+     */
+    PlanoReposicao planejar() const;
+
+    /**
+     * @brief Grava o plano (tudo ou nada)
+     * @throws CamarimException se algum camarim não existe mais
+     * @throws EstoqueInsuficienteException se o estoque mudou e não cobre o plano
+     * @throws ValidacaoException para quantidade <= 0
+     */
+    void executar(const PlanoReposicao& plano);
+
+    /**
+     * @brief planejar() + executar()
+     * @return O plano executado
+     */
+    PlanoReposicao repor();
+
+    // ===== Observador (POLIMORFISMO: sobrescreve os avisos) =====
+    void aoMudarCamarim(const Camarim* antes, const Camarim* depois) override;
+};  // Fim da classe ReposicaoCamarins
+
+#endif // REPOSICAO_H
+// Fim do include guard
@@ -0,0 +1,421 @@
+/**
+ * @file repositorio.h
+ * @brief Repositório genérico: registros em ordem de ID + índices declarados em tempo de compilação
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ *
+ * Os gerenciadores de itens, artistas, camarins, pedidos, listas de compras
+ * e modelos de rider guardam os registros do mesmo jeito: um vector em
+ * ordem crescente de ID, um alocador de IDs, um índice hash ID -> posição
+ * e alguns índices secundários (nome, camarim, artista, status...). Repositorio<T, Indices...>
+ * concentra essa parte; o gerenciador fica só com as regras e os avisos aos
+ * observadores.
+ *
+ * Os índices secundários são parâmetros do template:
+ *
+ *   Repositorio<Artista, IndicePorGrupo<&Artista::getCamarimId>> artistas;
+ *   artistas.indice<IndicePorGrupo<&Artista::getCamarimId>>().buscar(3);
+ *
+ * Todo índice expõe TipoChave, chave(registro), inserir(chave, id) e
+ * remover(chave, id). O repositório mantém TODOS os índices em inserir,
+ * remover e alterar: alterar() lê as chaves antes, aplica a alteração e
+ * move o registro apenas nos índices cuja chave mudou (mesmo se a
+ * alteração lançar no meio). A chave pode ser uma lista (ex: itens de um
+ * modelo de rider): o índice recebe a lista inteira em inserir/remover.
+ *
+ * ATENÇÃO: alterar um registro pelo ponteiro de buscar() sem passar por
+ * alterar() deixa os índices secundários desatualizados.
+ */
+
+// Proteção contra inclusão múltipla
+#ifndef REPOSITORIO_H  // Se REPOSITORIO_H não foi definido
+#define REPOSITORIO_H  // Define REPOSITORIO_H
+
+#include <vector>         // Para os registros (contíguos, em ordem de ID)
+#include <tuple>          // Para guardar os índices declarados
+#include <unordered_map>  // Para o índice ID -> posição e o índice único
+#include <set>            // Para o índice ordenado
+#include <algorithm>      // Para lower_bound, max
+#include <type_traits>    // Para decay_t, invoke_result_t
+#include <limits>         // Para numeric_limits
+#include <utility>        // Para move, index_sequence
+#include <cstddef>        // Para size_t
+#include "indice.h"       // Para IndiceGrupos
+#include "identificadores.h"  // Para AlocadorIds
+
+using namespace std;
+
+// ==================== Chaves dos índices ====================
+
+// Tipo devolvido por um getter const (ex: string para &Item::getNome)
+template <typename G>
+struct TipoDoGetter;
+
+template <typename R, typename C>
+struct TipoDoGetter<R (C::*)() const> {
+    using Chave = decay_t<R>;
+};
+
+// ==================== Índices secundários ====================
+
+/**
+ * @class IndicePorGrupo
+ * @brief Chave inteira -> IDs em ordem crescente (ex: artistas por camarim)
+ * @tparam Getter Getter da chave (ex: &Artista::getCamarimId); bool vira 0/1
+ *
+ * Como os IDs de cada grupo ficam em ordem crescente, percorrer o grupo
+ * devolve os registros na mesma ordem do vector.
+ */
+template <auto Getter>
+class IndicePorGrupo {
+private:
+    IndiceGrupos grupos;
+
+public:
+    using TipoChave = int;
+
+    template <typename T>
+    static TipoChave chave(const T& registro) {
+        return static_cast<int>((registro.*Getter)());
+    }
+
+    void inserir(TipoChave chave, int id) { grupos.inserir(chave, id); }
+    void remover(TipoChave chave, int id) { grupos.remover(chave, id); }
+
+    /**
+     * @brief IDs do grupo (vazio se não existir)
+     * @return Referência constante: válida até a próxima alteração do repositório
+     */
+    const vector<int>& buscar(int chave) const { return grupos.buscar(chave); }
+};  // Fim da classe IndicePorGrupo
+
+/**
+ * @class IndiceUnico
+ * @brief Chave -> ID de um único registro (ex: item por nome, por código de barras)
+ * @tparam Getter Getter da chave (ex: &Item::getNome)
+ *
+ * Chave com valor padrão (string vazia, 0) não é indexada: "sem código de
+ * barras" não ocupa o índice. A unicidade é regra do gerenciador, que
+ * confere antes de alterar; o índice só guarda o mapeamento.
+ */
+template <auto Getter>
+class IndiceUnico {
+public:
+    using TipoChave = typename TipoDoGetter<decltype(Getter)>::Chave;
+
+private:
+    unordered_map<TipoChave, int> idPorChave;
+
+public:
+    template <typename T>
+    static TipoChave chave(const T& registro) {
+        return (registro.*Getter)();
+    }
+
+    void inserir(const TipoChave& chave, int id) {
+        if (!(chave == TipoChave())) {
+            idPorChave[chave] = id;
+        }
+    }
+
+    void remover(const TipoChave& chave, int id) {
+        auto it = idPorChave.find(chave);
+        if (it != idPorChave.end() && it->second == id) {
+            idPorChave.erase(it);
+        }
+    }
+
+    /**
+     * @brief ID do registro com a chave (0 se nenhum)
+     */
+    int buscar(const TipoChave& chave) const {
+        auto it = idPorChave.find(chave);
+        return it == idPorChave.end() ? 0 : it->second;
+    }
+};  // Fim da classe IndiceUnico
+
+/**
+ * @class IndiceOrdenado
+ * @brief Pares (chave, ID) em ordem: consultas por faixa em O(log n + k)
+ * @tparam Getter Getter da chave (ex: &Pedido::getAtualizadoEm)
+ */
+template <auto Getter>
+class IndiceOrdenado {
+public:
+    using TipoChave = typename TipoDoGetter<decltype(Getter)>::Chave;
+
+private:
+    set<pair<TipoChave, int>> ordem;
+
+public:
+    template <typename T>
+    static TipoChave chave(const T& registro) {
+        return (registro.*Getter)();
+    }
+
+    void inserir(const TipoChave& chave, int id) { ordem.insert({chave, id}); }
+    void remover(const TipoChave& chave, int id) { ordem.erase({chave, id}); }
+
+    /**
+     * @brief IDs com chave em [inicio, fim], em ordem de chave (empate: menor ID)
+     */
+    vector<int> buscarEntre(const TipoChave& inicio, const TipoChave& fim) const {
+        vector<int> ids;
+        if (fim < inicio) {
+            return ids;
+        }
+        for (auto it = ordem.lower_bound({inicio, numeric_limits<int>::min()});
+             it != ordem.end() && !(fim < it->first); ++it) {
+            ids.push_back(it->second);
+        }
+        return ids;
+    }
+};  // Fim da classe IndiceOrdenado
+
+// ==================== Repositório ====================
+
+/**
+ * @class Repositorio
+ * @brief Registros em ordem crescente de ID, índice hash por ID e os índices declarados
+ * @tparam T Registro com getId() (Item, Artista, Camarim, Pedido, ListaCompras, ModeloRider)
+ * @tparam Indices Índices secundários mantidos automaticamente
+ */
+template <typename T, typename... Indices>
+class Repositorio {
+public:
+    static const size_t NAO_ENCONTRADO = static_cast<size_t>(-1);
+
+private:
+    vector<T> registros;                      // Em ordem crescente de ID
+    AlocadorIds ids;                          // IDs dos cadastros (seguro entre threads)
+    unordered_map<int, size_t> posicaoPorId;  // Índice: ID -> posição no vector
+    tuple<Indices...> indices;                // Índices secundários
+
+    using Chaves = tuple<typename Indices::TipoChave...>;
+
+    static Chaves lerChaves(const T& registro) {
+        return Chaves(Indices::chave(registro)...);
+    }
+
+    template <size_t... I>
+    void indexar(const T& registro, index_sequence<I...>) {
+        (get<I>(indices).inserir(Indices::chave(registro), registro.getId()), ...);
+    }
+
+    template <size_t... I>
+    void desindexar(const T& registro, index_sequence<I...>) {
+        (get<I>(indices).remover(Indices::chave(registro), registro.getId()), ...);
+    }
+
+    // Move o registro nos índices cuja chave mudou desde "antes"
+    template <size_t... I>
+    void reindexar(const Chaves& antes, const T& registro, index_sequence<I...>) {
+        int id = registro.getId();
+        auto mover = [&](auto& indice, const auto& chaveAntes) {
+            auto chaveAgora = decay_t<decltype(indice)>::chave(registro);
+            if (!(chaveAgora == chaveAntes)) {
+                indice.remover(chaveAntes, id);
+                indice.inserir(chaveAgora, id);
+            }
+        };
+        (mover(get<I>(indices), get<I>(antes)), ...);
+    }
+
+    // Recalcula posicaoPorId a partir de uma posição (após insert/erase no meio)
+    void reindexarPosicoes(size_t inicio) {
+        for (size_t i = inicio; i < registros.size(); i++) {
+            posicaoPorId[registros[i].getId()] = i;
+        }
+    }
+
+    // Reindexa o registro alterado: concluir() no caminho normal (pode lançar);
+    // se a alteração lançar antes, o destrutor reindexa sem deixar escapar nada
+    struct Reindexacao {
+        Repositorio& repositorio;
+        T& registro;
+        Chaves antes;
+        bool concluida;
+
+        void concluir() {
+            concluida = true;
+            repositorio.reindexar(antes, registro, index_sequence_for<Indices...>());
+        }
+
+        ~Reindexacao() noexcept {
+            if (!concluida) {
+                try {
+                    repositorio.reindexar(antes, registro, index_sequence_for<Indices...>());
+                } catch (...) {
+                    // Já há uma exceção a caminho (a da alteração): ela é a que importa
+                }
+            }
+        }
+    };
+
+public:
+    Repositorio() {}
+
+    /**
+     * @brief ID que o próximo cadastro deve usar (se nenhuma outra thread alocar antes)
+     */
+    int getProximoId() const { return ids.getLimite(); }
+
+    /**
+     * @brief Alocador compartilhado: threads pegam blocos de IDs dele
+     *
+     * Registros montados com esses IDs entram depois por inserir() (ou pelo
+     * restaurar() do gerenciador), sob a trava de quem grava.
+     */
+    AlocadorIds& getAlocadorIds() { return ids; }
+
+    /**
+     * @brief Cadastra um registro com um ID novo
+     * @param fabrica Monta o registro a partir do ID; se lançar, o ID é devolvido
+     * @param bloco Bloco de IDs da thread que cadastra (nullptr = ID avulso do alocador)
+     * @return Referência ao registro guardado
+     */
+    template <typename F>
+    T& cadastrar(F&& fabrica, AlocadorIds::Bloco* bloco = nullptr) {
+        int id = bloco != nullptr ? bloco->alocar() : ids.alocar();
+        try {
+            return inserir(fabrica(id));
+        } catch (...) {
+            // Sem lacuna se ninguém alocou depois (no bloco: se for o último dele)
+            if (bloco != nullptr) {
+                bloco->devolver(id);
+            } else {
+                ids.devolver(id);
+            }
+            throw;
+        }
+    }
+
+    /**
+     * @brief Guarda o registro e indexa (o ID ainda não pode existir)
+     * @return Referência ao registro guardado (válida até a próxima inserção/remoção)
+     *
+     * ID maior que todos (cadastro): anexa no fim, O(1). ID menor (desfazer
+     * uma remoção): volta para a posição do seu ID, mantendo a ordem.
+     */
+    T& inserir(T registro) {
+        int id = registro.getId();
+        size_t posicao = registros.size();
+        if (!registros.empty() && id < registros.back().getId()) {
+            auto pos = lower_bound(registros.begin(), registros.end(), id,
+                                   [](const T& r, int valor) { return r.getId() < valor; });
+            posicao = pos - registros.begin();
+            registros.insert(pos, move(registro));
+            reindexarPosicoes(posicao);  // Registros seguintes avançaram uma posição
+        } else {
+            registros.push_back(move(registro));
+            posicaoPorId[id] = posicao;
+        }
+        indexar(registros[posicao], index_sequence_for<Indices...>());
+        ids.observar(id);  // IDs restaurados ou carregados nunca voltam a ser entregues
+        return registros[posicao];
+    }
+
+    /**
+     * @brief Remove o registro do ID
+     * @param removido Se não for nullptr, recebe o registro removido
+     * @return false se o ID não existe
+     */
+    bool remover(int id, T* removido = nullptr) {
+        auto it = posicaoPorId.find(id);
+        if (it == posicaoPorId.end()) {
+            return false;
+        }
+        size_t posicao = it->second;
+        desindexar(registros[posicao], index_sequence_for<Indices...>());
+        posicaoPorId.erase(it);
+        if (removido != nullptr) {
+            *removido = move(registros[posicao]);
+        }
+        registros.erase(registros.begin() + posicao);  // Preserva a ordem
+        reindexarPosicoes(posicao);  // Registros seguintes recuaram uma posição
+        return true;
+    }
+
+    /**
+     * @brief Aplica uma alteração ao registro mantendo os índices
+     * @param alteracao Função que recebe T& (seu retorno é devolvido)
+     *
+     * Ex: repositorio.alterar(*artista, [&](Artista& a) { a.setCamarimId(3); });
+     */
+    template <typename F>
+    decltype(auto) alterar(T& registro, F&& alteracao) {
+        Reindexacao reindexacao{*this, registro, lerChaves(registro), false};
+        if constexpr (is_void_v<invoke_result_t<F&, T&>>) {
+            alteracao(registro);
+            reindexacao.concluir();
+        } else {
+            decltype(auto) resultado = alteracao(registro);
+            reindexacao.concluir();
+            return resultado;
+        }
+    }
+
+    // ===== Leitura =====
+
+    T* buscar(int id) {
+        auto it = posicaoPorId.find(id);
+        return it == posicaoPorId.end() ? nullptr : &registros[it->second];
+    }
+
+    const T* buscar(int id) const {
+        auto it = posicaoPorId.find(id);
+        return it == posicaoPorId.end() ? nullptr : &registros[it->second];
+    }
+
+    /**
+     * @brief Posição do ID no vector (NAO_ENCONTRADO se não existe)
+     */
+    size_t posicaoDe(int id) const {
+        auto it = posicaoPorId.find(id);
+        return it == posicaoPorId.end() ? NAO_ENCONTRADO : it->second;
+    }
+
+    T& naPosicao(size_t posicao) { return registros[posicao]; }
+    const T& naPosicao(size_t posicao) const { return registros[posicao]; }
+
+    /**
+     * @brief Posições dos IDs informados (ex: um grupo de índice), para Consulta::executar
+     */
+    vector<size_t> posicoesDe(const vector<int>& ids) const {
+        vector<size_t> posicoes;
+        posicoes.reserve(ids.size());
+        for (int id : ids) {
+            posicoes.push_back(posicaoPorId.at(id));
+        }
+        return posicoes;
+    }
+
+    /**
+     * @brief Cópias dos registros dos IDs informados, na ordem dos IDs
+     */
+    vector<T> registrosDe(const vector<int>& ids) const {
+        vector<T> resultado;
+        resultado.reserve(ids.size());
+        for (int id : ids) {
+            resultado.push_back(registros[posicaoPorId.at(id)]);
+        }
+        return resultado;
+    }
+
+    /**
+     * @brief Todos os registros, em ordem de ID (sem cópia)
+     */
+    const vector<T>& todos() const { return registros; }
+
+    size_t tamanho() const { return registros.size(); }
+
+    /**
+     * @brief Índice secundário declarado no template (ex: indice<IndiceUnico<&Item::getNome>>())
+     */
+    template <typename I>
+    const I& indice() const { return get<I>(indices); }
+};  // Fim da classe Repositorio
+
+#endif // REPOSITORIO_H
+// Fim do include guard
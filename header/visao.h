@@ -0,0 +1,95 @@
+/**
+ * @file visao.h
+ * @brief Visão consolidada de camarins (quadro de bastidores)
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ *
+ * Junta em uma única estrutura tudo o que se sabe sobre um camarim:
+ * o próprio camarim, seus artistas, pedidos pendentes e atendidos e o
+ * conteúdo atual com preços do catálogo.
+ *
+ * Antes eram quatro chamadas separadas (buscarPorId, buscarPorCamarim de
+ * artistas e de pedidos e uma busca de item por conteúdo), cada uma com
+ * varredura linear. Agora cada parte vem de um índice (hash por ID,
+ * agrupamento por camarim), com custo proporcional ao tamanho do camarim.
+ */
+
+// Proteção contra inclusão múltipla
+#ifndef VISAO_H  // Se VISAO_H não foi definido
+#define VISAO_H  // Define VISAO_H
+
+#include <string>  // Para trabalhar com strings
+#include <vector>  // Para listas de artistas, pedidos e conteúdo
+
+#include "item.h"     // GerenciadorItens (preços)
+#include "artista.h"  // GerenciadorArtistas
+#include "camarim.h"  // GerenciadorCamarins
+#include "pedido.h"   // GerenciadorPedidos
+
+using namespace std;
+
+/**
+ * @struct ConteudoCamarim
+ * @brief Um item presente no camarim, com preço resolvido no catálogo
+ */
+struct ConteudoCamarim {
+    int itemId;            // ID do item
+    string nomeItem;       // Nome (do catálogo, se o item ainda existe)
+    int quantidade;        // Quantidade no camarim
+    double precoUnitario;  // Preço atual do catálogo (0 se removido do catálogo)
+    double subtotal;       // quantidade * precoUnitario
+    bool noCatalogo;       // false = item foi removido do catálogo
+};
+
+/**
+ * @struct VisaoCamarim
+ * @brief Tudo sobre um camarim em uma única estrutura
+ */
+struct VisaoCamarim {
+    Camarim camarim;                   // Cópia do camarim
+    vector<Artista> artistas;          // Artistas alocados no camarim
+    vector<Pedido> pendentes;          // Pedidos ainda não atendidos
+    vector<Pedido> atendidos;          // Pedidos já atendidos
+    vector<ConteudoCamarim> conteudo;  // Itens presentes no camarim
+    int unidades = 0;                  // Soma das quantidades do conteúdo
+    int unidadesPendentes = 0;         // Soma das quantidades dos pedidos pendentes
+    double valorConteudo = 0.0;        // Soma dos subtotais do conteúdo
+
+    /**
+     * @brief Exibe a visão completa formatada
+     */
+    string exibir() const;
+};
+
+/**
+ * @brief Monta a visão de um camarim
+ * @param camarimId ID do camarim
+ * @return Visão completa (artistas, pedidos e conteúdo com preços)
+ * @throws CamarimException se o camarim não existe
+ */
+VisaoCamarim montarVisaoCamarim(int camarimId,
+                                const GerenciadorCamarins& camarins,
+                                const GerenciadorArtistas& artistas,
+                                const GerenciadorPedidos& pedidos,
+                                const GerenciadorItens& itens);
+
+/**
+ * @brief Monta a visão de TODOS os camarins (quadro de bastidores)
+ * @return Uma visão por camarim, em ordem de cadastro
+ *
+ * Cada artista e cada pedido é visitado uma única vez (através do índice
+ * por camarim); artistas/pedidos de camarins inexistentes são ignorados.
+ */
+vector<VisaoCamarim> montarQuadroBastidores(const GerenciadorCamarins& camarins,
+                                            const GerenciadorArtistas& artistas,
+                                            const GerenciadorPedidos& pedidos,
+                                            const GerenciadorItens& itens);
+
+/**
+ * @brief Tabela resumida do quadro (uma linha por camarim)
+ */
+string exibirQuadroBastidores(const vector<VisaoCamarim>& quadro);
+
+#endif // VISAO_H
+// Fim do include guard
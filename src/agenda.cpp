@@ -0,0 +1,275 @@
+/**
+ * @file agenda.cpp
+ * @brief Implementação da AgendaCamarins (reservas por horário)
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ */
+
+// Inclui o header com as declarações
+#include "agenda.h"
+// Para sort
+#include <algorithm>
+
+// ==================== Struct Reserva ====================
+
+bool Reserva::sobrepoe(long long inicio, long long fim) const {
+    return this->inicio < fim && inicio < this->fim;
+}
+
+// Períodos vazios ou invertidos não fazem sentido em nenhuma operação
+static void validarPeriodo(long long inicio, long long fim) {
+    if (fim <= inicio) {
+        throw ValidacaoException("Fim do período deve ser depois do início");
+    }
+}
+
+// ==================== Classe AgendaCamarins ====================
+
+AgendaCamarins::AgendaCamarins() {}
+
+AlocadorIds& AgendaCamarins::getAlocadorIds() {
+    return ids;
+}
+
+/**
+ * Destrutor - sai da lista de observadores dos gerenciadores
+ */
+AgendaCamarins::~AgendaCamarins() {
+    desconectar();
+}
+
+/**
+ * Conecta aos gerenciadores e abre uma agenda vazia para cada camarim
+ */
+void AgendaCamarins::conectar(GerenciadorArtistas& artistas, GerenciadorCamarins& camarins) {
+    desconectar();
+    reservas.clear();
+    porCamarim.clear();
+    porArtista.clear();
+
+    for (const Camarim& c : camarins.listar()) {
+        porCamarim[c.getId()];  // Camarim existente, ainda sem reservas
+    }
+
+    this->artistas = &artistas;
+    this->camarins = &camarins;
+    artistas.adicionarObservador(this);
+    camarins.adicionarObservador(this);
+}
+
+/**
+ * Desconecta dos gerenciadores (sem efeito se não conectado)
+ */
+void AgendaCamarins::desconectar() {
+    if (artistas) artistas->removerObservador(this);
+    if (camarins) camarins->removerObservador(this);
+    artistas = nullptr;
+    camarins = nullptr;
+}
+
+// ==================== Reservas ====================
+
+/**
+ * Vizinho anterior ao fim: único candidato a conflito em intervalos disjuntos
+ */
+const Reserva* AgendaCamarins::conflito(const map<long long, int>& agenda, long long inicio,
+                                        long long fim) const {
+    auto it = agenda.lower_bound(fim);  // Primeira reserva que começa em 'fim' ou depois
+    if (it == agenda.begin()) {
+        return nullptr;  // Todas começam depois do período
+    }
+    --it;  // Última reserva que começa antes de 'fim'
+    const Reserva& r = reservas.at(it->second);
+    return r.fim > inicio ? &r : nullptr;
+}
+
+/**
+ * Cria reserva verificando conflitos do camarim e do artista
+ */
+int AgendaCamarins::reservar(int camarimId, int artistaId, long long inicio, long long fim,
+                             AlocadorIds::Bloco* bloco) {
+    validarPeriodo(inicio, fim);
+
+    auto sala = porCamarim.find(camarimId);
+    if (sala == porCamarim.end()) {
+        throw CamarimException("Camarim com ID " + to_string(camarimId) + " não encontrado");
+    }
+    if (artistas == nullptr || artistas->buscarPorId(artistaId) == nullptr) {
+        throw ArtistaException("Artista com ID " + to_string(artistaId) + " não encontrado");
+    }
+
+    const Reserva* ocupada = conflito(sala->second, inicio, fim);
+    if (ocupada) {
+        throw CamarimException("Camarim " + to_string(camarimId) + " já reservado neste horário (reserva "
+                               + to_string(ocupada->id) + ", artista " + to_string(ocupada->artistaId) + ")");
+    }
+    auto agendaArtista = porArtista.find(artistaId);
+    if (agendaArtista != porArtista.end()) {
+        const Reserva* ocupado = conflito(agendaArtista->second, inicio, fim);
+        if (ocupado) {
+            throw ArtistaException("Artista " + to_string(artistaId) + " já tem reserva neste horário (reserva "
+                                   + to_string(ocupado->id) + ", camarim " + to_string(ocupado->camarimId) + ")");
+        }
+    }
+
+    int id = bloco != nullptr ? bloco->alocar() : ids.alocar();
+    Reserva reserva;
+    reserva.id = id;
+    reserva.camarimId = camarimId;
+    reserva.artistaId = artistaId;
+    reserva.inicio = inicio;
+    reserva.fim = fim;
+    reservas[id] = reserva;
+    sala->second[inicio] = id;
+    porArtista[artistaId][inicio] = id;
+    return id;
+}
+
+/**
+ * Cancela reserva retirando-a das duas agendas
+ */
+bool AgendaCamarins::cancelar(int reservaId) {
+    auto it = reservas.find(reservaId);
+    if (it == reservas.end()) {
+        return false;
+    }
+    const Reserva& r = it->second;
+
+    auto sala = porCamarim.find(r.camarimId);
+    if (sala != porCamarim.end()) {
+        sala->second.erase(r.inicio);
+    }
+    auto agendaArtista = porArtista.find(r.artistaId);
+    if (agendaArtista != porArtista.end()) {
+        agendaArtista->second.erase(r.inicio);
+        if (agendaArtista->second.empty()) {
+            porArtista.erase(agendaArtista);
+        }
+    }
+    reservas.erase(it);
+    return true;
+}
+
+void AgendaCamarins::cancelarTodas(const map<long long, int>& agenda) {
+    vector<int> ids;  // Cópia: cancelar() altera a própria agenda
+    for (const auto& par : agenda) {
+        ids.push_back(par.second);
+    }
+    for (int id : ids) {
+        cancelar(id);
+    }
+}
+
+// ==================== Consultas ====================
+
+const Reserva* AgendaCamarins::buscarPorId(int reservaId) const {
+    auto it = reservas.find(reservaId);
+    return it == reservas.end() ? nullptr : &it->second;
+}
+
+/**
+ * Quem está no camarim no instante: O(log n)
+ */
+const Reserva* AgendaCamarins::ocupante(int camarimId, long long instante) const {
+    auto sala = porCamarim.find(camarimId);
+    if (sala == porCamarim.end()) {
+        return nullptr;
+    }
+    return conflito(sala->second, instante, instante + 1);
+}
+
+bool AgendaCamarins::livre(int camarimId, long long inicio, long long fim) const {
+    validarPeriodo(inicio, fim);
+    auto sala = porCamarim.find(camarimId);
+    return sala != porCamarim.end() && conflito(sala->second, inicio, fim) == nullptr;
+}
+
+/**
+ * Camarins livres no período: um teste O(log n) por camarim
+ */
+vector<int> AgendaCamarins::camarinsLivres(long long inicio, long long fim) const {
+    validarPeriodo(inicio, fim);
+    vector<int> livres;
+    for (const auto& sala : porCamarim) {  // map: já em ordem de ID
+        if (conflito(sala.second, inicio, fim) == nullptr) {
+            livres.push_back(sala.first);
+        }
+    }
+    return livres;
+}
+
+/**
+ * Reservas do camarim no período: O(log n + k)
+ */
+vector<Reserva> AgendaCamarins::agendaDoCamarim(int camarimId, long long inicio, long long fim) const {
+    validarPeriodo(inicio, fim);
+    vector<Reserva> resultado;
+    auto sala = porCamarim.find(camarimId);
+    if (sala == porCamarim.end()) {
+        return resultado;
+    }
+
+    // Começa pela reserva que pode ter iniciado antes do período e ainda estar em andamento
+    const map<long long, int>& agenda = sala->second;
+    auto it = agenda.lower_bound(inicio);
+    if (it != agenda.begin() && reservas.at(prev(it)->second).fim > inicio) {
+        --it;
+    }
+    for (; it != agenda.end() && it->first < fim; ++it) {
+        resultado.push_back(reservas.at(it->second));
+    }
+    return resultado;
+}
+
+vector<Reserva> AgendaCamarins::agendaDoArtista(int artistaId) const {
+    vector<Reserva> resultado;
+    auto agenda = porArtista.find(artistaId);
+    if (agenda != porArtista.end()) {
+        for (const auto& par : agenda->second) {
+            resultado.push_back(reservas.at(par.second));
+        }
+    }
+    return resultado;
+}
+
+vector<Reserva> AgendaCamarins::listar() const {
+    vector<Reserva> resultado;
+    resultado.reserve(reservas.size());
+    for (const auto& par : reservas) {
+        resultado.push_back(par.second);
+    }
+    sort(resultado.begin(), resultado.end(), [](const Reserva& a, const Reserva& b) { return a.id < b.id; });
+    return resultado;
+}
+
+// ==================== Avisos dos gerenciadores ====================
+
+void AgendaCamarins::aoMudarArtista(const Artista* antes, const Artista* depois) {
+    if (depois == nullptr) {
+        // Artista removido: suas reservas deixam de valer
+        auto agenda = porArtista.find(antes->getId());
+        if (agenda != porArtista.end()) {
+            cancelarTodas(agenda->second);  // Último cancelamento apaga a entrada do artista
+            artistas->avisarDescarte(
+                DescarteDependentes{TipoEntidade::ARTISTA, antes->getId(), "reservas do artista descartadas"});
+        }
+    }
+}
+
+void AgendaCamarins::aoMudarCamarim(const Camarim* antes, const Camarim* depois) {
+    if (antes == nullptr) {
+        porCamarim[depois->getId()];  // Novo camarim: agenda vazia
+    } else if (depois == nullptr) {
+        auto sala = porCamarim.find(antes->getId());
+        if (sala != porCamarim.end()) {
+            bool tinhaReservas = !sala->second.empty();
+            cancelarTodas(sala->second);
+            porCamarim.erase(sala);
+            if (tinhaReservas) {
+                camarins->avisarDescarte(
+                    DescarteDependentes{TipoEntidade::CAMARIM, antes->getId(), "reservas do camarim descartadas"});
+            }
+        }
+    }
+}
@@ -0,0 +1,208 @@
+/**
+ * @file alocacao.cpp
+ * @brief Implementação do AlocadorCamarins (método húngaro + gravação atômica)
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ */
+
+// Inclui o header com as declarações
+#include "alocacao.h"
+// Para llround
+#include <cmath>
+// Para numeric_limits
+#include <limits>
+// Para conjuntos de IDs (validação)
+#include <unordered_set>
+
+// Custos em centímetros (inteiros: o método húngaro fica exato)
+static const long long SEM_CAMARIM = 1000000000000LL;     // Artista não alocado: > soma de custos reais
+static const long long PROIBIDO = 1000000000000000LL;     // Par incompatível: nunca preferível a SEM_CAMARIM
+static const double PESO_SOBRA = 1.0;                     // Metros equivalentes a um lugar sobrando
+
+/**
+ * Custo do par em centímetros (-1 = incompatível)
+ */
+long long AlocadorCamarins::custo(const RequisitoArtista& artista, const PerfilCamarim& camarim) {
+    if (camarim.capacidade < artista.integrantes) {
+        return -1;  // Não cabe
+    }
+    if (artista.distanciaMaxima > 0.0 && camarim.distanciaPalco > artista.distanciaMaxima) {
+        return -1;  // Longe demais do palco
+    }
+    double metros = camarim.distanciaPalco + PESO_SOBRA * (camarim.capacidade - artista.integrantes);
+    return llround(metros * 100.0);
+}
+
+/**
+ * Monta a matriz de custos e resolve o emparelhamento de custo mínimo
+ */
+ResultadoAlocacao AlocadorCamarins::resolver(const vector<RequisitoArtista>& artistas,
+                                             const vector<PerfilCamarim>& camarins,
+                                             const AgendaCamarins* agenda, long long inicio, long long fim) {
+    // ===== Validação =====
+    unordered_set<int> vistos;
+    for (const RequisitoArtista& a : artistas) {
+        if (!vistos.insert(a.artistaId).second) {
+            throw ValidacaoException("Artista repetido na alocação: " + to_string(a.artistaId));
+        }
+        if (a.integrantes <= 0) {
+            throw ValidacaoException("Integrantes deve ser maior que zero");
+        }
+        if (a.distanciaMaxima < 0.0) {
+            throw ValidacaoException("Capacidade e distâncias não podem ser negativas");
+        }
+    }
+    vistos.clear();
+    for (const PerfilCamarim& c : camarins) {
+        if (!vistos.insert(c.camarimId).second) {
+            throw ValidacaoException("Camarim repetido na alocação: " + to_string(c.camarimId));
+        }
+        if (c.capacidade < 0 || c.distanciaPalco < 0.0) {
+            throw ValidacaoException("Capacidade e distâncias não podem ser negativas");
+        }
+    }
+
+    int n = static_cast<int>(artistas.size());
+    int m = static_cast<int>(camarins.size());
+    int colunas = m + n;  // m camarins reais + n colunas "sem camarim"
+
+    // ===== Restrição de horário: dono das reservas de cada camarim no período =====
+    // -1 = livre | > 0 = reservado só para esse artista | 0 = reservado para vários
+    vector<int> dono(m, -1);
+    if (agenda) {
+        for (int j = 0; j < m; j++) {
+            for (const Reserva& r : agenda->agendaDoCamarim(camarins[j].camarimId, inicio, fim)) {
+                dono[j] = (dono[j] == -1 || dono[j] == r.artistaId) ? r.artistaId : 0;
+            }
+        }
+    }
+
+    // ===== Matriz de custos (linha = artista, 1-indexada como no método clássico) =====
+    vector<vector<long long>> a(n + 1, vector<long long>(colunas + 1, SEM_CAMARIM));
+    for (int i = 1; i <= n; i++) {
+        for (int j = 1; j <= m; j++) {
+            long long c = custo(artistas[i - 1], camarins[j - 1]);
+            bool ocupado = dono[j - 1] != -1 && dono[j - 1] != artistas[i - 1].artistaId;
+            a[i][j] = (c < 0 || ocupado) ? PROIBIDO : c;
+        }
+    }
+
+    // ===== Método húngaro com potenciais: O(n² · colunas) =====
+    // u/v = potenciais das linhas/colunas | p[j] = linha emparelhada com a coluna j
+    const long long INF = numeric_limits<long long>::max() / 4;
+    vector<long long> u(n + 1, 0), v(colunas + 1, 0);
+    vector<int> p(colunas + 1, 0), caminho(colunas + 1, 0);
+    for (int i = 1; i <= n; i++) {
+        p[0] = i;
+        int j0 = 0;
+        vector<long long> menor(colunas + 1, INF);
+        vector<bool> usada(colunas + 1, false);
+        do {
+            // Expande a árvore alternante pela coluna de menor custo reduzido
+            usada[j0] = true;
+            int i0 = p[j0];
+            int j1 = 0;
+            long long delta = INF;
+            for (int j = 1; j <= colunas; j++) {
+                if (usada[j]) continue;
+                long long reduzido = a[i0][j] - u[i0] - v[j];
+                if (reduzido < menor[j]) {
+                    menor[j] = reduzido;
+                    caminho[j] = j0;
+                }
+                if (menor[j] < delta) {
+                    delta = menor[j];
+                    j1 = j;
+                }
+            }
+            for (int j = 0; j <= colunas; j++) {
+                if (usada[j]) {
+                    u[p[j]] += delta;
+                    v[j] -= delta;
+                } else {
+                    menor[j] -= delta;
+                }
+            }
+            j0 = j1;
+        } while (p[j0] != 0);  // Achou coluna livre: caminho aumentante completo
+        do {
+            // Inverte o caminho aumentante
+            int j1 = caminho[j0];
+            p[j0] = p[j1];
+            j0 = j1;
+        } while (j0 != 0);
+    }
+
+    // ===== Resultado =====
+    vector<int> colunaDoArtista(n + 1, 0);
+    for (int j = 1; j <= colunas; j++) {
+        if (p[j] != 0) {
+            colunaDoArtista[p[j]] = j;
+        }
+    }
+    ResultadoAlocacao resultado;
+    vector<bool> camarimUsado(m, false);
+    long long centimetros = 0;
+    for (int i = 1; i <= n; i++) {
+        int j = colunaDoArtista[i];
+        if (j >= 1 && j <= m && a[i][j] < SEM_CAMARIM) {
+            resultado.pares.push_back(make_pair(artistas[i - 1].artistaId, camarins[j - 1].camarimId));
+            camarimUsado[j - 1] = true;
+            centimetros += a[i][j];
+        } else {
+            resultado.artistasSemCamarim.push_back(artistas[i - 1].artistaId);
+        }
+    }
+    for (int j = 0; j < m; j++) {
+        if (!camarimUsado[j]) {
+            resultado.camarinsSemArtista.push_back(camarins[j].camarimId);
+        }
+    }
+    resultado.custoTotal = centimetros / 100.0;
+    return resultado;
+}
+
+/**
+ * Grava a alocação; tudo é conferido ANTES da primeira escrita, então uma
+ * alocação inválida não chega aos observadores nem ao histórico
+ */
+void AlocadorCamarins::aplicar(const ResultadoAlocacao& resultado, GerenciadorArtistas& artistas,
+                               GerenciadorCamarins& camarins) {
+    // Escritas na ordem em que serão feitas: (ID, novo vínculo)
+    vector<pair<int, int>> escritasArtistas;
+    vector<pair<int, int>> escritasCamarins;
+    for (const auto& par : resultado.pares) {
+        escritasArtistas.push_back(par);
+        escritasCamarins.push_back({par.second, par.first});
+    }
+    for (int id : resultado.artistasSemCamarim) {
+        escritasArtistas.push_back({id, 0});
+    }
+    for (int id : resultado.camarinsSemArtista) {
+        escritasCamarins.push_back({id, 0});
+    }
+
+    // 1) Validação: as mesmas regras de atualizar(), sem escrever nada
+    for (const auto& escrita : escritasArtistas) {
+        if (artistas.buscarPorId(escrita.first) == nullptr) {
+            throw ArtistaException("Artista com ID " + to_string(escrita.first) + " não encontrado");
+        }
+        if (escrita.second < 0) {
+            throw ValidacaoException("ID de camarim inválido");
+        }
+    }
+    for (const auto& escrita : escritasCamarins) {
+        if (camarins.buscarPorId(escrita.first) == nullptr) {
+            throw CamarimException("Camarim com ID " + to_string(escrita.first) + " não encontrado");
+        }
+    }
+
+    // 2) Gravação: cada entidade existe e os valores são válidos, então nada mais falha
+    for (const auto& escrita : escritasArtistas) {
+        artistas.atualizar(escrita.first, artistas.buscarPorId(escrita.first)->getNome(), escrita.second);
+    }
+    for (const auto& escrita : escritasCamarins) {
+        camarins.atualizar(escrita.first, camarins.buscarPorId(escrita.first)->getNome(), escrita.second);
+    }
+}
@@ -0,0 +1,450 @@
+/**
+ * @file arquivo.cpp
+ * @brief Implementação do ArquivoPedidos (colunas delta/varint + dicionários + nomes pelo catálogo)
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ */
+
+// Inclui o header com as declarações
+#include "arquivo.h"
+// Para min, max
+#include <algorithm>
+// Para move
+#include <utility>
+// Para hash de string_view (tabela dos dicionários)
+#include <string_view>
+#include <functional>
+// Para INT_MAX, INT_MIN
+#include <climits>
+
+// ==================== Codificação ====================
+
+// Varint: 7 bits por byte, bit alto = "continua no próximo byte"
+static void escreverVarint(vector<uint8_t>& coluna, uint64_t valor) {
+    while (valor >= 0x80) {
+        coluna.push_back(static_cast<uint8_t>(valor) | 0x80);
+        valor >>= 7;
+    }
+    coluna.push_back(static_cast<uint8_t>(valor));
+}
+
+static uint64_t lerVarint(const vector<uint8_t>& coluna, size_t& posicao) {
+    uint64_t valor = 0;
+    for (int deslocamento = 0;; deslocamento += 7) {
+        uint8_t byte = coluna[posicao++];
+        valor |= static_cast<uint64_t>(byte & 0x7F) << deslocamento;
+        if ((byte & 0x80) == 0) {
+            return valor;
+        }
+    }
+}
+
+// Zigzag: inteiros pequenos de qualquer sinal viram varints pequenos
+static uint64_t zigzag(long long valor) {
+    return (static_cast<uint64_t>(valor) << 1) ^ static_cast<uint64_t>(valor >> 63);
+}
+
+// Avança um varint sem decodificá-lo
+static void pularVarint(const vector<uint8_t>& coluna, size_t& posicao) {
+    while (coluna[posicao++] & 0x80) {
+    }
+}
+
+static long long desfazerZigzag(uint64_t valor) {
+    return static_cast<long long>(valor >> 1) ^ -static_cast<long long>(valor & 1);
+}
+
+// Delta com aritmética sem sinal: não transborda nem com instantes extremos
+static uint64_t delta(long long atual, long long anterior) {
+    return zigzag(static_cast<long long>(static_cast<uint64_t>(atual) - static_cast<uint64_t>(anterior)));
+}
+
+static long long somarDelta(long long anterior, uint64_t codificado) {
+    return static_cast<long long>(static_cast<uint64_t>(anterior) +
+                                  static_cast<uint64_t>(desfazerZigzag(codificado)));
+}
+
+// Bytes no heap de uma string (libstdc++: até 15 caracteres ficam dentro do objeto)
+static size_t bytesNoHeap(const string& texto) {
+    return texto.size() > 15 ? texto.size() + 1 : 0;
+}
+
+/**
+ * Estimativa do pedido como objeto: Pedido + string do artista + bloco do
+ * shared_ptr com o map + um nó de árvore (3 ponteiros e cor) por linha
+ */
+static size_t estimarBytes(const Pedido& pedido) {
+    size_t bytes = sizeof(Pedido) + bytesNoHeap(pedido.getNomeArtista());
+    const map<int, ItemPedido>& itens = pedido.getItens();
+    if (!itens.empty()) {
+        bytes += sizeof(map<int, ItemPedido>) + 2 * sizeof(long);  // Contadores do shared_ptr
+    }
+    for (const auto& par : itens) {
+        bytes += sizeof(pair<const int, ItemPedido>) + 4 * sizeof(void*) + bytesNoHeap(par.second.nomeItem);
+    }
+    return bytes;
+}
+
+// ==================== Dicionário ====================
+
+uint32_t ArquivoPedidos::Dicionario::indiceDe(const string& nome) {
+    hash<string_view> espalhar;
+    if (tabela.size() < 2 * inicios.size()) {
+        // Carga acima de 1/2: dobra a tabela e reinsere os índices existentes
+        vector<uint32_t> nova(max<size_t>(16, tabela.size() * 2), 0);
+        size_t mascara = nova.size() - 1;
+        for (uint32_t i = 0; i < tamanho(); i++) {
+            size_t posicao = espalhar(string_view(texto).substr(inicios[i], inicios[i + 1] - inicios[i])) & mascara;
+            while (nova[posicao] != 0) {
+                posicao = (posicao + 1) & mascara;
+            }
+            nova[posicao] = i + 1;
+        }
+        tabela.swap(nova);
+    }
+
+    size_t mascara = tabela.size() - 1;
+    string_view procurado(nome);
+    for (size_t posicao = espalhar(procurado) & mascara;; posicao = (posicao + 1) & mascara) {
+        if (tabela[posicao] == 0) {  // Nome novo: vai para o fim do texto
+            uint32_t novo = static_cast<uint32_t>(tamanho());
+            texto += nome;
+            inicios.push_back(static_cast<uint32_t>(texto.size()));
+            tabela[posicao] = novo + 1;
+            return novo;
+        }
+        uint32_t i = tabela[posicao] - 1;
+        if (string_view(texto).substr(inicios[i], inicios[i + 1] - inicios[i]) == procurado) {
+            return i;
+        }
+    }
+}
+
+string ArquivoPedidos::Dicionario::nome(uint32_t indice) const {
+    return texto.substr(inicios[indice], inicios[indice + 1] - inicios[indice]);
+}
+
+size_t ArquivoPedidos::Dicionario::bytes() const {
+    return texto.size() + (inicios.size() + tabela.size()) * sizeof(uint32_t);
+}
+
+// ==================== ArquivoPedidos ====================
+
+ArquivoPedidos::ArquivoPedidos(size_t tamanhoBloco)
+    : menorItem(INT_MAX), maiorItem(INT_MIN), menorCamarim(INT_MAX), maiorCamarim(INT_MIN),
+      totalLinhas(0), tamanhoBloco(max<size_t>(1, tamanhoBloco)), bytesEstimados(0) {}
+
+/**
+ * Destrutor - sai da lista de observadores do catálogo (os nomes não serão mais lidos)
+ */
+ArquivoPedidos::~ArquivoPedidos() {
+    if (catalogo) catalogo->removerObservador(this);
+}
+
+void ArquivoPedidos::conectar(GerenciadorItens& itens) {
+    desconectar();
+    catalogo = &itens;
+    itens.adicionarObservador(this);
+}
+
+void ArquivoPedidos::desconectar() {
+    if (catalogo == nullptr) {
+        return;
+    }
+    // Sem avisos daqui em diante: congela o nome atual de cada item já arquivado
+    for (const Item& item : catalogo->listar()) {
+        guardarNomeAnterior(item.getId(), item.getNome());
+    }
+    catalogo->removerObservador(this);
+    catalogo = nullptr;
+}
+
+// ==================== Nomes pelo catálogo ====================
+
+void ArquivoPedidos::guardarNomeAnterior(int itemId, const string& nome) {
+    if (totalLinhas == 0 || itemId < menorItem || itemId > maiorItem) {
+        return;  // Nenhuma linha arquivada pode ter vindo do catálogo com este ID
+    }
+    vector<pair<size_t, uint32_t>>& anteriores = nomesAnteriores[itemId];
+    if (!anteriores.empty() && anteriores.back().first == fim.pedido) {
+        return;  // Mudou de novo sem arquivamento no meio: vale o nome já guardado
+    }
+    anteriores.emplace_back(fim.pedido, nomesItens.indiceDe(nome));
+}
+
+string ArquivoPedidos::nomeDoCatalogo(int itemId, size_t pedido) const {
+    auto encontrado = nomesAnteriores.find(itemId);
+    if (encontrado != nomesAnteriores.end()) {
+        for (const auto& anterior : encontrado->second) {  // Limites crescentes: o primeiro que cobre
+            if (pedido < anterior.first) {
+                return nomesItens.nome(anterior.second);
+            }
+        }
+    }
+    // Sem mudança desde o arquivamento: o item segue no catálogo com o mesmo nome
+    return catalogo->buscarPorId(itemId)->getNome();
+}
+
+void ArquivoPedidos::aoMudarItem(const Item* antes, const Item* depois) {
+    // Renomeado ou removido: o nome sai do catálogo, mas os pedidos arquivados ainda o usam
+    if (antes != nullptr && (depois == nullptr || depois->getNome() != antes->getNome())) {
+        guardarNomeAnterior(antes->getId(), antes->getNome());
+    }
+}
+
+void ArquivoPedidos::arquivar(const Pedido& pedido) {
+    int id = pedido.getId();
+    if (fim.pedido % tamanhoBloco == 0) {
+        blocos.push_back(Bloco{fim, id, id});  // Novo ponto de partida
+    } else {
+        blocos.back().menorId = min(blocos.back().menorId, id);
+        blocos.back().maiorId = max(blocos.back().maiorId, id);
+    }
+
+    escreverVarint(colunaIds, zigzag(static_cast<long long>(id) - fim.idAnterior));
+    escreverVarint(colunaCamarins, zigzag(pedido.getCamarimId()));
+    escreverVarint(colunaArtistas, artistas.indiceDe(pedido.getNomeArtista()));
+    menorCamarim = min(menorCamarim, pedido.getCamarimId());
+    maiorCamarim = max(maiorCamarim, pedido.getCamarimId());
+    escreverVarint(colunaCriados, delta(pedido.getCriadoEm(), fim.criadoAnterior));
+    escreverVarint(colunaAtualizados, delta(pedido.getAtualizadoEm(), pedido.getCriadoEm()));
+    colunaAtendidos.push_back(pedido.isAtendido());
+
+    const map<int, ItemPedido>& itens = pedido.getItens();
+    escreverVarint(colunaLinhas, itens.size());
+    int itemAnterior = 0;
+    for (const auto& par : itens) {  // map: IDs de item crescentes, deltas pequenos
+        escreverVarint(colunaItens, zigzag(static_cast<long long>(par.first) - itemAnterior));
+        // Nome igual ao do catálogo: só o bit; o nome sai do catálogo pelo ID
+        const Item* doCatalogo = catalogo ? catalogo->buscarPorId(par.first) : nullptr;
+        bool proprio = doCatalogo == nullptr || doCatalogo->getNome() != par.second.nomeItem;
+        colunaNomeProprio.push_back(proprio);
+        if (proprio) {
+            escreverVarint(colunaNomesItens, nomesItens.indiceDe(par.second.nomeItem));
+        }
+        escreverVarint(colunaQuantidades, zigzag(par.second.quantidade));
+        itemAnterior = par.first;
+    }
+    if (!itens.empty()) {
+        menorItem = min(menorItem, itens.begin()->first);
+        maiorItem = max(maiorItem, itens.rbegin()->first);
+        totalLinhas += itens.size();
+    }
+
+    fim.pedido++;
+    fim.ids = colunaIds.size();
+    fim.camarins = colunaCamarins.size();
+    fim.artistas = colunaArtistas.size();
+    fim.criados = colunaCriados.size();
+    fim.atualizados = colunaAtualizados.size();
+    fim.linhas = colunaLinhas.size();
+    fim.linha = colunaNomeProprio.size();
+    fim.itens = colunaItens.size();
+    fim.nomesItens = colunaNomesItens.size();
+    fim.quantidades = colunaQuantidades.size();
+    fim.idAnterior = id;
+    fim.criadoAnterior = pedido.getCriadoEm();
+    bytesEstimados += estimarBytes(pedido);
+}
+
+bool ArquivoPedidos::arquivar(GerenciadorPedidos& pedidos, int pedidoId) {
+    const Pedido* pedido = pedidos.buscarPorId(pedidoId);
+    if (pedido == nullptr || !pedido->isAtendido()) {
+        return false;
+    }
+    arquivar(*pedido);
+    pedidos.remover(pedidoId);
+    pedidos.avisarDescarte(DescarteDependentes{TipoEntidade::PEDIDO, pedidoId, "pedido movido para o arquivo"});
+    return true;
+}
+
+int ArquivoPedidos::arquivarAtendidos(GerenciadorPedidos& pedidos) {
+    vector<Pedido> atendidos = pedidos.listarAtendidos();
+    for (const Pedido& pedido : atendidos) {
+        arquivar(pedido);
+        pedidos.remover(pedido.getId());
+        pedidos.avisarDescarte(
+            DescarteDependentes{TipoEntidade::PEDIDO, pedido.getId(), "pedido movido para o arquivo"});
+    }
+    return static_cast<int>(atendidos.size());
+}
+
+// ==================== Consultas ====================
+
+Pedido ArquivoPedidos::decodificar(Cursor& cursor) const {
+    int id = static_cast<int>(cursor.idAnterior + desfazerZigzag(lerVarint(colunaIds, cursor.ids)));
+    int camarimId = static_cast<int>(desfazerZigzag(lerVarint(colunaCamarins, cursor.camarins)));
+    string artista = artistas.nome(static_cast<uint32_t>(lerVarint(colunaArtistas, cursor.artistas)));
+    long long criadoEm = somarDelta(cursor.criadoAnterior, lerVarint(colunaCriados, cursor.criados));
+    long long atualizadoEm = somarDelta(criadoEm, lerVarint(colunaAtualizados, cursor.atualizados));
+
+    Pedido pedido(id, camarimId, artista);
+    pedido.setAtendido(colunaAtendidos[cursor.pedido]);
+    pedido.setCriadoEm(criadoEm);
+    pedido.setAtualizadoEm(atualizadoEm);
+
+    size_t linhas = lerVarint(colunaLinhas, cursor.linhas);
+    if (linhas > 0) {
+        CopiaNaEscrita<map<int, ItemPedido>> itens;
+        map<int, ItemPedido>& mapa = itens.escrever();
+        int itemId = 0;
+        for (size_t l = 0; l < linhas; l++) {
+            itemId = static_cast<int>(itemId + desfazerZigzag(lerVarint(colunaItens, cursor.itens)));
+            string nome = colunaNomeProprio[cursor.linha++]
+                              ? nomesItens.nome(static_cast<uint32_t>(lerVarint(colunaNomesItens, cursor.nomesItens)))
+                              : nomeDoCatalogo(itemId, cursor.pedido);
+            int quantidade = static_cast<int>(desfazerZigzag(lerVarint(colunaQuantidades, cursor.quantidades)));
+            mapa.emplace_hint(mapa.end(), itemId, ItemPedido(itemId, nome, quantidade));  // Já em ordem
+        }
+        pedido.compartilharItens(itens);
+    }
+
+    cursor.pedido++;
+    cursor.idAnterior = id;
+    cursor.criadoAnterior = criadoEm;
+    return pedido;
+}
+
+void ArquivoPedidos::pular(Cursor& cursor) const {
+    cursor.idAnterior = static_cast<int>(cursor.idAnterior + desfazerZigzag(lerVarint(colunaIds, cursor.ids)));
+    cursor.criadoAnterior = somarDelta(cursor.criadoAnterior, lerVarint(colunaCriados, cursor.criados));
+    pularVarint(colunaCamarins, cursor.camarins);
+    pularVarint(colunaArtistas, cursor.artistas);
+    pularVarint(colunaAtualizados, cursor.atualizados);
+    size_t linhas = lerVarint(colunaLinhas, cursor.linhas);
+    for (size_t l = 0; l < linhas; l++) {
+        pularVarint(colunaItens, cursor.itens);
+        if (colunaNomeProprio[cursor.linha++]) {
+            pularVarint(colunaNomesItens, cursor.nomesItens);
+        }
+        pularVarint(colunaQuantidades, cursor.quantidades);
+    }
+    cursor.pedido++;
+}
+
+vector<Pedido> ArquivoPedidos::listar() const {
+    vector<Pedido> resultado;
+    resultado.reserve(fim.pedido);
+    Cursor cursor;
+    while (cursor.pedido < fim.pedido) {
+        resultado.push_back(decodificar(cursor));
+    }
+    return resultado;
+}
+
+bool ArquivoPedidos::buscarPorId(int id, Pedido& saida) const {
+    // Do bloco mais recente para o mais antigo: vale o último arquivamento do ID
+    for (size_t b = blocos.size(); b-- > 0;) {
+        const Cursor& inicio = blocos[b].inicio;
+        if (id < blocos[b].menorId || id > blocos[b].maiorId) {
+            continue;  // Faixa de IDs do bloco não contém o ID: nem lê o bloco
+        }
+        // Só a coluna de IDs: posição da última ocorrência no bloco
+        size_t ultimo = min(fim.pedido, inicio.pedido + tamanhoBloco);
+        size_t achado = ultimo;
+        size_t posicaoIds = inicio.ids;
+        int idAtual = inicio.idAnterior;
+        for (size_t p = inicio.pedido; p < ultimo; p++) {
+            idAtual = static_cast<int>(idAtual + desfazerZigzag(lerVarint(colunaIds, posicaoIds)));
+            if (idAtual == id) {
+                achado = p;
+            }
+        }
+        if (achado == ultimo) {
+            continue;
+        }
+        Cursor cursor = inicio;
+        while (cursor.pedido < achado) {
+            pular(cursor);
+        }
+        saida = decodificar(cursor);
+        return true;
+    }
+    return false;
+}
+
+// Faixa de IDs pequena perto do volume lido: acumula em vetor indexado, não em map
+static bool faixaDensa(int menor, int maior, size_t leituras) {
+    return static_cast<long long>(maior) - menor < 4 * static_cast<long long>(leituras) + 1024;
+}
+
+map<int, long long> ArquivoPedidos::quantidadePorItem() const {
+    map<int, long long> total;
+    if (totalLinhas == 0) {
+        return total;
+    }
+    bool denso = faixaDensa(menorItem, maiorItem, totalLinhas);
+    size_t faixa = denso ? static_cast<size_t>(static_cast<long long>(maiorItem) - menorItem + 1) : 0;
+    vector<long long> soma(faixa, 0);
+    vector<bool> presente(faixa, false);
+
+    size_t posicaoLinhas = 0, posicaoItens = 0, posicaoQuantidades = 0;
+    for (size_t p = 0; p < fim.pedido; p++) {
+        size_t linhas = lerVarint(colunaLinhas, posicaoLinhas);
+        int itemId = 0;
+        for (size_t l = 0; l < linhas; l++) {
+            itemId = static_cast<int>(itemId + desfazerZigzag(lerVarint(colunaItens, posicaoItens)));
+            long long quantidade = desfazerZigzag(lerVarint(colunaQuantidades, posicaoQuantidades));
+            if (denso) {
+                soma[static_cast<size_t>(static_cast<long long>(itemId) - menorItem)] += quantidade;
+                presente[static_cast<size_t>(static_cast<long long>(itemId) - menorItem)] = true;
+            } else {
+                total[itemId] += quantidade;
+            }
+        }
+    }
+    for (size_t i = 0; i < faixa; i++) {
+        if (presente[i]) {
+            total.emplace_hint(total.end(), static_cast<int>(menorItem + static_cast<long long>(i)), soma[i]);
+        }
+    }
+    return total;
+}
+
+map<int, int> ArquivoPedidos::pedidosPorCamarim() const {
+    map<int, int> contagem;
+    if (fim.pedido == 0) {
+        return contagem;
+    }
+    bool denso = faixaDensa(menorCamarim, maiorCamarim, fim.pedido);
+    size_t faixa = denso ? static_cast<size_t>(static_cast<long long>(maiorCamarim) - menorCamarim + 1) : 0;
+    vector<int> porCamarim(faixa, 0);
+
+    size_t posicao = 0;
+    for (size_t p = 0; p < fim.pedido; p++) {
+        int camarimId = static_cast<int>(desfazerZigzag(lerVarint(colunaCamarins, posicao)));
+        if (denso) {
+            porCamarim[static_cast<size_t>(static_cast<long long>(camarimId) - menorCamarim)]++;
+        } else {
+            contagem[camarimId]++;
+        }
+    }
+    for (size_t i = 0; i < faixa; i++) {
+        if (porCamarim[i] > 0) {
+            contagem.emplace_hint(contagem.end(), static_cast<int>(menorCamarim + static_cast<long long>(i)), porCamarim[i]);
+        }
+    }
+    return contagem;
+}
+
+size_t ArquivoPedidos::tamanho() const {
+    return fim.pedido;
+}
+
+size_t ArquivoPedidos::bytesComprimidos() const {
+    size_t bytes = colunaIds.size() + colunaCamarins.size() + colunaArtistas.size() + colunaCriados.size()
+                 + colunaAtualizados.size() + (colunaAtendidos.size() + 7) / 8 + colunaLinhas.size()
+                 + colunaItens.size() + (colunaNomeProprio.size() + 7) / 8 + colunaNomesItens.size()
+                 + colunaQuantidades.size() + blocos.size() * sizeof(Bloco);
+    // Nomes anteriores: baldes + um nó (chave, vetor, próximo, hash) por item + as entradas
+    bytes += nomesAnteriores.bucket_count() * sizeof(void*);
+    for (const auto& par : nomesAnteriores) {
+        bytes += sizeof(par) + 2 * sizeof(void*) + par.second.capacity() * sizeof(par.second[0]);
+    }
+    return bytes + artistas.bytes() + nomesItens.bytes();
+}
+
+size_t ArquivoPedidos::bytesDescomprimidos() const {
+    return bytesEstimados;
+}
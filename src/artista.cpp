@@ -10,6 +10,8 @@
 #include "artista.h"
 // Inclui as exceções customizadas do sistema
 #include "excecoes.h"
+// Regras dos campos (tabela constexpr do Artista)
+#include "esquema.h"
 // Inclui algoritmos STL (remove_if, etc)
 #include <algorithm>
 // Inclui stringstream para construir strings formatadas
@@ -25,7 +27,9 @@ Artista::Artista() : Pessoa(), camarimId(0) {}
 
 // Construtor parametrizado - Recebe todos os valores necessários
 Artista::Artista(int id, const string& nome, int camarimId)
-    : Pessoa(id, nome), camarimId(camarimId) {}  
+    : Pessoa(id, nome), camarimId(camarimId) {
+    esquema::validar(*this);  // Regras da tabela do Artista (as mesmas dos setters)
+}
 // Pessoa(id, nome) = chama construtor parametrizado da classe BASE
 // Passa id e nome para a classe pai inicializar seus atributos
 // camarimId(camarimId) = inicializa atributo adicional da classe DERIVADA
@@ -43,10 +47,18 @@ int Artista::getCamarimId() const {
 
 // ==================== Setters com Validação ====================
 
+void Artista::setId(int id) {
+    esquema::validarCampo<Artista>(Campo::ID, id);  // VALIDAÇÃO: id não pode ser negativo
+    Pessoa::setId(id);  // A classe BASE guarda o atributo
+}
+
+void Artista::setNome(const string& nome) {
+    esquema::validarCampo<Artista>(Campo::NOME, nome);  // VALIDAÇÃO: nome não pode ser vazio
+    Pessoa::setNome(nome);
+}
+
 void Artista::setCamarimId(int camarimId) {
-    if (camarimId < 0) {  // VALIDAÇÃO: camarimId não pode ser negativo
-        throw ValidacaoException("ID de camarim inválido");
-    }
+    esquema::validarCampo<Artista>(Campo::CAMARIM, camarimId);  // VALIDAÇÃO: camarimId não pode ser negativo
     this->camarimId = camarimId;  // Atribui novo valor se válido
 }
 
@@ -63,79 +75,90 @@ string Artista::exibir() const {
 // ==================== Classe GerenciadorArtistas ====================
 
 // Construtor - Inicializa o gerenciador
-GerenciadorArtistas::GerenciadorArtistas() : proximoId(1) {}  
-// proximoId(1) = primeiro artista terá ID = 1
-// Vetor 'artistas' é inicializado automaticamente vazio
+GerenciadorArtistas::GerenciadorArtistas() {}  
+
+/**
+ * Alocador de IDs do repositório (compartilhado entre threads)
+ */
+AlocadorIds& GerenciadorArtistas::getAlocadorIds() {
+    return artistas.getAlocadorIds();
+}
+// O repositório começa vazio, com o primeiro ID = 1
 
 // Cadastra novo artista no sistema (CREATE)
-int GerenciadorArtistas::cadastrar(const string& nome, int camarimId) {
+int GerenciadorArtistas::cadastrar(const string& nome, int camarimId, AlocadorIds::Bloco* bloco) {
     // ========== VALIDAÇÕES ==========
     
-    if (nome.empty()) {  // Verifica se nome não está vazio
-        throw ValidacaoException("Nome do artista não pode ser vazio");
-    }
-    
-    if (camarimId < 0) {  // Verifica se camarimId é válido
-        throw ValidacaoException("ID de camarim inválido");
-    }
+    // Regras da tabela do Artista, antes de gastar um ID
+    esquema::validarCampo<Artista>(Campo::NOME, nome);
+    esquema::validarCampo<Artista>(Campo::CAMARIM, camarimId);
     
     // ========== CADASTRO ==========
     
-    Artista novoArtista(proximoId, nome, camarimId);  // Cria novo objeto Artista
-    artistas.push_back(novoArtista);  // Adiciona ao vetor (no final)
+    // O repositório anexa no fim e atualiza os índices (ID e camarim)
+    Artista& novo = artistas.cadastrar([&](int id) { return Artista(id, nome, camarimId); }, bloco);
+    
+    // Avisa os observadores: artista criado
+    notificar([&](ObservadorMutacoes* o) { o->aoMudarArtista(nullptr, &novo); });
     
-    return proximoId++;  // Retorna ID usado e incrementa para próximo
+    return novo.getId();  // Retorna o ID gerado
 }
 
-// Busca artista por ID (READ)
+// Busca artista por ID (READ) usando o índice hash
 Artista* GerenciadorArtistas::buscarPorId(int id) {
-    // Percorre todos os artistas usando range-based for
-    for (auto& artista : artistas) {  // auto = Artista (deduzido automaticamente)
-        // & = referência (não copia, acessa diretamente)
-        
-        if (artista.getId() == id) {  // Compara ID do artista com ID buscado
-            return &artista;  // Retorna PONTEIRO para o artista encontrado
-        }
-    }
-    return nullptr;  // Se não encontrou, retorna ponteiro nulo
+    return artistas.buscar(id);  // O(1) em média; nullptr se não encontrou
+}
+
+// Versão const da busca por ID (somente leitura)
+const Artista* GerenciadorArtistas::buscarPorId(int id) const {
+    return artistas.buscar(id);
 }
 
-// Busca todos os artistas de um camarim específico (READ)
+// Busca todos os artistas de um camarim específico (READ) usando o índice por camarim
 vector<Artista> GerenciadorArtistas::buscarPorCamarim(int camarimId) const {
-    vector<Artista> resultado;  // Cria vetor vazio para armazenar resultado
-    
-    // Percorre todos os artistas
-    for (const auto& artista : artistas) {  // const = não modifica
-        if (artista.getCamarimId() == camarimId) {  // Se artista pertence ao camarim
-            resultado.push_back(artista);  // Adiciona ao vetor resultado
-        }
-    }
-    
-    return resultado;  // Retorna vetor com todos os artistas do camarim
+    // Percorre apenas os IDs do grupo (já em ordem de cadastro)
+    return artistas.registrosDe(artistas.indice<PorCamarim>().buscar(camarimId));
 }
 
 // Remove artista por ID (DELETE)
 bool GerenciadorArtistas::remover(int id) {
-    // Usa algoritmo remove_if da STL
-    auto it = remove_if(artistas.begin(), artistas.end(),
-                       [id](const Artista& a) { return a.getId() == id; });
-    // Lambda [id] captura variável id do escopo externo
-    // Lambda recebe cada artista e retorna true se deve ser removido
-    // remove_if move elementos a serem removidos para o final do vetor
-    
-    if (it != artistas.end()) {  // Se encontrou artista para remover
-        artistas.erase(it, artistas.end());  // Remove efetivamente do vetor
-        return true;  // Retorna sucesso
+    Artista removido;  // Recebe o artista para avisar os observadores
+    if (!artistas.remover(id, &removido)) {
+        return false;  // Se não encontrou, retorna falha
     }
-    return false;  // Se não encontrou, retorna falha
+    
+    // Avisa os observadores: artista removido
+    notificar([&](ObservadorMutacoes* o) { o->aoMudarArtista(&removido, nullptr); });
+    return true;  // Retorna sucesso
 }
 
 // Lista todos os artistas cadastrados (READ)
 vector<Artista> GerenciadorArtistas::listar() const {
-    return artistas;  // Retorna CÓPIA do vetor inteiro com todos os artistas
+    return artistas.todos();  // Retorna CÓPIA do vetor inteiro com todos os artistas
     // const = não modifica o estado do gerenciador
 }
 
+// Executa consulta usando o índice por ID ou por camarim quando possível
+ResultadoConsulta<Artista> GerenciadorArtistas::consultar(const Consulta& consulta) const {
+    consulta.validar<Artista>();  // Lança ValidacaoException se algum campo não existe
+    
+    vector<size_t> candidatos;  // Posições sugeridas pelo índice
+    int valor;
+    if (consulta.igualdadeInteira(Campo::ID, valor)) {
+        size_t posicao = artistas.posicaoDe(valor);
+        if (posicao != artistas.NAO_ENCONTRADO) {
+            candidatos.push_back(posicao);
+        }
+        return consulta.executar(artistas.todos(), &candidatos, "índice hash por ID");
+    }
+    if (consulta.igualdadeInteira(Campo::CAMARIM, valor)) {
+        candidatos = artistas.posicoesDe(artistas.indice<PorCamarim>().buscar(valor));
+        return consulta.executar(artistas.todos(), &candidatos, "índice por camarim");
+    }
+    // Sem índice aplicável: varre o vetor aplicando uma condição por vez
+    return consulta.executar(artistas.todos(), nullptr, "varredura vetorizada");
+}
+
 // Atualiza dados de um artista existente (UPDATE)
 bool GerenciadorArtistas::atualizar(int id, const string& nome, int camarimId) {
     // Busca o artista pelo ID
@@ -146,10 +169,36 @@ bool GerenciadorArtistas::atualizar(int id, const string& nome, int camarimId) {
         throw ArtistaException("Artista com ID " + to_string(id) + " não encontrado");
     }
     
-    // Atualiza os dados usando setters (que fazem validação)
-    artista->setNome(nome);  // Atualiza nome via ponteiro
-    // -> = operador de acesso a membro via ponteiro
-    artista->setCamarimId(camarimId);  // Atualiza camarimId via ponteiro
+    // Atualiza os dados usando setters (que fazem validação); o repositório
+    // move o artista de grupo se o camarim mudou
+    Artista antes = *artista;  // Estado anterior (para os observadores)
+    try {
+        artistas.alterar(*artista, [&](Artista& a) {
+            a.setNome(nome);
+            a.setCamarimId(camarimId);
+        });
+    } catch (...) {
+        // Camarim inválido: o nome já foi alterado, então os observadores são avisados
+        notificar([&](ObservadorMutacoes* o) { o->aoMudarArtista(&antes, artista); });
+        throw;  // Relança a mesma exceção
+    }
+    
+    notificar([&](ObservadorMutacoes* o) { o->aoMudarArtista(&antes, artista); });
     
     return true;  // Retorna true indicando sucesso
 }
+
+// Restaura um artista (desfazer/refazer): substitui ou recria com o mesmo ID
+void GerenciadorArtistas::restaurar(const Artista& estado) {
+    Artista* artista = artistas.buscar(estado.getId());
+    if (artista != nullptr) {
+        Artista antes = *artista;
+        artistas.alterar(*artista, [&](Artista& a) { a = estado; });
+        notificar([&](ObservadorMutacoes* o) { o->aoMudarArtista(&antes, artista); });
+        return;
+    }
+    
+    // Artista removido: o repositório o devolve à posição do seu ID
+    Artista& recriado = artistas.inserir(estado);
+    notificar([&](ObservadorMutacoes* o) { o->aoMudarArtista(nullptr, &recriado); });
+}
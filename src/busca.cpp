@@ -0,0 +1,246 @@
+/**
+ * @file busca.cpp
+ * @brief Implementação da normalização de nomes e do IndiceTrigramas
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ */
+
+// Inclui o header com as declarações
+#include "busca.h"
+// Algoritmos STL (sort, unique, partial_sort, find)
+#include <algorithm>
+// ValidacaoException
+#include "excecoes.h"
+
+// ==================== Normalização ====================
+
+/**
+ * Normaliza nome: minúsculas, sem acentos, pontuação vira espaço
+ */
+string normalizarNome(const string& nome) {
+    // Tabela para o segundo byte das letras acentuadas UTF-8 (0xC3 0x80..0xBF)
+    // Ex: "Á" = C3 81 -> 'a' | "ç" = C3 A7 -> 'c' | '×' e '÷' viram espaço
+    static const char acentos[] =
+        "aaaaaaaceeeeiiiidnooooo ouuuuyts"   // 0x80..0x9F (maiúsculas)
+        "aaaaaaaceeeeiiiidnooooo ouuuuyty";  // 0xA0..0xBF (minúsculas)
+
+    string resultado;
+    resultado.reserve(nome.size());
+    bool espacoPendente = false;  // Adia o espaço: evita espaços duplicados e nas bordas
+
+    for (size_t i = 0; i < nome.size(); i++) {
+        unsigned char c = static_cast<unsigned char>(nome[i]);
+        char letra = ' ';  // Caractere normalizado (espaço = separador)
+
+        if (c == 0xC3 && i + 1 < nome.size()) {
+            // Letra acentuada latina de 2 bytes
+            unsigned char segundo = static_cast<unsigned char>(nome[i + 1]);
+            if (segundo >= 0x80 && segundo <= 0xBF) {
+                letra = acentos[segundo - 0x80];
+            }
+            i++;  // Consome o segundo byte
+        } else if (c >= 'A' && c <= 'Z') {
+            letra = static_cast<char>(c - 'A' + 'a');  // Minúscula
+        } else if ((c >= 'a' && c <= 'z') || (c >= '0' && c <= '9')) {
+            letra = static_cast<char>(c);
+        } else if (c >= 0x80) {
+            continue;  // Outros bytes não-ASCII são descartados
+        }
+
+        if (letra == ' ') {
+            espacoPendente = !resultado.empty();
+        } else {
+            if (espacoPendente) {
+                resultado += ' ';
+                espacoPendente = false;
+            }
+            resultado += letra;
+        }
+    }
+    return resultado;
+}
+
+// ==================== Classe IndiceTrigramas ====================
+
+/**
+ * Extrai trigramas distintos (3 bytes empacotados em um uint32_t)
+ */
+vector<uint32_t> IndiceTrigramas::extrairTrigramas(const string& normalizado, bool comBordas) {
+    // Bordas: "  agua " gera "  a", " ag", ..., "ua " (valoriza início e fim de palavra)
+    string texto = comBordas ? "  " + normalizado + " " : normalizado;
+
+    vector<uint32_t> trigramas;
+    for (size_t i = 0; i + 2 < texto.size(); i++) {
+        uint32_t t = (static_cast<uint32_t>(static_cast<unsigned char>(texto[i])) << 16)
+                   | (static_cast<uint32_t>(static_cast<unsigned char>(texto[i + 1])) << 8)
+                   | static_cast<uint32_t>(static_cast<unsigned char>(texto[i + 2]));
+        trigramas.push_back(t);
+    }
+
+    // Ordena e remove duplicados (conjunto de trigramas)
+    sort(trigramas.begin(), trigramas.end());
+    trigramas.erase(unique(trigramas.begin(), trigramas.end()), trigramas.end());
+    return trigramas;
+}
+
+/**
+ * Indexa (ou reindexa) o nome de um ID
+ */
+void IndiceTrigramas::inserir(int id, const string& nome) {
+    if (id < 0) {
+        throw ValidacaoException("ID " + to_string(id) + " não pode ser indexado");
+    }
+    remover(id);  // Reindexação: descarta trigramas do nome antigo
+
+    if (static_cast<size_t>(id) >= trigramasPorId.size()) {
+        trigramasPorId.resize(id + 1);
+    }
+
+    vector<uint32_t> trigramas = extrairTrigramas(normalizarNome(nome), true);
+    for (uint32_t t : trigramas) {
+        postagens[t].push_back(id);  // Acrescenta o ID na lista do trigrama
+    }
+    if (!trigramas.empty()) {
+        trigramasPorId[id] = trigramas;
+        indexados++;
+    }
+}
+
+/**
+ * Remove um ID de todas as listas de postagens em que aparece
+ */
+void IndiceTrigramas::remover(int id) {
+    if (id < 0 || static_cast<size_t>(id) >= trigramasPorId.size() || trigramasPorId[id].empty()) {
+        return;  // Não indexado
+    }
+
+    for (uint32_t t : trigramasPorId[id]) {
+        vector<int>& lista = postagens[t];
+        auto it = find(lista.begin(), lista.end(), id);
+        if (it != lista.end()) {
+            *it = lista.back();  // Troca com o último e descarta (ordem não importa)
+            lista.pop_back();
+        }
+        if (lista.empty()) {
+            postagens.erase(t);
+        }
+    }
+    trigramasPorId[id].clear();
+    indexados--;
+}
+
+/**
+ * Esvazia o índice
+ */
+void IndiceTrigramas::limpar() {
+    postagens.clear();
+    trigramasPorId.clear();
+    indexados = 0;
+}
+
+/**
+ * Busca os IDs com maior similaridade de trigramas
+ */
+vector<Candidato> IndiceTrigramas::buscar(const string& consulta, size_t limite,
+                                          double similaridadeMinima) const {
+    vector<Candidato> resultado;
+    vector<uint32_t> trigramasConsulta = extrairTrigramas(normalizarNome(consulta), true);
+    if (trigramasConsulta.empty() || limite == 0) {
+        return resultado;
+    }
+
+    // Rascunho da thread, reutilizado entre buscas (sem alocar a cada consulta) e
+    // sempre devolvido zerado: buscas em threads diferentes não se misturam
+    thread_local vector<uint16_t> contagem;  // contagem[id] = trigramas em comum com a consulta
+    thread_local vector<int> tocados;        // IDs com contagem > 0 (para zerar depois)
+    if (contagem.size() < trigramasPorId.size()) {
+        contagem.resize(trigramasPorId.size(), 0);
+    }
+
+    // 1) Conta trigramas em comum percorrendo só as listas dos trigramas da consulta
+    for (uint32_t t : trigramasConsulta) {
+        auto it = postagens.find(t);
+        if (it == postagens.end()) {
+            continue;
+        }
+        for (int id : it->second) {
+            if (contagem[id]++ == 0) {
+                tocados.push_back(id);  // Primeira vez que este ID aparece
+            }
+        }
+    }
+
+    // 2) Calcula o coeficiente de Dice e zera o rascunho para a próxima busca
+    double totalConsulta = static_cast<double>(trigramasConsulta.size());
+    for (int id : tocados) {
+        double similaridade = 2.0 * contagem[id] / (totalConsulta + trigramasPorId[id].size());
+        if (similaridade >= similaridadeMinima) {
+            resultado.push_back(Candidato(id, similaridade));
+        }
+        contagem[id] = 0;
+    }
+    tocados.clear();
+
+    // 3) Mantém apenas os 'limite' melhores (partial_sort: O(n log limite))
+    auto melhor = [](const Candidato& a, const Candidato& b) {
+        if (a.similaridade != b.similaridade) {
+            return a.similaridade > b.similaridade;  // Mais parecido primeiro
+        }
+        return a.id < b.id;  // Empate: ordem de cadastro
+    };
+    if (resultado.size() > limite) {
+        partial_sort(resultado.begin(), resultado.begin() + limite, resultado.end(), melhor);
+        resultado.resize(limite);
+    } else {
+        sort(resultado.begin(), resultado.end(), melhor);
+    }
+    return resultado;
+}
+
+/**
+ * Candidatos para busca por substring: interseção das listas de postagens
+ */
+bool IndiceTrigramas::candidatosSubstring(const string& trechoNormalizado, vector<int>& candidatos) const {
+    candidatos.clear();
+    // Sem bordas: o trecho pode estar no meio do nome
+    vector<uint32_t> trigramas = extrairTrigramas(trechoNormalizado, false);
+    if (trigramas.empty()) {
+        return false;  // Trecho curto: o planejador faz varredura
+    }
+
+    // Parte da menor lista de postagens (a mais seletiva)
+    const vector<int>* menor = nullptr;
+    for (uint32_t t : trigramas) {
+        auto it = postagens.find(t);
+        if (it == postagens.end()) {
+            return true;  // Algum trigrama não existe: nenhum nome contém o trecho
+        }
+        if (menor == nullptr || it->second.size() < menor->size()) {
+            menor = &it->second;
+        }
+    }
+
+    // Mantém apenas os IDs que possuem todos os trigramas (busca binária: vetores ordenados)
+    for (int id : *menor) {
+        const vector<uint32_t>& doId = trigramasPorId[id];
+        bool todos = true;
+        for (uint32_t t : trigramas) {
+            if (!binary_search(doId.begin(), doId.end(), t)) {
+                todos = false;
+                break;
+            }
+        }
+        if (todos) {
+            candidatos.push_back(id);
+        }
+    }
+    return true;
+}
+
+/**
+ * Quantidade de nomes indexados
+ */
+size_t IndiceTrigramas::tamanho() const {
+    return indexados;
+}
@@ -12,6 +12,8 @@
 #include "camarim.h"
 // Inclui exceções customizadas
 #include "excecoes.h"
+// Regras dos campos (tabela constexpr do Camarim)
+#include "esquema.h"
 // Algoritmos STL (find, remove_if, etc)
 #include <algorithm>
 // Para usar stringstream (construir strings formatadas)
@@ -31,7 +33,9 @@ Camarim::Camarim() : id(0), nome(""), artistaId(0) {}
  * Construtor parametrizado - inicializa com valores fornecidos
  */
 Camarim::Camarim(int id, const string& nome, int artistaId)
-    : id(id), nome(nome), artistaId(artistaId) {}
+    : id(id), nome(nome), artistaId(artistaId) {
+    esquema::validar(*this);  // Regras da tabela do Camarim (as mesmas dos setters)
+}
 // Inicializa diretamente os atributos privados
 // artistaId = 0 significa que não há artista associado ainda
 
@@ -53,8 +57,8 @@ int Camarim::getId() const {
 /**
  * Retorna o nome do camarim
  */
-string Camarim::getNome() const {
-    return nome;  // Retorna cópia da string
+const string& Camarim::getNome() const {
+    return nome;  // Referência: válida enquanto o camarim existir
 }
 
 /**
@@ -70,10 +74,7 @@ int Camarim::getArtistaId() const {
  * Define o ID do camarim com validação
  */
 void Camarim::setId(int id) {
-    if (id < 0) {  // Validação: ID não pode ser negativo
-        throw ValidacaoException("ID do camarim inválido");
-        // Lança exceção específica de validação
-    }
+    esquema::validarCampo<Camarim>(Campo::ID, id);  // Validação: ID não pode ser negativo
     this->id = id;  // this-> diferencia parâmetro de atributo
 }
 
@@ -81,9 +82,7 @@ void Camarim::setId(int id) {
  * Define o nome do camarim com validação
  */
 void Camarim::setNome(const string& nome) {
-    if (nome.empty()) {  // Validação: nome não pode ser vazio
-        throw ValidacaoException("Nome do camarim não pode ser vazio");
-    }
+    esquema::validarCampo<Camarim>(Campo::NOME, nome);  // Validação: nome não pode ser vazio
     this->nome = nome;  // Atualiza atributo privado
 }
 
@@ -111,6 +110,9 @@ void Camarim::inserirItem(int itemId, const string& nomeItem, int quantidade) {
         throw ValidacaoException("Quantidade deve ser maior que zero");
     }
     
+    // Escrita: se o map é compartilhado com outra cópia, separa-se dela aqui
+    map<int, ItemCamarim>& itens = this->itens.escrever();
+    
     // MAP: find() retorna iterator para o elemento ou end() se não encontrar
     if (itens.find(itemId) != itens.end()) {
         // Item JÁ EXISTE no camarim: soma à quantidade existente
@@ -128,8 +130,8 @@ void Camarim::inserirItem(int itemId, const string& nomeItem, int quantidade) {
  * Remove quantidade de um item do camarim
  */
 bool Camarim::removerItem(int itemId, int quantidade) {
-    // Verifica se item existe no camarim
-    if (itens.find(itemId) == itens.end()) {
+    // Verifica se item existe no camarim (leitura: ainda não copia nada)
+    if (itens.ler().find(itemId) == itens.ler().end()) {
         // find() == end() significa que não encontrou
         throw CamarimException("Item não encontrado no camarim");
     }
@@ -138,11 +140,14 @@ bool Camarim::removerItem(int itemId, int quantidade) {
         throw ValidacaoException("Quantidade deve ser maior que zero");
     }
     
-    if (itens[itemId].quantidade < quantidade) {
+    if (itens.ler().at(itemId).quantidade < quantidade) {
         // Não há quantidade suficiente no camarim
         throw CamarimException("Quantidade insuficiente no camarim");
     }
     
+    // Validado: só agora separa o map de outras cópias
+    map<int, ItemCamarim>& itens = this->itens.escrever();
+    
     // Subtrai quantidade
     itens[itemId].quantidade -= quantidade;
     
@@ -154,6 +159,16 @@ bool Camarim::removerItem(int itemId, int quantidade) {
     return true;  // Sucesso na remoção
 }
 
+// Acesso somente leitura aos itens do camarim
+const map<int, ItemCamarim>& Camarim::getItens() const {
+    return itens.ler();  // Referência constante: sem cópia e sem permitir alteração
+}
+
+// Passa a usar o armazenamento de 'origem' (cópia O(1))
+void Camarim::compartilharItens(const CopiaNaEscrita<map<int, ItemCamarim>>& origem) {
+    itens = origem;
+}
+
 /**
  * Exibe todas as informações do camarim formatadas
  */
@@ -164,6 +179,8 @@ string Camarim::exibir() const {
     ss << "Nome: " << nome << endl;
     ss << "Artista ID: " << artistaId << endl;
     
+    const map<int, ItemCamarim>& itens = this->itens.ler();  // Somente leitura
+    
     // Calcula total de itens percorrendo o map
     int total = 0;
     for (const auto& par : itens) {  
@@ -225,91 +242,111 @@ ostream& operator<<(ostream& os, const Camarim& camarim) {
 /**
  * Construtor - inicializa próximo ID como 1
  */
-GerenciadorCamarins::GerenciadorCamarins() : proximoId(1) {}
+GerenciadorCamarins::GerenciadorCamarins() {}
+
+/**
+ * Alocador de IDs do repositório (compartilhado entre threads)
+ */
+AlocadorIds& GerenciadorCamarins::getAlocadorIds() {
+    return camarins.getAlocadorIds();
+}
 // IDs começam em 1 (0 geralmente significa "nenhum")
 
 /**
  * Cadastra novo camarim (CREATE)
  */
-int GerenciadorCamarins::cadastrar(const string& nome, int artistaId) {
-    if (nome.empty()) {  // Validação: nome obrigatório
-        throw ValidacaoException("Nome do camarim não pode ser vazio");
-    }
+int GerenciadorCamarins::cadastrar(const string& nome, int artistaId, AlocadorIds::Bloco* bloco) {
+    esquema::validarCampo<Camarim>(Campo::NOME, nome);  // Validação: nome obrigatório
     
-    // Cria novo camarim com ID automático
-    Camarim novoCamarim(proximoId, nome, artistaId);
+    // Cria novo camarim com ID automático; o repositório atualiza os índices
+    Camarim& novo = camarins.cadastrar([&](int id) { return Camarim(id, nome, artistaId); }, bloco);
+    registrarAlteracao(novo.getId(), TipoAlteracaoCamarim::CRIADO);
     
-    // Adiciona ao vector de camarins
-    camarins.push_back(novoCamarim);
-    // push_back() adiciona ao final do vector (faz cópia do objeto)
+    // Avisa os observadores: camarim criado
+    notificar([&](ObservadorMutacoes* o) { o->aoMudarCamarim(nullptr, &novo); });
     
-    return proximoId++;  // Retorna ID usado e incrementa para próximo
-    // Pós-incremento: retorna valor atual, depois incrementa
+    return novo.getId();  // Retorna o ID gerado
 }
 
 /**
  * Busca camarim por ID (READ)
  */
 Camarim* GerenciadorCamarins::buscarPorId(int id) {
-    // Range-based for com referência não-const (permite modificação)
-    for (auto& camarim : camarins) {
-        // auto& = referência a cada Camarim no vector
-        // & = não faz cópia, permite modificar original
-        
-        if (camarim.getId() == id) {  // Se encontrou
-            return &camarim;  // Retorna PONTEIRO para o objeto no vector
-            // & = operador address-of (retorna endereço do objeto)
-        }
-    }
-    return nullptr;  // Não encontrado: retorna ponteiro nulo
+    return camarins.buscar(id);  // Índice hash: O(1) em média; nullptr se não encontrado
+}
+
+/**
+ * Versão const da busca por ID (somente leitura)
+ */
+const Camarim* GerenciadorCamarins::buscarPorId(int id) const {
+    return camarins.buscar(id);
 }
 
 /**
  * Busca camarim por artista associado (READ)
  */
 Camarim* GerenciadorCamarins::buscarPorArtista(int artistaId) {
-    for (auto& camarim : camarins) {
-        if (camarim.getArtistaId() == artistaId) {
-            return &camarim;  // Retorna ponteiro para o camarim encontrado
-        }
+    const vector<int>& ids = camarins.indice<PorArtista>().buscar(artistaId);
+    if (ids.empty()) {
+        return nullptr;  // Artista não tem camarim associado
     }
-    return nullptr;  // Artista não tem camarim associado
+    return buscarPorId(ids.front());  // Primeiro cadastrado (menor ID), como na varredura
 }
 
 /**
  * Remove camarim por ID (DELETE)
  */
 bool GerenciadorCamarins::remover(int id) {
-    // PADRÃO REMOVE-ERASE:
-    // 1. remove_if move elementos a remover para o final
-    // 2. erase remove elementos do final
-    
-    auto it = remove_if(camarins.begin(), camarins.end(),
-                       [id](const Camarim& c) { return c.getId() == id; });
-    // remove_if(início, fim, predicado) 
-    // Retorna iterator para primeiro elemento "removido"
-    // LAMBDA: [id](const Camarim& c) { return c.getId() == id; }
-    //   [id] = captura variável id por valor
-    //   (const Camarim& c) = parâmetro (cada camarim)
-    //   { return ... } = corpo da função (critério de remoção)
-    
-    if (it != camarins.end()) {  // Se encontrou elemento(s) a remover
-        camarins.erase(it, camarins.end());
-        // erase(início, fim) remove range do vector
-        // Remove todos desde it até o final
-        return true;  // Sucesso
-    }
-    return false;  // Não encontrado
+    // Guarda o camarim removido apenas se alguém vai ser avisado (map de itens)
+    Camarim removido;
+    bool avisar = temObservadores();
+    if (!camarins.remover(id, avisar ? &removido : nullptr)) {
+        return false;  // Não encontrado
+    }
+    registrarAlteracao(id, TipoAlteracaoCamarim::REMOVIDO);
+    
+    if (avisar) {
+        notificar([&](ObservadorMutacoes* o) { o->aoMudarCamarim(&removido, nullptr); });
+    }
+    return true;  // Sucesso
 }
 
 /**
  * Lista todos os camarins (READ ALL)
  */
 vector<Camarim> GerenciadorCamarins::listar() const {
-    return camarins;  // Retorna CÓPIA do vector completo
+    return camarins.todos();  // Retorna CÓPIA do vector completo
     // Vector faz deep copy de todos os objetos
 }
 
+/**
+ * Acesso direto ao vector do repositório (sem cópia)
+ */
+const vector<Camarim>& GerenciadorCamarins::todos() const {
+    return camarins.todos();
+}
+
+// Executa consulta usando o índice por ID ou por artista quando possível
+ResultadoConsulta<Camarim> GerenciadorCamarins::consultar(const Consulta& consulta) const {
+    consulta.validar<Camarim>();  // Lança ValidacaoException se algum campo não existe
+    
+    vector<size_t> candidatos;  // Posições sugeridas pelo índice
+    int valor;
+    if (consulta.igualdadeInteira(Campo::ID, valor)) {
+        size_t posicao = camarins.posicaoDe(valor);
+        if (posicao != camarins.NAO_ENCONTRADO) {
+            candidatos.push_back(posicao);
+        }
+        return consulta.executar(camarins.todos(), &candidatos, "índice hash por ID");
+    }
+    if (consulta.igualdadeInteira(Campo::ARTISTA, valor)) {
+        candidatos = camarins.posicoesDe(camarins.indice<PorArtista>().buscar(valor));
+        return consulta.executar(camarins.todos(), &candidatos, "índice por artista");
+    }
+    // Sem índice aplicável: varre o vetor aplicando uma condição por vez
+    return consulta.executar(camarins.todos(), nullptr, "varredura vetorizada");
+}
+
 /**
  * Atualiza dados de um camarim (UPDATE)
  */
@@ -322,10 +359,184 @@ bool GerenciadorCamarins::atualizar(int id, const string& nome, int artistaId) {
         // Concatenação de strings com operador +
     }
     
-    // Atualiza campos usando setters (que fazem validação)
-    camarim->setNome(nome);
-    // -> = acesso a membro através de ponteiro (equivale a (*camarim).setNome(nome))
-    camarim->setArtistaId(artistaId);
+    Camarim antes = *camarim;  // Estado anterior (para os observadores)
+    
+    // Atualiza campos usando setters (que fazem validação); se o artista
+    // mudou, o repositório move o camarim de grupo no índice
+    camarins.alterar(*camarim, [&](Camarim& c) {
+        c.setNome(nome);
+        c.setArtistaId(artistaId);
+    });
+    registrarAlteracao(id, TipoAlteracaoCamarim::ATUALIZADO);
     
+    notificar([&](ObservadorMutacoes* o) { o->aoMudarCamarim(&antes, camarim); });
     return true;  // Sucesso na atualização
 }
+
+/**
+ * Adiciona item ao camarim avisando os observadores
+ */
+void GerenciadorCamarins::inserirItem(int camarimId, int itemId, const string& nomeItem, int quantidade) {
+    Camarim* camarim = buscarPorId(camarimId);
+    if (camarim == nullptr) {
+        throw CamarimException("Camarim com ID " + to_string(camarimId) + " não encontrado");
+    }
+    Camarim antes;
+    bool avisar = temObservadores();
+    if (avisar) {
+        antes = *camarim;  // Cópia só quando alguém vai ser avisado
+    }
+    
+    camarim->inserirItem(itemId, nomeItem, quantidade);  // Se lançar, nada mudou
+    registrarAlteracao(camarimId, TipoAlteracaoCamarim::ITEM_INSERIDO, itemId, quantidade);
+    if (avisar) {
+        notificar([&](ObservadorMutacoes* o) { o->aoMudarCamarim(&antes, camarim); });
+    }
+}
+
+/**
+ * Remove quantidade de item do camarim avisando os observadores
+ */
+bool GerenciadorCamarins::removerItem(int camarimId, int itemId, int quantidade) {
+    Camarim* camarim = buscarPorId(camarimId);
+    if (camarim == nullptr) {
+        throw CamarimException("Camarim com ID " + to_string(camarimId) + " não encontrado");
+    }
+    Camarim antes;
+    bool avisar = temObservadores();
+    if (avisar) {
+        antes = *camarim;
+    }
+    
+    if (!camarim->removerItem(itemId, quantidade)) {
+        return false;  // Quantidade insuficiente: nada mudou
+    }
+    registrarAlteracao(camarimId, TipoAlteracaoCamarim::ITEM_REMOVIDO, itemId, quantidade);
+    if (avisar) {
+        notificar([&](ObservadorMutacoes* o) { o->aoMudarCamarim(&antes, camarim); });
+    }
+    return true;
+}
+
+/**
+ * Adiciona as linhas de um modelo: compartilha o map se o camarim está vazio
+ */
+void GerenciadorCamarins::abastecer(int camarimId, const CopiaNaEscrita<map<int, ItemCamarim>>& itens) {
+    Camarim* camarim = buscarPorId(camarimId);
+    if (camarim == nullptr) {
+        throw CamarimException("Camarim com ID " + to_string(camarimId) + " não encontrado");
+    }
+    if (itens.ler().empty()) {
+        return;  // Nada a adicionar
+    }
+    Camarim antes;
+    bool avisar = temObservadores();
+    if (avisar) {
+        antes = *camarim;  // O(1): compartilha o map atual
+    }
+    
+    if (camarim->getItens().empty()) {
+        camarim->compartilharItens(itens);  // Sem cópia até a primeira alteração
+    } else {
+        for (const auto& par : itens.ler()) {
+            camarim->inserirItem(par.first, par.second.nomeItem, par.second.quantidade);
+        }
+    }
+    for (const auto& par : itens.ler()) {
+        registrarAlteracao(camarimId, TipoAlteracaoCamarim::ITEM_INSERIDO, par.first, par.second.quantidade);
+    }
+    if (avisar) {
+        notificar([&](ObservadorMutacoes* o) { o->aoMudarCamarim(&antes, camarim); });
+    }
+}
+
+/**
+ * Retira todas as linhas: um aviso só, mesmo com muitas linhas
+ */
+map<int, ItemCamarim> GerenciadorCamarins::esvaziar(int camarimId) {
+    Camarim* camarim = buscarPorId(camarimId);
+    if (camarim == nullptr) {
+        throw CamarimException("Camarim com ID " + to_string(camarimId) + " não encontrado");
+    }
+    map<int, ItemCamarim> linhas = camarim->getItens();
+    if (linhas.empty()) {
+        return linhas;  // Nada a retirar
+    }
+    Camarim antes;
+    bool avisar = temObservadores();
+    if (avisar) {
+        antes = *camarim;  // O(1): compartilha o map atual
+    }
+    
+    camarim->compartilharItens(CopiaNaEscrita<map<int, ItemCamarim>>());  // Vazio, sem alocação
+    for (const auto& par : linhas) {
+        registrarAlteracao(camarimId, TipoAlteracaoCamarim::ITEM_REMOVIDO, par.first, par.second.quantidade);
+    }
+    if (avisar) {
+        notificar([&](ObservadorMutacoes* o) { o->aoMudarCamarim(&antes, camarim); });
+    }
+    return linhas;
+}
+
+/**
+ * Restaura um camarim (desfazer/refazer): substitui ou recria com o mesmo ID
+ */
+void GerenciadorCamarins::restaurar(const Camarim& estado) {
+    int id = estado.getId();
+    
+    Camarim* camarim = camarins.buscar(id);
+    if (camarim != nullptr) {
+        Camarim antes = *camarim;
+        camarins.alterar(*camarim, [&](Camarim& c) { c = estado; });
+        registrarAlteracao(id, TipoAlteracaoCamarim::ATUALIZADO);
+        notificar([&](ObservadorMutacoes* o) { o->aoMudarCamarim(&antes, camarim); });
+        return;
+    }
+    
+    // Camarim removido: o repositório o devolve à posição do seu ID
+    Camarim& recriado = camarins.inserir(estado);
+    registrarAlteracao(id, TipoAlteracaoCamarim::CRIADO);
+    
+    notificar([&](ObservadorMutacoes* o) { o->aoMudarCamarim(nullptr, &recriado); });
+}
+
+/**
+ * Anexa alteração ao histórico (Relogio::agora() mantém a ordem de tempo)
+ */
+void GerenciadorCamarins::registrarAlteracao(int camarimId, TipoAlteracaoCamarim tipo, int itemId,
+                                             int quantidade) {
+    alteracoes.push_back(AlteracaoCamarim{Relogio::agora(), camarimId, tipo, itemId, quantidade});
+}
+
+/**
+ * Alterações no período [inicio, fim], opcionalmente de um único camarim
+ */
+vector<AlteracaoCamarim> GerenciadorCamarins::alteracoesEntre(long long inicio, long long fim,
+                                                              int camarimId) const {
+    vector<AlteracaoCamarim> resultado =
+        registrosEntre(alteracoes, inicio, fim, [](const AlteracaoCamarim& a) { return a.tempo; });
+    if (camarimId != 0) {
+        resultado.erase(remove_if(resultado.begin(), resultado.end(),
+                                  [camarimId](const AlteracaoCamarim& a) { return a.camarimId != camarimId; }),
+                        resultado.end());
+    }
+    return resultado;
+}
+
+// ==================== Struct AlteracaoCamarim ====================
+
+/**
+ * Descrição legível da alteração
+ */
+string AlteracaoCamarim::descricao() const {
+    switch (tipo) {
+        case TipoAlteracaoCamarim::CRIADO:        return "criado";
+        case TipoAlteracaoCamarim::ATUALIZADO:    return "atualizado";
+        case TipoAlteracaoCamarim::REMOVIDO:      return "removido";
+        case TipoAlteracaoCamarim::ITEM_INSERIDO:
+            return "item " + to_string(itemId) + " inserido (x" + to_string(quantidade) + ")";
+        case TipoAlteracaoCamarim::ITEM_REMOVIDO:
+            return "item " + to_string(itemId) + " removido (x" + to_string(quantidade) + ")";
+    }
+    return "?";
+}
@@ -0,0 +1,254 @@
+/**
+ * @file congelado.cpp
+ * @brief Implementação do CatalogoCongelado (hash perfeito mínimo)
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ */
+
+// Inclui o header com as declarações
+#include "congelado.h"
+// Para normalizarNome
+#include "busca.h"
+// Para ValidacaoException
+#include "excecoes.h"
+// Para sort
+#include <algorithm>
+// Para move
+#include <utility>
+
+// ==================== Funções de hash ====================
+
+/**
+ * Finalizador do splitmix64: espalha bem e é bijetor (IDs distintos -> hashes distintos)
+ */
+static uint64_t espalhar(uint64_t x) {
+    x += 0x9E3779B97F4A7C15ULL;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    return x ^ (x >> 31);
+}
+
+// Reduz um hash a [0, n) com multiplicação e deslocamento (bem mais barato que %)
+static size_t reduzir(uint64_t hash, size_t n) {
+    return static_cast<size_t>(((hash >> 32) * static_cast<uint64_t>(n)) >> 32);
+}
+
+static uint64_t hashDoId(int id) {
+    return espalhar(static_cast<uint32_t>(id));
+}
+
+// FNV-1a de 64 bits (determinístico em qualquer compilador, ao contrário de std::hash)
+static uint64_t hashDoNome(const string& normalizado) {
+    uint64_t h = 0xCBF29CE484222325ULL;
+    for (unsigned char c : normalizado) {
+        h = (h ^ c) * 0x100000001B3ULL;
+    }
+    return h;
+}
+
+// ==================== TabelaPerfeita ====================
+
+size_t CatalogoCongelado::TabelaPerfeita::entrada(uint64_t hash) const {
+    int32_t d = deslocamentos[reduzir(espalhar(hash ^ semente), deslocamentos.size())];
+    if (d < 0) {
+        return static_cast<size_t>(-d - 1);  // Grupo de uma chave: posição direta
+    }
+    return reduzir(espalhar(hash + semente + static_cast<uint64_t>(d) * 0x9E3779B97F4A7C15ULL), tamanho);
+}
+
+/**
+ * Hash-and-displace: grupos maiores primeiro (mais difíceis de encaixar),
+ * grupos de uma chave por último, direto nas posições que sobraram.
+ * Tudo em vectors planos: chaves agrupadas por counting sort (sem um vector por grupo).
+ */
+bool CatalogoCongelado::TabelaPerfeita::montar(const vector<uint64_t>& hashes, vector<uint32_t>& entradaDaChave) {
+    const size_t n = hashes.size();
+    const size_t grupos = max<size_t>(1, (n + 1) / 2);  // ~2 chaves por grupo: montagem rápida
+    const int32_t LIMITE_DESLOCAMENTO = 1 << 20;
+    tamanho = n;
+    entradaDaChave.assign(n, 0);
+
+    vector<uint32_t> grupoDaChave(n);
+    vector<uint32_t> inicio(grupos + 1);   // Chaves do grupo g: chaves[inicio[g] .. inicio[g + 1])
+    vector<uint32_t> chaves(n);
+    vector<uint32_t> ordem(grupos);        // Grupos do maior para o menor
+    vector<uint8_t> ocupada(n);
+    vector<size_t> tentativas;             // Entradas do grupo para o deslocamento em teste
+
+    for (uint64_t tentativa = 1; tentativa <= 8; tentativa++) {
+        semente = espalhar(tentativa);
+        deslocamentos.assign(grupos, 0);
+        if (n == 0) {
+            return true;
+        }
+
+        // Counting sort das chaves por grupo
+        fill(inicio.begin(), inicio.end(), 0);
+        for (size_t k = 0; k < n; k++) {
+            grupoDaChave[k] = static_cast<uint32_t>(reduzir(espalhar(hashes[k] ^ semente), grupos));
+            inicio[grupoDaChave[k] + 1]++;
+        }
+        size_t maior = 0;
+        for (size_t g = 0; g < grupos; g++) {
+            maior = max<size_t>(maior, inicio[g + 1]);
+            inicio[g + 1] += inicio[g];
+        }
+        vector<uint32_t> proxima(inicio.begin(), inicio.end() - 1);
+        for (size_t k = 0; k < n; k++) {
+            chaves[proxima[grupoDaChave[k]]++] = static_cast<uint32_t>(k);
+        }
+        // Counting sort dos grupos por tamanho (decrescente)
+        vector<uint32_t> porTamanho(maior + 2, 0);
+        for (size_t g = 0; g < grupos; g++) {
+            porTamanho[maior - (inicio[g + 1] - inicio[g]) + 1]++;
+        }
+        for (size_t t = 1; t < porTamanho.size(); t++) {
+            porTamanho[t] += porTamanho[t - 1];
+        }
+        for (size_t g = 0; g < grupos; g++) {
+            ordem[porTamanho[maior - (inicio[g + 1] - inicio[g])]++] = static_cast<uint32_t>(g);
+        }
+
+        fill(ocupada.begin(), ocupada.end(), 0);
+        bool montou = true;
+        size_t i = 0;
+        for (; i < grupos && inicio[ordem[i] + 1] - inicio[ordem[i]] > 1; i++) {
+            const uint32_t g = ordem[i];
+            int32_t d = 0;
+            for (; d < LIMITE_DESLOCAMENTO; d++) {
+                tentativas.clear();
+                for (uint32_t c = inicio[g]; c < inicio[g + 1]; c++) {
+                    size_t e = reduzir(espalhar(hashes[chaves[c]] + semente + static_cast<uint64_t>(d) * 0x9E3779B97F4A7C15ULL), n);
+                    if (ocupada[e] || find(tentativas.begin(), tentativas.end(), e) != tentativas.end()) {
+                        break;
+                    }
+                    tentativas.push_back(e);
+                }
+                if (tentativas.size() == inicio[g + 1] - inicio[g]) {
+                    break;
+                }
+            }
+            if (d == LIMITE_DESLOCAMENTO) {
+                montou = false;  // Hashes repetidos (ou muito azar): tenta outra semente
+                break;
+            }
+            deslocamentos[g] = d;
+            for (uint32_t c = inicio[g]; c < inicio[g + 1]; c++) {
+                ocupada[tentativas[c - inicio[g]]] = 1;
+                entradaDaChave[chaves[c]] = static_cast<uint32_t>(tentativas[c - inicio[g]]);
+            }
+        }
+        if (!montou) {
+            continue;
+        }
+
+        // Grupos de uma chave: cada um fica com uma posição livre
+        size_t livre = 0;
+        for (; i < grupos && inicio[ordem[i] + 1] - inicio[ordem[i]] == 1; i++) {
+            while (ocupada[livre]) {
+                livre++;
+            }
+            ocupada[livre] = 1;
+            deslocamentos[ordem[i]] = -static_cast<int32_t>(livre) - 1;
+            entradaDaChave[chaves[inicio[ordem[i]]]] = static_cast<uint32_t>(livre);
+        }
+        return true;
+    }
+    return false;
+}
+
+// ==================== CatalogoCongelado ====================
+
+CatalogoCongelado::CatalogoCongelado(const vector<int>& ids, const vector<string>& nomes) {
+    // ===== IDs (distintos por construção do catálogo) =====
+    vector<uint64_t> hashes(ids.size());
+    for (size_t i = 0; i < ids.size(); i++) {
+        hashes[i] = hashDoId(ids[i]);
+    }
+    vector<uint32_t> entradaDaChave;
+    // Hash bijetor: IDs distintos sempre montam; falhar aqui é ID repetido
+    if (!tabelaIds.montar(hashes, entradaDaChave)) {
+        throw ValidacaoException("Catálogo congelado: IDs repetidos, tabela de IDs não montada");
+    }
+    entradasId.resize(ids.size());
+    for (size_t i = 0; i < ids.size(); i++) {
+        entradasId[entradaDaChave[i]] = EntradaId{ids[i], static_cast<uint32_t>(i)};
+    }
+
+    // ===== Nomes normalizados (o primeiro de cada nome vence) =====
+    // Repetidos saem ordenando por hash: nomes iguais ficam vizinhos, sem tabela de strings
+    vector<string> todos(nomes.size());
+    vector<pair<uint64_t, uint32_t>> porHash(nomes.size());
+    for (size_t i = 0; i < nomes.size(); i++) {
+        todos[i] = normalizarNome(nomes[i]);
+        porHash[i] = make_pair(hashDoNome(todos[i]), static_cast<uint32_t>(i));
+    }
+    sort(porHash.begin(), porHash.end());
+    vector<string> normalizados;
+    vector<uint32_t> posicoes;
+    hashes.clear();
+    for (size_t i = 0; i < porHash.size(); i++) {
+        // Mesmo hash: repetido se o texto é igual ao de um nome já aceito com esse hash
+        bool repetido = false;
+        for (size_t j = hashes.size(); j-- > 0 && hashes[j] == porHash[i].first && !repetido;) {
+            repetido = normalizados[j] == todos[porHash[i].second];
+        }
+        if (!repetido) {  // Dentro do mesmo hash, a menor posição vem primeiro
+            hashes.push_back(porHash[i].first);
+            posicoes.push_back(porHash[i].second);
+            normalizados.push_back(move(todos[porHash[i].second]));
+        }
+    }
+    entradasNome.resize(normalizados.size());
+    nomesPorEntrada.resize(normalizados.size());
+    if (!tabelaNomes.montar(hashes, entradaDaChave)) {
+        // Dois nomes com o mesmo hash de 64 bits: sem tabela, busca sequencial
+        tabelaNomes.deslocamentos.clear();
+        for (size_t i = 0; i < normalizados.size(); i++) {
+            entradaDaChave[i] = static_cast<uint32_t>(i);
+        }
+    }
+    for (size_t i = 0; i < normalizados.size(); i++) {
+        entradasNome[entradaDaChave[i]] = EntradaNome{hashes[i], posicoes[i]};
+        nomesPorEntrada[entradaDaChave[i]] = move(normalizados[i]);
+    }
+}
+
+size_t CatalogoCongelado::posicaoDoId(int id) const {
+    if (entradasId.empty()) {
+        return NAO_ENCONTRADO;
+    }
+    const EntradaId& e = entradasId[tabelaIds.entrada(hashDoId(id))];
+    return e.id == id ? e.posicao : NAO_ENCONTRADO;
+}
+
+size_t CatalogoCongelado::posicaoDoNome(const string& nome) const {
+    if (entradasNome.empty()) {
+        return NAO_ENCONTRADO;
+    }
+    string normalizado = normalizarNome(nome);
+    uint64_t hash = hashDoNome(normalizado);
+
+    if (tabelaNomes.deslocamentos.empty()) {  // Tabela não montada: busca sequencial
+        for (size_t i = 0; i < entradasNome.size(); i++) {
+            if (entradasNome[i].hash == hash && nomesPorEntrada[i] == normalizado) {
+                return entradasNome[i].posicao;
+            }
+        }
+        return NAO_ENCONTRADO;
+    }
+    size_t i = tabelaNomes.entrada(hash);
+    if (entradasNome[i].hash == hash && nomesPorEntrada[i] == normalizado) {
+        return entradasNome[i].posicao;
+    }
+    return NAO_ENCONTRADO;
+}
+
+size_t CatalogoCongelado::tamanho() const {
+    return entradasId.size();
+}
+
+size_t CatalogoCongelado::nomesDistintos() const {
+    return entradasNome.size();
+}
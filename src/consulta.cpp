@@ -0,0 +1,198 @@
+/**
+ * @file consulta.cpp
+ * @brief Implementação das condições e do acesso aos campos das entidades
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ *
+ * Campos disponíveis por entidade (tabelas em esquema.h):
+ *   Item          ID, NOME, PRECO
+ *   ItemEstoque   ID (itemId), NOME, QUANTIDADE
+ *   Artista       ID, NOME, CAMARIM
+ *   Camarim       ID, NOME, ARTISTA, QUANTIDADE (soma dos itens)
+ *   Pedido        ID, NOME (artista), CAMARIM, ATENDIDO, QUANTIDADE (soma dos itens)
+ *   ListaCompras  ID, NOME (descrição), PRECO (total), QUANTIDADE (soma dos itens)
+ */
+
+// Inclui o header com as declarações
+#include "consulta.h"
+// Entidades consultadas e suas tabelas de campos
+#include "esquema.h"
+// Normalização de nomes (operador CONTEM)
+#include "busca.h"
+// Faixa de int (valorInteiro)
+#include <limits>
+// floor
+#include <cmath>
+
+// ==================== Classe Consulta ====================
+
+/**
+ * Construtor - consulta vazia (todos os registros, ordem de cadastro)
+ */
+Consulta::Consulta() : limite(0) {}
+
+/**
+ * Adiciona condição numérica
+ */
+Consulta& Consulta::onde(Campo campo, Operador operador, double valor, double valorFinal) {
+    if (operador == Operador::CONTEM) {
+        throw ValidacaoException("Operador CONTEM só se aplica a texto");
+    }
+    condicoes.push_back(Condicao{campo, operador, false, valor, valorFinal, ""});
+    return *this;  // Retorna a própria consulta: permite encadear chamadas
+}
+
+/**
+ * Adiciona condição textual
+ */
+Consulta& Consulta::ondeTexto(Campo campo, Operador operador, const string& texto) {
+    if (operador != Operador::IGUAL && operador != Operador::DIFERENTE &&
+        operador != Operador::CONTEM) {
+        throw ValidacaoException("Texto só aceita os operadores IGUAL, DIFERENTE e CONTEM");
+    }
+    // CONTEM compara nomes normalizados: normaliza a consulta uma única vez
+    string valor = operador == Operador::CONTEM ? normalizarNome(texto) : texto;
+    condicoes.push_back(Condicao{campo, operador, true, 0.0, 0.0, valor});
+    return *this;
+}
+
+/**
+ * Adiciona critério de ordenação
+ */
+Consulta& Consulta::ordenarPor(Campo campo, bool crescente) {
+    ordenacoes.push_back(Ordenacao{campo, crescente});
+    return *this;
+}
+
+/**
+ * Limita a quantidade de resultados
+ */
+Consulta& Consulta::limitar(size_t quantidade) {
+    limite = quantidade;
+    return *this;
+}
+
+const vector<Condicao>& Consulta::getCondicoes() const { return condicoes; }
+size_t Consulta::getLimite() const { return limite; }
+
+/**
+ * Procura condição de igualdade inteira sobre o campo
+ */
+bool Consulta::igualdadeInteira(Campo campo, int& valor) const {
+    for (const Condicao& c : condicoes) {
+        if (c.campo == campo && !c.textual && c.operador == Operador::IGUAL && valorInteiro(c.valor, valor)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// ==================== Struct Condicao ====================
+
+/**
+ * Avalia condição numérica
+ */
+bool Condicao::avaliar(double numero) const {
+    switch (operador) {
+        case Operador::IGUAL:       return numero == valor;
+        case Operador::DIFERENTE:   return numero != valor;
+        case Operador::MENOR:       return numero < valor;
+        case Operador::MENOR_IGUAL: return numero <= valor;
+        case Operador::MAIOR:       return numero > valor;
+        case Operador::MAIOR_IGUAL: return numero >= valor;
+        case Operador::ENTRE:       return numero >= valor && numero <= valorFinal;
+        default:                    return false;
+    }
+}
+
+/**
+ * Avalia condição textual
+ */
+bool Condicao::avaliarTexto(const string& valorCampo) const {
+    switch (operador) {
+        case Operador::IGUAL:     return valorCampo == texto;
+        case Operador::DIFERENTE: return valorCampo != texto;
+        case Operador::CONTEM:    return normalizarNome(valorCampo).find(texto) != string::npos;
+        default:                  return false;
+    }
+}
+
+/**
+ * Faixa conferida em double ANTES do cast: converter para int um valor
+ * fora da faixa é comportamento indefinido (NaN falha nas comparações)
+ */
+bool valorInteiro(double valor, int& inteiro) {
+    if (!(valor >= numeric_limits<int>::min() && valor <= numeric_limits<int>::max()) || valor != floor(valor)) {
+        return false;
+    }
+    inteiro = static_cast<int>(valor);
+    return true;
+}
+
+/**
+ * Nome legível do campo
+ */
+string nomeCampo(Campo campo) {
+    switch (campo) {
+        case Campo::ID:         return "id";
+        case Campo::NOME:       return "nome";
+        case Campo::PRECO:      return "preco";
+        case Campo::QUANTIDADE: return "quantidade";
+        case Campo::CAMARIM:    return "camarim";
+        case Campo::ARTISTA:    return "artista";
+        case Campo::ATENDIDO:   return "atendido";
+    }
+    return "?";
+}
+
+// ==================== Acesso aos campos ====================
+// Gerado a partir das tabelas de esquema.h (um campo = uma chamada direta ao getter)
+
+bool campoNumerico(const Item& item, Campo campo, double& valor) {
+    return esquema::lerNumero(item, campo, valor);
+}
+
+bool campoNumerico(const ItemEstoque& item, Campo campo, double& valor) {
+    return esquema::lerNumero(item, campo, valor);
+}
+
+bool campoNumerico(const Artista& artista, Campo campo, double& valor) {
+    return esquema::lerNumero(artista, campo, valor);
+}
+
+bool campoNumerico(const Camarim& camarim, Campo campo, double& valor) {
+    return esquema::lerNumero(camarim, campo, valor);
+}
+
+bool campoNumerico(const Pedido& pedido, Campo campo, double& valor) {
+    return esquema::lerNumero(pedido, campo, valor);
+}
+
+bool campoNumerico(const ListaCompras& lista, Campo campo, double& valor) {
+    return esquema::lerNumero(lista, campo, valor);
+}
+
+const string* campoTexto(const Item& item, Campo campo) {
+    return esquema::lerTexto(item, campo);
+}
+
+const string* campoTexto(const ItemEstoque& item, Campo campo) {
+    return esquema::lerTexto(item, campo);
+}
+
+const string* campoTexto(const Artista& artista, Campo campo) {
+    return esquema::lerTexto(artista, campo);
+}
+
+const string* campoTexto(const Camarim& camarim, Campo campo) {
+    return esquema::lerTexto(camarim, campo);
+}
+
+const string* campoTexto(const Pedido& pedido, Campo campo) {
+    return esquema::lerTexto(pedido, campo);
+}
+
+const string* campoTexto(const ListaCompras& lista, Campo campo) {
+    return esquema::lerTexto(lista, campo);
+}
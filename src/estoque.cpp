@@ -12,16 +12,29 @@
 #include "estoque.h"
 // Inclui exceções customizadas
 #include "excecoes.h"
+// Regras dos campos (tabela constexpr do ItemEstoque)
+#include "esquema.h"
 // Para stringstream (construir strings)
 #include <sstream>
 // Para formatação (setw, left)
 #include <iomanip>
+// Para numeric_limits (limites da faixa de IDs)
+#include <limits>
+// Para ceil e floor
+#include <cmath>
+// Para push_heap, pop_heap, make_heap e sort (lotes)
+#include <algorithm>
+
+// Ordem do heap de lotes: 'a' sai depois de 'b' (vence depois; empate: entrou depois)
+static bool saiDepois(const LoteEstoque& a, const LoteEstoque& b) {
+    return a.validade != b.validade ? a.validade > b.validade : a.numero > b.numero;
+}
 
 /**
  * Construtor - inicializa map vazio
  */
-Estoque::Estoque() {}
-// Map é inicializado vazio automaticamente
+Estoque::Estoque() : proximoLote(1) {}
+// Maps são inicializados vazios automaticamente
 
 /**
  * Destrutor - libera recursos
@@ -33,18 +46,20 @@ Estoque::~Estoque() {}
  * Adiciona quantidade de item ao estoque (ENTRADA)
  */
 void Estoque::adicionarItem(int itemId, const string& nomeItem, int quantidade) {
-    // VALIDAÇÕES:
-    if (itemId < 0) {  // ID deve ser positivo
-        throw ValidacaoException("ID do item inválido");
-    }
+    adicionarLote(itemId, nomeItem, quantidade, LoteEstoque::SEM_VALIDADE);  // Entrada sem validade
+}
+
+/**
+ * Entrada de um lote com validade
+ */
+void Estoque::adicionarLote(int itemId, const string& nomeItem, int quantidade, long long validade) {
+    // VALIDAÇÕES: regras da tabela do ItemEstoque
+    esquema::validarCampo<ItemEstoque>(Campo::ID, itemId);
+    esquema::validarCampo<ItemEstoque>(Campo::NOME, nomeItem);
+    esquema::validarCampo<ItemEstoque>(Campo::QUANTIDADE, quantidade);
     
-    if (nomeItem.empty()) {  // Nome não pode ser vazio
-        throw ValidacaoException("Nome do item não pode ser vazio");
-    }
-    
-    if (quantidade < 0) {  // Quantidade não pode ser negativa
-        throw ValidacaoException("Quantidade não pode ser negativa");
-    }
+    int quantidadeAntes = obterQuantidade(itemId);  // Para avisar os observadores
+    vector<LoteEstoque> lotesAntes = lotesParaAviso(itemId);
     
     // Verifica se item já existe no estoque
     if (itens.find(itemId) != itens.end()) {
@@ -56,6 +71,9 @@ void Estoque::adicionarItem(int itemId, const string& nomeItem, int quantidade)
         itens[itemId] = ItemEstoque(itemId, nomeItem, quantidade);
         // Chama construtor parametrizado de ItemEstoque
     }
+    receberLote(itemId, quantidade, validade);
+    
+    registrarMudanca(itemId, itens[itemId].nomeItem, quantidadeAntes, obterMinimo(itemId), move(lotesAntes));
 }
 
 /**
@@ -83,7 +101,12 @@ bool Estoque::removerItem(int itemId, int quantidade) {
         // Mensagem formatada com valores atuais
     }
     
-    // Subtrai quantidade
+    int quantidadeAntes = itens[itemId].quantidade;
+    string nomeItem = itens[itemId].nomeItem;  // Cópia: o item pode sair do map
+    vector<LoteEstoque> lotesAntes = lotesParaAviso(itemId);
+    
+    // Subtrai quantidade (dos lotes que vencem primeiro)
+    consumirLotes(itemId, quantidade);
     itens[itemId].quantidade -= quantidade;
     
     // Remove item do map se quantidade chegar a zero
@@ -91,6 +114,7 @@ bool Estoque::removerItem(int itemId, int quantidade) {
         itens.erase(itemId);  // erase() remove elemento do map
     }
     
+    registrarMudanca(itemId, nomeItem, quantidadeAntes, obterMinimo(itemId), move(lotesAntes));
     return true;  // Sucesso
 }
 
@@ -148,6 +172,47 @@ vector<ItemEstoque> Estoque::listar() const {
     return lista;  // Retorna vector com cópias de todos os ItemEstoque
 }
 
+/**
+ * Executa consulta: condições sobre ID viram uma faixa do map ordenado
+ */
+ResultadoConsulta<ItemEstoque> Estoque::consultar(const Consulta& consulta) const {
+    consulta.validar<ItemEstoque>();
+    
+    // Faixa de IDs permitida pelas condições sobre o campo ID
+    double menor = numeric_limits<int>::min();
+    double maior = numeric_limits<int>::max();
+    bool usaFaixa = false;
+    
+    for (const Condicao& c : consulta.getCondicoes()) {
+        if (c.campo != Campo::ID || c.textual) {
+            continue;
+        }
+        usaFaixa = true;
+        switch (c.operador) {
+            case Operador::IGUAL:       menor = max(menor, ceil(c.valor)); maior = min(maior, floor(c.valor)); break;
+            case Operador::MENOR:       maior = min(maior, ceil(c.valor) - 1); break;
+            case Operador::MENOR_IGUAL: maior = min(maior, floor(c.valor)); break;
+            case Operador::MAIOR:       menor = max(menor, floor(c.valor) + 1); break;
+            case Operador::MAIOR_IGUAL: menor = max(menor, ceil(c.valor)); break;
+            case Operador::ENTRE:       menor = max(menor, ceil(c.valor)); maior = min(maior, floor(c.valorFinal)); break;
+            default: break;  // DIFERENTE não restringe a faixa
+        }
+    }
+    
+    // Endereços dos itens dentro da faixa (o map já está ordenado por ID):
+    // o filtro roda sobre o próprio map e só os aprovados são copiados
+    vector<const ItemEstoque*> faixa;
+    if (menor <= maior) {
+        auto inicio = itens.lower_bound(static_cast<int>(menor));  // Primeiro ID >= menor
+        auto fim = itens.upper_bound(static_cast<int>(maior));     // Primeiro ID > maior
+        for (auto it = inicio; it != fim; ++it) {
+            faixa.push_back(&it->second);
+        }
+    }
+    
+    return consulta.executar(faixa, usaFaixa ? "faixa ordenada do map por ID" : "varredura vetorizada");
+}
+
 /**
  * Atualiza quantidade de um item (SUBSTITUI valor)
  */
@@ -161,47 +226,345 @@ void Estoque::atualizarQuantidade(int itemId, int novaQuantidade) {
         throw ValidacaoException("Quantidade não pode ser negativa");
     }
     
+    int quantidadeAntes = itens[itemId].quantidade;
+    string nomeItem = itens[itemId].nomeItem;
+    vector<LoteEstoque> lotesAntes = lotesParaAviso(itemId);
+    
     // SUBSTITUI quantidade (não soma como adicionarItem)
+    ajustarLotes(itemId, quantidadeAntes, novaQuantidade);
     itens[itemId].quantidade = novaQuantidade;
     
     // Remove item se nova quantidade for zero
     if (novaQuantidade == 0) {
         itens.erase(itemId);
     }
+    
+    registrarMudanca(itemId, nomeItem, quantidadeAntes, obterMinimo(itemId), move(lotesAntes));
 }
 
 /**
- * Exibe informações formatadas do estoque
+ * Define o estoque mínimo de um item
  */
-string Estoque::exibir() const {
-    stringstream ss;  // String stream para construir string
-    ss << "=== ESTOQUE ===" << endl;
+void Estoque::definirMinimo(int itemId, int minimo) {
+    if (itemId < 0) {
+        throw ValidacaoException("ID do item inválido");
+    }
+    if (minimo < 0) {
+        throw ValidacaoException("Estoque mínimo não pode ser negativo");
+    }
     
-    if (itens.empty()) {  // Se map está vazio
-        ss << "Estoque vazio" << endl;
+    int minimoAntes = obterMinimo(itemId);
+    if (minimo == 0) {
+        minimos.erase(itemId);  // 0 = sem mínimo (não guarda entrada vazia)
     } else {
-        // Cabeçalho da tabela
-        ss << left << setw(5) << "ID" << setw(30) << "Nome" 
-           << setw(10) << "Quantidade" << endl;
-        // left = alinha à esquerda
-        // setw(n) = define largura de n caracteres
-        
-        ss << string(45, '-') << endl;
-        // Linha separadora com 45 hífens
-        
-        // Percorre todos os itens do map
-        for (const auto& par : itens) {
-            const ItemEstoque& item = par.second;
-            // Referência constante ao ItemEstoque (evita cópia)
-            
-            ss << left << setw(5) << item.itemId 
-               << setw(30) << item.nomeItem
-               << setw(10) << item.quantidade << endl;
-            // Formata cada linha da tabela
+        minimos[itemId] = minimo;
+    }
+    
+    auto it = itens.find(itemId);
+    registrarMudanca(itemId, it == itens.end() ? "" : it->second.nomeItem, obterQuantidade(itemId), minimoAntes,
+                     lotesParaAviso(itemId));
+}
+
+/**
+ * Estoque mínimo de um item (0 se não definido)
+ */
+int Estoque::obterMinimo(int itemId) const {
+    auto it = minimos.find(itemId);
+    return it == minimos.end() ? 0 : it->second;
+}
+
+/**
+ * Todos os mínimos definidos
+ */
+map<int, int> Estoque::listarMinimos() const {
+    return minimos;  // Cópia do map
+}
+
+/**
+ * Restaura quantidade e mínimo de um item (desfazer/refazer)
+ */
+void Estoque::restaurar(int itemId, const string& nomeItem, int quantidade, int minimo) {
+    if (quantidade < 0 || minimo < 0) {
+        throw ValidacaoException("Quantidade não pode ser negativa");
+    }
+    
+    int quantidadeAntes = obterQuantidade(itemId);
+    int minimoAntes = obterMinimo(itemId);
+    vector<LoteEstoque> lotesAntes = lotesParaAviso(itemId);
+    auto it = itens.find(itemId);
+    string nome = it == itens.end() ? nomeItem : it->second.nomeItem;  // Nome atual tem prioridade
+    
+    ajustarLotes(itemId, quantidadeAntes, quantidade);
+    if (quantidade == 0) {
+        itens.erase(itemId);
+    } else if (it != itens.end()) {
+        it->second.quantidade = quantidade;
+    } else {
+        itens[itemId] = ItemEstoque(itemId, nomeItem, quantidade);
+    }
+    if (minimo == 0) {
+        minimos.erase(itemId);
+    } else {
+        minimos[itemId] = minimo;
+    }
+    
+    registrarMudanca(itemId, nome, quantidadeAntes, minimoAntes, move(lotesAntes));
+}
+
+/**
+ * Restaura exatamente os lotes e o mínimo de um item (desfazer/refazer)
+ */
+void Estoque::restaurarLotes(int itemId, const string& nomeItem, const vector<LoteEstoque>& lotesItem, int minimo) {
+    if (minimo < 0) {
+        throw ValidacaoException("Quantidade não pode ser negativa");
+    }
+    int total = 0;
+    for (const LoteEstoque& lote : lotesItem) {
+        if (lote.quantidade < 0) {
+            throw ValidacaoException("Quantidade não pode ser negativa");
+        }
+        total += lote.quantidade;
+    }
+    
+    int quantidadeAntes = obterQuantidade(itemId);
+    int minimoAntes = obterMinimo(itemId);
+    vector<LoteEstoque> lotesAntes = lotesParaAviso(itemId);
+    auto it = itens.find(itemId);
+    string nome = it == itens.end() ? nomeItem : it->second.nomeItem;  // Nome atual tem prioridade
+    
+    descartarLotes(itemId);
+    for (const LoteEstoque& lote : lotesItem) {
+        if (lote.quantidade == 0) {
+            continue;
+        }
+        LoteEstoque restaurado = lote;
+        restaurado.itemId = itemId;
+        lotes[itemId].push_back(restaurado);
+        if (restaurado.validade != LoteEstoque::SEM_VALIDADE) {
+            vencimentos[make_pair(restaurado.validade, restaurado.numero)] = restaurado;
+        }
+        proximoLote = max(proximoLote, restaurado.numero + 1);  // Números nunca se repetem
+    }
+    if (total > 0) {
+        make_heap(lotes[itemId].begin(), lotes[itemId].end(), saiDepois);
+    }
+    
+    if (total == 0) {
+        itens.erase(itemId);
+    } else if (it != itens.end()) {
+        it->second.quantidade = total;
+    } else {
+        itens[itemId] = ItemEstoque(itemId, nomeItem, total);
+    }
+    if (minimo == 0) {
+        minimos.erase(itemId);
+    } else {
+        minimos[itemId] = minimo;
+    }
+    
+    registrarMudanca(itemId, nome, quantidadeAntes, minimoAntes, move(lotesAntes));
+}
+
+// ==================== Lotes (FEFO) ====================
+
+/**
+ * Soma ao lote de mesma validade ou cria um lote novo no heap do item
+ */
+void Estoque::receberLote(int itemId, int quantidade, long long validade) {
+    if (quantidade == 0) {
+        return;  // Entrada vazia não cria lote
+    }
+    vector<LoteEstoque>& heap = lotes[itemId];
+    for (LoteEstoque& lote : heap) {
+        if (lote.validade == validade) {  // Mesma validade: a chave do heap não muda
+            lote.quantidade += quantidade;
+            if (validade != LoteEstoque::SEM_VALIDADE) {
+                vencimentos[make_pair(validade, lote.numero)].quantidade = lote.quantidade;
+            }
+            return;
         }
     }
+    LoteEstoque novo{itemId, proximoLote++, quantidade, validade};
+    heap.push_back(novo);
+    push_heap(heap.begin(), heap.end(), saiDepois);
+    if (validade != LoteEstoque::SEM_VALIDADE) {
+        vencimentos[make_pair(validade, novo.numero)] = novo;
+    }
+}
+
+/**
+ * Retira do topo do heap (o que vence primeiro) até completar a quantidade
+ */
+void Estoque::consumirLotes(int itemId, int quantidade) {
+    if (quantidade == 0) {
+        return;
+    }
+    auto it = lotes.find(itemId);  // Existe: quem chama já conferiu a quantidade
+    vector<LoteEstoque>& heap = it->second;
+    while (quantidade > 0) {
+        LoteEstoque& primeiro = heap.front();
+        int retirada = min(quantidade, primeiro.quantidade);
+        primeiro.quantidade -= retirada;
+        quantidade -= retirada;
+        bool temValidade = primeiro.validade != LoteEstoque::SEM_VALIDADE;
+        if (primeiro.quantidade > 0) {
+            if (temValidade) {
+                vencimentos[make_pair(primeiro.validade, primeiro.numero)].quantidade = primeiro.quantidade;
+            }
+        } else {
+            if (temValidade) {
+                vencimentos.erase(make_pair(primeiro.validade, primeiro.numero));
+            }
+            pop_heap(heap.begin(), heap.end(), saiDepois);
+            heap.pop_back();
+        }
+    }
+    if (heap.empty()) {
+        lotes.erase(it);
+    }
+}
+
+/**
+ * Nova quantidade total: menos = saída FEFO; mais = entrada sem validade
+ */
+void Estoque::ajustarLotes(int itemId, int antes, int depois) {
+    if (depois < antes) {
+        consumirLotes(itemId, antes - depois);
+    } else {
+        receberLote(itemId, depois - antes, LoteEstoque::SEM_VALIDADE);
+    }
+}
+
+/**
+ * Remove os lotes do item e suas entradas no índice
+ */
+void Estoque::descartarLotes(int itemId) {
+    auto it = lotes.find(itemId);
+    if (it == lotes.end()) {
+        return;
+    }
+    for (const LoteEstoque& lote : it->second) {
+        if (lote.validade != LoteEstoque::SEM_VALIDADE) {
+            vencimentos.erase(make_pair(lote.validade, lote.numero));
+        }
+    }
+    lotes.erase(it);
+}
+
+/**
+ * Lotes do item em ordem de saída (cópia do heap ordenada)
+ */
+vector<LoteEstoque> Estoque::listarLotes(int itemId) const {
+    auto it = lotes.find(itemId);
+    if (it == lotes.end()) {
+        return vector<LoteEstoque>();
+    }
+    vector<LoteEstoque> ordenados = it->second;
+    sort(ordenados.begin(), ordenados.end(),
+         [](const LoteEstoque& a, const LoteEstoque& b) { return saiDepois(b, a); });
+    return ordenados;
+}
+
+/**
+ * Lotes com validade em [inicio, fim]: faixa do índice ordenado
+ */
+vector<LoteEstoque> Estoque::lotesVencendo(long long inicio, long long fim) const {
+    vector<LoteEstoque> resultado;
+    if (inicio > fim) {
+        return resultado;
+    }
+    for (auto it = vencimentos.lower_bound(make_pair(inicio, numeric_limits<int>::min()));
+         it != vencimentos.end() && it->first.first <= fim; ++it) {
+        resultado.push_back(it->second);
+    }
+    return resultado;
+}
+
+/**
+ * Lotes que vencem entre agora e agora + horas
+ */
+vector<LoteEstoque> Estoque::lotesVencendoEm(int horas) const {
+    if (horas < 0) {
+        throw ValidacaoException("Quantidade de horas não pode ser negativa");
+    }
+    long long agora = Relogio::agora();
+    return lotesVencendo(agora, agora + horas * 3600LL * 1000000LL);
+}
+
+vector<LoteEstoque> Estoque::lotesParaAviso(int itemId) const {
+    return temObservadores() ? listarLotes(itemId) : vector<LoteEstoque>();
+}
+
+/**
+ * Movimentações no período [inicio, fim]
+ */
+vector<MovimentoEstoque> Estoque::movimentosEntre(long long inicio, long long fim) const {
+    return registrosEntre(movimentos, inicio, fim, [](const MovimentoEstoque& m) { return m.tempo; });
+}
+
+size_t Estoque::totalMovimentos() const {
+    return movimentos.size();
+}
+
+/**
+ * Registra a movimentação e avisa os observadores sobre a mudança do item
+ */
+void Estoque::registrarMudanca(int itemId, const string& nomeItem, int quantidadeAntes, int minimoAntes,
+                               vector<LoteEstoque> lotesAntes) {
+    int quantidadeDepois = obterQuantidade(itemId);
+    if (quantidadeDepois != quantidadeAntes) {
+        // Relogio::agora() nunca diminui: o histórico continua ordenado
+        movimentos.push_back(MovimentoEstoque{Relogio::agora(), itemId, nomeItem,
+                                              quantidadeAntes, quantidadeDepois});
+    }
+    if (!temObservadores()) {
+        return;
+    }
+    MudancaEstoque mudanca{itemId, nomeItem, quantidadeAntes, quantidadeDepois,
+                           minimoAntes, obterMinimo(itemId), move(lotesAntes), listarLotes(itemId)};
+    notificar([&](ObservadorMutacoes* o) { o->aoMudarEstoque(mudanca); });
+}
+
+/**
+ * Linha da tabela do estoque
+ */
+string ItemEstoque::exibir() const {
+    stringstream ss;
+    ss << left << setw(5) << itemId 
+       << setw(30) << nomeItem
+       << setw(10) << quantidade << endl;
+    // left = alinha à esquerda
+    // setw(n) = define largura de n caracteres
+    return ss.str();
+}
+
+/**
+ * Título e cabeçalho da tabela (usado quando há itens)
+ */
+string Estoque::cabecalhoExibicao() {
+    stringstream ss;
+    ss << "=== ESTOQUE ===" << endl;
+    ss << left << setw(5) << "ID" << setw(30) << "Nome" 
+       << setw(10) << "Quantidade" << endl;
+    ss << string(45, '-') << endl;
+    // Linha separadora com 45 hífens
+    return ss.str();
+}
+
+/**
+ * Exibe informações formatadas do estoque
+ */
+string Estoque::exibir() const {
+    if (itens.empty()) {  // Se map está vazio
+        return "=== ESTOQUE ===\nEstoque vazio\n";
+    }
     
-    return ss.str();  // Converte stringstream para string
+    string saida = cabecalhoExibicao();
+    // Percorre todos os itens do map; cada um formata a própria linha
+    for (const auto& par : itens) {
+        saida += par.second.exibir();
+    }
+    return saida;
 }
 
 /**
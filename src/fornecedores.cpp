@@ -0,0 +1,307 @@
+/**
+ * @file fornecedores.cpp
+ * @brief Implementação da TabelaFornecedores (ofertas por item e melhor preço)
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ */
+
+// Inclui o header com as declarações
+#include "fornecedores.h"
+// Para lower_bound
+#include <algorithm>
+
+// Ordem das ofertas de um item: menor preço por unidade, depois menor fornecedorId.
+// Produto cruzado em vez de divisão: preços iguais por unidade empatam exatamente.
+static bool maisBarata(const OfertaFornecedor& a, const OfertaFornecedor& b) {
+    double precoA = a.precoEmbalagem * b.unidadesEmbalagem;
+    double precoB = b.precoEmbalagem * a.unidadesEmbalagem;
+    if (precoA != precoB) {
+        return precoA < precoB;
+    }
+    return a.fornecedorId < b.fornecedorId;
+}
+
+// ==================== Structs ====================
+
+double OfertaFornecedor::precoUnitario() const {
+    return precoEmbalagem / unidadesEmbalagem;
+}
+
+double PedidoFornecedor::total() const {
+    double soma = 0.0;
+    for (const auto& item : itens) {
+        soma += item.subtotal;
+    }
+    return soma;
+}
+
+double DivisaoCompras::total() const {
+    double soma = 0.0;
+    for (const auto& pedido : pedidos) {
+        soma += pedido.total();
+    }
+    for (const auto& item : semOferta) {
+        soma += item.subtotal;
+    }
+    return soma;
+}
+
+// ==================== Classe TabelaFornecedores ====================
+
+TabelaFornecedores::TabelaFornecedores() {}
+
+/**
+ * Destrutor - sai da lista de observadores do catálogo
+ */
+TabelaFornecedores::~TabelaFornecedores() {
+    desconectar();
+}
+
+/**
+ * Fornecedores continuam; ofertas só valem para itens do catálogo conectado
+ */
+void TabelaFornecedores::conectar(GerenciadorItens& itens) {
+    desconectar();
+    for (auto par = ofertas.begin(); par != ofertas.end();) {
+        par = itens.buscarPorId(par->first) == nullptr ? ofertas.erase(par) : next(par);
+    }
+    this->itens = &itens;
+    itens.adicionarObservador(this);
+}
+
+void TabelaFornecedores::desconectar() {
+    if (itens) itens->removerObservador(this);
+    itens = nullptr;
+}
+
+void TabelaFornecedores::exigirConexao() const {
+    if (itens == nullptr) {
+        throw ItemException("Tabela de fornecedores não está conectada");
+    }
+}
+
+const string& TabelaFornecedores::exigirFornecedor(int fornecedorId) const {
+    auto fornecedor = fornecedores.find(fornecedorId);
+    if (fornecedor == fornecedores.end()) {
+        throw ValidacaoException("Fornecedor com ID " + to_string(fornecedorId) + " não encontrado");
+    }
+    return fornecedor->second;
+}
+
+// ==================== Fornecedores ====================
+
+AlocadorIds& TabelaFornecedores::getAlocadorIds() {
+    return ids;
+}
+
+int TabelaFornecedores::cadastrarFornecedor(const string& nome, AlocadorIds::Bloco* bloco) {
+    if (nome.empty()) {
+        throw ValidacaoException("Nome do fornecedor não pode ser vazio");
+    }
+    int id = bloco != nullptr ? bloco->alocar() : ids.alocar();
+    fornecedores[id] = nome;
+    return id;
+}
+
+bool TabelaFornecedores::removerFornecedor(int fornecedorId) {
+    if (fornecedores.erase(fornecedorId) == 0) {
+        return false;
+    }
+    // Poucas ofertas por item: procurar em cada item custa O(total de ofertas)
+    for (auto par = ofertas.begin(); par != ofertas.end();) {
+        vector<OfertaFornecedor>& doItem = par->second;
+        for (size_t i = 0; i < doItem.size(); i++) {
+            if (doItem[i].fornecedorId == fornecedorId) {
+                doItem.erase(doItem.begin() + i);  // No máximo uma oferta por fornecedor
+                break;
+            }
+        }
+        par = doItem.empty() ? ofertas.erase(par) : next(par);
+    }
+    return true;
+}
+
+vector<Fornecedor> TabelaFornecedores::listarFornecedores() const {
+    vector<Fornecedor> resultado;
+    for (const auto& par : fornecedores) {
+        resultado.push_back(Fornecedor{par.first, par.second});
+    }
+    return resultado;
+}
+
+// ==================== Ofertas ====================
+
+void TabelaFornecedores::definirOferta(int fornecedorId, int itemId, double precoEmbalagem,
+                                       int unidadesEmbalagem) {
+    exigirConexao();
+    exigirFornecedor(fornecedorId);
+    if (itens->buscarPorId(itemId) == nullptr) {
+        throw ItemException("Item com ID " + to_string(itemId) + " não encontrado");
+    }
+    if (precoEmbalagem < 0) {
+        throw ValidacaoException("Preço não pode ser negativo");
+    }
+    if (unidadesEmbalagem <= 0) {
+        throw ValidacaoException("Embalagem deve ter pelo menos uma unidade");
+    }
+
+    // Substitui: tira a oferta antiga e insere a nova na posição do seu preço
+    removerOferta(fornecedorId, itemId);
+    OfertaFornecedor nova{fornecedorId, itemId, precoEmbalagem, unidadesEmbalagem};
+    vector<OfertaFornecedor>& doItem = ofertas[itemId];
+    doItem.insert(lower_bound(doItem.begin(), doItem.end(), nova, maisBarata), nova);
+}
+
+bool TabelaFornecedores::removerOferta(int fornecedorId, int itemId) {
+    auto par = ofertas.find(itemId);
+    if (par == ofertas.end()) {
+        return false;
+    }
+    vector<OfertaFornecedor>& doItem = par->second;
+    for (size_t i = 0; i < doItem.size(); i++) {
+        if (doItem[i].fornecedorId == fornecedorId) {
+            doItem.erase(doItem.begin() + i);
+            if (doItem.empty()) {
+                ofertas.erase(par);
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
+vector<OfertaFornecedor> TabelaFornecedores::ofertasDe(int itemId) const {
+    auto par = ofertas.find(itemId);
+    return par == ofertas.end() ? vector<OfertaFornecedor>() : par->second;
+}
+
+/**
+ * Ofertas em ordem de preço por unidade: o custo de cada uma é pelo menos
+ * quantidade x preço por unidade, então a busca para quando esse limite
+ * passa do melhor custo (as seguintes só podem custar mais)
+ */
+CotacaoCompra TabelaFornecedores::cotar(int itemId, int quantidade) const {
+    exigirConexao();
+    if (itemId < 0) {
+        throw ValidacaoException("ID do item inválido");
+    }
+    if (quantidade <= 0) {
+        throw ValidacaoException("Quantidade deve ser maior que zero");
+    }
+
+    CotacaoCompra cotacao;
+    cotacao.itemId = itemId;
+    cotacao.quantidade = quantidade;
+
+    auto par = ofertas.find(itemId);
+    if (par == ofertas.end()) {
+        // Ninguém oferece: preço do catálogo, sem arredondar
+        const Item* item = itens->buscarPorId(itemId);
+        cotacao.unidades = quantidade;
+        cotacao.precoUnitario = item ? item->getPreco() : 0.0;
+        cotacao.custo = quantidade * cotacao.precoUnitario;
+        return cotacao;
+    }
+
+    for (const OfertaFornecedor& oferta : par->second) {
+        // Limite inferior (quantidade x preço por unidade) acima do melhor: nenhuma outra serve
+        if (cotacao.fornecedorId != 0
+            && quantidade * oferta.precoEmbalagem > cotacao.custo * oferta.unidadesEmbalagem) {
+            break;
+        }
+        int embalagens = (quantidade - 1) / oferta.unidadesEmbalagem + 1;  // Arredonda para cima
+        double custo = embalagens * oferta.precoEmbalagem;
+        if (cotacao.fornecedorId == 0 || custo < cotacao.custo) {
+            cotacao.fornecedorId = oferta.fornecedorId;
+            cotacao.embalagens = embalagens;
+            cotacao.unidades = embalagens * oferta.unidadesEmbalagem;
+            cotacao.precoUnitario = oferta.precoUnitario();
+            cotacao.custo = custo;
+        }
+    }
+    return cotacao;
+}
+
+// ==================== Listas de compras ====================
+
+int TabelaFornecedores::gerarListaCompras(GerenciadorListaCompras& listas, const string& descricao,
+                                          const vector<TransferenciaReposicao>& faltas) const {
+    exigirConexao();
+    if (faltas.empty()) {
+        throw ValidacaoException("Nenhum item a comprar");
+    }
+
+    // Soma as faltas de todos os camarins por item (map: lista em ordem de itemId)
+    map<int, ItemCompra> necessidades;
+    for (const auto& falta : faltas) {
+        ItemCompra& linha = necessidades[falta.itemId];
+        linha.itemId = falta.itemId;
+        linha.nomeItem = falta.nomeItem;
+        linha.quantidade += falta.quantidade;
+    }
+
+    vector<ItemCompra> linhas;
+    linhas.reserve(necessidades.size());
+    for (const auto& par : necessidades) {
+        CotacaoCompra cotacao = cotar(par.first, par.second.quantidade);
+        linhas.push_back(ItemCompra(par.first, par.second.nomeItem, cotacao.unidades, cotacao.precoUnitario));
+    }
+    return listas.criarComItens(descricao, linhas);
+}
+
+DivisaoCompras TabelaFornecedores::dividir(const ListaCompras& lista) const {
+    map<int, vector<ItemCompra>> porFornecedor;  // Pedidos em ordem de fornecedorId
+    DivisaoCompras divisao;
+
+    for (const auto& par : lista.getItens()) {  // Itens em ordem de itemId
+        const ItemCompra& linha = par.second;
+        CotacaoCompra cotacao = cotar(linha.itemId, linha.quantidade);
+        if (cotacao.fornecedorId == 0) {
+            divisao.semOferta.push_back(linha);
+        } else {
+            porFornecedor[cotacao.fornecedorId].push_back(
+                ItemCompra(linha.itemId, linha.nomeItem, cotacao.unidades, cotacao.precoUnitario));
+        }
+    }
+
+    divisao.pedidos.reserve(porFornecedor.size());
+    for (auto& par : porFornecedor) {
+        PedidoFornecedor pedido;
+        pedido.fornecedorId = par.first;
+        pedido.nomeFornecedor = fornecedores.at(par.first);  // Ofertas só existem de fornecedores cadastrados
+        pedido.itens = move(par.second);
+        divisao.pedidos.push_back(move(pedido));
+    }
+    return divisao;
+}
+
+ListasPorFornecedor TabelaFornecedores::dividirEmListas(GerenciadorListaCompras& listas, int listaId) const {
+    const ListaCompras* lista = listas.buscarPorId(listaId);
+    if (lista == nullptr) {
+        throw ListaComprasException("Lista com ID " + to_string(listaId) + " não encontrada");
+    }
+    // Divide antes de criar: criar listas pode mover a original no repositório
+    DivisaoCompras divisao = dividir(*lista);
+    string descricao = lista->getDescricao();
+
+    ListasPorFornecedor criadas;
+    for (const auto& pedido : divisao.pedidos) {
+        criadas.porFornecedor.push_back(listas.criarComItens(descricao + " - " + pedido.nomeFornecedor, pedido.itens));
+    }
+    if (!divisao.semOferta.empty()) {
+        criadas.semOferta = listas.criarComItens(descricao + " - Sem oferta", divisao.semOferta);
+    }
+    return criadas;
+}
+
+// ==================== Aviso do catálogo ====================
+
+void TabelaFornecedores::aoMudarItem(const Item* antes, const Item* depois) {
+    if (depois == nullptr) {
+        if (ofertas.erase(antes->getId()) > 0) {  // Item removido: ofertas deixam de valer
+            itens->avisarDescarte(
+                DescarteDependentes{TipoEntidade::ITEM, antes->getId(), "ofertas de fornecedores do item descartadas"});
+        }
+    }
+}
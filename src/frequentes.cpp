@@ -0,0 +1,239 @@
+/**
+ * @file frequentes.cpp
+ * @brief Implementação do Space-Saving e do observador ItensMaisPedidos
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ */
+
+// Inclui o header com as declarações
+#include "frequentes.h"
+// Para partial_sort e min
+#include <algorithm>
+// Relógio do sistema (instante das consultas por janela)
+#include "relogio.h"
+// Para ValidacaoException
+#include "excecoes.h"
+
+// Ordem de exibição: maior contagem, maior mínimo garantido, menor ID
+static bool maisFrequente(const ItemFrequente& a, const ItemFrequente& b) {
+    if (a.contagem != b.contagem) return a.contagem > b.contagem;
+    if (a.minimoGarantido() != b.minimoGarantido()) return a.minimoGarantido() > b.minimoGarantido();
+    return a.itemId < b.itemId;
+}
+
+// Mantém os k primeiros segundo maisFrequente (partial_sort: O(n log k))
+static vector<ItemFrequente> selecionar(vector<ItemFrequente> itens, size_t k) {
+    if (itens.size() > k) {
+        partial_sort(itens.begin(), itens.begin() + k, itens.end(), maisFrequente);
+        itens.resize(k);
+    } else {
+        sort(itens.begin(), itens.end(), maisFrequente);
+    }
+    return itens;
+}
+
+// ==================== Classe ResumoFrequencias ====================
+
+/**
+ * Construtor - resumo vazio com K contadores
+ */
+ResumoFrequencias::ResumoFrequencias(size_t capacidade) : capacidade(capacidade), total(0) {
+    if (capacidade == 0) {
+        throw ValidacaoException("Capacidade do resumo deve ser maior que zero");
+    }
+    contadores.reserve(capacidade);
+}
+
+/**
+ * Soma 1 ao contador da posição p
+ *
+ * Exemplo (contagens): [9 7 7 7 4], p = 3 (contagem 7, grupo começa em 1)
+ *   troca posições 3 e 1 -> [9 7 7 7 4] (itens trocados)
+ *   posição 1 vira 8      -> [9 8 7 7 4] (continua decrescente)
+ */
+void ResumoFrequencias::incrementar(size_t p) {
+    long long contagem = contadores[p].contagem;
+    size_t inicio = inicioGrupo[contagem];
+
+    // 1) Leva o item para o início do seu grupo de empatados
+    if (inicio != p) {
+        swap(contadores[inicio], contadores[p]);
+        posicao[contadores[inicio].itemId] = inicio;
+        posicao[contadores[p].itemId] = p;
+    }
+
+    // 2) O grupo antigo passa a começar na posição seguinte (ou deixa de existir)
+    if (inicio + 1 < contadores.size() && contadores[inicio + 1].contagem == contagem) {
+        inicioGrupo[contagem] = inicio + 1;
+    } else {
+        inicioGrupo.erase(contagem);
+    }
+
+    // 3) Soma 1: o item vira o último do grupo 'contagem + 1' (que fica logo antes)
+    contadores[inicio].contagem = contagem + 1;
+    if (inicioGrupo.find(contagem + 1) == inicioGrupo.end()) {
+        inicioGrupo[contagem + 1] = inicio;
+    }
+}
+
+/**
+ * Registra uma ocorrência do item
+ */
+void ResumoFrequencias::registrar(int itemId, const string& nomeItem) {
+    total++;
+
+    auto it = posicao.find(itemId);
+    if (it != posicao.end()) {
+        incrementar(it->second);  // Já monitorado
+        return;
+    }
+
+    size_t p;
+    if (contadores.size() < capacidade) {
+        // Espaço livre: novo contador com contagem 0 no fim (menor grupo)
+        p = contadores.size();
+        contadores.push_back(ItemFrequente{itemId, nomeItem, 0, 0});
+        if (inicioGrupo.find(0) == inicioGrupo.end()) {
+            inicioGrupo[0] = p;
+        }
+    } else {
+        // Cheio: ocupa o MENOR contador (o último), herdando sua contagem como erro
+        p = contadores.size() - 1;
+        posicao.erase(contadores[p].itemId);
+        contadores[p].itemId = itemId;
+        contadores[p].nomeItem = nomeItem;
+        contadores[p].erro = contadores[p].contagem;
+    }
+    posicao[itemId] = p;
+    incrementar(p);
+}
+
+const vector<ItemFrequente>& ResumoFrequencias::getContadores() const {
+    return contadores;
+}
+
+long long ResumoFrequencias::minimo() const {
+    return contadores.size() < capacidade ? 0 : contadores.back().contagem;
+}
+
+bool ResumoFrequencias::monitora(int itemId) const {
+    return posicao.find(itemId) != posicao.end();
+}
+
+long long ResumoFrequencias::getTotal() const {
+    return total;
+}
+
+void ResumoFrequencias::limpar() {
+    contadores.clear();
+    posicao.clear();
+    inicioGrupo.clear();
+    total = 0;
+}
+
+// ==================== Classe ItensMaisPedidos ====================
+
+/**
+ * Construtor - anel de baldes vazio
+ */
+ItensMaisPedidos::ItensMaisPedidos(size_t capacidade, int quantidadeBaldes, long long larguraBalde)
+    : geral(capacidade), larguraBalde(larguraBalde) {
+    if (quantidadeBaldes <= 0 || larguraBalde <= 0) {
+        throw ValidacaoException("Janela de tempo inválida");
+    }
+    baldes.assign(quantidadeBaldes, ResumoFrequencias(capacidade));
+    numeroBalde.assign(quantidadeBaldes, -1);
+}
+
+/**
+ * Destrutor - sai da lista de observadores
+ */
+ItensMaisPedidos::~ItensMaisPedidos() {
+    desconectar();
+}
+
+void ItensMaisPedidos::conectar(GerenciadorPedidos& pedidos) {
+    desconectar();
+    this->pedidos = &pedidos;
+    pedidos.adicionarObservador(this);
+}
+
+void ItensMaisPedidos::desconectar() {
+    if (pedidos) pedidos->removerObservador(this);
+    pedidos = nullptr;
+}
+
+/**
+ * Registra pedido do item: resumo geral + balde do instante
+ */
+void ItensMaisPedidos::registrar(int itemId, const string& nomeItem, long long instante) {
+    long long numero = instante / larguraBalde;
+    size_t posicaoAnel = static_cast<size_t>(numero % static_cast<long long>(baldes.size()));
+
+    if (numeroBalde[posicaoAnel] != numero) {
+        // Posição guardava um intervalo antigo (fora de qualquer janela): reaproveita
+        baldes[posicaoAnel].limpar();
+        numeroBalde[posicaoAnel] = numero;
+    }
+    baldes[posicaoAnel].registrar(itemId, nomeItem);
+    geral.registrar(itemId, nomeItem);
+}
+
+vector<ItemFrequente> ItensMaisPedidos::maisPedidos(size_t k) const {
+    return selecionar(geral.getContadores(), k);
+}
+
+/**
+ * Junta os resumos dos baldes da janela
+ *
+ * Um item ausente de um balde CHEIO pode ter ocorrido até minimo() vezes
+ * nele: soma esse valor à contagem e ao erro (mantém os limites). Em vez de
+ * testar cada item em cada balde, soma os mínimos de todos os baldes cheios
+ * uma vez e desconta o mínimo dos baldes em que o item aparece.
+ */
+vector<ItemFrequente> ItensMaisPedidos::maisPedidos(size_t k, int ultimosBaldes) const {
+    if (ultimosBaldes <= 0 || static_cast<size_t>(ultimosBaldes) > baldes.size()) {
+        throw ValidacaoException("Janela deve ter entre 1 e " + to_string(baldes.size()) + " intervalos");
+    }
+    long long atual = Relogio::agora() / larguraBalde;
+
+    unordered_map<int, ItemFrequente> juntos;
+    long long somaMinimos = 0;
+    for (size_t i = 0; i < baldes.size(); i++) {
+        if (numeroBalde[i] < 0 || numeroBalde[i] <= atual - ultimosBaldes || numeroBalde[i] > atual) {
+            continue;  // Vazio ou fora da janela
+        }
+        long long minimo = baldes[i].minimo();
+        somaMinimos += minimo;
+        for (const ItemFrequente& c : baldes[i].getContadores()) {
+            auto it = juntos.find(c.itemId);
+            if (it == juntos.end()) {
+                it = juntos.emplace(c.itemId, ItemFrequente{c.itemId, c.nomeItem, 0, 0}).first;
+            }
+            it->second.contagem += c.contagem - minimo;
+            it->second.erro += c.erro - minimo;
+        }
+    }
+
+    vector<ItemFrequente> itens;
+    itens.reserve(juntos.size());
+    for (auto& par : juntos) {
+        par.second.contagem += somaMinimos;
+        par.second.erro += somaMinimos;
+        itens.push_back(par.second);
+    }
+    return selecionar(itens, k);
+}
+
+long long ItensMaisPedidos::getTotal() const {
+    return geral.getTotal();
+}
+
+// ==================== Aviso dos pedidos ====================
+
+void ItensMaisPedidos::aoAdicionarItemPedido(const Pedido& pedido, int itemId, const string& nomeItem,
+                                             int) {
+    // Conta o pedido do item (não as unidades) no instante da alteração do pedido
+    registrar(itemId, nomeItem, pedido.getAtualizadoEm());
+}
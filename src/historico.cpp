@@ -0,0 +1,374 @@
+/**
+ * @file historico.cpp
+ * @brief Implementação dos comandos e do Historico (desfazer/refazer)
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ */
+
+// Inclui o header com as declarações
+#include "historico.h"
+// Para ValidacaoException
+#include "excecoes.h"
+
+// ==================== Comparação e descrição das entidades ====================
+// Avisos sem mudança real (ex: atualizar com os mesmos dados) não viram comando
+
+template <typename ItemMapa, typename Igual>
+static bool mesmosItens(const map<int, ItemMapa>& a, const map<int, ItemMapa>& b, Igual igual) {
+    if (a.size() != b.size()) {
+        return false;
+    }
+    for (auto i = a.begin(), j = b.begin(); i != a.end(); ++i, ++j) {
+        if (i->first != j->first || i->second.nomeItem != j->second.nomeItem ||
+            i->second.quantidade != j->second.quantidade || !igual(i->second, j->second)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool mesmoEstado(const Item& a, const Item& b) {
+    return a.getNome() == b.getNome() && a.getPreco() == b.getPreco()
+        && a.getCodigoBarras() == b.getCodigoBarras();
+}
+
+static bool mesmoEstado(const Artista& a, const Artista& b) {
+    return a.getNome() == b.getNome() && a.getCamarimId() == b.getCamarimId();
+}
+
+static bool mesmoEstado(const Camarim& a, const Camarim& b) {
+    return a.getNome() == b.getNome() && a.getArtistaId() == b.getArtistaId()
+        && mesmosItens(a.getItens(), b.getItens(), [](const ItemCamarim&, const ItemCamarim&) { return true; });
+}
+
+static bool mesmoEstado(const Pedido& a, const Pedido& b) {
+    return a.getCamarimId() == b.getCamarimId() && a.getNomeArtista() == b.getNomeArtista()
+        && a.isAtendido() == b.isAtendido() && a.getCriadoEm() == b.getCriadoEm()
+        && a.getAtualizadoEm() == b.getAtualizadoEm()
+        && mesmosItens(a.getItens(), b.getItens(), [](const ItemPedido&, const ItemPedido&) { return true; });
+}
+
+static bool mesmoEstado(const ListaCompras& a, const ListaCompras& b) {
+    return a.getDescricao() == b.getDescricao()
+        && mesmosItens(a.getItens(), b.getItens(), [](const ItemCompra& x, const ItemCompra& y) {
+               return x.preco == y.preco && x.subtotal == y.subtotal;
+           });
+}
+
+// Identificação curta da entidade: "item 3 (Agua)"
+static string rotulo(const Item& i) { return "item " + to_string(i.getId()) + " (" + i.getNome() + ")"; }
+static string rotulo(const Artista& a) { return "artista " + to_string(a.getId()) + " (" + a.getNome() + ")"; }
+static string rotulo(const Camarim& c) { return "camarim " + to_string(c.getId()) + " (" + c.getNome() + ")"; }
+static string rotulo(const Pedido& p) { return "pedido " + to_string(p.getId()) + " (" + p.getNomeArtista() + ")"; }
+static string rotulo(const ListaCompras& l) { return "lista " + to_string(l.getId()) + " (" + l.getDescricao() + ")"; }
+
+// Tipo da entidade (casado com DescarteDependentes::tipo)
+static TipoEntidade tipoDe(const Item*) { return TipoEntidade::ITEM; }
+static TipoEntidade tipoDe(const Artista*) { return TipoEntidade::ARTISTA; }
+static TipoEntidade tipoDe(const Camarim*) { return TipoEntidade::CAMARIM; }
+static TipoEntidade tipoDe(const Pedido*) { return TipoEntidade::PEDIDO; }
+static TipoEntidade tipoDe(const ListaCompras*) { return TipoEntidade::LISTA; }
+
+// ==================== Comandos ====================
+
+/**
+ * @struct Historico::Comando
+ * @brief Mutação reversível (POLIMORFISMO: entidade ou estoque)
+ */
+struct Historico::Comando {
+    long long numero = 0;  // Ordem de registro (comparado com marcadores)
+    string bloqueio;       // Dados descartados por módulos ("" = reversível)
+
+    virtual ~Comando() {}
+    virtual void aplicar(Historico& historico, bool desfazendo) const = 0;
+    virtual string descrever() const = 0;
+
+    // true se o comando registrou a remoção dessa entidade
+    virtual bool removeu(TipoEntidade, int) const { return false; }
+
+    void bloquear(const string& motivo) {
+        bloqueio += (bloqueio.empty() ? "" : "; ") + motivo;
+    }
+};
+
+/**
+ * @struct Historico::ComandoEntidade
+ * @brief Estado antes/depois de uma entidade (nullptr = não existia / foi removida)
+ */
+template <typename T>
+struct Historico::ComandoEntidade : Historico::Comando {
+    int id;
+    unique_ptr<T> antes;
+    unique_ptr<T> depois;
+
+    ComandoEntidade(const T* antes, const T* depois)
+        : id(antes ? antes->getId() : depois->getId()),
+          antes(antes ? new T(*antes) : nullptr),
+          depois(depois ? new T(*depois) : nullptr) {}
+
+    void aplicar(Historico& historico, bool desfazendo) const override {
+        historico.colocarEm(id, desfazendo ? antes.get() : depois.get());
+    }
+
+    string descrever() const override {
+        if (!antes) return "Cadastro de " + rotulo(*depois);
+        if (!depois) return "Remoção de " + rotulo(*antes);
+        return "Alteração de " + rotulo(*depois);
+    }
+
+    bool removeu(TipoEntidade tipo, int id) const override {
+        return !depois && tipo == tipoDe(antes.get()) && id == this->id;
+    }
+};
+
+/**
+ * @struct Historico::ComandoEstoque
+ * @brief Lotes (quantidade e validades) e mínimo de um item antes/depois
+ */
+struct Historico::ComandoEstoque : Historico::Comando {
+    MudancaEstoque mudanca;
+
+    explicit ComandoEstoque(const MudancaEstoque& mudanca) : mudanca(mudanca) {}
+
+    void aplicar(Historico& historico, bool desfazendo) const override {
+        historico.estoque->restaurarLotes(mudanca.itemId, mudanca.nomeItem,
+                                          desfazendo ? mudanca.lotesAntes : mudanca.lotesDepois,
+                                          desfazendo ? mudanca.minimoAntes : mudanca.minimoDepois);
+    }
+
+    string descrever() const override {
+        return "Estoque do item " + to_string(mudanca.itemId) + ": quantidade "
+               + to_string(mudanca.quantidadeAntes) + " -> " + to_string(mudanca.quantidadeDepois)
+               + ", mínimo " + to_string(mudanca.minimoAntes) + " -> " + to_string(mudanca.minimoDepois);
+    }
+};
+
+// ==================== Classe Historico ====================
+
+/**
+ * Construtor - histórico vazio
+ */
+Historico::Historico(size_t capacidade) : capacidade(capacidade) {
+    if (capacidade == 0) {
+        throw ValidacaoException("Capacidade do histórico deve ser maior que zero");
+    }
+}
+
+/**
+ * Destrutor - sai da lista de observadores
+ */
+Historico::~Historico() {
+    desconectar();
+}
+
+void Historico::conectar(GerenciadorItens& itens, GerenciadorArtistas& artistas,
+                         GerenciadorCamarins& camarins, GerenciadorPedidos& pedidos,
+                         GerenciadorListaCompras& listas, Estoque& estoque) {
+    desconectar();
+    this->itens = &itens;
+    this->artistas = &artistas;
+    this->camarins = &camarins;
+    this->pedidos = &pedidos;
+    this->listas = &listas;
+    this->estoque = &estoque;
+    itens.adicionarObservador(this);
+    artistas.adicionarObservador(this);
+    camarins.adicionarObservador(this);
+    pedidos.adicionarObservador(this);
+    listas.adicionarObservador(this);
+    estoque.adicionarObservador(this);
+}
+
+void Historico::desconectar() {
+    if (itens) itens->removerObservador(this);
+    if (artistas) artistas->removerObservador(this);
+    if (camarins) camarins->removerObservador(this);
+    if (pedidos) pedidos->removerObservador(this);
+    if (listas) listas->removerObservador(this);
+    if (estoque) estoque->removerObservador(this);
+    itens = nullptr;
+    artistas = nullptr;
+    camarins = nullptr;
+    pedidos = nullptr;
+    listas = nullptr;
+    estoque = nullptr;
+}
+
+/**
+ * Guarda novo comando: O(1)
+ */
+void Historico::registrar(unique_ptr<Comando> comando) {
+    comando->numero = proximoNumero++;
+    paraRefazer.clear();  // Nova alteração: o que foi desfeito não pode mais ser refeito
+
+    // Descartes avisados antes deste comando (módulos avisados antes do histórico)
+    for (const auto& descarte : pendentes) {
+        if (comando->removeu(descarte.tipo, descarte.id)) {
+            comando->bloquear(descarte.motivo);
+        }
+    }
+    pendentes.clear();
+
+    if (paraDesfazer.size() >= capacidade) {
+        ultimoDescartado = paraDesfazer.front()->numero;
+        paraDesfazer.pop_front();  // Descarta o mais antigo
+    }
+    paraDesfazer.push_back(move(comando));
+}
+
+template <typename T>
+void Historico::registrarEntidade(const T* antes, const T* depois) {
+    if (aplicando || (antes && depois && mesmoEstado(*antes, *depois))) {
+        return;  // Aviso do próprio desfazer/refazer ou sem mudança real
+    }
+    registrar(unique_ptr<Comando>(new ComandoEntidade<T>(antes, depois)));
+}
+
+/**
+ * Aplica o comando; os avisos gerados por ele não viram novos comandos
+ */
+void Historico::aplicar(Comando& comando, bool desfazendo) {
+    exigirReversivel(comando, desfazendo);
+    aplicando = true;
+    emAplicacao = &comando;  // Descartes causados por este passo bloqueiam o comando
+    try {
+        comando.aplicar(*this, desfazendo);
+    } catch (...) {
+        aplicando = false;
+        emAplicacao = nullptr;
+        throw;  // Comando continua onde estava
+    }
+    aplicando = false;
+    emAplicacao = nullptr;
+}
+
+void Historico::exigirReversivel(const Comando& comando, bool desfazendo) {
+    if (!comando.bloqueio.empty()) {
+        throw ValidacaoException(string("Não é possível ") + (desfazendo ? "desfazer" : "refazer")
+                                 + " \"" + comando.descrever() + "\": " + comando.bloqueio);
+    }
+}
+
+void Historico::colocarEm(int id, const Item* estado) {
+    if (estado) itens->restaurar(*estado); else itens->remover(id);
+}
+
+void Historico::colocarEm(int id, const Artista* estado) {
+    if (estado) artistas->restaurar(*estado); else artistas->remover(id);
+}
+
+void Historico::colocarEm(int id, const Camarim* estado) {
+    if (estado) camarins->restaurar(*estado); else camarins->remover(id);
+}
+
+void Historico::colocarEm(int id, const Pedido* estado) {
+    if (estado) pedidos->restaurar(*estado); else pedidos->remover(id);
+}
+
+void Historico::colocarEm(int id, const ListaCompras* estado) {
+    if (estado) listas->restaurar(*estado); else listas->remover(id);
+}
+
+/**
+ * Desfaz o comando mais recente
+ */
+bool Historico::desfazer() {
+    if (paraDesfazer.empty()) {
+        return false;
+    }
+    aplicar(*paraDesfazer.back(), true);
+    paraRefazer.push_back(move(paraDesfazer.back()));
+    paraDesfazer.pop_back();
+    return true;
+}
+
+/**
+ * Refaz o último comando desfeito
+ */
+bool Historico::refazer() {
+    if (paraRefazer.empty()) {
+        return false;
+    }
+    aplicar(*paraRefazer.back(), false);
+    paraDesfazer.push_back(move(paraRefazer.back()));  // Nunca passa da capacidade: veio de lá
+    paraRefazer.pop_back();
+    return true;
+}
+
+string Historico::proximoDesfazer() const {
+    return paraDesfazer.empty() ? "" : paraDesfazer.back()->descrever();
+}
+
+string Historico::proximoRefazer() const {
+    return paraRefazer.empty() ? "" : paraRefazer.back()->descrever();
+}
+
+long long Historico::marcar() const {
+    return proximoNumero;  // Comandos registrados depois terão número >= marcador
+}
+
+/**
+ * Desfaz tudo o que foi registrado depois do marcador
+ */
+int Historico::desfazerAte(long long marcador) {
+    if (marcador < 0 || marcador > proximoNumero) {
+        throw ValidacaoException("Marcador inválido");
+    }
+    if (marcador <= ultimoDescartado) {
+        // Parte das alterações já saiu do histórico: reverter só o resto seria enganoso
+        throw ValidacaoException("Marcador anterior ao início do histórico");
+    }
+
+    // Confere todos antes: parar no meio deixaria a reversão pela metade
+    for (auto it = paraDesfazer.rbegin(); it != paraDesfazer.rend() && (*it)->numero >= marcador; ++it) {
+        exigirReversivel(**it, true);
+    }
+
+    int desfeitos = 0;
+    while (!paraDesfazer.empty() && paraDesfazer.back()->numero >= marcador) {
+        desfazer();
+        desfeitos++;
+    }
+    return desfeitos;
+}
+
+vector<string> Historico::listar() const {
+    vector<string> descricoes;
+    for (auto it = paraDesfazer.rbegin(); it != paraDesfazer.rend(); ++it) {
+        descricoes.push_back((*it)->descrever());
+    }
+    return descricoes;
+}
+
+size_t Historico::totalDesfazer() const { return paraDesfazer.size(); }
+size_t Historico::totalRefazer() const { return paraRefazer.size(); }
+
+// ==================== Avisos dos gerenciadores ====================
+
+void Historico::aoMudarItem(const Item* antes, const Item* depois) { registrarEntidade(antes, depois); }
+void Historico::aoMudarArtista(const Artista* antes, const Artista* depois) { registrarEntidade(antes, depois); }
+void Historico::aoMudarCamarim(const Camarim* antes, const Camarim* depois) { registrarEntidade(antes, depois); }
+void Historico::aoMudarPedido(const Pedido* antes, const Pedido* depois) { registrarEntidade(antes, depois); }
+void Historico::aoMudarLista(const ListaCompras* antes, const ListaCompras* depois) { registrarEntidade(antes, depois); }
+
+void Historico::aoMudarEstoque(const MudancaEstoque& mudanca) {
+    if (aplicando || (mudanca.quantidadeAntes == mudanca.quantidadeDepois &&
+                      mudanca.minimoAntes == mudanca.minimoDepois)) {
+        return;
+    }
+    registrar(unique_ptr<Comando>(new ComandoEstoque(mudanca)));
+}
+
+/**
+ * Descarte de um módulo: bloqueia o comando da remoção que o causou
+ */
+void Historico::aoDescartarDependentes(const DescarteDependentes& descarte) {
+    if (aplicando) {
+        emAplicacao->bloquear(descarte.motivo);  // Causado pelo desfazer/refazer em curso
+    } else if (!paraDesfazer.empty() && paraDesfazer.back()->removeu(descarte.tipo, descarte.id)) {
+        paraDesfazer.back()->bloquear(descarte.motivo);  // Histórico avisado antes do módulo
+    } else {
+        pendentes.push_back(descarte);  // O comando da remoção ainda vai chegar
+    }
+}
@@ -0,0 +1,89 @@
+/**
+ * @file identificadores.cpp
+ * @brief Implementação do AlocadorIds (contador atômico + blocos por thread)
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ *
+ * Ordem de memória relaxed em todas as operações: o contador só precisa
+ * ser indivisível (faixas disjuntas). Os registros criados com os IDs são
+ * publicados por outros meios (ex: a trava de quem grava no gerenciador).
+ */
+
+// Inclui o header com as declarações
+#include "identificadores.h"
+// Para max
+#include <algorithm>
+
+// ==================== AlocadorIds ====================
+
+AlocadorIds::AlocadorIds(int primeiro, int tamanhoBloco)
+    : limite(primeiro), tamanhoBloco(max(1, tamanhoBloco)) {}
+
+int AlocadorIds::alocar() {
+    return limite.fetch_add(1, memory_order_relaxed);
+}
+
+pair<int, int> AlocadorIds::reservar(int quantidade) {
+    quantidade = max(1, quantidade);
+    int inicio = limite.fetch_add(quantidade, memory_order_relaxed);
+    return make_pair(inicio, inicio + quantidade);
+}
+
+bool AlocadorIds::devolver(int inicio, int fim) {
+    if (inicio >= fim) {
+        return true;  // Faixa vazia: nada a devolver
+    }
+    // Só recua se o limite ainda é o fim desta faixa (ninguém pegou IDs depois)
+    int esperado = fim;
+    return limite.compare_exchange_strong(esperado, inicio, memory_order_relaxed);
+}
+
+bool AlocadorIds::devolver(int id) {
+    return devolver(id, id + 1);
+}
+
+void AlocadorIds::observar(int id) {
+    int atual = limite.load(memory_order_relaxed);
+    // Máximo atômico: tenta de novo só se outra thread avançou o limite no meio
+    while (atual <= id && !limite.compare_exchange_weak(atual, id + 1, memory_order_relaxed)) {
+    }
+}
+
+int AlocadorIds::getLimite() const {
+    return limite.load(memory_order_relaxed);
+}
+
+int AlocadorIds::getTamanhoBloco() const {
+    return tamanhoBloco;
+}
+
+// ==================== Bloco ====================
+
+AlocadorIds::Bloco::Bloco(AlocadorIds& origem) : origem(origem), proximo(0), fim(0) {}
+
+AlocadorIds::Bloco::~Bloco() {
+    origem.devolver(proximo, fim);  // Sobra volta se este ainda for o último bloco
+}
+
+int AlocadorIds::Bloco::alocar() {
+    if (proximo == fim) {  // Faixa esgotada (ou bloco novo): pega a próxima
+        pair<int, int> faixa = origem.reservar(origem.getTamanhoBloco());
+        proximo = faixa.first;
+        fim = faixa.second;
+    }
+    return proximo++;
+}
+
+bool AlocadorIds::Bloco::devolver(int id) {
+    // O ID entregue por alocar() é sempre da faixa atual: basta recuar o cursor
+    if (id + 1 != proximo) {
+        return false;
+    }
+    proximo = id;
+    return true;
+}
+
+int AlocadorIds::Bloco::restantes() const {
+    return fim - proximo;
+}
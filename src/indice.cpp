@@ -0,0 +1,63 @@
+/**
+ * @file indice.cpp
+ * @brief Implementação do IndiceGrupos
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ */
+
+// Inclui o header com as declarações
+#include "indice.h"
+// Para lower_bound
+#include <algorithm>
+
+/**
+ * Adiciona ID ao grupo mantendo a ordem crescente
+ */
+void IndiceGrupos::inserir(int chave, int id) {
+    vector<int>& ids = grupos[chave];  // Cria o grupo vazio se ainda não existe
+    
+    if (ids.empty() || ids.back() < id) {
+        ids.push_back(id);  // Caso comum: IDs novos são sempre os maiores
+    } else {
+        auto pos = lower_bound(ids.begin(), ids.end(), id);
+        if (pos == ids.end() || *pos != id) {
+            ids.insert(pos, id);  // Reinserção (ex: atualização de chave)
+        }
+    }
+}
+
+/**
+ * Remove ID do grupo (busca binária: o grupo está ordenado)
+ */
+void IndiceGrupos::remover(int chave, int id) {
+    auto it = grupos.find(chave);
+    if (it == grupos.end()) {
+        return;
+    }
+    
+    vector<int>& ids = it->second;
+    auto pos = lower_bound(ids.begin(), ids.end(), id);
+    if (pos != ids.end() && *pos == id) {
+        ids.erase(pos);
+    }
+    if (ids.empty()) {
+        grupos.erase(it);  // Não guarda grupos vazios
+    }
+}
+
+/**
+ * IDs do grupo (referência para vetor vazio estático se não existir)
+ */
+const vector<int>& IndiceGrupos::buscar(int chave) const {
+    static const vector<int> vazio;  // Compartilhado por todas as buscas sem resultado
+    auto it = grupos.find(chave);
+    return it == grupos.end() ? vazio : it->second;
+}
+
+/**
+ * Remove todos os grupos
+ */
+void IndiceGrupos::limpar() {
+    grupos.clear();
+}
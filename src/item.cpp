@@ -10,6 +10,8 @@
 #include "item.h"
 // Inclui as classes de exceções customizadas do sistema
 #include "excecoes.h"
+// Regras dos campos (tabela constexpr do Item)
+#include "esquema.h"
 // Inclui algoritmos da STL (find_if, remove_if, etc)
 #include <algorithm>
 // Inclui stringstream para manipulação de strings
@@ -26,7 +28,9 @@ Item::Item() : id(0), nome(""), preco(0.0) {}
 
 // Construtor parametrizado - Recebe valores como parâmetros
 Item::Item(int id, const string& nome, double preco)
-    : id(id), nome(nome), preco(preco) {}  
+    : id(id), nome(nome), preco(preco) {
+    esquema::validar(*this);  // Mesmas regras dos setters, lidas da tabela em esquema.h
+}
 // Inicializa os atributos com os valores recebidos como parâmetros
 // const string& = referência constante (não copia a string, economiza memória)
 
@@ -42,42 +46,64 @@ int Item::getId() const {
     return id;  // Retorna cópia do valor do id
 }
 
-string Item::getNome() const {
-    return nome;  // Retorna cópia da string nome
+const string& Item::getNome() const {
+    return nome;  // Referência: quem precisa de cópia copia
 }
 
 double Item::getPreco() const {
     return preco;  // Retorna cópia do valor do preço
 }
 
+const string& Item::getCodigoBarras() const {
+    return codigoBarras;
+}
+
 // ==================== Setters com Validação ====================
 // Métodos para MODIFICAR os valores dos atributos privados
 // Incluem validações para garantir integridade dos dados
 
 void Item::setId(int id) {
-    if (id < 0) {  // VALIDAÇÃO: id não pode ser negativo
-        // Lança exceção se a validação falhar
-        throw ValidacaoException("ID do item não pode ser negativo");
-    }
+    // VALIDAÇÃO: id não pode ser negativo (lança exceção se a regra da tabela falhar)
+    esquema::validarCampo<Item>(Campo::ID, id);
     this->id = id;  // this-> diferencia o atributo do parâmetro
     // Só atribui se passou na validação
 }
 
 void Item::setNome(const string& nome) {
-    if (nome.empty()) {  // VALIDAÇÃO: nome não pode ser string vazia
-        // empty() retorna true se a string está vazia
-        throw ValidacaoException("Nome do item não pode ser vazio");
-    }
+    esquema::validarCampo<Item>(Campo::NOME, nome);  // VALIDAÇÃO: nome não pode ser string vazia
     this->nome = nome;  // Atribui o novo nome ao atributo
 }
 
 void Item::setPreco(double preco) {
-    if (preco < 0) {  // VALIDAÇÃO: preço não pode ser negativo (mas pode ser 0 = grátis)
-        throw ValidacaoException("Preço do item não pode ser negativo");
-    }
+    esquema::validarCampo<Item>(Campo::PRECO, preco);  // VALIDAÇÃO: preço não negativo (0 = grátis)
     this->preco = preco;  // Atribui o novo preço ao atributo
 }
 
+void Item::setCodigoBarras(const string& codigo) {
+    if (!codigo.empty() && !codigoBarrasValido(codigo)) {  // VALIDAÇÃO: vazio = sem código
+        throw ValidacaoException("Código de barras inválido: " + codigo);
+    }
+    codigoBarras = codigo;
+}
+
+// Dígito verificador GS1: pesos 3 e 1 alternados a partir da direita (sem o próprio dígito)
+bool Item::codigoBarrasValido(const string& codigo) {
+    size_t n = codigo.size();
+    if (n != 8 && n != 12 && n != 13 && n != 14) {
+        return false;
+    }
+    int soma = 0;
+    for (size_t i = 0; i < n; i++) {
+        if (codigo[i] < '0' || codigo[i] > '9') {
+            return false;
+        }
+        if (i + 1 < n) {
+            soma += (codigo[i] - '0') * ((n - 1 - i) % 2 == 1 ? 3 : 1);
+        }
+    }
+    return (10 - soma % 10) % 10 == codigo[n - 1] - '0';
+}
+
 // Exibe informações do item formatadas
 string Item::exibir() const {
     stringstream ss;  // Cria um stream de string para construir a saída formatada
@@ -86,8 +112,12 @@ string Item::exibir() const {
     // setprecision(2) = 2 casas decimais após a vírgula (ex: 2.50)
     
     ss << "Item [ID: " << id << ", Nome: " << nome 
-       << ", Preço: R$ " << preco << "]";
+       << ", Preço: R$ " << preco;
     // Concatena as informações do item em uma string formatada
+    if (!codigoBarras.empty()) {
+        ss << ", EAN: " << codigoBarras;
+    }
+    ss << "]";
     
     return ss.str();  // str() converte o stringstream para string e retorna
 }
@@ -104,24 +134,54 @@ bool Item::operator==(const Item& outro) const {
     // Retorna true se IDs são iguais, false caso contrário
 }
 
+// ==================== Classe IndiceNomeNormalizado ====================
+
+// IDs de cada nome em ordem crescente: o primeiro é o menor
+void IndiceNomeNormalizado::inserir(const string& normalizado, int id) {
+    vector<int>& ids = idsPorNome[normalizado];
+    ids.insert(lower_bound(ids.begin(), ids.end(), id), id);
+}
+
+void IndiceNomeNormalizado::remover(const string& normalizado, int id) {
+    auto grupo = idsPorNome.find(normalizado);
+    if (grupo == idsPorNome.end()) {
+        return;
+    }
+    vector<int>& ids = grupo->second;
+    auto posicao = lower_bound(ids.begin(), ids.end(), id);
+    if (posicao != ids.end() && *posicao == id) {
+        ids.erase(posicao);
+    }
+    if (ids.empty()) {
+        idsPorNome.erase(grupo);
+    }
+}
+
+int IndiceNomeNormalizado::buscar(const string& normalizado) const {
+    auto grupo = idsPorNome.find(normalizado);
+    return grupo == idsPorNome.end() ? 0 : grupo->second.front();
+}
+
 // ==================== Classe GerenciadorItens ====================
 
 // Construtor - Inicializa o gerenciador
-GerenciadorItens::GerenciadorItens() : proximoId(1) {}  
-// Inicializa proximoId com 1 (primeiro ID disponível)
-// Vetor itens é inicializado automaticamente vazio
+GerenciadorItens::GerenciadorItens() {}  
+
+/**
+ * Alocador de IDs do repositório (compartilhado entre threads)
+ */
+AlocadorIds& GerenciadorItens::getAlocadorIds() {
+    return itens.getAlocadorIds();
+}
+// O repositório começa vazio, com o primeiro ID = 1
 
 // Cadastra novo item no sistema
-int GerenciadorItens::cadastrar(const string& nome, double preco) {
+int GerenciadorItens::cadastrar(const string& nome, double preco, AlocadorIds::Bloco* bloco) {
     // ========== VALIDAÇÕES ==========
     
-    if (nome.empty()) {  // Verifica se o nome está vazio
-        throw ValidacaoException("Nome do item não pode ser vazio");
-    }
-    
-    if (preco < 0) {  // Verifica se o preço é negativo
-        throw ValidacaoException("Preço do item não pode ser negativo");
-    }
+    // Regras da tabela do Item, antes de gastar um ID
+    esquema::validarCampo<Item>(Campo::NOME, nome);
+    esquema::validarCampo<Item>(Campo::PRECO, preco);
     
     // Verifica se já existe item com este nome
     if (buscarPorNome(nome) != nullptr) {  // nullptr = ponteiro nulo
@@ -131,62 +191,153 @@ int GerenciadorItens::cadastrar(const string& nome, double preco) {
     
     // ========== CADASTRO ==========
     
-    Item novoItem(proximoId, nome, preco);  // Cria novo item com ID atual
-    itens.push_back(novoItem);  // Adiciona o item no FINAL do vetor
-    // push_back() adiciona elemento ao final do vector
+    descongelar();  // As posições congeladas deixam de valer
+    // O repositório anexa no FINAL do vetor e atualiza todos os índices
+    Item& novo = itens.cadastrar([&](int id) { return Item(id, nome, preco); }, bloco);
     
-    return proximoId++;  // Retorna o ID usado e depois incrementa para o próximo
-    // proximoId++ = usa o valor atual, DEPOIS incrementa
+    // Avisa os observadores: item criado (antes = nullptr)
+    notificar([&](ObservadorMutacoes* o) { o->aoMudarItem(nullptr, &novo); });
+    
+    return novo.getId();  // Retorna o ID gerado
 }
 
-// Busca item por ID no vetor
+// Busca item por ID usando o índice hash (O(1) em média)
 Item* GerenciadorItens::buscarPorId(int id) {
-    // Range-based for: percorre cada elemento do vetor
-    for (auto& item : itens) {  // auto = tipo deduzido automaticamente (Item)
-        // & = referência (não copia o item, acessa diretamente)
-        
-        if (item.getId() == id) {  // Se encontrou o item com este ID
-            return &item;  // Retorna PONTEIRO para o item (endereço de memória)
-            // & = operador de endereço (retorna ponteiro)
-        }
+    if (congelado) {  // Hash perfeito: uma sonda
+        size_t posicao = congelado->posicaoDoId(id);
+        return posicao == CatalogoCongelado::NAO_ENCONTRADO ? nullptr : &itens.naPosicao(posicao);
+    }
+    return itens.buscar(id);  // nullptr se não encontrou
+}
+
+// Versão const da busca por ID (somente leitura)
+const Item* GerenciadorItens::buscarPorId(int id) const {
+    if (congelado) {
+        size_t posicao = congelado->posicaoDoId(id);
+        return posicao == CatalogoCongelado::NAO_ENCONTRADO ? nullptr : &itens.naPosicao(posicao);
     }
-    return nullptr;  // Se não encontrou, retorna ponteiro nulo
+    return itens.buscar(id);
 }
 
-// Busca item por nome no vetor
+// Busca item por nome exato usando o índice hash (O(1) em média)
 Item* GerenciadorItens::buscarPorNome(const string& nome) {
-    // Percorre todos os itens do vetor
-    for (auto& item : itens) {
-        if (item.getNome() == nome) {  // Compara o nome do item com o nome buscado
-            return &item;  // Se encontrou, retorna ponteiro para o item
+    int id = itens.indice<PorNome>().buscar(nome);  // 0 = nenhum item com esse nome
+    return id == 0 ? nullptr : buscarPorId(id);  // Converte ID em ponteiro
+}
+
+// Busca item pelo código de barras usando o índice hash (O(1) em média)
+Item* GerenciadorItens::buscarPorCodigo(const string& codigo) {
+    int id = itens.indice<PorCodigo>().buscar(codigo);
+    return id == 0 ? nullptr : buscarPorId(id);
+}
+
+const Item* GerenciadorItens::buscarPorCodigo(const string& codigo) const {
+    int id = itens.indice<PorCodigo>().buscar(codigo);
+    return id == 0 ? nullptr : buscarPorId(id);
+}
+
+// Associa (ou remove) o código de barras, mantendo o índice
+void GerenciadorItens::definirCodigoBarras(int id, const string& codigo) {
+    Item* item = buscarPorId(id);
+    if (item == nullptr) {
+        throw ItemException("Item com ID " + to_string(id) + " não encontrado");
+    }
+    if (!codigo.empty() && !Item::codigoBarrasValido(codigo)) {
+        throw ValidacaoException("Código de barras inválido: " + codigo);
+    }
+    const Item* dono = buscarPorCodigo(codigo);
+    if (dono != nullptr && dono->getId() != id) {
+        throw ItemException("Código de barras já usado pelo item " + to_string(dono->getId()));
+    }
+    if (item->getCodigoBarras() == codigo) {
+        return;  // Nada muda
+    }
+    
+    descongelar();
+    Item antes = *item;
+    itens.alterar(*item, [&](Item& i) { i.setCodigoBarras(codigo); });  // Reindexa o código
+    notificar([&](ObservadorMutacoes* o) { o->aoMudarItem(&antes, item); });
+}
+
+// Busca aproximada: consulta o índice de trigramas e devolve os itens ranqueados
+vector<ResultadoBusca> GerenciadorItens::buscarAproximado(const string& consulta, size_t limite) const {
+    vector<ResultadoBusca> resultado;
+    
+    // O índice devolve (ID, similaridade) já ordenados
+    for (const Candidato& candidato : itens.indice<IndiceAproximado>().getTrigramas().buscar(consulta, limite)) {
+        const Item* item = itens.buscar(candidato.id);
+        if (item != nullptr) {
+            resultado.push_back(ResultadoBusca(*item, candidato.similaridade));
+        }
+    }
+    return resultado;
+}
+
+// Executa consulta escolhendo o índice mais seletivo disponível
+ResultadoConsulta<Item> GerenciadorItens::consultar(const Consulta& consulta) const {
+    consulta.validar<Item>();  // Lança ValidacaoException se algum campo não existe
+    
+    // Procura uma condição atendida por índice, na ordem de seletividade
+    const Condicao* porId = nullptr;
+    const Condicao* porNome = nullptr;
+    const Condicao* porTrecho = nullptr;
+    for (const Condicao& c : consulta.getCondicoes()) {
+        if (c.campo == Campo::ID && !c.textual && c.operador == Operador::IGUAL) {
+            porId = &c;
+        } else if (c.campo == Campo::NOME && c.operador == Operador::IGUAL) {
+            porNome = &c;
+        } else if (c.campo == Campo::NOME && c.operador == Operador::CONTEM) {
+            porTrecho = &c;
+        }
+    }
+    
+    vector<size_t> candidatos;  // Posições no vetor sugeridas pelo índice
+    
+    if (porId) {
+        // ID inteiro: no máximo um candidato (fracionário ou fora da faixa de int: nenhum)
+        int id = 0;
+        size_t posicao = valorInteiro(porId->valor, id) ? itens.posicaoDe(id) : itens.NAO_ENCONTRADO;
+        if (posicao != itens.NAO_ENCONTRADO) {
+            candidatos.push_back(posicao);
+        }
+        return consulta.executar(itens.todos(), &candidatos, "índice hash por ID");
+    }
+    
+    if (porNome) {
+        int id = itens.indice<PorNome>().buscar(porNome->texto);
+        if (id != 0) {
+            candidatos.push_back(itens.posicaoDe(id));
         }
+        return consulta.executar(itens.todos(), &candidatos, "índice hash por nome");
+    }
+    
+    vector<int> ids;
+    if (porTrecho && itens.indice<IndiceAproximado>().getTrigramas().candidatosSubstring(porTrecho->texto, ids)) {
+        candidatos = itens.posicoesDe(ids);
+        return consulta.executar(itens.todos(), &candidatos, "índice de trigramas");
     }
-    return nullptr;  // Se não encontrou, retorna nullptr
+    
+    return consulta.executar(itens.todos(), nullptr, "varredura vetorizada");
 }
 
 // Remove item por ID do vetor
 bool GerenciadorItens::remover(int id) {
-    // Usa algoritmo remove_if da STL (Standard Template Library)
-    auto it = remove_if(itens.begin(), itens.end(),
-                       [id](const Item& i) { return i.getId() == id; });
-    // remove_if move elementos que atendem à condição para o final
-    // Lambda [id]: captura a variável id do escopo externo
-    // Lambda (const Item& i): recebe cada item como parâmetro
-    // Lambda { return ... }: retorna true se o item deve ser removido
-    // Retorna iterador apontando para o início dos elementos "removidos"
-    
-    if (it != itens.end()) {  // Se encontrou elementos para remover
-        // end() retorna iterador para "após o último elemento"
-        itens.erase(it, itens.end());  // erase() realmente REMOVE do vetor
-        // Remove do iterador 'it' até o fim
-        return true;  // Retorna true indicando sucesso
+    if (itens.buscar(id) == nullptr) {
+        return false;  // Retorna false se não encontrou o item
     }
-    return false;  // Retorna false se não encontrou o item
+    
+    descongelar();
+    Item removido;  // Recebe o item para avisar os observadores
+    itens.remover(id, &removido);  // Sai de todos os índices e do vetor (preserva a ordem)
+    
+    // Avisa os observadores: item removido (depois = nullptr)
+    notificar([&](ObservadorMutacoes* o) { o->aoMudarItem(&removido, nullptr); });
+    return true;  // Retorna true indicando sucesso
 }
 
 // Lista todos os itens cadastrados
 vector<Item> GerenciadorItens::listar() const {
-    return itens;  // Retorna uma CÓPIA do vetor inteiro
+    return itens.todos();  // Retorna uma CÓPIA do vetor inteiro
     // const = não modifica o estado do gerenciador
 }
 
@@ -209,9 +360,87 @@ bool GerenciadorItens::atualizar(int id, const string& nome, double preco) {
         throw ItemException("Já existe outro item com este nome: " + nome);
     }
     
-    // Se todas as validações passaram, atualiza os dados
-    item->setNome(nome);   // Chama o setter via ponteiro (item->setNome)
-    item->setPreco(preco); // Chama o setter via ponteiro
+    // Se todas as validações passaram, atualiza os dados; o repositório
+    // reindexa o nome (exato e aproximado) se ele mudou
+    descongelar();
+    Item antes = *item;  // Estado anterior (para os observadores)
+    itens.alterar(*item, [&](Item& i) { i.setNome(nome); });  // Chama o setter
     
+    try {
+        item->setPreco(preco); // O preço não é chave de índice: direto pelo ponteiro
+    } catch (...) {
+        // Preço inválido: o nome já foi alterado, então os observadores são avisados
+        notificar([&](ObservadorMutacoes* o) { o->aoMudarItem(&antes, item); });
+        throw;  // Relança a mesma exceção
+    }
+    
+    notificar([&](ObservadorMutacoes* o) { o->aoMudarItem(&antes, item); });
     return true;  // Retorna true indicando sucesso na atualização
 }
+
+// Restaura um item (desfazer/refazer): substitui ou recria com o mesmo ID
+void GerenciadorItens::restaurar(const Item& estado) {
+    int id = estado.getId();
+    const string& nome = estado.getNome();
+    
+    // Mesma regra do cadastro: nomes únicos
+    Item* itemComNome = buscarPorNome(nome);
+    if (itemComNome != nullptr && itemComNome->getId() != id) {
+        throw ItemException("Já existe outro item com este nome: " + nome);
+    }
+    const string& codigo = estado.getCodigoBarras();
+    const Item* dono = codigo.empty() ? nullptr : buscarPorCodigo(codigo);
+    if (dono != nullptr && dono->getId() != id) {
+        throw ItemException("Código de barras já usado pelo item " + to_string(dono->getId()));
+    }
+    
+    descongelar();
+    Item* item = itens.buscar(id);
+    if (item != nullptr) {
+        // Item existe: substitui os dados (o repositório reindexa nome e código)
+        Item antes = *item;
+        itens.alterar(*item, [&](Item& i) { i = estado; });
+        notificar([&](ObservadorMutacoes* o) { o->aoMudarItem(&antes, item); });
+        return;
+    }
+    
+    // Item removido: volta para a posição do seu ID (o vetor continua em ordem de ID)
+    Item& recriado = itens.inserir(estado);
+    notificar([&](ObservadorMutacoes* o) { o->aoMudarItem(nullptr, &recriado); });
+}
+
+// ==================== Congelamento ====================
+
+// Monta as tabelas perfeitas a partir do vetor atual (posição i = itens[i])
+void GerenciadorItens::congelar() {
+    if (congelado) {
+        return;  // Nada mudou desde o último congelamento
+    }
+    vector<int> ids;
+    vector<string> nomes;
+    ids.reserve(itens.tamanho());
+    nomes.reserve(itens.tamanho());
+    for (const Item& item : itens.todos()) {
+        ids.push_back(item.getId());
+        nomes.push_back(item.getNome());
+    }
+    congelado = make_shared<const CatalogoCongelado>(ids, nomes);
+}
+
+void GerenciadorItens::descongelar() {
+    congelado.reset();
+}
+
+bool GerenciadorItens::estaCongelado() const {
+    return congelado != nullptr;
+}
+
+// Nome normalizado: sonda no catálogo congelado ou no índice do repositório
+const Item* GerenciadorItens::buscarPorNomeNormalizado(const string& nome) const {
+    if (congelado) {
+        size_t posicao = congelado->posicaoDoNome(nome);
+        return posicao == CatalogoCongelado::NAO_ENCONTRADO ? nullptr : &itens.naPosicao(posicao);
+    }
+    int id = itens.indice<IndiceNomeNormalizado>().buscar(normalizarNome(nome));
+    return id == 0 ? nullptr : itens.buscar(id);
+}
@@ -0,0 +1,146 @@
+/**
+ * @file leitor.cpp
+ * @brief Implementação do LeitorCodigos (recebimento por código de barras)
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ */
+
+// Inclui o header com as declarações
+#include "leitor.h"
+// Para stoi (quantidade da linha)
+#include <string>
+
+LeitorCodigos::LeitorCodigos(const GerenciadorItens& itens, Estoque& estoque, size_t limiteLote)
+    : itens(itens), estoque(estoque), limiteLote(limiteLote) {
+    if (limiteLote == 0) {
+        throw ValidacaoException("Limite do lote deve ser maior que zero");
+    }
+}
+
+void LeitorCodigos::rejeitar(const string& codigo) {
+    resumo.rejeitadas++;
+    if (rejeitados.size() == MAX_REJEITADOS) {
+        rejeitados.erase(rejeitados.begin());  // Vector pequeno: mantém só os mais recentes
+    }
+    rejeitados.push_back(codigo);
+}
+
+// ==================== Leitura ====================
+
+bool LeitorCodigos::ler(const string& codigo, int quantidade) {
+    if (quantidade <= 0) {
+        throw ValidacaoException("Quantidade deve ser maior que zero");
+    }
+    resumo.leituras++;
+
+    // Índice hash do catálogo: código inválido também não está lá
+    const Item* item = itens.buscarPorCodigo(codigo);
+    if (item == nullptr) {
+        rejeitar(codigo);
+        return false;
+    }
+    resumo.aceitas++;
+
+    auto pendente = pendentes.find(item->getId());
+    if (pendente == pendentes.end()) {
+        pendentes.emplace(item->getId(), ItemEstoque(item->getId(), item->getNome(), quantidade));
+    } else {
+        pendente->second.quantidade += quantidade;  // Mesmo item: só soma
+    }
+    if (++leiturasPendentes >= limiteLote) {
+        descarregar();
+    }
+    return true;
+}
+
+long long LeitorCodigos::lerFluxo(istream& entrada, const string& fim) {
+    long long linhas = 0;
+    string linha;
+    vector<string> partes;  // Reaproveitado entre linhas
+    while (getline(entrada, linha)) {
+        if (!linha.empty() && linha.back() == '\r') {
+            linha.pop_back();  // Leitores que terminam a linha com CR LF
+        }
+        if (!fim.empty() && linha == fim) {
+            break;
+        }
+        // Separa por espaços sem stringstream (o custo dominante numa rajada de leituras)
+        partes.clear();
+        size_t i = 0;
+        while (i < linha.size()) {
+            while (i < linha.size() && (linha[i] == ' ' || linha[i] == '\t')) {
+                i++;
+            }
+            size_t inicio = i;
+            while (i < linha.size() && linha[i] != ' ' && linha[i] != '\t') {
+                i++;
+            }
+            if (i > inicio) {
+                partes.push_back(linha.substr(inicio, i - inicio));
+            }
+        }
+        if (partes.empty()) {
+            continue;  // Linha vazia
+        }
+        linhas++;
+
+        // "codigo" ou "codigo quantidade"
+        int quantidade = 1;
+        bool valida = partes.size() <= 2;
+        if (valida && partes.size() == 2) {
+            size_t lidos = 0;
+            try {
+                quantidade = stoi(partes[1], &lidos);
+            } catch (const exception&) {
+                lidos = 0;  // Não é número (ou não cabe em int)
+            }
+            valida = lidos == partes[1].size() && quantidade > 0;
+        }
+        if (!valida) {
+            resumo.leituras++;
+            rejeitar(linha);  // Linha mal formada
+            continue;
+        }
+        ler(partes[0], quantidade);
+    }
+    descarregar();
+    return linhas;
+}
+
+// ==================== Gravação ====================
+
+/**
+ * Um adicionarItem por item do lote (o map já está em ordem de ID)
+ */
+void LeitorCodigos::descarregar() {
+    if (pendentes.empty()) {
+        leiturasPendentes = 0;
+        return;
+    }
+    for (const auto& par : pendentes) {
+        const ItemEstoque& lote = par.second;
+        estoque.adicionarItem(lote.itemId, lote.nomeItem, lote.quantidade);
+        resumo.entradas++;
+        resumo.unidades += lote.quantidade;
+    }
+    resumo.lotes++;
+    pendentes.clear();
+    leiturasPendentes = 0;
+}
+
+vector<ItemEstoque> LeitorCodigos::listarPendentes() const {
+    vector<ItemEstoque> resultado;
+    for (const auto& par : pendentes) {
+        resultado.push_back(par.second);
+    }
+    return resultado;
+}
+
+ResumoLeitura LeitorCodigos::getResumo() const {
+    return resumo;
+}
+
+const vector<string>& LeitorCodigos::ultimosRejeitados() const {
+    return rejeitados;
+}
@@ -12,6 +12,8 @@
 #include "listacompras.h"
 // Inclui exceções customizadas
 #include "excecoes.h"
+// Regras dos campos (tabela constexpr da ListaCompras)
+#include "esquema.h"
 // Algoritmos STL (remove_if, etc)
 #include <algorithm>
 // Para stringstream (construir strings)
@@ -30,7 +32,9 @@ ListaCompras::ListaCompras() : id(0), descricao("") {}
  * Construtor parametrizado
  */
 ListaCompras::ListaCompras(int id, const string& descricao)
-    : id(id), descricao(descricao) {}
+    : id(id), descricao(descricao) {
+    esquema::validar(*this);  // Regras da tabela da ListaCompras (as mesmas dos setters)
+}
 // Lista começa vazia (map itens vazio)
 
 /**
@@ -51,7 +55,7 @@ int ListaCompras::getId() const {
 /**
  * Retorna descrição/título da lista
  */
-string ListaCompras::getDescricao() const {
+const string& ListaCompras::getDescricao() const {
     return descricao;
 }
 
@@ -61,9 +65,7 @@ string ListaCompras::getDescricao() const {
  * Define ID com validação
  */
 void ListaCompras::setId(int id) {
-    if (id < 0) {
-        throw ValidacaoException("ID da lista inválido");
-    }
+    esquema::validarCampo<ListaCompras>(Campo::ID, id);
     this->id = id;
 }
 
@@ -71,9 +73,7 @@ void ListaCompras::setId(int id) {
  * Define descrição com validação
  */
 void ListaCompras::setDescricao(const string& descricao) {
-    if (descricao.empty()) {
-        throw ValidacaoException("Descrição não pode ser vazia");
-    }
+    esquema::validarCampo<ListaCompras>(Campo::NOME, descricao);
     this->descricao = descricao;
 }
 
@@ -174,6 +174,11 @@ void ListaCompras::limpar() {
     itens.clear();  // Método clear() do map remove todos os elementos
 }
 
+// Acesso somente leitura aos itens da lista
+const map<int, ItemCompra>& ListaCompras::getItens() const {
+    return itens;  // Referência constante: sem cópia e sem permitir alteração
+}
+
 /**
  * Exibe informações da lista formatadas
  */
@@ -241,65 +246,200 @@ ostream& operator<<(ostream& os, const ListaCompras& lista) {
 /**
  * Construtor - inicializa próximo ID como 1
  */
-GerenciadorListaCompras::GerenciadorListaCompras() : proximoId(1) {}
+GerenciadorListaCompras::GerenciadorListaCompras() {}
+
+/**
+ * Alocador de IDs do repositório (compartilhado entre threads)
+ */
+AlocadorIds& GerenciadorListaCompras::getAlocadorIds() {
+    return listas.getAlocadorIds();
+}
 
 /**
  * Cria nova lista de compras (CREATE)
  */
-int GerenciadorListaCompras::criar(const string& descricao) {
-    if (descricao.empty()) {  // Validação
-        throw ValidacaoException("Descrição não pode ser vazia");
+int GerenciadorListaCompras::criar(const string& descricao, AlocadorIds::Bloco* bloco) {
+    esquema::validarCampo<ListaCompras>(Campo::NOME, descricao);  // Validação
+    
+    // Cria nova lista com ID automático e guarda no repositório
+    ListaCompras& nova = listas.cadastrar([&](int id) { return ListaCompras(id, descricao); }, bloco);
+    
+    // Avisa os observadores: lista criada
+    notificar([&](ObservadorMutacoes* o) { o->aoMudarLista(nullptr, &nova); });
+    
+    return nova.getId();  // Retorna o ID gerado
+}
+
+/**
+ * Cria lista já com itens: valida tudo num rascunho antes de gerar o ID
+ */
+int GerenciadorListaCompras::criarComItens(const string& descricao, const vector<ItemCompra>& itens,
+                                           AlocadorIds::Bloco* bloco) {
+    esquema::validarCampo<ListaCompras>(Campo::NOME, descricao);  // Validação
+    
+    ListaCompras rascunho(0, descricao);
+    for (const auto& item : itens) {
+        rascunho.adicionarItem(item.itemId, item.nomeItem, item.quantidade, item.preco);  // Lança se inválido
     }
     
-    // Cria nova lista com ID automático
-    ListaCompras novaLista(proximoId, descricao);
+    ListaCompras& nova = listas.cadastrar([&](int id) {
+        rascunho.setId(id);
+        return rascunho;
+    }, bloco);
     
-    // Adiciona ao vector
-    listas.push_back(novaLista);
-    // push_back() faz cópia do objeto
+    // Avisa os observadores: lista criada (um único aviso, já com os itens)
+    notificar([&](ObservadorMutacoes* o) { o->aoMudarLista(nullptr, &nova); });
     
-    return proximoId++;  // Retorna ID usado e incrementa
+    return nova.getId();
 }
 
 /**
  * Busca lista por ID (READ)
  */
 ListaCompras* GerenciadorListaCompras::buscarPorId(int id) {
-    // Percorre vector de listas
-    for (auto& lista : listas) {
-        // auto& = referência (permite modificar)
-        
-        if (lista.getId() == id) {  // Se encontrou
-            return &lista;  // Retorna PONTEIRO para a lista
-            // Ponteiro permite adicionar/remover itens
-        }
-    }
-    return nullptr;  // Não encontrou
+    return listas.buscar(id);  // Índice hash: O(1) em média; nullptr se não encontrou
+    // Ponteiro permite adicionar/remover itens
+}
+
+/**
+ * Versão const da busca por ID (somente leitura)
+ */
+const ListaCompras* GerenciadorListaCompras::buscarPorId(int id) const {
+    return listas.buscar(id);
 }
 
 /**
  * Remove lista de compras (DELETE)
  */
 bool GerenciadorListaCompras::remover(int id) {
-    // PADRÃO REMOVE-ERASE:
-    auto it = remove_if(listas.begin(), listas.end(),
-                       [id](const ListaCompras& l) { return l.getId() == id; });
-    // LAMBDA: [id](const ListaCompras& l) { return l.getId() == id; }
-    //   [id] = captura variável id
-    //   (const ListaCompras& l) = parâmetro (cada lista)
-    //   { return ... } = critério de remoção
-    
-    if (it != listas.end()) {  // Se encontrou lista(s) a remover
-        listas.erase(it, listas.end());
-        // Remove do vector
-        return true;  // Sucesso
+    // Guarda a lista removida apenas se alguém vai ser avisado
+    ListaCompras removida;
+    bool avisar = temObservadores();
+    if (!listas.remover(id, avisar ? &removida : nullptr)) {
+        return false;  // Não encontrou
     }
-    return false;  // Não encontrou
+    if (avisar) {
+        notificar([&](ObservadorMutacoes* o) { o->aoMudarLista(&removida, nullptr); });
+    }
+    return true;  // Sucesso
 }
 
 /**
  * Lista todas as listas de compras (READ ALL)
  */
 vector<ListaCompras> GerenciadorListaCompras::listar() const {
-    return listas;  // Retorna CÓPIA de todo o vector
+    return listas.todos();  // Retorna CÓPIA de todo o vector
+}
+
+/**
+ * Acesso direto ao vector do repositório (sem cópia)
+ */
+const vector<ListaCompras>& GerenciadorListaCompras::todos() const {
+    return listas.todos();
+}
+
+// Executa consulta usando o índice por ID quando possível
+ResultadoConsulta<ListaCompras> GerenciadorListaCompras::consultar(const Consulta& consulta) const {
+    consulta.validar<ListaCompras>();  // Lança ValidacaoException se algum campo não existe
+    
+    int valor;
+    if (consulta.igualdadeInteira(Campo::ID, valor)) {
+        vector<size_t> candidatos;
+        size_t posicao = listas.posicaoDe(valor);
+        if (posicao != listas.NAO_ENCONTRADO) {
+            candidatos.push_back(posicao);
+        }
+        return consulta.executar(listas.todos(), &candidatos, "índice hash por ID");
+    }
+    // Sem índice aplicável: varre o vetor aplicando uma condição por vez
+    return consulta.executar(listas.todos(), nullptr, "varredura vetorizada");
+}
+
+// Localiza lista ou lança ListaComprasException (usado pelas alterações abaixo)
+static ListaCompras* exigirLista(GerenciadorListaCompras& gerenciador, int listaId) {
+    ListaCompras* lista = gerenciador.buscarPorId(listaId);
+    if (lista == nullptr) {
+        throw ListaComprasException("Lista com ID " + to_string(listaId) + " não encontrada");
+    }
+    return lista;
+}
+
+/**
+ * Adiciona item à lista avisando os observadores
+ */
+void GerenciadorListaCompras::adicionarItem(int listaId, int itemId, const string& nomeItem,
+                                            int quantidade, double preco) {
+    ListaCompras* lista = exigirLista(*this, listaId);
+    if (!temObservadores()) {
+        lista->adicionarItem(itemId, nomeItem, quantidade, preco);  // Sem observadores: nenhuma cópia
+        return;
+    }
+    
+    ListaCompras antes = *lista;
+    lista->adicionarItem(itemId, nomeItem, quantidade, preco);  // Se lançar, nada mudou
+    notificar([&](ObservadorMutacoes* o) { o->aoMudarLista(&antes, lista); });
+}
+
+/**
+ * Remove item da lista avisando os observadores
+ */
+bool GerenciadorListaCompras::removerItem(int listaId, int itemId) {
+    ListaCompras* lista = exigirLista(*this, listaId);
+    if (!temObservadores()) {
+        return lista->removerItem(itemId);
+    }
+    
+    ListaCompras antes = *lista;
+    if (!lista->removerItem(itemId)) {
+        return false;  // Item não estava na lista
+    }
+    notificar([&](ObservadorMutacoes* o) { o->aoMudarLista(&antes, lista); });
+    return true;
+}
+
+/**
+ * Atualiza quantidade de item da lista avisando os observadores
+ */
+void GerenciadorListaCompras::atualizarQuantidade(int listaId, int itemId, int quantidade) {
+    ListaCompras* lista = exigirLista(*this, listaId);
+    if (!temObservadores()) {
+        lista->atualizarQuantidade(itemId, quantidade);
+        return;
+    }
+    
+    ListaCompras antes = *lista;
+    lista->atualizarQuantidade(itemId, quantidade);  // Se lançar, nada mudou
+    notificar([&](ObservadorMutacoes* o) { o->aoMudarLista(&antes, lista); });
+}
+
+/**
+ * Esvazia a lista avisando os observadores
+ */
+void GerenciadorListaCompras::limpar(int listaId) {
+    ListaCompras* lista = exigirLista(*this, listaId);
+    if (!temObservadores()) {
+        lista->limpar();
+        return;
+    }
+    
+    ListaCompras antes = *lista;
+    lista->limpar();
+    notificar([&](ObservadorMutacoes* o) { o->aoMudarLista(&antes, lista); });
+}
+
+/**
+ * Restaura uma lista (desfazer/refazer): substitui ou recria com o mesmo ID
+ */
+void GerenciadorListaCompras::restaurar(const ListaCompras& estado) {
+    ListaCompras* lista = buscarPorId(estado.getId());
+    if (lista != nullptr) {
+        ListaCompras antes = *lista;
+        *lista = estado;  // Sem índices secundários: basta substituir
+        notificar([&](ObservadorMutacoes* o) { o->aoMudarLista(&antes, lista); });
+        return;
+    }
+    
+    // Lista removida: o repositório a devolve à posição do seu ID
+    ListaCompras& recriada = listas.inserir(estado);
+    notificar([&](ObservadorMutacoes* o) { o->aoMudarLista(nullptr, &recriada); });
 }
@@ -24,6 +24,23 @@
 #include "pedido.h"       // Classe Pedido e GerenciadorPedidos
 #include "listacompras.h" // Classe ListaCompras e gerenciador
 #include "excecoes.h"     // Hierarquia de exceções customizadas
+#include "visao.h"        // Visão consolidada de camarins (quadro de bastidores)
+#include "painel.h"       // Painel com contadores materializados
+#include "relogio.h"      // Carimbos de tempo (consultas por período)
+#include "frequentes.h"   // Itens mais pedidos (Space-Saving)
+#include "historico.h"    // Desfazer/refazer alterações
+#include "referencias.h"  // Onde cada item é usado (remoção segura)
+#include "agenda.h"       // Reservas de camarins por horário
+#include "alocacao.h"     // Alocação automática artistas x camarins
+#include "modelo.h"       // Modelos de rider (itens reutilizáveis)
+#include "reposicao.h"    // Níveis de reposição dos camarins
+#include "reconciliacao.h" // Fechamento: sobras voltam ao estoque
+#include "leitor.h"        // Recebimento por leitor de código de barras
+#include "esquema.h"       // Exportação CSV/JSON gerada pelas tabelas de campos
+#include "arquivo.h"       // Pedidos atendidos em colunas comprimidas
+#include "relatorio.h"     // Relatório geral gerado em paralelo
+#include "fornecedores.h"  // Ofertas de fornecedores e melhor preço
+#include <fstream>         // Para exportar em arquivo
 
 using namespace std;  // Namespace padrão da STL
 
@@ -35,6 +52,15 @@ Estoque estoque;                                   // Controla estoque central
 GerenciadorCamarins gerenciadorCamarins;          // Gerencia camarins
 GerenciadorPedidos gerenciadorPedidos;            // Gerencia pedidos de itens
 GerenciadorListaCompras gerenciadorListaCompras;  // Gerencia listas de compras
+GerenciadorModelos gerenciadorModelos;            // Modelos de rider (pedidos e camarins prontos)
+PainelBastidores painel;  // Declarado depois dos gerenciadores: é destruído antes deles
+ItensMaisPedidos maisPedidos;  // Top itens pedidos (baldes de 1 minuto, última hora)
+AgendaCamarins agenda;         // Reservas de camarins por horário (festivais de vários dias)
+IndiceReferencias referenciasItens;  // Item -> camarins, pedidos, listas e estoque que o usam
+ReposicaoCamarins reposicao;   // Níveis-padrão de cada camarim e reposição a partir do estoque
+TabelaFornecedores fornecedores;  // Ofertas por fornecedor (preço e embalagem) de cada item
+Historico historico;           // Últimas 100 alterações (desfazer/refazer)
+ArquivoPedidos arquivoPedidos; // Pedidos atendidos já retirados do gerenciador
 
 /**
  * @brief Limpa buffer de entrada
@@ -52,6 +78,50 @@ void limparBuffer() {
     // '\n' = delimitador (para ao encontrar quebra de linha)
 }
 
+/**
+ * @brief Lê um período de hoje no formato HH MM (ex: 18 00 até 20 00)
+ * @return false se o horário for inválido (mensagem já exibida)
+ */
+bool lerPeriodoDeHoje(long long& inicio, long long& fim) {
+    int horaInicio, minutoInicio, horaFim, minutoFim;
+    cout << "Início (HH MM): ";
+    cin >> horaInicio >> minutoInicio;
+    cout << "Fim (HH MM): ";
+    cin >> horaFim >> minutoFim;
+    
+    try {
+        inicio = Relogio::horarioDeHoje(horaInicio, minutoInicio);
+        fim = Relogio::horarioDeHoje(horaFim, minutoFim) + 59999999;  // Inclui o minuto final inteiro
+    } catch (const ExcecaoBase& e) {
+        cout << "\n[ERRO] " << e.what() << endl;
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Lê um horário de festival: dia relativo a hoje + hora e minuto
+ * @param rotulo Texto exibido (ex: "Início")
+ * @param instante Saída: microssegundos (Relogio)
+ * @return false se o horário for inválido (mensagem já exibida)
+ */
+bool lerHorario(const string& rotulo, long long& instante) {
+    int dia, hora, minuto;
+    cout << rotulo << " - dia (0 = hoje, 1 = amanhã...), hora e minuto (D HH MM): ";
+    cin >> dia >> hora >> minuto;
+    
+    try {
+        if (dia < 0) {
+            throw ValidacaoException("Dia não pode ser negativo");
+        }
+        instante = Relogio::horarioDeHoje(hora, minuto) + dia * 86400000000LL;  // 1 dia em µs
+    } catch (const ExcecaoBase& e) {
+        cout << "\n[ERRO] " << e.what() << endl;
+        return false;
+    }
+    return true;
+}
+
 /**
  * @brief Lê valor double aceitando vírgula ou ponto como separador decimal
  * 
@@ -154,7 +224,9 @@ void cadastrarItem() {
 /**
  * @brief Remove item do catálogo
  * 
- * ATENÇÃO: Remove do catálogo, não do estoque!
+ * Se o item ainda é usado (estoque, camarins, pedidos, listas, modelos,
+ * níveis de reposição), pergunta se deve retirá-lo de todos esses lugares
+ * antes (cascata) ou cancelar.
  */
 void removerItem() {
     int id;  // ID do item a remover
@@ -163,8 +235,21 @@ void removerItem() {
     cout << "Digite o ID do item: ";
     cin >> id;
     
+    ModoRemocao modo = ModoRemocao::BLOQUEAR;
+    if (referenciasItens.emUso(id)) {
+        char resposta;
+        cout << "Item em uso: " << referenciasItens.referenciasDe(id).descrever() << endl;
+        cout << "Retirar o item de todos esses lugares e remover? (s/n): ";
+        cin >> resposta;
+        if (resposta != 's' && resposta != 'S') {
+            cout << "\nRemoção cancelada." << endl;
+            return;
+        }
+        modo = ModoRemocao::CASCATA;
+    }
+    
     try {
-        if (gerenciadorItens.remover(id)) {
+        if (referenciasItens.removerItem(id, modo)) {
             // remover() retorna true se encontrou e removeu
             cout << "\n[OK] Item removido do catálogo com sucesso!" << endl;
         } else {
@@ -176,6 +261,38 @@ void removerItem() {
     }
 }
 
+/**
+ * @brief Mostra onde um item é usado (sem varrer os gerenciadores)
+ */
+void ondeItemEhUsado() {
+    int id;
+    
+    cout << "\n=== Onde o Item é Usado ===" << endl;
+    cout << "Digite o ID do item: ";
+    cin >> id;
+    
+    ReferenciasItem r = referenciasItens.referenciasDe(id);
+    if (r.total() == 0) {
+        cout << "\nO item não é usado em nenhum lugar." << endl;
+        return;
+    }
+    auto exibirIds = [](const string& titulo, const vector<int>& ids) {
+        if (ids.empty()) return;
+        cout << titulo << ":";
+        for (int i : ids) cout << " " << i;
+        cout << endl;
+    };
+    cout << endl;
+    if (r.noEstoque) {
+        cout << "Estoque central: " << estoque.obterQuantidade(id) << " unidade(s)" << endl;
+    }
+    exibirIds("Camarins", r.camarins);
+    exibirIds("Pedidos", r.pedidos);
+    exibirIds("Listas de compras", r.listas);
+    exibirIds("Modelos de rider", r.modelos);
+    exibirIds("Níveis de reposição (camarins)", r.niveis);
+}
+
 /**
  * @brief Atualiza dados de um item do catálogo
  * 
@@ -230,7 +347,155 @@ void buscarItemPorNome() {
         // item-> = acesso a método através de ponteiro
     } else {
         cout << "\n[AVISO] Item não encontrado no catálogo!" << endl;
+        
+        // Sugere o nome mais parecido (ex: digitou "agua mineal")
+        vector<ResultadoBusca> sugestoes = gerenciadorItens.buscarAproximado(nome, 1);
+        if (!sugestoes.empty()) {
+            cout << "Você quis dizer: " << sugestoes[0].item.getNome() 
+                 << " (ID " << sugestoes[0].item.getId() << ")?" << endl;
+        }
+    }
+}
+
+/**
+ * @brief Associa um código de barras (EAN/GTIN) ao item
+ */
+void definirCodigoBarrasItem() {
+    int id;
+    string codigo;
+    
+    cout << "\n=== Definir Código de Barras ===" << endl;
+    cout << "ID do Item: ";
+    cin >> id;
+    limparBuffer();
+    cout << "Código (vazio = remover): ";
+    getline(cin, codigo);
+    
+    try {
+        gerenciadorItens.definirCodigoBarras(id, codigo);
+        cout << "\n[OK] Código de barras atualizado!" << endl;
+    } catch (const ExcecaoBase& e) {
+        cout << "\n[ERRO] " << e.what() << endl;
+    }
+}
+
+/**
+ * @brief Busca item pelo código de barras (índice hash)
+ */
+void buscarItemPorCodigo() {
+    string codigo;
+    
+    cout << "\n=== Buscar por Código de Barras ===" << endl;
+    cout << "Código: ";
+    cin >> codigo;
+    
+    const Item* item = gerenciadorItens.buscarPorCodigo(codigo);
+    if (item) {
+        cout << "\n" << item->exibir() << endl;
+    } else if (!Item::codigoBarrasValido(codigo)) {
+        cout << "\n[ERRO] Código de barras inválido!" << endl;
+    } else {
+        cout << "\n[AVISO] Nenhum item com este código!" << endl;
+    }
+}
+
+/**
+ * @brief Congela o catálogo para o show (buscas por ID e nome em uma sonda)
+ * 
+ * O catálogo volta ao modo normal sozinho na próxima alteração de item.
+ */
+void congelarCatalogo() {
+    cout << "\n=== Congelar Catálogo ===" << endl;
+    if (gerenciadorItens.estaCongelado()) {
+        cout << "\n[AVISO] Catálogo já está congelado!" << endl;
+        return;
+    }
+    gerenciadorItens.congelar();
+    cout << "\n[OK] Catálogo congelado (" << gerenciadorItens.listar().size() << " itens)." << endl;
+    cout << "Qualquer alteração de item descongela o catálogo." << endl;
+}
+
+/**
+ * @brief Busca aproximada no catálogo
+ * 
+ * Tolerante a acentos, maiúsculas, pontuação e erros de digitação.
+ * Exibe os itens mais parecidos com a porcentagem de similaridade.
+ */
+void buscarItemAproximado() {
+    string consulta;
+    
+    cout << "\n=== Busca Aproximada de Itens ===" << endl;
+    limparBuffer();
+    
+    cout << "Nome (ou parte do nome): ";
+    getline(cin, consulta);
+    
+    vector<ResultadoBusca> resultados = gerenciadorItens.buscarAproximado(consulta, 10);
+    
+    if (resultados.empty()) {
+        cout << "\n[AVISO] Nenhum item parecido encontrado!" << endl;
+        return;
+    }
+    
+    // Cabeçalho da tabela
+    cout << "\n" << left << setw(5) << "ID" << setw(30) << "Nome" 
+         << setw(12) << "Preço" << "Similaridade" << endl;
+    cout << string(60, '-') << endl;
+    
+    for (const auto& resultado : resultados) {
+        cout << left << setw(5) << resultado.item.getId()
+             << setw(30) << resultado.item.getNome()
+             << "R$ " << setw(9) << fixed << setprecision(2) << resultado.item.getPreco()
+             << setprecision(0) << resultado.similaridade * 100 << "%" << endl;
+    }
+}
+
+/**
+ * @brief Filtra o catálogo por faixa de preço e trecho do nome
+ * 
+ * Usa o motor de consultas: o planejador escolhe o índice adequado
+ */
+void filtrarItens() {
+    double precoMin, precoMax;
+    string trecho;
+    int ordem;
+    
+    cout << "\n=== Filtrar Itens ===" << endl;
+    cout << "Preço mínimo: ";
+    cin >> precoMin;
+    cout << "Preço máximo: ";
+    cin >> precoMax;
+    limparBuffer();
+    cout << "Nome contém (vazio = qualquer): ";
+    getline(cin, trecho);
+    cout << "Ordenar por (1 = nome, 2 = menor preço, 3 = maior preço): ";
+    cin >> ordem;
+    
+    // Monta a consulta encadeando condições
+    Consulta consulta;
+    consulta.onde(Campo::PRECO, Operador::ENTRE, precoMin, precoMax);
+    if (!trecho.empty()) {
+        consulta.ondeTexto(Campo::NOME, Operador::CONTEM, trecho);
+    }
+    if (ordem == 2 || ordem == 3) {
+        consulta.ordenarPor(Campo::PRECO, ordem == 2);
+    }
+    consulta.ordenarPor(Campo::NOME);
+    
+    ResultadoConsulta<Item> resultado = gerenciadorItens.consultar(consulta);
+    
+    if (resultado.registros.empty()) {
+        cout << "\n[AVISO] Nenhum item atende ao filtro!" << endl;
+    } else {
+        cout << "\n" << left << setw(5) << "ID" << setw(30) << "Nome" << "Preço" << endl;
+        cout << string(45, '-') << endl;
+        for (const auto& item : resultado.registros) {
+            cout << left << setw(5) << item.getId() << setw(30) << item.getNome()
+                 << "R$ " << fixed << setprecision(2) << item.getPreco() << endl;
+        }
     }
+    cout << "\n(" << resultado.registros.size() << " encontrado(s), plano: " << resultado.plano
+         << ", " << resultado.examinados << " examinado(s))" << endl;
 }
 
 // ==================== Funções de Artista ====================
@@ -429,6 +694,111 @@ void atualizarQuantidadeEstoque() {
     }
 }
 
+void definirMinimoEstoque() {
+    int itemId, minimo;
+    cout << "\n=== Definir Estoque Mínimo ===" << endl;
+    cout << "ID do Item: ";
+    cin >> itemId;
+    
+    cout << "Estoque Mínimo (0 = sem mínimo): ";
+    cin >> minimo;
+    
+    try {
+        estoque.definirMinimo(itemId, minimo);
+        cout << "\n[OK] Estoque mínimo definido!" << endl;
+    } catch (const ExcecaoBase& e) {
+        cout << "\n[ERRO] " << e.what() << endl;
+    }
+}
+
+void movimentosEstoquePorPeriodo() {
+    long long inicio, fim;
+    cout << "\n=== Movimentações no Período (hoje) ===" << endl;
+    if (!lerPeriodoDeHoje(inicio, fim)) {
+        return;
+    }
+    
+    vector<MovimentoEstoque> movimentos = estoque.movimentosEntre(inicio, fim);
+    for (const auto& m : movimentos) {
+        cout << Relogio::formatar(m.tempo) << "  " << left << setw(25) << m.nomeItem
+             << (m.variacao() > 0 ? "+" : "") << m.variacao()
+             << "  (" << m.quantidadeAntes << " -> " << m.quantidadeDepois << ")" << endl;
+    }
+    cout << "(" << movimentos.size() << " movimentação(ões))" << endl;
+}
+
+void entradaComValidadeEstoque() {
+    int itemId, quantidade, horas;
+
+    cout << "\n=== Entrada de Lote com Validade ===" << endl;
+    cout << "ID do Item (do catálogo): ";
+    cin >> itemId;
+
+    Item* item = gerenciadorItens.buscarPorId(itemId);
+    if (!item) {
+        cout << "\n[ERRO] Item não encontrado no catálogo!" << endl;
+        return;
+    }
+
+    cout << "Item selecionado: " << item->getNome() << endl;
+    cout << "Quantidade: ";
+    cin >> quantidade;
+    cout << "Vence em quantas horas: ";
+    cin >> horas;
+
+    try {
+        estoque.adicionarLote(item->getId(), item->getNome(), quantidade,
+                              Relogio::agora() + horas * 3600LL * 1000000LL);  // horas em µs
+        cout << "\n[OK] Lote adicionado ao estoque!" << endl;
+    } catch (const ExcecaoBase& e) {
+        cout << "\n[ERRO] " << e.what() << endl;
+    }
+}
+
+void lotesAVencerEstoque() {
+    int horas;
+    cout << "\n=== Lotes a Vencer ===" << endl;
+    cout << "Próximas quantas horas: ";
+    cin >> horas;
+
+    try {
+        vector<LoteEstoque> lotes = estoque.lotesVencendoEm(horas);
+        for (const auto& lote : lotes) {
+            Item* item = gerenciadorItens.buscarPorId(lote.itemId);
+            cout << Relogio::formatar(lote.validade) << "  Lote " << setw(5) << lote.numero << "  "
+                 << left << setw(25) << (item ? item->getNome() : "Item " + to_string(lote.itemId))
+                 << right << lote.quantidade << endl;
+        }
+        cout << "(" << lotes.size() << " lote(s))" << endl;
+    } catch (const ExcecaoBase& e) {
+        cout << "\n[ERRO] " << e.what() << endl;
+    }
+}
+
+/**
+ * @brief Recebimento de mercadoria: uma leitura por linha até "fim"
+ * 
+ * Leitores USB funcionam como teclado: cada bipe chega como uma linha.
+ * Aceita também "codigo quantidade" (caixa fechada). As leituras são
+ * gravadas no estoque em lotes, uma entrada por item.
+ */
+void recebimentoPorLeitor() {
+    cout << "\n=== Recebimento por Leitor ===" << endl;
+    cout << "Passe os códigos (ou digite \"codigo quantidade\"); \"fim\" encerra." << endl;
+    limparBuffer();
+    
+    LeitorCodigos leitor(gerenciadorItens, estoque);
+    long long linhas = leitor.lerFluxo(cin, "fim");
+    
+    ResumoLeitura resumo = leitor.getResumo();
+    cout << "\n" << linhas << " leitura(s): " << resumo.aceitas << " aceita(s), "
+         << resumo.rejeitadas << " rejeitada(s)" << endl;
+    cout << resumo.unidades << " unidade(s) em " << resumo.entradas << " entrada(s) de estoque" << endl;
+    for (const string& codigo : leitor.ultimosRejeitados()) {
+        cout << "  Rejeitado: " << codigo << endl;
+    }
+}
+
 // ==================== Funções de Camarim ====================
 
 void exibirCamarins() {
@@ -511,7 +881,7 @@ void cadastrarItemCamarim() {
     cin >> quantidade;
     
     try {
-        camarim->inserirItem(item->getId(), item->getNome(), quantidade);
+        gerenciadorCamarins.inserirItem(camarimId, item->getId(), item->getNome(), quantidade);
         cout << "\n[OK] Item adicionado ao camarim!" << endl;
     } catch (const ExcecaoBase& e) {
         cout << "\n[ERRO] " << e.what() << endl;
@@ -538,8 +908,11 @@ void removerItemCamarim() {
     cin >> quantidade;
     
     try {
-        camarim->removerItem(itemId, quantidade);
-        cout << "\n[OK] Item removido do camarim!" << endl;
+        if (gerenciadorCamarins.removerItem(camarimId, itemId, quantidade)) {
+            cout << "\n[OK] Item removido do camarim!" << endl;
+        } else {
+            cout << "\n[ERRO] Quantidade insuficiente no camarim!" << endl;
+        }
     } catch (const ExcecaoBase& e) {
         cout << "\n[ERRO] " << e.what() << endl;
     }
@@ -587,120 +960,370 @@ void buscarCamarimPorArtista() {
     }
 }
 
-// ==================== Funções de Pedidos ====================
-
-void exibirPedidos() {
-    vector<Pedido> pedidos = gerenciadorPedidos.listar();
-    if (pedidos.empty()) {
-        cout << "\nNenhum pedido cadastrado.\n" << endl;
-        return;
-    }
-    
-    cout << "\n=== Lista de Pedidos ===" << endl;
-    for (const auto& pedido : pedidos) {
-        cout << pedido << endl;
-    }
-}
-
-void cadastrarPedido() {
+/**
+ * @brief Exibe a visão completa de um camarim
+ * 
+ * Artistas, pedidos pendentes/atendidos e conteúdo com preços do catálogo
+ */
+void exibirVisaoCamarim() {
     int camarimId;
-    string nomeArtista;
     
-    cout << "\n=== Criar Pedido ===" << endl;
+    cout << "\n=== Visão do Camarim ===" << endl;
     cout << "ID do Camarim: ";
     cin >> camarimId;
-    limparBuffer();
-    
-    cout << "Nome do Artista: ";
-    getline(cin, nomeArtista);
     
     try {
-        int id = gerenciadorPedidos.criar(camarimId, nomeArtista);
-        cout << "\n[OK] Pedido criado com ID: " << id << endl;
+        VisaoCamarim visao = montarVisaoCamarim(camarimId, gerenciadorCamarins, gerenciadorArtistas,
+                                                gerenciadorPedidos, gerenciadorItens);
+        cout << "\n" << visao.exibir() << endl;
     } catch (const ExcecaoBase& e) {
         cout << "\n[ERRO] " << e.what() << endl;
     }
 }
 
-void removerPedido() {
-    int id;
-    cout << "\n=== Remover Pedido ===" << endl;
-    cout << "Digite o ID do pedido: ";
-    cin >> id;
+void alteracoesCamarimPorPeriodo() {
+    int camarimId;
+    long long inicio, fim;
+    cout << "\n=== Alterações de Camarim no Período (hoje) ===" << endl;
+    cout << "ID do Camarim (0 = todos): ";
+    cin >> camarimId;
+    if (!lerPeriodoDeHoje(inicio, fim)) {
+        return;
+    }
     
-    try {
-        gerenciadorPedidos.remover(id);
-        cout << "\n[OK] Pedido removido com sucesso!" << endl;
-    } catch (const ExcecaoBase& e) {
-        cout << "\n[ERRO] " << e.what() << endl;
+    vector<AlteracaoCamarim> alteracoes = gerenciadorCamarins.alteracoesEntre(inicio, fim, camarimId);
+    for (const auto& a : alteracoes) {
+        cout << Relogio::formatar(a.tempo) << "  Camarim " << a.camarimId << ": " << a.descricao() << endl;
     }
+    cout << "(" << alteracoes.size() << " alteração(ões))" << endl;
 }
 
-void adicionarItemPedido() {
-    int pedidoId, itemId, quantidade;
-    
-    cout << "\n=== Adicionar Item ao Pedido ===" << endl;
-    cout << "ID do Pedido: ";
-    cin >> pedidoId;
-    
-    Pedido* pedido = gerenciadorPedidos.buscarPorId(pedidoId);
-    if (!pedido) {
-        cout << "\n[ERRO] Pedido não encontrado!" << endl;
+/**
+ * @brief Aloca automaticamente todos os artistas nos camarins
+ * 
+ * Pergunta os requisitos de cada artista e o perfil de cada camarim,
+ * mostra a alocação de menor custo e grava somente após confirmação.
+ */
+void alocarCamarins() {
+    vector<Artista> artistas = gerenciadorArtistas.listar();
+    vector<Camarim> camarins = gerenciadorCamarins.listar();
+    cout << "\n=== Alocação Automática de Camarins ===" << endl;
+    if (artistas.empty() || camarins.empty()) {
+        cout << "Cadastre artistas e camarins antes." << endl;
         return;
     }
     
-    cout << "ID do Item (do catálogo): ";
-    cin >> itemId;
+    vector<RequisitoArtista> requisitos;
+    for (const auto& a : artistas) {
+        RequisitoArtista r;
+        r.artistaId = a.getId();
+        cout << a.getNome() << " - integrantes: ";
+        cin >> r.integrantes;
+        cout << a.getNome() << " - distância máxima do palco em metros (0 = qualquer): ";
+        r.distanciaMaxima = lerDouble();
+        requisitos.push_back(r);
+    }
+    vector<PerfilCamarim> perfis;
+    for (const auto& c : camarins) {
+        PerfilCamarim p;
+        p.camarimId = c.getId();
+        cout << c.getNome() << " - capacidade: ";
+        cin >> p.capacidade;
+        cout << c.getNome() << " - distância do palco em metros: ";
+        p.distanciaPalco = lerDouble();
+        perfis.push_back(p);
+    }
     
-    // Buscar item no catálogo
-    Item* item = gerenciadorItens.buscarPorId(itemId);
-    if (!item) {
-        cout << "\n[ERRO] Item não encontrado no catálogo!" << endl;
-        cout << "Dica: Cadastre o item no catálogo primeiro (Menu Itens)." << endl;
+    char resposta;
+    long long inicio = 0, fim = 0;
+    cout << "Respeitar as reservas da agenda em um horário? (s/n): ";
+    cin >> resposta;
+    bool usarAgenda = resposta == 's' || resposta == 'S';
+    if (usarAgenda && (!lerHorario("Início do show", inicio) || !lerHorario("Fim do show", fim))) {
         return;
     }
     
-    cout << "Item selecionado: " << item->getNome() << endl;
-    cout << "Quantidade: ";
-    cin >> quantidade;
-    
     try {
-        pedido->adicionarItem(item->getId(), item->getNome(), quantidade);
-        cout << "\n[OK] Item adicionado ao pedido!" << endl;
+        ResultadoAlocacao resultado = AlocadorCamarins::resolver(requisitos, perfis,
+                                                                 usarAgenda ? &agenda : nullptr, inicio, fim);
+        cout << "\n--- Alocação proposta ---" << endl;
+        for (const auto& par : resultado.pares) {
+            cout << gerenciadorArtistas.buscarPorId(par.first)->getNome() << " -> "
+                 << gerenciadorCamarins.buscarPorId(par.second)->getNome() << endl;
+        }
+        for (int id : resultado.artistasSemCamarim) {
+            cout << gerenciadorArtistas.buscarPorId(id)->getNome() << " -> (sem camarim compatível)" << endl;
+        }
+        cout << "Custo total: " << fixed << setprecision(2) << resultado.custoTotal << " m" << endl;
+        
+        cout << "Gravar esta alocação? (s/n): ";
+        cin >> resposta;
+        if (resposta != 's' && resposta != 'S') {
+            cout << "\nAlocação descartada." << endl;
+            return;
+        }
+        AlocadorCamarins::aplicar(resultado, gerenciadorArtistas, gerenciadorCamarins);
+        cout << "\n[OK] Alocação gravada!" << endl;
     } catch (const ExcecaoBase& e) {
         cout << "\n[ERRO] " << e.what() << endl;
     }
 }
 
-void removerItemPedido() {
-    int pedidoId, itemId;
+/**
+ * @brief Exibe e define o nível-padrão de um item em um camarim
+ */
+void definirNivelReposicao() {
+    int camarimId, itemId, quantidade;
     
-    cout << "\n=== Remover Item do Pedido ===" << endl;
-    cout << "ID do Pedido: ";
-    cin >> pedidoId;
+    cout << "\n=== Níveis de Reposição ===" << endl;
+    cout << "ID do Camarim: ";
+    cin >> camarimId;
     
-    Pedido* pedido = gerenciadorPedidos.buscarPorId(pedidoId);
-    if (!pedido) {
-        cout << "\n[ERRO] Pedido não encontrado!" << endl;
-        return;
+    vector<ItemCamarim> niveis = reposicao.niveisDe(camarimId);
+    for (const auto& nivel : niveis) {
+        cout << "  " << nivel.itemId << " - " << nivel.nomeItem << ": " << nivel.quantidade << endl;
     }
+    cout << "(" << niveis.size() << " nível(is))" << endl;
     
     cout << "ID do Item: ";
     cin >> itemId;
+    cout << "Nível (0 = remover): ";
+    cin >> quantidade;
     
     try {
-        if (pedido->removerItem(itemId)) {
-            cout << "\n[OK] Item removido do pedido!" << endl;
-        } else {
-            cout << "\n[ERRO] Item não encontrado no pedido!" << endl;
+        const Item* item = gerenciadorItens.buscarPorId(itemId);
+        reposicao.definirNivel(camarimId, itemId, item ? item->getNome() : "", quantidade);
+        cout << "\n[OK] Nível atualizado!" << endl;
+    } catch (const ExcecaoBase& e) {
+        cout << "\n[ERRO] " << e.what() << endl;
+    }
+}
+
+/**
+ * @brief Mostra o plano de reposição de todos os camarins e grava após confirmação
+ */
+void reporCamarins() {
+    cout << "\n=== Repor Camarins ===" << endl;
+    try {
+        PlanoReposicao plano = reposicao.planejar();
+        for (const auto& t : plano.transferencias) {
+            cout << "Camarim " << t.camarimId << " <- " << t.quantidade << " x " << t.nomeItem << endl;
+        }
+        for (const auto& f : plano.faltas) {
+            cout << "Camarim " << f.camarimId << " - faltam " << f.quantidade << " x " << f.nomeItem
+                 << " (sem estoque)" << endl;
+        }
+        if (plano.transferencias.empty()) {
+            cout << "Nada a transferir." << endl;
+            return;
         }
+        
+        char resposta;
+        cout << "Transferir " << plano.totalUnidades() << " unidade(s) do estoque? (s/n): ";
+        cin >> resposta;
+        if (resposta != 's' && resposta != 'S') {
+            cout << "\nReposição descartada." << endl;
+            return;
+        }
+        reposicao.executar(plano);
+        cout << "\n[OK] Camarins repostos!" << endl;
     } catch (const ExcecaoBase& e) {
         cout << "\n[ERRO] " << e.what() << endl;
     }
 }
 
-void marcarPedidoAtendido() {
-    int pedidoId;
+/**
+ * @brief Fechamento do show: conta as sobras, mostra consumo x devolução e grava após confirmação
+ * 
+ * ID 0 fecha todos os camarins de uma vez.
+ */
+void fecharCamarins() {
+    int camarimId;
+    
+    cout << "\n=== Fechamento de Camarins ===" << endl;
+    cout << "ID do Camarim (0 = todos): ";
+    cin >> camarimId;
+    
+    vector<Camarim> camarins;
+    if (camarimId == 0) {
+        camarins = gerenciadorCamarins.listar();
+    } else if (const Camarim* camarim = gerenciadorCamarins.buscarPorId(camarimId)) {
+        camarins.push_back(*camarim);
+    } else {
+        cout << "\n[ERRO] Camarim não encontrado!" << endl;
+        return;
+    }
+    
+    // Contagem do que sobrou em cada linha
+    map<int, map<int, int>> contagens;
+    for (const auto& camarim : camarins) {
+        for (const auto& par : camarim.getItens()) {
+            cout << camarim.getNome() << " - " << par.second.nomeItem << " (" << par.second.quantidade
+                 << ") - sobrou: ";
+            cin >> contagens[camarim.getId()][par.first];
+        }
+    }
+    
+    try {
+        ResultadoReconciliacao resultado = camarimId == 0
+            ? ReconciliacaoCamarins::calcularTodos(gerenciadorCamarins, contagens)
+            : ReconciliacaoCamarins::calcular(gerenciadorCamarins, contagens);
+        if (resultado.linhas.empty()) {
+            cout << "Nenhum item nos camarins." << endl;
+            return;
+        }
+        cout << "\n--- Fechamento ---" << endl;
+        for (const auto& linha : resultado.linhas) {
+            cout << "Camarim " << linha.camarimId << " | " << linha.nomeItem << ": consumido "
+                 << linha.consumido << ", devolvido " << linha.devolvido << endl;
+        }
+        cout << "Total consumido: " << resultado.totalConsumido()
+             << " | devolvido ao estoque: " << resultado.totalDevolvido() << endl;
+        
+        char resposta;
+        cout << "Gravar o fechamento? (s/n): ";
+        cin >> resposta;
+        if (resposta != 's' && resposta != 'S') {
+            cout << "\nFechamento descartado." << endl;
+            return;
+        }
+        ReconciliacaoCamarins::aplicar(resultado, gerenciadorCamarins, estoque);
+        cout << "\n[OK] Camarins fechados!" << endl;
+    } catch (const ExcecaoBase& e) {
+        cout << "\n[ERRO] " << e.what() << endl;
+    }
+}
+
+/**
+ * @brief Exibe o quadro de bastidores (resumo de todos os camarins)
+ */
+void exibirQuadroBastidores() {
+    vector<VisaoCamarim> quadro = montarQuadroBastidores(gerenciadorCamarins, gerenciadorArtistas,
+                                                         gerenciadorPedidos, gerenciadorItens);
+    cout << "\n" << exibirQuadroBastidores(quadro) << endl;
+}
+
+/**
+ * @brief Exibe o painel de indicadores (contadores já calculados, sem varredura)
+ */
+void exibirPainel() {
+    cout << "\n" << painel.exibir() << endl;
+}
+
+// ==================== Funções de Pedidos ====================
+
+void exibirPedidos() {
+    vector<Pedido> pedidos = gerenciadorPedidos.listar();
+    if (pedidos.empty()) {
+        cout << "\nNenhum pedido cadastrado.\n" << endl;
+        return;
+    }
+    
+    cout << "\n=== Lista de Pedidos ===" << endl;
+    for (const auto& pedido : pedidos) {
+        cout << pedido << endl;
+    }
+}
+
+void cadastrarPedido() {
+    int camarimId;
+    string nomeArtista;
+    
+    cout << "\n=== Criar Pedido ===" << endl;
+    cout << "ID do Camarim: ";
+    cin >> camarimId;
+    limparBuffer();
+    
+    cout << "Nome do Artista: ";
+    getline(cin, nomeArtista);
+    
+    try {
+        int id = gerenciadorPedidos.criar(camarimId, nomeArtista);
+        cout << "\n[OK] Pedido criado com ID: " << id << endl;
+    } catch (const ExcecaoBase& e) {
+        cout << "\n[ERRO] " << e.what() << endl;
+    }
+}
+
+void removerPedido() {
+    int id;
+    cout << "\n=== Remover Pedido ===" << endl;
+    cout << "Digite o ID do pedido: ";
+    cin >> id;
+    
+    try {
+        gerenciadorPedidos.remover(id);
+        cout << "\n[OK] Pedido removido com sucesso!" << endl;
+    } catch (const ExcecaoBase& e) {
+        cout << "\n[ERRO] " << e.what() << endl;
+    }
+}
+
+void adicionarItemPedido() {
+    int pedidoId, itemId, quantidade;
+    
+    cout << "\n=== Adicionar Item ao Pedido ===" << endl;
+    cout << "ID do Pedido: ";
+    cin >> pedidoId;
+    
+    Pedido* pedido = gerenciadorPedidos.buscarPorId(pedidoId);
+    if (!pedido) {
+        cout << "\n[ERRO] Pedido não encontrado!" << endl;
+        return;
+    }
+    
+    cout << "ID do Item (do catálogo): ";
+    cin >> itemId;
+    
+    // Buscar item no catálogo
+    Item* item = gerenciadorItens.buscarPorId(itemId);
+    if (!item) {
+        cout << "\n[ERRO] Item não encontrado no catálogo!" << endl;
+        cout << "Dica: Cadastre o item no catálogo primeiro (Menu Itens)." << endl;
+        return;
+    }
+    
+    cout << "Item selecionado: " << item->getNome() << endl;
+    cout << "Quantidade: ";
+    cin >> quantidade;
+    
+    try {
+        gerenciadorPedidos.adicionarItem(pedidoId, item->getId(), item->getNome(), quantidade);
+        cout << "\n[OK] Item adicionado ao pedido!" << endl;
+    } catch (const ExcecaoBase& e) {
+        cout << "\n[ERRO] " << e.what() << endl;
+    }
+}
+
+void removerItemPedido() {
+    int pedidoId, itemId;
+    
+    cout << "\n=== Remover Item do Pedido ===" << endl;
+    cout << "ID do Pedido: ";
+    cin >> pedidoId;
+    
+    Pedido* pedido = gerenciadorPedidos.buscarPorId(pedidoId);
+    if (!pedido) {
+        cout << "\n[ERRO] Pedido não encontrado!" << endl;
+        return;
+    }
+    
+    cout << "ID do Item: ";
+    cin >> itemId;
+    
+    try {
+        if (gerenciadorPedidos.removerItem(pedidoId, itemId)) {
+            cout << "\n[OK] Item removido do pedido!" << endl;
+        } else {
+            cout << "\n[ERRO] Item não encontrado no pedido!" << endl;
+        }
+    } catch (const ExcecaoBase& e) {
+        cout << "\n[ERRO] " << e.what() << endl;
+    }
+}
+
+void marcarPedidoAtendido() {
+    int pedidoId;
     
     cout << "\n=== Marcar Pedido como Atendido ===" << endl;
     cout << "ID do Pedido: ";
@@ -713,7 +1336,7 @@ void marcarPedidoAtendido() {
     }
     
     try {
-        pedido->marcarAtendido();
+        gerenciadorPedidos.marcarAtendido(pedidoId);
         cout << "\n[OK] Pedido marcado como atendido!" << endl;
     } catch (const ExcecaoBase& e) {
         cout << "\n[ERRO] " << e.what() << endl;
@@ -753,6 +1376,415 @@ void buscarPedidosPorCamarim() {
     }
 }
 
+/**
+ * @brief Filtra pedidos por status, camarim e quantidade mínima de unidades
+ */
+void filtrarPedidos() {
+    int status, camarimId, minimoUnidades;
+    
+    cout << "\n=== Filtrar Pedidos ===" << endl;
+    cout << "Status (0 = todos, 1 = pendentes, 2 = atendidos): ";
+    cin >> status;
+    cout << "ID do Camarim (0 = todos): ";
+    cin >> camarimId;
+    cout << "Mínimo de unidades solicitadas: ";
+    cin >> minimoUnidades;
+    
+    Consulta consulta;
+    if (status == 1 || status == 2) {
+        consulta.onde(Campo::ATENDIDO, Operador::IGUAL, status == 2 ? 1 : 0);
+    }
+    if (camarimId > 0) {
+        consulta.onde(Campo::CAMARIM, Operador::IGUAL, camarimId);
+    }
+    consulta.onde(Campo::QUANTIDADE, Operador::MAIOR_IGUAL, minimoUnidades)
+            .ordenarPor(Campo::QUANTIDADE, false);  // Maiores pedidos primeiro
+    
+    ResultadoConsulta<Pedido> resultado = gerenciadorPedidos.consultar(consulta);
+    
+    if (resultado.registros.empty()) {
+        cout << "\nNenhum pedido atende ao filtro." << endl;
+        return;
+    }
+    for (const auto& pedido : resultado.registros) {
+        cout << pedido.exibir() << endl;
+    }
+    cout << "(" << resultado.registros.size() << " encontrado(s))" << endl;
+}
+
+void pedidosPorPeriodo() {
+    long long inicio, fim;
+    cout << "\n=== Pedidos Criados no Período (hoje) ===" << endl;
+    if (!lerPeriodoDeHoje(inicio, fim)) {
+        return;
+    }
+    
+    vector<Pedido> pedidos = gerenciadorPedidos.buscarCriadosEntre(inicio, fim);
+    for (const auto& pedido : pedidos) {
+        cout << "Criado em " << Relogio::formatar(pedido.getCriadoEm())
+             << " | última alteração " << Relogio::formatar(pedido.getAtualizadoEm()) << endl;
+        cout << pedido.exibir() << endl;
+    }
+    cout << "(" << pedidos.size() << " pedido(s))" << endl;
+}
+
+/**
+ * @brief Exibe uma lista de itens mais pedidos
+ */
+void exibirFrequentes(const string& titulo, const vector<ItemFrequente>& itens) {
+    cout << "\n--- " << titulo << " ---" << endl;
+    if (itens.empty()) {
+        cout << "Nenhum item pedido." << endl;
+        return;
+    }
+    int posicao = 1;
+    for (const auto& item : itens) {
+        cout << posicao++ << ". " << item.nomeItem << " (ID " << item.itemId << "): ";
+        if (item.erro == 0) {
+            cout << item.contagem << " pedido(s)" << endl;
+        } else {
+            // Estimativa: a contagem real está entre os dois valores
+            cout << "entre " << item.minimoGarantido() << " e " << item.contagem << " pedido(s)" << endl;
+        }
+    }
+}
+
+void itensMaisPedidos() {
+    cout << "\n=== Itens Mais Pedidos ===" << endl;
+    exibirFrequentes("Últimos 15 minutos", maisPedidos.maisPedidos(10, 15));
+    exibirFrequentes("Última hora", maisPedidos.maisPedidos(10, 60));
+    exibirFrequentes("Desde o início", maisPedidos.maisPedidos(10));
+}
+
+void arquivarPedidosAtendidos() {
+    cout << "\n=== Arquivar Pedidos Atendidos ===" << endl;
+    int arquivados = arquivoPedidos.arquivarAtendidos(gerenciadorPedidos);
+    cout << "\n[OK] " << arquivados << " pedido(s) arquivado(s)" << endl;
+}
+
+void relatorioArquivo() {
+    cout << "\n=== Relatório do Arquivo ===" << endl;
+    if (arquivoPedidos.tamanho() == 0) {
+        cout << "Nenhum pedido arquivado." << endl;
+        return;
+    }
+    cout << arquivoPedidos.tamanho() << " pedido(s) arquivado(s) em "
+         << arquivoPedidos.bytesComprimidos() << " bytes (cerca de "
+         << arquivoPedidos.bytesDescomprimidos() << " bytes como objetos)" << endl;
+
+    cout << "\nQuantidade por item:" << endl;
+    for (const auto& par : arquivoPedidos.quantidadePorItem()) {
+        const Item* item = gerenciadorItens.buscarPorId(par.first);
+        cout << "  " << (item ? item->getNome() : "Item " + to_string(par.first))
+             << " (ID " << par.first << "): " << par.second << endl;
+    }
+    cout << "\nPedidos por camarim:" << endl;
+    for (const auto& par : arquivoPedidos.pedidosPorCamarim()) {
+        cout << "  Camarim " << par.first << ": " << par.second << endl;
+    }
+}
+
+// ==================== Funções da Agenda de Camarins ====================
+
+/**
+ * @brief Exibe uma reserva com horários formatados
+ */
+void exibirReserva(const Reserva& r) {
+    const Artista* artista = gerenciadorArtistas.buscarPorId(r.artistaId);
+    cout << "Reserva " << r.id << " | Camarim " << r.camarimId << " | "
+         << (artista ? artista->getNome() : "Artista " + to_string(r.artistaId))
+         << " | " << Relogio::formatar(r.inicio) << " até " << Relogio::formatar(r.fim) << endl;
+}
+
+void exibirReservas() {
+    cout << "\n=== Reservas de Camarins ===" << endl;
+    vector<Reserva> reservas = agenda.listar();
+    for (const auto& r : reservas) {
+        exibirReserva(r);
+    }
+    cout << "(" << reservas.size() << " reserva(s))" << endl;
+}
+
+void reservarCamarim() {
+    int camarimId, artistaId;
+    long long inicio, fim;
+    
+    cout << "\n=== Reservar Camarim ===" << endl;
+    cout << "ID do Camarim: ";
+    cin >> camarimId;
+    cout << "ID do Artista: ";
+    cin >> artistaId;
+    if (!lerHorario("Início", inicio) || !lerHorario("Fim", fim)) {
+        return;
+    }
+    
+    try {
+        int id = agenda.reservar(camarimId, artistaId, inicio, fim);
+        cout << "\n[OK] Reserva criada com ID: " << id << endl;
+    } catch (const ExcecaoBase& e) {
+        cout << "\n[ERRO] " << e.what() << endl;
+    }
+}
+
+void cancelarReserva() {
+    int id;
+    
+    cout << "\n=== Cancelar Reserva ===" << endl;
+    cout << "ID da Reserva: ";
+    cin >> id;
+    
+    if (agenda.cancelar(id)) {
+        cout << "\n[OK] Reserva cancelada!" << endl;
+    } else {
+        cout << "\n[ERRO] Reserva não encontrada!" << endl;
+    }
+}
+
+void ocupanteCamarim() {
+    int camarimId;
+    long long instante;
+    
+    cout << "\n=== Quem Está no Camarim ===" << endl;
+    cout << "ID do Camarim: ";
+    cin >> camarimId;
+    if (!lerHorario("Horário", instante)) {
+        return;
+    }
+    
+    const Reserva* r = agenda.ocupante(camarimId, instante);
+    if (r) {
+        exibirReserva(*r);
+    } else {
+        cout << "\nCamarim livre neste horário." << endl;
+    }
+}
+
+void camarinsLivres() {
+    long long inicio, fim;
+    
+    cout << "\n=== Camarins Livres no Período ===" << endl;
+    if (!lerHorario("Início", inicio) || !lerHorario("Fim", fim)) {
+        return;
+    }
+    
+    try {
+        vector<int> livres = agenda.camarinsLivres(inicio, fim);
+        for (int id : livres) {
+            const Camarim* camarim = gerenciadorCamarins.buscarPorId(id);
+            cout << "Camarim " << id << (camarim ? " - " + camarim->getNome() : "") << endl;
+        }
+        cout << "(" << livres.size() << " camarim(ns) livre(s))" << endl;
+    } catch (const ExcecaoBase& e) {
+        cout << "\n[ERRO] " << e.what() << endl;
+    }
+}
+
+void agendaDoArtista() {
+    int artistaId;
+    
+    cout << "\n=== Agenda do Artista ===" << endl;
+    cout << "ID do Artista: ";
+    cin >> artistaId;
+    
+    vector<Reserva> reservas = agenda.agendaDoArtista(artistaId);
+    for (const auto& r : reservas) {
+        exibirReserva(r);
+    }
+    cout << "(" << reservas.size() << " reserva(s))" << endl;
+}
+
+// ==================== Funções de Modelos de Rider ====================
+
+void exibirModelos() {
+    vector<ModeloRider> modelos = gerenciadorModelos.listar();
+    if (modelos.empty()) {
+        cout << "\nNenhum modelo cadastrado.\n" << endl;
+        return;
+    }
+    
+    cout << "\n=== Modelos de Rider ===" << endl;
+    for (const auto& modelo : modelos) {
+        cout << modelo.exibir() << endl;
+    }
+}
+
+void cadastrarModelo() {
+    string nome;
+    
+    cout << "\n=== Cadastrar Modelo ===" << endl;
+    limparBuffer();
+    cout << "Nome do Modelo: ";
+    getline(cin, nome);
+    
+    try {
+        int id = gerenciadorModelos.criar(nome);
+        cout << "\n[OK] Modelo criado com ID: " << id << endl;
+    } catch (const ExcecaoBase& e) {
+        cout << "\n[ERRO] " << e.what() << endl;
+    }
+}
+
+void removerModelo() {
+    int id;
+    
+    cout << "\n=== Remover Modelo ===" << endl;
+    cout << "ID do Modelo: ";
+    cin >> id;
+    
+    if (gerenciadorModelos.remover(id)) {
+        cout << "\n[OK] Modelo removido (pedidos e camarins já criados não mudam)." << endl;
+    } else {
+        cout << "\n[ERRO] Modelo não encontrado!" << endl;
+    }
+}
+
+void adicionarItemModelo() {
+    int modeloId, itemId, quantidade;
+    
+    cout << "\n=== Adicionar Item ao Modelo ===" << endl;
+    cout << "ID do Modelo: ";
+    cin >> modeloId;
+    cout << "ID do Item (do catálogo): ";
+    cin >> itemId;
+    
+    Item* item = gerenciadorItens.buscarPorId(itemId);
+    if (!item) {
+        cout << "\n[ERRO] Item não encontrado no catálogo!" << endl;
+        return;
+    }
+    
+    cout << "Item selecionado: " << item->getNome() << endl;
+    cout << "Quantidade: ";
+    cin >> quantidade;
+    
+    try {
+        gerenciadorModelos.adicionarItem(modeloId, item->getId(), item->getNome(), quantidade);
+        cout << "\n[OK] Item adicionado ao modelo!" << endl;
+    } catch (const ExcecaoBase& e) {
+        cout << "\n[ERRO] " << e.what() << endl;
+    }
+}
+
+void removerItemModelo() {
+    int modeloId, itemId;
+    
+    cout << "\n=== Remover Item do Modelo ===" << endl;
+    cout << "ID do Modelo: ";
+    cin >> modeloId;
+    cout << "ID do Item: ";
+    cin >> itemId;
+    
+    try {
+        if (gerenciadorModelos.removerItem(modeloId, itemId)) {
+            cout << "\n[OK] Item removido do modelo!" << endl;
+        } else {
+            cout << "\n[ERRO] Item não está no modelo!" << endl;
+        }
+    } catch (const ExcecaoBase& e) {
+        cout << "\n[ERRO] " << e.what() << endl;
+    }
+}
+
+void criarPedidoDeModelo() {
+    int modeloId, camarimId;
+    string nomeArtista;
+    
+    cout << "\n=== Criar Pedido a partir de Modelo ===" << endl;
+    cout << "ID do Modelo: ";
+    cin >> modeloId;
+    cout << "ID do Camarim: ";
+    cin >> camarimId;
+    limparBuffer();
+    cout << "Nome do Artista: ";
+    getline(cin, nomeArtista);
+    
+    try {
+        int id = gerenciadorModelos.instanciarPedido(modeloId, gerenciadorPedidos, camarimId, nomeArtista);
+        cout << "\n[OK] Pedido criado com ID: " << id << endl;
+    } catch (const ExcecaoBase& e) {
+        cout << "\n[ERRO] " << e.what() << endl;
+    }
+}
+
+void abastecerCamarimComModelo() {
+    int modeloId, camarimId;
+    
+    cout << "\n=== Abastecer Camarim com Modelo ===" << endl;
+    cout << "ID do Modelo: ";
+    cin >> modeloId;
+    cout << "ID do Camarim: ";
+    cin >> camarimId;
+    
+    try {
+        gerenciadorModelos.instanciarCamarim(modeloId, gerenciadorCamarins, camarimId);
+        cout << "\n[OK] Itens do modelo colocados no camarim!" << endl;
+    } catch (const ExcecaoBase& e) {
+        cout << "\n[ERRO] " << e.what() << endl;
+    }
+}
+
+/**
+ * @brief Exibe as alterações que podem ser desfeitas (mais recente primeiro)
+ */
+void exibirHistorico() {
+    cout << "\n=== Histórico de Alterações ===" << endl;
+    vector<string> alteracoes = historico.listar();
+    if (alteracoes.empty()) {
+        cout << "Nenhuma alteração registrada." << endl;
+    }
+    for (const auto& descricao : alteracoes) {
+        cout << "- " << descricao << endl;
+    }
+    cout << "(" << historico.totalDesfazer() << " para desfazer, "
+         << historico.totalRefazer() << " para refazer)" << endl;
+}
+
+void desfazerAlteracao() {
+    string descricao = historico.proximoDesfazer();
+    try {
+        if (historico.desfazer()) {
+            cout << "\n[OK] Desfeito: " << descricao << endl;
+        } else {
+            cout << "\nNada para desfazer." << endl;
+        }
+    } catch (const ExcecaoBase& e) {
+        cout << "\n[ERRO] " << e.what() << endl;
+    }
+}
+
+void refazerAlteracao() {
+    string descricao = historico.proximoRefazer();
+    try {
+        if (historico.refazer()) {
+            cout << "\n[OK] Refeito: " << descricao << endl;
+        } else {
+            cout << "\nNada para refazer." << endl;
+        }
+    } catch (const ExcecaoBase& e) {
+        cout << "\n[ERRO] " << e.what() << endl;
+    }
+}
+
+void marcarHistorico() {
+    cout << "\n[OK] Marcador criado: " << historico.marcar() << endl;
+    cout << "Use 'Desfazer até Marcador' para reverter tudo o que vier depois." << endl;
+}
+
+void desfazerAteMarcador() {
+    long long marcador;
+    
+    cout << "\n=== Desfazer até Marcador ===" << endl;
+    cout << "Marcador: ";
+    cin >> marcador;
+    
+    try {
+        int desfeitos = historico.desfazerAte(marcador);
+        cout << "\n[OK] " << desfeitos << " alteração(ões) desfeita(s)." << endl;
+    } catch (const ExcecaoBase& e) {
+        cout << "\n[ERRO] " << e.what() << endl;
+    }
+}
+
 void buscarArtistasPorCamarim() {
     int camarimId;
     
@@ -848,7 +1880,8 @@ void adicionarItemListaCompras() {
     cin >> quantidade;
     
     try {
-        lista->adicionarItem(item->getId(), item->getNome(), quantidade, item->getPreco());
+        gerenciadorListaCompras.adicionarItem(listaId, item->getId(), item->getNome(), quantidade,
+                                              item->getPreco());
         cout << "\n[OK] Item adicionado à lista!" << endl;
     } catch (const ExcecaoBase& e) {
         cout << "\n[ERRO] " << e.what() << endl;
@@ -872,20 +1905,185 @@ void removerItemListaCompras() {
     cin >> itemId;
     
     try {
-        if (lista->removerItem(itemId)) {
-            cout << "\n[OK] Item removido da lista!" << endl;
-        } else {
-            cout << "\n[ERRO] Item não encontrado na lista!" << endl;
-        }
+        if (gerenciadorListaCompras.removerItem(listaId, itemId)) {
+            cout << "\n[OK] Item removido da lista!" << endl;
+        } else {
+            cout << "\n[ERRO] Item não encontrado na lista!" << endl;
+        }
+    } catch (const ExcecaoBase& e) {
+        cout << "\n[ERRO] " << e.what() << endl;
+    }
+}
+
+void atualizarQuantidadeItemLista() {
+    int listaId, itemId, quantidade;
+    
+    cout << "\n=== Atualizar Quantidade de Item ===" << endl;
+    cout << "ID da Lista: ";
+    cin >> listaId;
+    
+    ListaCompras* lista = gerenciadorListaCompras.buscarPorId(listaId);
+    if (!lista) {
+        cout << "\n[ERRO] Lista não encontrada!" << endl;
+        return;
+    }
+    
+    cout << "ID do Item: ";
+    cin >> itemId;
+    
+    cout << "Nova Quantidade: ";
+    cin >> quantidade;
+    
+    try {
+        gerenciadorListaCompras.atualizarQuantidade(listaId, itemId, quantidade);
+        cout << "\n[OK] Quantidade atualizada!" << endl;
+    } catch (const ExcecaoBase& e) {
+        cout << "\n[ERRO] " << e.what() << endl;
+    }
+}
+
+void calcularTotalListaCompras() {
+    int listaId;
+    
+    cout << "\n=== Calcular Total da Lista ===" << endl;
+    cout << "ID da Lista: ";
+    cin >> listaId;
+    
+    ListaCompras* lista = gerenciadorListaCompras.buscarPorId(listaId);
+    if (!lista) {
+        cout << "\n[ERRO] Lista não encontrada!" << endl;
+        return;
+    }
+    
+    double total = lista->calcularTotal();
+    cout << "\n=== TOTAL ===" << endl;
+    cout << fixed << setprecision(2);
+    cout << "R$ " << total << endl;
+}
+
+void limparListaCompras() {
+    int listaId;
+    
+    cout << "\n=== Limpar Lista de Compras ===" << endl;
+    cout << "ID da Lista: ";
+    cin >> listaId;
+    
+    ListaCompras* lista = gerenciadorListaCompras.buscarPorId(listaId);
+    if (!lista) {
+        cout << "\n[ERRO] Lista não encontrada!" << endl;
+        return;
+    }
+    
+    try {
+        gerenciadorListaCompras.limpar(listaId);
+        cout << "\n[OK] Lista de compras limpa!" << endl;
+    } catch (const ExcecaoBase& e) {
+        cout << "\n[ERRO] " << e.what() << endl;
+    }
+}
+
+// ==================== Funções de Fornecedores ====================
+
+void cadastrarFornecedor() {
+    string nome;
+    cout << "\n=== Cadastrar Fornecedor ===" << endl;
+    limparBuffer();
+    cout << "Nome: ";
+    getline(cin, nome);
+    
+    try {
+        int id = fornecedores.cadastrarFornecedor(nome);
+        cout << "\n[OK] Fornecedor cadastrado com ID: " << id << endl;
+    } catch (const ExcecaoBase& e) {
+        cout << "\n[ERRO] " << e.what() << endl;
+    }
+}
+
+void definirOfertaFornecedor() {
+    int fornecedorId, itemId, unidades;
+    double preco;
+    
+    cout << "\n=== Definir Oferta de Fornecedor ===" << endl;
+    for (const auto& f : fornecedores.listarFornecedores()) {
+        cout << f.id << ". " << f.nome << endl;
+    }
+    cout << "ID do Fornecedor: ";
+    cin >> fornecedorId;
+    cout << "ID do Item (do catálogo): ";
+    cin >> itemId;
+    cout << "Unidades por embalagem (1 = avulso): ";
+    cin >> unidades;
+    cout << "Preço da embalagem: R$ ";
+    cin >> preco;
+    
+    try {
+        fornecedores.definirOferta(fornecedorId, itemId, preco, unidades);
+        cout << "\n[OK] Oferta registrada!" << endl;
+    } catch (const ExcecaoBase& e) {
+        cout << "\n[ERRO] " << e.what() << endl;
+    }
+}
+
+/**
+ * @brief Ofertas do item (mais barata por unidade primeiro) e a melhor para uma quantidade
+ */
+void ofertasDoItem() {
+    int itemId, quantidade;
+    cout << "\n=== Ofertas de um Item ===" << endl;
+    cout << "ID do Item: ";
+    cin >> itemId;
+    
+    vector<Fornecedor> cadastrados = fornecedores.listarFornecedores();
+    map<int, string> nomes;
+    for (const auto& f : cadastrados) {
+        nomes[f.id] = f.nome;
+    }
+    vector<OfertaFornecedor> ofertas = fornecedores.ofertasDe(itemId);
+    if (ofertas.empty()) {
+        cout << "Nenhum fornecedor oferece este item (vale o preço do catálogo)." << endl;
+    }
+    for (const auto& o : ofertas) {
+        cout << left << setw(25) << nomes[o.fornecedorId] << right << fixed << setprecision(2)
+             << "R$ " << setw(8) << o.precoEmbalagem << " / " << o.unidadesEmbalagem << " un."
+             << "  (R$ " << o.precoUnitario() << " por unidade)" << endl;
+    }
+    
+    cout << "Quantidade a comprar: ";
+    cin >> quantidade;
+    try {
+        CotacaoCompra cotacao = fornecedores.cotar(itemId, quantidade);
+        cout << "\nMelhor compra: " << (cotacao.fornecedorId ? nomes[cotacao.fornecedorId] : "preço do catálogo")
+             << " - " << cotacao.unidades << " un. por R$ " << fixed << setprecision(2) << cotacao.custo << endl;
+    } catch (const ExcecaoBase& e) {
+        cout << "\n[ERRO] " << e.what() << endl;
+    }
+}
+
+/**
+ * @brief Nova lista de compras com o que falta para repor os camarins, no melhor preço
+ */
+void gerarListaPelaReposicao() {
+    string descricao;
+    cout << "\n=== Gerar Lista pela Reposição ===" << endl;
+    limparBuffer();
+    cout << "Descrição da lista: ";
+    getline(cin, descricao);
+    
+    try {
+        int id = fornecedores.gerarListaCompras(gerenciadorListaCompras, descricao, reposicao.planejar().faltas);
+        cout << "\n[OK] Lista criada com ID: " << id << endl;
+        cout << *gerenciadorListaCompras.buscarPorId(id) << endl;
     } catch (const ExcecaoBase& e) {
         cout << "\n[ERRO] " << e.what() << endl;
     }
 }
 
-void atualizarQuantidadeItemLista() {
-    int listaId, itemId, quantidade;
-    
-    cout << "\n=== Atualizar Quantidade de Item ===" << endl;
+/**
+ * @brief Mostra a divisão da lista por fornecedor e grava uma lista por fornecedor após confirmação
+ */
+void dividirListaPorFornecedor() {
+    int listaId;
+    cout << "\n=== Dividir Lista por Fornecedor ===" << endl;
     cout << "ID da Lista: ";
     cin >> listaId;
     
@@ -895,58 +2093,118 @@ void atualizarQuantidadeItemLista() {
         return;
     }
     
-    cout << "ID do Item: ";
-    cin >> itemId;
-    
-    cout << "Nova Quantidade: ";
-    cin >> quantidade;
-    
     try {
-        lista->atualizarQuantidade(itemId, quantidade);
-        cout << "\n[OK] Quantidade atualizada!" << endl;
+        DivisaoCompras divisao = fornecedores.dividir(*lista);
+        cout << fixed << setprecision(2);
+        for (const auto& pedido : divisao.pedidos) {
+            cout << "\n--- " << pedido.nomeFornecedor << " (R$ " << pedido.total() << ") ---" << endl;
+            for (const auto& item : pedido.itens) {
+                cout << left << setw(25) << item.nomeItem << right << setw(5) << item.quantidade
+                     << " x R$ " << item.preco << " = R$ " << item.subtotal << endl;
+            }
+        }
+        if (!divisao.semOferta.empty()) {
+            cout << "\n--- Sem oferta de fornecedor ---" << endl;
+            for (const auto& item : divisao.semOferta) {
+                cout << left << setw(25) << item.nomeItem << right << setw(5) << item.quantidade << endl;
+            }
+        }
+        cout << "\nTotal: R$ " << divisao.total() << endl;
+        
+        char resposta;
+        cout << "Criar uma lista por fornecedor? (s/n): ";
+        cin >> resposta;
+        if (resposta != 's' && resposta != 'S') {
+            return;
+        }
+        ListasPorFornecedor criadas = fornecedores.dividirEmListas(gerenciadorListaCompras, listaId);
+        cout << "\n[OK] " << criadas.porFornecedor.size() << " lista(s) por fornecedor criada(s)." << endl;
+        if (criadas.semOferta != 0) {
+            cout << "[OK] Itens sem oferta na lista ID " << criadas.semOferta << "." << endl;
+        }
     } catch (const ExcecaoBase& e) {
         cout << "\n[ERRO] " << e.what() << endl;
     }
 }
 
-void calcularTotalListaCompras() {
-    int listaId;
-    
-    cout << "\n=== Calcular Total da Lista ===" << endl;
-    cout << "ID da Lista: ";
-    cin >> listaId;
+// ==================== Funções de Exportação ====================
+
+/**
+ * @brief Exporta uma coleção escolhida em CSV ou JSON
+ * 
+ * O formato sai das tabelas de campos (esquema.h): nenhuma entidade
+ * precisa de código próprio para exportar.
+ */
+template <typename T>
+void exportar(ostream& saida, const vector<T>& registros, int formato) {
+    if (formato == 1) {
+        esquema::exportarCsv(saida, registros);
+    } else {
+        esquema::exportarJson(saida, registros);
+    }
+}
+
+void exportarDados() {
+    int entidade, formato;
+    string arquivo;
     
-    ListaCompras* lista = gerenciadorListaCompras.buscarPorId(listaId);
-    if (!lista) {
-        cout << "\n[ERRO] Lista não encontrada!" << endl;
+    cout << "\n=== Exportar Dados ===" << endl;
+    cout << "1. Itens  2. Estoque  3. Artistas  4. Camarins  5. Pedidos  6. Listas de Compras" << endl;
+    cout << "Entidade: ";
+    cin >> entidade;
+    cout << "Formato (1 = CSV, 2 = JSON): ";
+    cin >> formato;
+    limparBuffer();
+    if (entidade < 1 || entidade > 6 || (formato != 1 && formato != 2)) {
+        cout << "\n[ERRO] Opção inválida!" << endl;
         return;
     }
-    
-    double total = lista->calcularTotal();
-    cout << "\n=== TOTAL ===" << endl;
-    cout << fixed << setprecision(2);
-    cout << "R$ " << total << endl;
+    cout << "Arquivo (vazio = tela): ";
+    getline(cin, arquivo);
+    
+    ofstream arquivoSaida;
+    if (!arquivo.empty()) {
+        arquivoSaida.open(arquivo);
+        if (!arquivoSaida) {
+            cout << "\n[ERRO] Não foi possível criar o arquivo " << arquivo << endl;
+            return;
+        }
+    }
+    ostream& saida = arquivo.empty() ? cout : arquivoSaida;
+    switch (entidade) {
+        case 1: exportar(saida, gerenciadorItens.listar(), formato); break;
+        case 2: exportar(saida, estoque.listar(), formato); break;
+        case 3: exportar(saida, gerenciadorArtistas.listar(), formato); break;
+        case 4: exportar(saida, gerenciadorCamarins.listar(), formato); break;
+        case 5: exportar(saida, gerenciadorPedidos.listar(), formato); break;
+        case 6: exportar(saida, gerenciadorListaCompras.listar(), formato); break;
+    }
+    if (!arquivo.empty()) {
+        cout << "\n[OK] Exportado para " << arquivo << endl;
+    }
 }
 
-void limparListaCompras() {
-    int listaId;
+void relatorioGeral() {
+    string arquivo;
     
-    cout << "\n=== Limpar Lista de Compras ===" << endl;
-    cout << "ID da Lista: ";
-    cin >> listaId;
+    cout << "\n=== Relatório Geral ===" << endl;
+    limparBuffer();  // Limpa buffer antes de getline()
+    cout << "Arquivo (vazio = tela): ";
+    getline(cin, arquivo);
     
-    ListaCompras* lista = gerenciadorListaCompras.buscarPorId(listaId);
-    if (!lista) {
-        cout << "\n[ERRO] Lista não encontrada!" << endl;
+    string texto = gerarRelatorio(gerenciadorCamarins, gerenciadorPedidos, gerenciadorListaCompras,
+                                  estoque, &Escalonador::compartilhado());
+    if (arquivo.empty()) {
+        cout << "\n" << texto;
         return;
     }
-    
-    try {
-        lista->limpar();
-        cout << "\n[OK] Lista de compras limpa!" << endl;
-    } catch (const ExcecaoBase& e) {
-        cout << "\n[ERRO] " << e.what() << endl;
+    ofstream arquivoSaida(arquivo);
+    if (!arquivoSaida) {
+        cout << "\n[ERRO] Não foi possível criar o arquivo " << arquivo << endl;
+        return;
     }
+    arquivoSaida << texto;
+    cout << "\n[OK] Relatório gravado em " << arquivo << endl;
 }
 
 
@@ -958,9 +2216,46 @@ void menuPrincipal(){
     cout << "4. Artista" << endl;
     cout << "5. Lista de Pedidos" << endl;
     cout << "6. Lista de Compras" << endl;
+    cout << "7. Quadro de Bastidores" << endl;
+    cout << "8. Painel" << endl;
+    cout << "9. Histórico" << endl;
+    cout << "10. Agenda de Camarins" << endl;
+    cout << "11. Modelos de Rider" << endl;
+    cout << "12. Exportar Dados" << endl;
+    cout << "13. Relatório Geral" << endl;
     cout << "0. Finalizar" << endl;
 }
 
+void menuSubModelos(){
+    cout << "1. Exibir" << endl;
+    cout << "2. Cadastrar" << endl;
+    cout << "3. Remover" << endl;
+    cout << "4. Adicionar Item" << endl;
+    cout << "5. Remover Item" << endl;
+    cout << "6. Criar Pedido" << endl;
+    cout << "7. Abastecer Camarim" << endl;
+    cout << "0. Retornar" << endl;
+}
+
+void menuSubAgenda(){
+    cout << "1. Exibir Reservas" << endl;
+    cout << "2. Reservar" << endl;
+    cout << "3. Cancelar Reserva" << endl;
+    cout << "4. Quem Está no Camarim" << endl;
+    cout << "5. Camarins Livres no Período" << endl;
+    cout << "6. Agenda do Artista" << endl;
+    cout << "0. Retornar" << endl;
+}
+
+void menuSubHistorico(){
+    cout << "1. Exibir" << endl;
+    cout << "2. Desfazer" << endl;
+    cout << "3. Refazer" << endl;
+    cout << "4. Criar Marcador" << endl;
+    cout << "5. Desfazer até Marcador" << endl;
+    cout << "0. Retornar" << endl;
+}
+
 void menuSub(){
     cout << "1. Exibir" << endl;
     cout << "2. Cadastrar" << endl;
@@ -974,6 +2269,12 @@ void menuSubItens(){
     cout << "3. Remover" << endl;
     cout << "4. Atualizar" << endl;
     cout << "5. Buscar por Nome" << endl;
+    cout << "6. Busca Aproximada" << endl;
+    cout << "7. Filtrar" << endl;
+    cout << "8. Onde é Usado" << endl;
+    cout << "9. Definir Código de Barras" << endl;
+    cout << "10. Buscar por Código de Barras" << endl;
+    cout << "11. Congelar Catálogo" << endl;
     cout << "0. Retornar" << endl;
 }
 
@@ -984,6 +2285,11 @@ void menuSubEstoque(){
     cout << "4. Verificar Disponibilidade" << endl;
     cout << "5. Consultar Quantidade" << endl;
     cout << "6. Atualizar Quantidade" << endl;
+    cout << "7. Definir Mínimo" << endl;
+    cout << "8. Movimentações no Período" << endl;
+    cout << "9. Recebimento por Leitor" << endl;
+    cout << "10. Entrada de Lote com Validade" << endl;
+    cout << "11. Lotes a Vencer" << endl;
     cout << "0. Retornar" << endl;
 }
 
@@ -1004,6 +2310,12 @@ void menuSubCamarins(){
     cout << "5. Remover Item" << endl;
     cout << "6. Atualizar" << endl;
     cout << "7. Buscar por Artista" << endl;
+    cout << "8. Visão Completa" << endl;
+    cout << "9. Alterações no Período" << endl;
+    cout << "10. Alocação Automática" << endl;
+    cout << "11. Níveis de Reposição" << endl;
+    cout << "12. Repor Camarins" << endl;
+    cout << "13. Fechamento (Sobras e Consumo)" << endl;
     cout << "0. Retornar" << endl;
 }
 
@@ -1016,6 +2328,11 @@ void menuSubPedidos(){
     cout << "6. Marcar Atendido" << endl;
     cout << "7. Listar Pendentes" << endl;
     cout << "8. Buscar por Camarim" << endl;
+    cout << "9. Filtrar" << endl;
+    cout << "10. Criados no Período" << endl;
+    cout << "11. Itens Mais Pedidos" << endl;
+    cout << "12. Arquivar Atendidos" << endl;
+    cout << "13. Relatório do Arquivo" << endl;
     cout << "0. Retornar" << endl;
 }
 
@@ -1028,6 +2345,11 @@ void menuSubListaCompras(){
     cout << "6. Atualizar Quantidade" << endl;
     cout << "7. Calcular Total" << endl;
     cout << "8. Limpar Lista" << endl;
+    cout << "9. Cadastrar Fornecedor" << endl;
+    cout << "10. Definir Oferta de Fornecedor" << endl;
+    cout << "11. Ofertas de um Item" << endl;
+    cout << "12. Gerar Lista pela Reposição (melhor preço)" << endl;
+    cout << "13. Dividir Lista por Fornecedor" << endl;
     cout << "0. Retornar" << endl;
 }
 
@@ -1042,6 +2364,20 @@ int main(){
     
     int opcao1, opcao2;
     
+    // Painel passa a receber todas as mutações dos gerenciadores
+    painel.conectar(gerenciadorArtistas, gerenciadorCamarins, gerenciadorPedidos,
+                    gerenciadorListaCompras, estoque);
+    maisPedidos.conectar(gerenciadorPedidos);
+    agenda.conectar(gerenciadorArtistas, gerenciadorCamarins);
+    reposicao.conectar(gerenciadorCamarins, estoque);
+    fornecedores.conectar(gerenciadorItens);
+    arquivoPedidos.conectar(gerenciadorItens);  // Nomes de item do arquivo vêm do catálogo
+    referenciasItens.conectar(gerenciadorItens, gerenciadorCamarins, gerenciadorPedidos,
+                              gerenciadorListaCompras, estoque);
+    referenciasItens.acompanharModulos(gerenciadorModelos, reposicao);
+    historico.conectar(gerenciadorItens, gerenciadorArtistas, gerenciadorCamarins, gerenciadorPedidos,
+                       gerenciadorListaCompras, estoque);
+    
     do {
         menuPrincipal();
         cout << "\nDigite uma opção: ";
@@ -1081,6 +2417,30 @@ int main(){
                         buscarItemPorNome();
                         break;
                         
+                        case 6:
+                        buscarItemAproximado();
+                        break;
+                        
+                        case 7:
+                        filtrarItens();
+                        break;
+                        
+                        case 8:
+                        ondeItemEhUsado();
+                        break;
+                        
+                        case 9:
+                        definirCodigoBarrasItem();
+                        break;
+                        
+                        case 10:
+                        buscarItemPorCodigo();
+                        break;
+                        
+                        case 11:
+                        congelarCatalogo();
+                        break;
+                        
                         case 0: 
                         cout << "\nRetornando ao menu principal...\n" << endl;
                         break;
@@ -1126,6 +2486,26 @@ int main(){
                         atualizarQuantidadeEstoque();
                         break;
                         
+                        case 7:
+                        definirMinimoEstoque();
+                        break;
+                        
+                        case 8:
+                        movimentosEstoquePorPeriodo();
+                        break;
+                        
+                        case 9:
+                        recebimentoPorLeitor();
+                        break;
+                        
+                        case 10:
+                        entradaComValidadeEstoque();
+                        break;
+                        
+                        case 11:
+                        lotesAVencerEstoque();
+                        break;
+                        
                         case 0: 
                         cout << "\nRetornando ao menu principal...\n" << endl;
                         break;
@@ -1175,6 +2555,30 @@ int main(){
                         buscarCamarimPorArtista();
                         break;
                         
+                        case 8:
+                        exibirVisaoCamarim();
+                        break;
+                        
+                        case 9:
+                        alteracoesCamarimPorPeriodo();
+                        break;
+                        
+                        case 10:
+                        alocarCamarins();
+                        break;
+                        
+                        case 11:
+                        definirNivelReposicao();
+                        break;
+                        
+                        case 12:
+                        reporCamarins();
+                        break;
+                        
+                        case 13:
+                        fecharCamarins();
+                        break;
+                        
                         case 0: 
                         cout << "\nRetornando ao menu principal...\n" << endl;
                         break;
@@ -1269,6 +2673,26 @@ int main(){
                         buscarPedidosPorCamarim();
                         break;
                         
+                        case 9:
+                        filtrarPedidos();
+                        break;
+                        
+                        case 10:
+                        pedidosPorPeriodo();
+                        break;
+                        
+                        case 11:
+                        itensMaisPedidos();
+                        break;
+                        
+                        case 12:
+                        arquivarPedidosAtendidos();
+                        break;
+                        
+                        case 13:
+                        relatorioArquivo();
+                        break;
+                        
                         case 0: 
                         cout << "\nRetornando ao menu principal...\n" << endl;
                         break;
@@ -1322,6 +2746,169 @@ int main(){
                         limparListaCompras();
                         break;
                         
+                        case 9:
+                        cadastrarFornecedor();
+                        break;
+                        
+                        case 10:
+                        definirOfertaFornecedor();
+                        break;
+                        
+                        case 11:
+                        ofertasDoItem();
+                        break;
+                        
+                        case 12:
+                        gerarListaPelaReposicao();
+                        break;
+                        
+                        case 13:
+                        dividirListaPorFornecedor();
+                        break;
+                        
+                        case 0: 
+                        cout << "\nRetornando ao menu principal...\n" << endl;
+                        break;
+                        
+                        default: cout <<"Digite uma opção válida...\n" << endl;
+                    }
+                } while (opcao2 != 0);
+                
+                break;
+                
+                case 7:
+                exibirQuadroBastidores();
+                break;
+                
+                case 8:
+                exibirPainel();
+                break;
+                
+                case 9:
+                do {
+                    //Chama o submenu 9.Histórico e aguarda interação
+                    
+                    cout << "Menu de Histórico: \n";
+                    menuSubHistorico();
+                    cout << "\nDigite uma opção: ";
+                    cin >> opcao2;
+                    cout << endl;
+                    
+                    switch (opcao2){
+                        case 1: 
+                        exibirHistorico();
+                        break;
+                        
+                        case 2: 
+                        desfazerAlteracao();
+                        break;
+                        
+                        case 3: 
+                        refazerAlteracao();
+                        break;
+                        
+                        case 4:
+                        marcarHistorico();
+                        break;
+                        
+                        case 5:
+                        desfazerAteMarcador();
+                        break;
+                        
+                        case 0: 
+                        cout << "\nRetornando ao menu principal...\n" << endl;
+                        break;
+                        
+                        default: cout <<"Digite uma opção válida...\n" << endl;
+                    }
+                } while (opcao2 != 0);
+                
+                break;
+                
+                case 10:
+                do {
+                    //Chama o submenu 10.Agenda de Camarins e aguarda interação
+                    
+                    cout << "Menu de Agenda de Camarins: \n";
+                    menuSubAgenda();
+                    cout << "\nDigite uma opção: ";
+                    cin >> opcao2;
+                    cout << endl;
+                    
+                    switch (opcao2){
+                        case 1: 
+                        exibirReservas();
+                        break;
+                        
+                        case 2: 
+                        reservarCamarim();
+                        break;
+                        
+                        case 3: 
+                        cancelarReserva();
+                        break;
+                        
+                        case 4:
+                        ocupanteCamarim();
+                        break;
+                        
+                        case 5:
+                        camarinsLivres();
+                        break;
+                        
+                        case 6:
+                        agendaDoArtista();
+                        break;
+                        
+                        case 0: 
+                        cout << "\nRetornando ao menu principal...\n" << endl;
+                        break;
+                        
+                        default: cout <<"Digite uma opção válida...\n" << endl;
+                    }
+                } while (opcao2 != 0);
+                
+                break;
+                
+                case 11:
+                do {
+                    //Chama o submenu 11.Modelos de Rider e aguarda interação
+                    
+                    cout << "Menu de Modelos de Rider: \n";
+                    menuSubModelos();
+                    cout << "\nDigite uma opção: ";
+                    cin >> opcao2;
+                    cout << endl;
+                    
+                    switch (opcao2){
+                        case 1: 
+                        exibirModelos();
+                        break;
+                        
+                        case 2: 
+                        cadastrarModelo();
+                        break;
+                        
+                        case 3: 
+                        removerModelo();
+                        break;
+                        
+                        case 4:
+                        adicionarItemModelo();
+                        break;
+                        
+                        case 5:
+                        removerItemModelo();
+                        break;
+                        
+                        case 6:
+                        criarPedidoDeModelo();
+                        break;
+                        
+                        case 7:
+                        abastecerCamarimComModelo();
+                        break;
+                        
                         case 0: 
                         cout << "\nRetornando ao menu principal...\n" << endl;
                         break;
@@ -1332,6 +2919,14 @@ int main(){
                 
                 break;
                 
+                case 12:
+                exportarDados();
+                break;
+                
+                case 13:
+                relatorioGeral();
+                break;
+                
                 case 0: cout << "Finalizando programa"; break; 
                 default: cout <<"Digite uma opção válida...\n" << endl; // retorna ao menu principal
                 
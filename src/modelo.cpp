@@ -0,0 +1,190 @@
+/**
+ * @file modelo.cpp
+ * @brief Implementação de ModeloRider e GerenciadorModelos
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ */
+
+// Inclui o header com as declarações
+#include "modelo.h"
+// Para stringstream (exibir)
+#include <sstream>
+// Para formatação (setw, left)
+#include <iomanip>
+
+// ==================== Classe ModeloRider ====================
+
+ModeloRider::ModeloRider() : id(0), nome("") {}
+
+ModeloRider::ModeloRider(int id, const string& nome) : id(id), nome(nome) {}
+
+int ModeloRider::getId() const { return id; }
+string ModeloRider::getNome() const { return nome; }
+
+/**
+ * Adiciona linha nos dois formatos (as instâncias continuam com as linhas antigas)
+ */
+void ModeloRider::adicionarItem(int itemId, const string& nomeItem, int quantidade) {
+    // Mesmas regras de Pedido::adicionarItem e Camarim::inserirItem
+    if (itemId < 0) {
+        throw ValidacaoException("ID do item inválido");
+    }
+    if (nomeItem.empty()) {
+        throw ValidacaoException("Nome do item não pode ser vazio");
+    }
+    if (quantidade <= 0) {
+        throw ValidacaoException("Quantidade deve ser maior que zero");
+    }
+
+    // escrever(): se alguma instância ainda compartilha as linhas, o modelo se separa dela
+    map<int, ItemPedido>& pedido = linhasPedido.escrever();
+    map<int, ItemCamarim>& camarim = linhasCamarim.escrever();
+    auto it = pedido.find(itemId);
+    if (it != pedido.end()) {
+        it->second.quantidade += quantidade;
+        camarim[itemId].quantidade += quantidade;
+    } else {
+        pedido[itemId] = ItemPedido(itemId, nomeItem, quantidade);
+        camarim[itemId] = ItemCamarim(itemId, nomeItem, quantidade);
+    }
+}
+
+bool ModeloRider::removerItem(int itemId) {
+    if (linhasPedido.ler().count(itemId) == 0) {
+        return false;  // Leitura apenas: nada é copiado
+    }
+    linhasPedido.escrever().erase(itemId);
+    linhasCamarim.escrever().erase(itemId);
+    return true;
+}
+
+const map<int, ItemPedido>& ModeloRider::getItens() const {
+    return linhasPedido.ler();
+}
+
+const CopiaNaEscrita<map<int, ItemPedido>>& ModeloRider::getLinhasPedido() const {
+    return linhasPedido;
+}
+
+const CopiaNaEscrita<map<int, ItemCamarim>>& ModeloRider::getLinhasCamarim() const {
+    return linhasCamarim;
+}
+
+string ModeloRider::exibir() const {
+    stringstream ss;
+    ss << "=== MODELO ===" << endl;
+    ss << "ID: " << id << endl;
+    ss << "Nome: " << nome << endl;
+    ss << "\nItens:" << endl;
+
+    const map<int, ItemPedido>& itens = linhasPedido.ler();
+    if (itens.empty()) {
+        ss << "  Nenhum item no modelo" << endl;
+    } else {
+        ss << left << setw(5) << "  ID" << setw(30) << "Nome"
+           << setw(10) << "Quantidade" << endl;
+        ss << "  " << string(42, '-') << endl;
+        for (const auto& par : itens) {
+            const ItemPedido& item = par.second;
+            ss << left << setw(5) << "  " + to_string(item.itemId)
+               << setw(30) << item.nomeItem
+               << setw(10) << item.quantidade << endl;
+        }
+    }
+    return ss.str();
+}
+
+// ==================== Classe IndiceModelosPorItem ====================
+
+// Chave = itemIds das linhas (em ordem: as linhas são um map)
+vector<int> IndiceModelosPorItem::chave(const ModeloRider& modelo) {
+    vector<int> itens;
+    itens.reserve(modelo.getItens().size());
+    for (const auto& par : modelo.getItens()) {
+        itens.push_back(par.first);
+    }
+    return itens;
+}
+
+void IndiceModelosPorItem::inserir(const vector<int>& itens, int id) {
+    for (int itemId : itens) {
+        grupos.inserir(itemId, id);
+    }
+}
+
+void IndiceModelosPorItem::remover(const vector<int>& itens, int id) {
+    for (int itemId : itens) {
+        grupos.remover(itemId, id);
+    }
+}
+
+// ==================== Classe GerenciadorModelos ====================
+
+const ModeloRider& GerenciadorModelos::exigir(int id) const {
+    const ModeloRider* modelo = buscarPorId(id);
+    if (modelo == nullptr) {
+        throw ModeloException("Modelo com ID " + to_string(id) + " não encontrado");
+    }
+    return *modelo;
+}
+
+int GerenciadorModelos::criar(const string& nome, AlocadorIds::Bloco* bloco) {
+    if (nome.empty()) {
+        throw ValidacaoException("Nome do modelo não pode ser vazio");
+    }
+    return modelos.cadastrar([&](int id) { return ModeloRider(id, nome); }, bloco).getId();
+}
+
+AlocadorIds& GerenciadorModelos::getAlocadorIds() {
+    return modelos.getAlocadorIds();
+}
+
+const ModeloRider* GerenciadorModelos::buscarPorId(int id) const {
+    return modelos.buscar(id);
+}
+
+// Mover um modelo no vector é O(1): as linhas são compartilhadas
+bool GerenciadorModelos::remover(int id) {
+    return modelos.remover(id);
+}
+
+vector<ModeloRider> GerenciadorModelos::listar() const {
+    return modelos.todos();  // Cópia O(n): as linhas não são copiadas
+}
+
+const vector<int>& GerenciadorModelos::modelosComItem(int itemId) const {
+    return modelos.indice<IndiceModelosPorItem>().buscar(itemId);
+}
+
+// O repositório põe o modelo no grupo do item se a linha é nova
+void GerenciadorModelos::adicionarItem(int modeloId, int itemId, const string& nomeItem, int quantidade) {
+    exigir(modeloId);
+    modelos.alterar(*modelos.buscar(modeloId), [&](ModeloRider& modelo) {
+        modelo.adicionarItem(itemId, nomeItem, quantidade);
+    });
+}
+
+bool GerenciadorModelos::removerItem(int modeloId, int itemId) {
+    exigir(modeloId);
+    return modelos.alterar(*modelos.buscar(modeloId), [&](ModeloRider& modelo) {
+        return modelo.removerItem(itemId);
+    });
+}
+
+// ==================== Instanciação ====================
+
+/**
+ * Pedido novo compartilhando as linhas do modelo: O(1) em memória
+ */
+int GerenciadorModelos::instanciarPedido(int modeloId, GerenciadorPedidos& pedidos, int camarimId,
+                                         const string& nomeArtista) const {
+    return pedidos.criarComItens(camarimId, nomeArtista, exigir(modeloId).getLinhasPedido());
+}
+
+/**
+ * Camarim abastecido com as linhas do modelo
+ */
+void GerenciadorModelos::instanciarCamarim(int modeloId, GerenciadorCamarins& camarins, int camarimId) const {
+    camarins.abastecer(camarimId, exigir(modeloId).getLinhasCamarim());
+}
@@ -0,0 +1,71 @@
+/**
+ * @file observador.cpp
+ * @brief Implementação das classes ObservadorMutacoes e FonteMutacoes
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ */
+
+// Inclui o header com as declarações
+#include "observador.h"
+// Para find e remove
+#include <algorithm>
+
+// ==================== Classe ObservadorMutacoes ====================
+// Implementações vazias: cada observador sobrescreve só o que precisa
+
+ObservadorMutacoes::~ObservadorMutacoes() {}
+
+void ObservadorMutacoes::aoMudarItem(const Item*, const Item*) {}
+void ObservadorMutacoes::aoMudarArtista(const Artista*, const Artista*) {}
+void ObservadorMutacoes::aoMudarCamarim(const Camarim*, const Camarim*) {}
+void ObservadorMutacoes::aoMudarPedido(const Pedido*, const Pedido*) {}
+void ObservadorMutacoes::aoMudarLista(const ListaCompras*, const ListaCompras*) {}
+void ObservadorMutacoes::aoMudarEstoque(const MudancaEstoque&) {}
+void ObservadorMutacoes::aoAdicionarItemPedido(const Pedido&, int, const string&, int) {}
+void ObservadorMutacoes::aoDescartarDependentes(const DescarteDependentes&) {}
+
+// ==================== Classe FonteMutacoes ====================
+
+FonteMutacoes::FonteMutacoes() {}
+
+// Cópia começa sem observadores: quem observa o original não observa a cópia
+FonteMutacoes::FonteMutacoes(const FonteMutacoes&) {}
+
+FonteMutacoes& FonteMutacoes::operator=(const FonteMutacoes&) {
+    return *this;  // Observadores do destino são mantidos
+}
+
+FonteMutacoes::~FonteMutacoes() {}
+
+/**
+ * Registra observador (sem duplicar)
+ */
+void FonteMutacoes::adicionarObservador(ObservadorMutacoes* observador) {
+    if (observador != nullptr &&
+        find(observadores.begin(), observadores.end(), observador) == observadores.end()) {
+        observadores.push_back(observador);
+    }
+}
+
+/**
+ * Remove observador
+ */
+void FonteMutacoes::removerObservador(ObservadorMutacoes* observador) {
+    observadores.erase(remove(observadores.begin(), observadores.end(), observador),
+                       observadores.end());
+}
+
+/**
+ * Há observadores registrados?
+ */
+bool FonteMutacoes::temObservadores() const {
+    return !observadores.empty();
+}
+
+/**
+ * Repassa o descarte de um módulo a todos os observadores
+ */
+void FonteMutacoes::avisarDescarte(const DescarteDependentes& descarte) const {
+    notificar([&](ObservadorMutacoes* o) { o->aoDescartarDependentes(descarte); });
+}
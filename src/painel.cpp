@@ -0,0 +1,189 @@
+/**
+ * @file painel.cpp
+ * @brief Implementação do PainelBastidores (contadores incrementais)
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ */
+
+// Inclui o header com as declarações
+#include "painel.h"
+// Para stringstream
+#include <sstream>
+// Para formatação (setw, setprecision)
+#include <iomanip>
+
+PainelBastidores::PainelBastidores() {}
+
+/**
+ * Destrutor - sai da lista de observadores dos gerenciadores
+ */
+PainelBastidores::~PainelBastidores() {
+    desconectar();
+}
+
+/**
+ * Conecta aos gerenciadores e reconstrói os contadores
+ */
+void PainelBastidores::conectar(GerenciadorArtistas& artistas, GerenciadorCamarins& camarins,
+                                GerenciadorPedidos& pedidos, GerenciadorListaCompras& listas,
+                                Estoque& estoque) {
+    desconectar();
+
+    // Zera tudo e reaproveita os próprios avisos para montar o estado inicial
+    indicadores = IndicadoresPainel();
+    artistasPorCamarim.clear();
+    camarinsExistentes.clear();
+    totalArtistas = 0;
+    artistasAlocados = 0;
+    totalListas = 0;
+
+    for (const Camarim& c : camarins.listar()) {
+        aoMudarCamarim(nullptr, &c);
+    }
+    for (const Artista& a : artistas.listar()) {
+        aoMudarArtista(nullptr, &a);
+    }
+    for (const Pedido& p : pedidos.listar()) {
+        aoMudarPedido(nullptr, &p);
+    }
+    for (const ListaCompras& l : listas.listar()) {
+        aoMudarLista(nullptr, &l);
+    }
+    map<int, int> minimos = estoque.listarMinimos();
+    for (const ItemEstoque& item : estoque.listar()) {
+        aoMudarEstoque(MudancaEstoque{item.itemId, item.nomeItem, 0, item.quantidade,
+                                      0, estoque.obterMinimo(item.itemId), {}, estoque.listarLotes(item.itemId)});
+        minimos.erase(item.itemId);  // Mínimo já contabilizado
+    }
+    for (const auto& par : minimos) {
+        // Mínimo de item que não está no estoque (quantidade 0)
+        aoMudarEstoque(MudancaEstoque{par.first, "", 0, 0, 0, par.second, {}, {}});
+    }
+
+    // A partir daqui, cada mutação chega pelos avisos
+    this->artistas = &artistas;
+    this->camarins = &camarins;
+    this->pedidos = &pedidos;
+    this->listas = &listas;
+    this->estoque = &estoque;
+    artistas.adicionarObservador(this);
+    camarins.adicionarObservador(this);
+    pedidos.adicionarObservador(this);
+    listas.adicionarObservador(this);
+    estoque.adicionarObservador(this);
+}
+
+/**
+ * Desconecta dos gerenciadores (sem efeito se não conectado)
+ */
+void PainelBastidores::desconectar() {
+    if (artistas) artistas->removerObservador(this);
+    if (camarins) camarins->removerObservador(this);
+    if (pedidos) pedidos->removerObservador(this);
+    if (listas) listas->removerObservador(this);
+    if (estoque) estoque->removerObservador(this);
+    artistas = nullptr;
+    camarins = nullptr;
+    pedidos = nullptr;
+    listas = nullptr;
+    estoque = nullptr;
+}
+
+const IndicadoresPainel& PainelBastidores::obter() const {
+    return indicadores;
+}
+
+// ==================== Avisos dos gerenciadores ====================
+
+/**
+ * Soma (delta = +1) ou retira (delta = -1) um artista de um camarim
+ */
+void PainelBastidores::contarArtista(int camarimId, int delta) {
+    int& quantidade = artistasPorCamarim[camarimId];
+    quantidade += delta;
+    totalArtistas += delta;
+
+    if (camarinsExistentes.count(camarimId)) {
+        artistasAlocados += delta;
+        // Camarim passou de vazio para ocupado (ou o contrário)
+        if (delta > 0 && quantidade == 1) indicadores.camarinsOcupados++;
+        if (delta < 0 && quantidade == 0) indicadores.camarinsOcupados--;
+    }
+    if (quantidade == 0) {
+        artistasPorCamarim.erase(camarimId);  // Não acumula chaves zeradas
+    }
+    indicadores.artistasSemCamarim = totalArtistas - artistasAlocados;
+}
+
+void PainelBastidores::aoMudarArtista(const Artista* antes, const Artista* depois) {
+    if (antes) contarArtista(antes->getCamarimId(), -1);
+    if (depois) contarArtista(depois->getCamarimId(), +1);
+}
+
+void PainelBastidores::aoMudarCamarim(const Camarim* antes, const Camarim* depois) {
+    if (antes && depois) {
+        return;  // Alteração de nome/artista/itens: o ID continua existindo
+    }
+    int id = antes ? antes->getId() : depois->getId();
+    auto it = artistasPorCamarim.find(id);
+    int alocados = it == artistasPorCamarim.end() ? 0 : it->second;
+
+    if (depois) {  // Camarim criado: artistas que já apontavam para ele passam a alocados
+        camarinsExistentes.insert(id);
+        artistasAlocados += alocados;
+        if (alocados > 0) indicadores.camarinsOcupados++;
+    } else {       // Camarim removido: seus artistas ficam sem camarim
+        camarinsExistentes.erase(id);
+        artistasAlocados -= alocados;
+        if (alocados > 0) indicadores.camarinsOcupados--;
+    }
+    indicadores.artistasSemCamarim = totalArtistas - artistasAlocados;
+}
+
+void PainelBastidores::aoMudarPedido(const Pedido* antes, const Pedido* depois) {
+    if (antes) {
+        (antes->isAtendido() ? indicadores.pedidosAtendidos : indicadores.pedidosPendentes)--;
+    }
+    if (depois) {
+        (depois->isAtendido() ? indicadores.pedidosAtendidos : indicadores.pedidosPendentes)++;
+    }
+}
+
+void PainelBastidores::aoMudarLista(const ListaCompras* antes, const ListaCompras* depois) {
+    if (antes) {
+        indicadores.valorListas -= antes->calcularTotal();
+        totalListas--;
+    }
+    if (depois) {
+        indicadores.valorListas += depois->calcularTotal();
+        totalListas++;
+    }
+    if (totalListas == 0) {
+        indicadores.valorListas = 0.0;  // Sem listas: descarta resíduo de arredondamento
+    }
+}
+
+void PainelBastidores::aoMudarEstoque(const MudancaEstoque& mudanca) {
+    indicadores.unidadesEstoque += mudanca.quantidadeDepois - mudanca.quantidadeAntes;
+
+    bool abaixoAntes = mudanca.minimoAntes > 0 && mudanca.quantidadeAntes < mudanca.minimoAntes;
+    bool abaixoDepois = mudanca.minimoDepois > 0 && mudanca.quantidadeDepois < mudanca.minimoDepois;
+    indicadores.itensAbaixoMinimo += static_cast<int>(abaixoDepois) - static_cast<int>(abaixoAntes);
+}
+
+// ==================== Exibição ====================
+
+string PainelBastidores::exibir() const {
+    stringstream ss;
+    ss << "=== PAINEL DE BASTIDORES ===" << endl;
+    ss << left << setw(28) << "Pedidos pendentes:" << indicadores.pedidosPendentes << endl;
+    ss << left << setw(28) << "Pedidos atendidos:" << indicadores.pedidosAtendidos << endl;
+    ss << left << setw(28) << "Camarins ocupados:" << indicadores.camarinsOcupados << endl;
+    ss << left << setw(28) << "Artistas sem camarim:" << indicadores.artistasSemCamarim << endl;
+    ss << left << setw(29) << "Itens abaixo do mínimo:" << indicadores.itensAbaixoMinimo << endl;
+    ss << left << setw(28) << "Unidades em estoque:" << indicadores.unidadesEstoque << endl;
+    ss << left << setw(28) << "Valor das listas:" << "R$ " << fixed << setprecision(2)
+       << indicadores.valorListas << endl;
+    return ss.str();
+}
@@ -0,0 +1,271 @@
+/**
+ * @file paralelo.cpp
+ * @brief Implementação do Escalonador (filas por thread e roubo de trabalho)
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ */
+
+// Inclui o header com as declarações
+#include "paralelo.h"
+// Para max
+#include <algorithm>
+
+// Escalonador e fila da thread atual (nullptr: thread de fora)
+static thread_local const Escalonador* donoDaThread = nullptr;
+static thread_local size_t filaDaThread = 0;
+
+// ==================== Grupo ====================
+
+Escalonador::Grupo::Grupo(Escalonador& escalonador) : escalonador(escalonador), pendentes(0) {}
+
+Escalonador::Grupo::~Grupo() {
+    try {
+        esperar();
+    } catch (...) {
+        // Exceção não consultada: o destrutor só garante que as tarefas terminaram
+    }
+}
+
+void Escalonador::Grupo::registrarErro(exception_ptr e) {
+    lock_guard<mutex> guarda(travaErro);
+    if (!erro) {
+        erro = e;
+    }
+}
+
+void Escalonador::Grupo::enviar(function<void()> tarefa, Prioridade prioridade) {
+    pendentes.fetch_add(1);
+    escalonador.empilhar(Tarefa{move(tarefa), this}, prioridade);
+}
+
+void Escalonador::Grupo::esperar() {
+    size_t fila = escalonador.filaAtual();
+    while (pendentes.load() > 0) {
+        if (escalonador.executarUma(fila, true)) {
+            continue;
+        }
+        // Nada para executar: dorme até o grupo acabar ou surgir tarefa nova
+        unique_lock<mutex> guarda(escalonador.travaSono);
+        auto pronto = [&] { return pendentes.load() == 0 || escalonador.haTarefas(); };
+        escalonador.dormindo.fetch_add(1);
+        if (!pronto()) {
+            escalonador.adormecimentos.fetch_add(1, memory_order_relaxed);
+            escalonador.acordar.wait(guarda, pronto);
+        }
+        escalonador.dormindo.fetch_sub(1);
+    }
+    exception_ptr e;
+    {
+        lock_guard<mutex> guarda(travaErro);
+        e = erro;
+        erro = nullptr;
+    }
+    if (e) {
+        rethrow_exception(e);
+    }
+}
+
+// ==================== Escalonador ====================
+
+Escalonador::Fila::Fila() {
+    for (int p = 0; p < TOTAL_PRIORIDADES; p++) {
+        executadas[p].store(0);
+    }
+}
+
+size_t Escalonador::padraoThreads() {
+    unsigned nucleos = thread::hardware_concurrency();
+    return nucleos > 1 ? nucleos - 1 : 0;
+}
+
+Escalonador& Escalonador::compartilhado() {
+    static Escalonador instancia;
+    return instancia;
+}
+
+Escalonador::Escalonador(size_t threads) : dormindo(0), adormecimentos(0), encerrando(false) {
+    for (int p = 0; p < TOTAL_PRIORIDADES; p++) {
+        enfileiradas[p].store(0);
+    }
+    for (size_t i = 0; i <= threads; i++) {
+        filas.push_back(unique_ptr<Fila>(new Fila()));
+    }
+    trabalhadores.reserve(threads);
+    for (size_t i = 0; i < threads; i++) {
+        trabalhadores.emplace_back([this, i] { laco(i); });
+    }
+}
+
+Escalonador::~Escalonador() {
+    {
+        lock_guard<mutex> guarda(travaSono);
+        encerrando = true;
+    }
+    acordar.notify_all();
+    for (thread& t : trabalhadores) {
+        t.join();
+    }
+}
+
+size_t Escalonador::filaAtual() const {
+    return donoDaThread == this ? filaDaThread : filas.size() - 1;
+}
+
+bool Escalonador::haTarefas() const {
+    for (int p = 0; p < TOTAL_PRIORIDADES; p++) {
+        if (enfileiradas[p].load() > 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void Escalonador::avisar(bool todos) {
+    // Contadores seq_cst dos dois lados: quem vai dormir incrementa 'dormindo'
+    // e depois olha as filas; quem enfileira faz o contrário. Um dos dois vê o outro.
+    if (dormindo.load() == 0) {
+        return;
+    }
+    lock_guard<mutex> guarda(travaSono);
+    if (todos) {
+        acordar.notify_all();
+    } else {
+        acordar.notify_one();
+    }
+}
+
+void Escalonador::empilhar(Tarefa tarefa, Prioridade prioridade) {
+    int p = static_cast<int>(prioridade);
+    Fila& fila = *filas[filaAtual()];
+    {
+        lock_guard<mutex> guarda(fila.trava);
+        fila.tarefas[p].push_back(move(tarefa));
+    }
+    enfileiradas[p].fetch_add(1);
+    avisar(false);
+}
+
+bool Escalonador::retirar(size_t fila, Tarefa& tarefa, int& prioridade, bool& roubada) {
+    size_t n = filas.size();
+    for (int p = 0; p < TOTAL_PRIORIDADES; p++) {
+        if (enfileiradas[p].load() == 0) {
+            continue;  // Nenhuma tarefa desta prioridade em fila alguma
+        }
+        // Primeiro a própria fila (pelo fim), depois as outras (pelo início)
+        for (size_t k = 0; k < n; k++) {
+            Fila& alvo = *filas[(fila + k) % n];
+            lock_guard<mutex> guarda(alvo.trava);
+            deque<Tarefa>& tarefas = alvo.tarefas[p];
+            if (tarefas.empty()) {
+                continue;
+            }
+            if (k == 0) {
+                tarefa = move(tarefas.back());
+                tarefas.pop_back();
+            } else {
+                tarefa = move(tarefas.front());
+                tarefas.pop_front();
+            }
+            enfileiradas[p].fetch_sub(1);
+            prioridade = p;
+            roubada = k != 0;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool Escalonador::executarUma(size_t fila, bool esperando) {
+    Tarefa tarefa;
+    int prioridade = 0;
+    bool roubada = false;
+    if (!retirar(fila, tarefa, prioridade, roubada)) {
+        return false;
+    }
+    try {
+        tarefa.corpo();
+    } catch (...) {
+        tarefa.grupo->registrarErro(current_exception());
+    }
+    tarefa.corpo = nullptr;  // Capturas destruídas antes de o grupo ser dado como concluído
+
+    Fila& propria = *filas[fila];
+    propria.executadas[prioridade].fetch_add(1, memory_order_relaxed);
+    if (roubada) {
+        propria.roubadas.fetch_add(1, memory_order_relaxed);
+    }
+    if (esperando) {
+        propria.executadasEsperando.fetch_add(1, memory_order_relaxed);
+    }
+    // Depois deste decremento o grupo pode deixar de existir: não é mais tocado
+    if (tarefa.grupo->pendentes.fetch_sub(1) == 1) {
+        avisar(true);
+    }
+    return true;
+}
+
+void Escalonador::laco(size_t fila) {
+    donoDaThread = this;
+    filaDaThread = fila;
+    for (;;) {
+        if (executarUma(fila, false)) {
+            continue;
+        }
+        unique_lock<mutex> guarda(travaSono);
+        auto pronto = [&] { return encerrando || haTarefas(); };
+        dormindo.fetch_add(1);
+        if (!pronto()) {
+            adormecimentos.fetch_add(1, memory_order_relaxed);
+            acordar.wait(guarda, pronto);
+        }
+        dormindo.fetch_sub(1);
+        if (encerrando && !haTarefas()) {
+            return;
+        }
+    }
+}
+
+void Escalonador::dividir(Grupo& grupo, const function<void(size_t)>& corpo, size_t inicio, size_t fim,
+                          size_t porTarefa, Prioridade prioridade) {
+    // Metade de cima vai para a fila (pode ser roubada e dividida de novo); a de baixo fica
+    while (fim - inicio > porTarefa) {
+        size_t meio = inicio + (fim - inicio) / 2;
+        grupo.enviar([this, &grupo, &corpo, meio, fim, porTarefa, prioridade] {
+            dividir(grupo, corpo, meio, fim, porTarefa, prioridade);
+        }, prioridade);
+        fim = meio;
+    }
+    for (size_t i = inicio; i < fim; i++) {
+        corpo(i);
+    }
+}
+
+void Escalonador::paraCada(size_t inicio, size_t fim, const function<void(size_t)>& corpo,
+                           size_t porTarefa, Prioridade prioridade) {
+    if (inicio >= fim) {
+        return;
+    }
+    Grupo grupo(*this);  // Se corpo lançar aqui, o destrutor espera as partes já enviadas
+    dividir(grupo, corpo, inicio, fim, max<size_t>(1, porTarefa), prioridade);
+    grupo.esperar();
+}
+
+size_t Escalonador::getParalelismo() const {
+    return trabalhadores.size() + 1;
+}
+
+EstatisticasEscalonador Escalonador::getEstatisticas() const {
+    EstatisticasEscalonador estatisticas;
+    for (const auto& fila : filas) {
+        unsigned long long interativas = fila->executadas[static_cast<int>(Prioridade::INTERATIVA)].load();
+        unsigned long long lote = fila->executadas[static_cast<int>(Prioridade::LOTE)].load();
+        estatisticas.interativas += interativas;
+        estatisticas.lote += lote;
+        estatisticas.roubadas += fila->roubadas.load();
+        estatisticas.executadasEsperando += fila->executadasEsperando.load();
+        estatisticas.porFila.push_back(interativas + lote);
+    }
+    estatisticas.adormecimentos = adormecimentos.load();
+    return estatisticas;
+}
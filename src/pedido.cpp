@@ -12,6 +12,8 @@
 #include "pedido.h"
 // Inclui exceções customizadas
 #include "excecoes.h"
+// Regras dos campos (tabela constexpr do Pedido)
+#include "esquema.h"
 // Algoritmos STL (remove_if, etc)
 #include <algorithm>
 // Para stringstream (construir strings)
@@ -24,14 +26,17 @@
 /**
  * Construtor padrão - inicializa com valores vazios
  */
-Pedido::Pedido() : id(0), camarimId(0), nomeArtista(""), atendido(false) {}
+Pedido::Pedido() : id(0), camarimId(0), nomeArtista(""), atendido(false), criadoEm(0), atualizadoEm(0) {}
 // atendido = false: pedido começa como PENDENTE
 
 /**
  * Construtor parametrizado - inicializa com dados fornecidos
  */
 Pedido::Pedido(int id, int camarimId, const string& nomeArtista)
-    : id(id), camarimId(camarimId), nomeArtista(nomeArtista), atendido(false) {}
+    : id(id), camarimId(camarimId), nomeArtista(nomeArtista), atendido(false),
+      criadoEm(0), atualizadoEm(0) {
+    esquema::validar(*this);  // Regras da tabela do Pedido (as mesmas dos setters)
+}
 // Pedido sempre começa como não atendido (pendente)
 
 /**
@@ -59,8 +64,8 @@ int Pedido::getCamarimId() const {
 /**
  * Retorna nome do artista
  */
-string Pedido::getNomeArtista() const {
-    return nomeArtista;  // Retorna cópia da string
+const string& Pedido::getNomeArtista() const {
+    return nomeArtista;  // Referência: válida enquanto o pedido existir
 }
 
 /**
@@ -71,15 +76,16 @@ bool Pedido::isAtendido() const {
     // Convenção: is<Nome>() para métodos que retornam bool
 }
 
+long long Pedido::getCriadoEm() const { return criadoEm; }
+long long Pedido::getAtualizadoEm() const { return atualizadoEm; }
+
 // ==================== SETTERS ====================
 
 /**
  * Define ID do pedido com validação
  */
 void Pedido::setId(int id) {
-    if (id < 0) {  // Validação
-        throw ValidacaoException("ID do pedido inválido");
-    }
+    esquema::validarCampo<Pedido>(Campo::ID, id);  // Validação
     this->id = id;  // this-> diferencia parâmetro de atributo
 }
 
@@ -87,9 +93,7 @@ void Pedido::setId(int id) {
  * Define camarim solicitante com validação
  */
 void Pedido::setCamarimId(int camarimId) {
-    if (camarimId < 0) {  // ID deve ser positivo
-        throw ValidacaoException("ID do camarim inválido");
-    }
+    esquema::validarCampo<Pedido>(Campo::CAMARIM, camarimId);  // ID não pode ser negativo
     this->camarimId = camarimId;
 }
 
@@ -97,9 +101,7 @@ void Pedido::setCamarimId(int camarimId) {
  * Define nome do artista com validação
  */
 void Pedido::setNomeArtista(const string& nomeArtista) {
-    if (nomeArtista.empty()) {  // Nome não pode ser vazio
-        throw ValidacaoException("Nome do artista não pode ser vazio");
-    }
+    esquema::validarCampo<Pedido>(Campo::NOME, nomeArtista);  // Nome não pode ser vazio
     this->nomeArtista = nomeArtista;
 }
 
@@ -110,6 +112,9 @@ void Pedido::setAtendido(bool atendido) {
     this->atendido = atendido;  // Permite mudar de volta para pendente se necessário
 }
 
+void Pedido::setCriadoEm(long long criadoEm) { this->criadoEm = criadoEm; }
+void Pedido::setAtualizadoEm(long long atualizadoEm) { this->atualizadoEm = atualizadoEm; }
+
 /**
  * Adiciona item ao pedido
  */
@@ -132,6 +137,9 @@ void Pedido::adicionarItem(int itemId, const string& nomeItem, int quantidade) {
         throw ValidacaoException("Quantidade deve ser maior que zero");
     }
     
+    // Escrita: se o map é compartilhado com outra cópia, separa-se dela aqui
+    map<int, ItemPedido>& itens = this->itens.escrever();
+    
     // Adiciona ou atualiza item no map
     if (itens.find(itemId) != itens.end()) {
         // Item JÁ EXISTE: soma quantidade
@@ -151,15 +159,13 @@ bool Pedido::removerItem(int itemId) {
         throw PedidoException("Não é possível remover itens de um pedido já atendido");
     }
     
-    // Busca item no map
-    auto it = itens.find(itemId);
-    
-    if (it == itens.end()) {  // Não encontrou
+    // Busca item no map (leitura: item ausente não copia nada)
+    if (itens.ler().find(itemId) == itens.ler().end()) {  // Não encontrou
         return false;  // Item não está no pedido
     }
     
     // Remove completamente do map (não subtrai quantidade)
-    itens.erase(itemId);
+    itens.escrever().erase(itemId);
     return true;  // Sucesso
 }
 
@@ -171,6 +177,16 @@ void Pedido::marcarAtendido() {
     // Chamado após transferir itens do estoque para o camarim
 }
 
+// Acesso somente leitura aos itens do pedido
+const map<int, ItemPedido>& Pedido::getItens() const {
+    return itens.ler();  // Referência constante: sem cópia e sem permitir alteração
+}
+
+// Passa a usar o armazenamento de 'origem' (cópia O(1))
+void Pedido::compartilharItens(const CopiaNaEscrita<map<int, ItemPedido>>& origem) {
+    itens = origem;
+}
+
 /**
  * Exibe informações completas do pedido
  */
@@ -186,6 +202,7 @@ string Pedido::exibir() const {
     
     ss << "\nItens:" << endl;
     
+    const map<int, ItemPedido>& itens = this->itens.ler();  // Somente leitura
     if (itens.empty()) {  // Se não há itens
         ss << "  Nenhum item no pedido" << endl;
     } else {
@@ -219,66 +236,75 @@ ostream& operator<<(ostream& os, const Pedido& pedido) {
 /**
  * Construtor - inicializa próximo ID como 1
  */
-GerenciadorPedidos::GerenciadorPedidos() : proximoId(1) {}
+GerenciadorPedidos::GerenciadorPedidos() {}
+
+/**
+ * Alocador de IDs do repositório (compartilhado entre threads)
+ */
+AlocadorIds& GerenciadorPedidos::getAlocadorIds() {
+    return pedidos.getAlocadorIds();
+}
 
 /**
  * Cria novo pedido (CREATE)
  */
-int GerenciadorPedidos::criar(int camarimId, const string& nomeArtista) {
-    // VALIDAÇÕES:
-    if (camarimId < 0) {
-        throw ValidacaoException("ID do camarim inválido");
-    }
-    
-    if (nomeArtista.empty()) {
-        throw ValidacaoException("Nome do artista não pode ser vazio");
-    }
+int GerenciadorPedidos::criar(int camarimId, const string& nomeArtista, AlocadorIds::Bloco* bloco) {
+    return criarComItens(camarimId, nomeArtista, CopiaNaEscrita<map<int, ItemPedido>>(), bloco);
+}
+
+/**
+ * Cria pedido compartilhando as linhas informadas (CREATE a partir de modelo)
+ */
+int GerenciadorPedidos::criarComItens(int camarimId, const string& nomeArtista,
+                                      const CopiaNaEscrita<map<int, ItemPedido>>& itens,
+                                      AlocadorIds::Bloco* bloco) {
+    // VALIDAÇÕES: regras da tabela do Pedido, antes de gastar um ID
+    esquema::validarCampo<Pedido>(Campo::CAMARIM, camarimId);
+    esquema::validarCampo<Pedido>(Campo::NOME, nomeArtista);
     
-    // Cria pedido com ID automático
-    Pedido novoPedido(proximoId, camarimId, nomeArtista);
-    // Pedido começa vazio (sem itens) e pendente (não atendido)
+    // Cria pedido com ID automático; o repositório atualiza os índices
+    Pedido& novo = pedidos.cadastrar([&](int id) {
+        Pedido novoPedido(id, camarimId, nomeArtista);
+        novoPedido.compartilharItens(itens);  // O(1): nenhuma linha é copiada
+        // Pedido começa pendente (não atendido)
+        long long agora = Relogio::agora();
+        novoPedido.setCriadoEm(agora);
+        novoPedido.setAtualizadoEm(agora);
+        return novoPedido;
+    }, bloco);
     
-    // Adiciona ao vector
-    pedidos.push_back(novoPedido);
-    // push_back() faz cópia do objeto
+    // Avisa os observadores: pedido criado (e cada item dele, para os itens mais pedidos)
+    notificar([&](ObservadorMutacoes* o) {
+        o->aoMudarPedido(nullptr, &novo);
+        for (const auto& par : novo.getItens()) {
+            o->aoAdicionarItemPedido(novo, par.first, par.second.nomeItem, par.second.quantidade);
+        }
+    });
     
-    return proximoId++;  // Retorna ID usado e incrementa para próximo
+    return novo.getId();  // Retorna o ID gerado
 }
 
 /**
  * Busca pedido por ID (READ)
  */
 Pedido* GerenciadorPedidos::buscarPorId(int id) {
-    // Percorre vector de pedidos
-    for (auto& pedido : pedidos) {
-        // auto& = referência (permite modificar)
-        
-        if (pedido.getId() == id) {  // Se encontrou
-            return &pedido;  // Retorna PONTEIRO para o pedido
-            // Ponteiro permite adicionar itens, marcar como atendido, etc
-        }
-    }
-    return nullptr;  // Não encontrado
+    return pedidos.buscar(id);  // Índice hash: O(1) em média; nullptr se não encontrado
+    // Ponteiro permite adicionar itens, etc
+}
+
+/**
+ * Versão const da busca por ID (somente leitura)
+ */
+const Pedido* GerenciadorPedidos::buscarPorId(int id) const {
+    return pedidos.buscar(id);
 }
 
 /**
  * Busca pedidos de um camarim específico (READ com filtro)
  */
 vector<Pedido> GerenciadorPedidos::buscarPorCamarim(int camarimId) const {
-    vector<Pedido> resultado;  // Vector vazio para armazenar resultados
-    
-    // Percorre todos os pedidos
-    for (const auto& pedido : pedidos) {
-        // const auto& = referência constante (não modifica)
-        
-        if (pedido.getCamarimId() == camarimId) {
-            // Se pedido é deste camarim
-            resultado.push_back(pedido);
-            // Adiciona CÓPIA do pedido ao resultado
-        }
-    }
-    
-    return resultado;  // Retorna vector com todos os pedidos deste camarim
+    // Percorre apenas os pedidos do camarim (índice por camarim, ordem de criação)
+    return pedidos.registrosDe(pedidos.indice<PorCamarim>().buscar(camarimId));
     // Útil para ver histórico de pedidos de um artista
 }
 
@@ -286,46 +312,179 @@ vector<Pedido> GerenciadorPedidos::buscarPorCamarim(int camarimId) const {
  * Lista apenas pedidos pendentes (READ com filtro)
  */
 vector<Pedido> GerenciadorPedidos::listarPendentes() const {
-    vector<Pedido> pendentes;  // Vector para armazenar apenas pendentes
-    
-    // Percorre todos os pedidos
-    for (const auto& pedido : pedidos) {
-        if (!pedido.isAtendido()) {
-            // ! = operador NOT (negação)
-            // Se NOT atendido = pendente
-            
-            pendentes.push_back(pedido);
-            // Adiciona cópia ao vector
-        }
-    }
-    
-    return pendentes;  // Retorna apenas pedidos não atendidos
+    // Grupo 0 do índice por status = não atendidos, em ordem de criação
+    return pedidos.registrosDe(pedidos.indice<PorStatus>().buscar(0));
     // Útil para gerenciar fila de processamento
 }
 
+/**
+ * Lista apenas pedidos atendidos (grupo 1 do índice por status)
+ */
+vector<Pedido> GerenciadorPedidos::listarAtendidos() const {
+    return pedidos.registrosDe(pedidos.indice<PorStatus>().buscar(1));
+}
+
 /**
  * Remove pedido (DELETE)
  */
 bool GerenciadorPedidos::remover(int id) {
-    // PADRÃO REMOVE-ERASE:
-    auto it = remove_if(pedidos.begin(), pedidos.end(),
-                       [id](const Pedido& p) { return p.getId() == id; });
-    // LAMBDA: [id](const Pedido& p) { return p.getId() == id; }
-    //   [id] = captura variável id por valor
-    //   (const Pedido& p) = parâmetro (cada pedido)
-    //   { return ... } = critério de remoção
+    // Guarda o pedido removido apenas se alguém vai ser avisado (map de itens)
+    Pedido removido;
+    bool avisar = temObservadores();
+    if (!pedidos.remover(id, avisar ? &removido : nullptr)) {
+        return false;  // Não encontrado
+    }
     
-    if (it != pedidos.end()) {  // Se encontrou pedido(s) a remover
-        pedidos.erase(it, pedidos.end());
-        // erase() remove do vector
-        return true;  // Sucesso
+    if (avisar) {
+        notificar([&](ObservadorMutacoes* o) { o->aoMudarPedido(&removido, nullptr); });
     }
-    return false;  // Não encontrado
+    return true;  // Sucesso
 }
 
 /**
  * Lista todos os pedidos (READ ALL)
  */
 vector<Pedido> GerenciadorPedidos::listar() const {
-    return pedidos;  // Retorna CÓPIA de todo o vector
+    return pedidos.todos();  // Retorna CÓPIA de todo o vector
+}
+
+/**
+ * Acesso direto ao vector do repositório (sem cópia)
+ */
+const vector<Pedido>& GerenciadorPedidos::todos() const {
+    return pedidos.todos();
+}
+
+// Executa consulta usando o índice por ID ou por camarim quando possível
+ResultadoConsulta<Pedido> GerenciadorPedidos::consultar(const Consulta& consulta) const {
+    consulta.validar<Pedido>();  // Lança ValidacaoException se algum campo não existe
+    
+    vector<size_t> candidatos;  // Posições sugeridas pelo índice
+    int valor;
+    if (consulta.igualdadeInteira(Campo::ID, valor)) {
+        size_t posicao = pedidos.posicaoDe(valor);
+        if (posicao != pedidos.NAO_ENCONTRADO) {
+            candidatos.push_back(posicao);
+        }
+        return consulta.executar(pedidos.todos(), &candidatos, "índice hash por ID");
+    }
+    if (consulta.igualdadeInteira(Campo::CAMARIM, valor)) {
+        candidatos = pedidos.posicoesDe(pedidos.indice<PorCamarim>().buscar(valor));
+        return consulta.executar(pedidos.todos(), &candidatos, "índice por camarim");
+    }
+    // Sem índice aplicável: varre o vetor aplicando uma condição por vez
+    return consulta.executar(pedidos.todos(), nullptr, "varredura vetorizada");
+}
+
+// Localiza pedido ou lança PedidoException (usado pelas alterações abaixo)
+static Pedido* exigirPedido(GerenciadorPedidos& gerenciador, int pedidoId) {
+    Pedido* pedido = gerenciador.buscarPorId(pedidoId);
+    if (pedido == nullptr) {
+        throw PedidoException("Pedido com ID " + to_string(pedidoId) + " não encontrado");
+    }
+    return pedido;
+}
+
+/**
+ * Carimba a alteração de um pedido (o repositório move-o no índice por atualização)
+ */
+void GerenciadorPedidos::registrarAtualizacao(Pedido& pedido) {
+    pedidos.alterar(pedido, [](Pedido& p) { p.setAtualizadoEm(Relogio::agora()); });
+}
+
+/**
+ * Adiciona item ao pedido avisando os observadores
+ */
+void GerenciadorPedidos::adicionarItem(int pedidoId, int itemId, const string& nomeItem, int quantidade) {
+    Pedido* pedido = exigirPedido(*this, pedidoId);
+    Pedido antes;
+    bool avisar = temObservadores();
+    if (avisar) {
+        antes = *pedido;  // Cópia só quando alguém vai ser avisado
+    }
+    
+    pedido->adicionarItem(itemId, nomeItem, quantidade);  // Se lançar, nada mudou
+    registrarAtualizacao(*pedido);
+    if (avisar) {
+        notificar([&](ObservadorMutacoes* o) {
+            o->aoMudarPedido(&antes, pedido);
+            o->aoAdicionarItemPedido(*pedido, itemId, nomeItem, quantidade);
+        });
+    }
+}
+
+/**
+ * Remove item do pedido avisando os observadores
+ */
+bool GerenciadorPedidos::removerItem(int pedidoId, int itemId) {
+    Pedido* pedido = exigirPedido(*this, pedidoId);
+    Pedido antes;
+    bool avisar = temObservadores();
+    if (avisar) {
+        antes = *pedido;
+    }
+    
+    if (!pedido->removerItem(itemId)) {
+        return false;  // Item não estava no pedido: nada mudou
+    }
+    registrarAtualizacao(*pedido);
+    if (avisar) {
+        notificar([&](ObservadorMutacoes* o) { o->aoMudarPedido(&antes, pedido); });
+    }
+    return true;
+}
+
+/**
+ * Marca pedido como atendido avisando os observadores
+ */
+void GerenciadorPedidos::marcarAtendido(int pedidoId) {
+    Pedido* pedido = exigirPedido(*this, pedidoId);
+    Pedido antes;
+    bool avisar = temObservadores();
+    if (avisar) {
+        antes = *pedido;
+    }
+    
+    pedidos.alterar(*pedido, [](Pedido& p) { p.marcarAtendido(); });  // Sai dos pendentes
+    registrarAtualizacao(*pedido);
+    if (avisar) {
+        notificar([&](ObservadorMutacoes* o) { o->aoMudarPedido(&antes, pedido); });
+    }
+}
+
+/**
+ * Restaura um pedido (desfazer/refazer): substitui ou recria com o mesmo ID
+ */
+void GerenciadorPedidos::restaurar(const Pedido& estado) {
+    Pedido* pedido = pedidos.buscar(estado.getId());
+    if (pedido != nullptr) {
+        Pedido antes = *pedido;
+        pedidos.alterar(*pedido, [&](Pedido& p) { p = estado; });
+        registrarAtualizacao(*pedido);  // Restaurar também é uma alteração (novo carimbo)
+        notificar([&](ObservadorMutacoes* o) { o->aoMudarPedido(&antes, pedido); });
+        return;
+    }
+    
+    // Pedido removido: volta para a posição do seu ID (IDs menores = criados antes,
+    // então o vector continua em ordem de criadoEm)
+    Pedido& recriado = pedidos.inserir(estado);
+    registrarAtualizacao(recriado);
+    
+    notificar([&](ObservadorMutacoes* o) { o->aoMudarPedido(nullptr, &recriado); });
+}
+
+/**
+ * Pedidos criados no período [inicio, fim]
+ */
+vector<Pedido> GerenciadorPedidos::buscarCriadosEntre(long long inicio, long long fim) const {
+    // O vector está em ordem de criação, logo em ordem crescente de criadoEm
+    return registrosEntre(pedidos.todos(), inicio, fim, [](const Pedido& p) { return p.getCriadoEm(); });
+}
+
+/**
+ * Pedidos alterados pela última vez no período [inicio, fim]
+ */
+vector<Pedido> GerenciadorPedidos::buscarAtualizadosEntre(long long inicio, long long fim) const {
+    // Índice ordenado por (atualizadoEm, id): percorre apenas a faixa pedida
+    return pedidos.registrosDe(pedidos.indice<PorAtualizacao>().buscarEntre(inicio, fim));
 }
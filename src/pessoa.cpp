@@ -27,7 +27,7 @@ int Pessoa::getId() const {
     return id; // Retorna o valor do atributo id
 }
 
-string Pessoa::getNome() const {
+const string& Pessoa::getNome() const {
     return nome; // Retorna o valor do atributo nome
 }
 
@@ -0,0 +1,149 @@
+/**
+ * @file reconciliacao.cpp
+ * @brief Implementação da ReconciliacaoCamarins (fechamento de camarins em lote)
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ */
+
+// Inclui o header com as declarações
+#include "reconciliacao.h"
+
+// ==================== Struct ResultadoReconciliacao ====================
+
+int ResultadoReconciliacao::totalDevolvido() const {
+    int total = 0;
+    for (const auto& linha : linhas) {
+        total += linha.devolvido;
+    }
+    return total;
+}
+
+int ResultadoReconciliacao::totalConsumido() const {
+    int total = 0;
+    for (const auto& linha : linhas) {
+        total += linha.consumido;
+    }
+    return total;
+}
+
+// ==================== Cálculo ====================
+
+/**
+ * Reconcilia um camarim: valida a contagem e gera uma linha por item do camarim
+ *
+ * Contagem e itens estão ordenados por itemId: um merge, sem buscas.
+ */
+static void reconciliarCamarim(const Camarim& camarim, const map<int, int>& contagem,
+                               vector<LinhaReconciliacao>& linhas) {
+    const map<int, ItemCamarim>& itens = camarim.getItens();
+
+    // Valida antes de gerar qualquer linha
+    auto item = itens.begin();
+    for (const auto& contado : contagem) {
+        if (contado.second < 0) {
+            throw ValidacaoException("Quantidade não pode ser negativa");
+        }
+        while (item != itens.end() && item->first < contado.first) {
+            ++item;
+        }
+        if (item == itens.end() || item->first != contado.first) {
+            throw CamarimException("Item não encontrado no camarim");  // Mesma mensagem de Camarim::removerItem
+        }
+        if (contado.second > item->second.quantidade) {
+            throw ValidacaoException("Contagem maior que a quantidade no camarim");
+        }
+    }
+
+    auto contado = contagem.begin();
+    for (const auto& par : itens) {
+        while (contado != contagem.end() && contado->first < par.first) {
+            ++contado;
+        }
+        int sobrou = (contado != contagem.end() && contado->first == par.first) ? contado->second : 0;
+        linhas.push_back(LinhaReconciliacao{camarim.getId(), par.first, par.second.nomeItem,
+                                            par.second.quantidade, sobrou, par.second.quantidade - sobrou});
+    }
+}
+
+ResultadoReconciliacao ReconciliacaoCamarins::calcular(const GerenciadorCamarins& camarins,
+                                                       const map<int, map<int, int>>& contagens) {
+    ResultadoReconciliacao resultado;
+    for (const auto& par : contagens) {  // map: camarins em ordem de ID
+        const Camarim* camarim = camarins.buscarPorId(par.first);
+        if (camarim == nullptr) {
+            throw CamarimException("Camarim com ID " + to_string(par.first) + " não encontrado");
+        }
+        reconciliarCamarim(*camarim, par.second, resultado.linhas);
+    }
+    return resultado;
+}
+
+ResultadoReconciliacao ReconciliacaoCamarins::calcularTodos(const GerenciadorCamarins& camarins,
+                                                            const map<int, map<int, int>>& contagens) {
+    // Contagem de camarim inexistente é erro, como em calcular()
+    for (const auto& par : contagens) {
+        if (camarins.buscarPorId(par.first) == nullptr) {
+            throw CamarimException("Camarim com ID " + to_string(par.first) + " não encontrado");
+        }
+    }
+
+    ResultadoReconciliacao resultado;
+    const map<int, int> nadaSobrou;
+    for (const auto& camarim : camarins.listar()) {  // Em ordem de ID
+        auto contagem = contagens.find(camarim.getId());
+        reconciliarCamarim(camarim, contagem == contagens.end() ? nadaSobrou : contagem->second,
+                           resultado.linhas);
+    }
+    return resultado;
+}
+
+// ==================== Gravação ====================
+
+/**
+ * Valida tudo, depois um esvaziar por camarim e uma entrada de estoque por item
+ */
+void ReconciliacaoCamarins::aplicar(const ResultadoReconciliacao& resultado, GerenciadorCamarins& camarins,
+                                    Estoque& estoque) {
+    // ===== Agrupa: linhas por camarim e devoluções por item (ambos ordenados) =====
+    map<int, map<int, const LinhaReconciliacao*>> porCamarim;
+    map<int, int> devolucoes;
+    for (const auto& linha : resultado.linhas) {
+        if (linha.devolvido < 0 || linha.consumido < 0 || linha.devolvido + linha.consumido != linha.quantidade
+            || !porCamarim[linha.camarimId].emplace(linha.itemId, &linha).second) {
+            throw ValidacaoException("Linha de reconciliação inconsistente");
+        }
+        if (linha.devolvido > 0) {
+            devolucoes[linha.itemId] += linha.devolvido;
+        }
+    }
+
+    // ===== O camarim precisa estar exatamente como foi contado =====
+    map<int, string> nomes;  // Nome do item no camarim (usado se o item não está no estoque)
+    for (const auto& par : porCamarim) {
+        const Camarim* camarim = camarins.buscarPorId(par.first);
+        if (camarim == nullptr) {
+            throw CamarimException("Camarim com ID " + to_string(par.first) + " não encontrado");
+        }
+        const map<int, ItemCamarim>& itens = camarim->getItens();
+        bool igual = itens.size() == par.second.size();
+        auto linha = par.second.begin();
+        for (auto item = itens.begin(); igual && item != itens.end(); ++item, ++linha) {
+            igual = item->first == linha->first && item->second.quantidade == linha->second->quantidade;
+            if (igual && linha->second->devolvido > 0) {
+                nomes.emplace(item->first, item->second.nomeItem);
+            }
+        }
+        if (!igual) {
+            throw CamarimException("Camarim " + to_string(par.first) + " mudou desde a contagem");
+        }
+    }
+
+    // ===== Grava: nada abaixo pode falhar depois da validação =====
+    for (const auto& par : porCamarim) {
+        camarins.esvaziar(par.first);
+    }
+    for (const auto& par : devolucoes) {
+        estoque.adicionarItem(par.first, nomes.at(par.first), par.second);
+    }
+}
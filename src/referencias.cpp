@@ -0,0 +1,279 @@
+/**
+ * @file referencias.cpp
+ * @brief Implementação do IndiceReferencias (índice reverso item -> usos)
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ */
+
+// Inclui o header com as declarações
+#include "referencias.h"
+
+// ==================== Struct ReferenciasItem ====================
+
+size_t ReferenciasItem::total() const {
+    return camarins.size() + pedidos.size() + listas.size() + modelos.size() + niveis.size()
+           + (noEstoque ? 1 : 0);
+}
+
+/**
+ * Descrição curta das referências (usada na mensagem de bloqueio)
+ */
+string ReferenciasItem::descrever() const {
+    vector<string> partes;
+    if (!camarins.empty()) partes.push_back(to_string(camarins.size()) + " camarim(ns)");
+    if (!pedidos.empty()) partes.push_back(to_string(pedidos.size()) + " pedido(s)");
+    if (!listas.empty()) partes.push_back(to_string(listas.size()) + " lista(s) de compras");
+    if (!modelos.empty()) partes.push_back(to_string(modelos.size()) + " modelo(s) de rider");
+    if (!niveis.empty()) partes.push_back(to_string(niveis.size()) + " nível(is) de reposição");
+    if (noEstoque) partes.push_back("estoque");
+
+    if (partes.empty()) {
+        return "sem referências";
+    }
+    string descricao = partes[0];
+    for (size_t i = 1; i < partes.size(); i++) {
+        descricao += ", " + partes[i];
+    }
+    return descricao;
+}
+
+// ==================== Classe IndiceReferencias ====================
+
+IndiceReferencias::IndiceReferencias() {}
+
+/**
+ * Destrutor - sai da lista de observadores dos gerenciadores
+ */
+IndiceReferencias::~IndiceReferencias() {
+    desconectar();
+}
+
+/**
+ * Conecta aos gerenciadores e indexa tudo o que já existe
+ */
+void IndiceReferencias::conectar(GerenciadorItens& itens, GerenciadorCamarins& camarins,
+                                 GerenciadorPedidos& pedidos, GerenciadorListaCompras& listas,
+                                 Estoque& estoque) {
+    desconectar();
+    porItem.clear();
+
+    // Reaproveita os próprios avisos: cada entidade entra como "criada"
+    for (const Camarim& c : camarins.listar()) {
+        aoMudarCamarim(nullptr, &c);
+    }
+    for (const Pedido& p : pedidos.listar()) {
+        aoMudarPedido(nullptr, &p);
+    }
+    for (const ListaCompras& l : listas.listar()) {
+        aoMudarLista(nullptr, &l);
+    }
+    for (const ItemEstoque& item : estoque.listar()) {
+        aoMudarEstoque(MudancaEstoque{item.itemId, item.nomeItem, 0, item.quantidade,
+                                      0, estoque.obterMinimo(item.itemId), {}, estoque.listarLotes(item.itemId)});
+    }
+    for (const auto& par : estoque.listarMinimos()) {
+        // Mínimo de item que não está no estoque (quantidade 0)
+        aoMudarEstoque(MudancaEstoque{par.first, "", 0, estoque.obterQuantidade(par.first),
+                                      0, par.second, {}, estoque.listarLotes(par.first)});
+    }
+
+    // A partir daqui, cada mutação chega pelos avisos
+    this->itens = &itens;
+    this->camarins = &camarins;
+    this->pedidos = &pedidos;
+    this->listas = &listas;
+    this->estoque = &estoque;
+    camarins.adicionarObservador(this);
+    pedidos.adicionarObservador(this);
+    listas.adicionarObservador(this);
+    estoque.adicionarObservador(this);
+}
+
+void IndiceReferencias::acompanharModulos(GerenciadorModelos& modelos, ReposicaoCamarins& reposicao) {
+    this->modelos = &modelos;
+    this->reposicao = &reposicao;
+}
+
+/**
+ * Desconecta dos gerenciadores (sem efeito se não conectado)
+ */
+void IndiceReferencias::desconectar() {
+    if (camarins) camarins->removerObservador(this);
+    if (pedidos) pedidos->removerObservador(this);
+    if (listas) listas->removerObservador(this);
+    if (estoque) estoque->removerObservador(this);
+    itens = nullptr;
+    camarins = nullptr;
+    pedidos = nullptr;
+    listas = nullptr;
+    estoque = nullptr;
+}
+
+// ==================== Consultas ====================
+
+/**
+ * Onde o item é usado: cópia dos conjuntos, O(referências)
+ */
+ReferenciasItem IndiceReferencias::referenciasDe(int itemId) const {
+    ReferenciasItem resultado;
+    if (modelos) resultado.modelos = modelos->modelosComItem(itemId);
+    if (reposicao) resultado.niveis = reposicao->camarinsComNivel(itemId);
+    auto it = porItem.find(itemId);
+    if (it == porItem.end()) {
+        return resultado;  // Nenhuma entidade dos gerenciadores usa o item
+    }
+    const Referencias& r = it->second;
+    resultado.noEstoque = r.noEstoque;
+    resultado.camarins.assign(r.camarins.begin(), r.camarins.end());
+    resultado.pedidos.assign(r.pedidos.begin(), r.pedidos.end());
+    resultado.listas.assign(r.listas.begin(), r.listas.end());
+    return resultado;
+}
+
+bool IndiceReferencias::emUso(int itemId) const {
+    return porItem.count(itemId) > 0  // Entradas vazias são descartadas
+        || (modelos && !modelos->modelosComItem(itemId).empty())
+        || (reposicao && !reposicao->camarinsComNivel(itemId).empty());
+}
+
+size_t IndiceReferencias::totalItensReferenciados() const {
+    return porItem.size();
+}
+
+// ==================== Remoção segura ====================
+
+/**
+ * Remove o item do catálogo bloqueando ou cascateando as referências
+ */
+bool IndiceReferencias::removerItem(int itemId, ModoRemocao modo) {
+    if (itens == nullptr) {
+        throw ItemException("Índice de referências não está conectado");
+    }
+    if (itens->buscarPorId(itemId) == nullptr) {
+        return false;  // Mesmo contrato de GerenciadorItens::remover
+    }
+
+    // Cópia: cada passo da cascata avisa este índice, que altera os conjuntos
+    ReferenciasItem usos = referenciasDe(itemId);
+    if (usos.total() == 0) {
+        return itens->remover(itemId);
+    }
+    if (modo == ModoRemocao::BLOQUEAR) {
+        throw ItemException("Item " + to_string(itemId) + " em uso: " + usos.descrever());
+    }
+
+    // Confere tudo antes do primeiro passo: a cascata é tudo ou nada
+    int atendidos = 0;
+    for (int pedidoId : usos.pedidos) {
+        atendidos += pedidos->buscarPorId(pedidoId)->isAtendido() ? 1 : 0;
+    }
+    if (atendidos > 0) {
+        // Atendido: registro imutável do que foi entregue
+        throw ItemException("Item " + to_string(itemId) + " consta em " + to_string(atendidos)
+                            + " pedido(s) atendido(s): arquive-os antes de remover o item");
+    }
+
+    for (int camarimId : usos.camarins) {
+        const Camarim* camarim = camarins->buscarPorId(camarimId);
+        camarins->removerItem(camarimId, itemId, camarim->getItens().at(itemId).quantidade);
+    }
+    for (int pedidoId : usos.pedidos) {
+        pedidos->removerItem(pedidoId, itemId);
+    }
+    for (int listaId : usos.listas) {
+        listas->removerItem(listaId, itemId);
+    }
+    for (int modeloId : usos.modelos) {
+        modelos->removerItem(modeloId, itemId);
+    }
+    for (int camarimId : usos.niveis) {
+        reposicao->definirNivel(camarimId, itemId, "", 0);  // 0 = remove o nível
+    }
+    if (usos.noEstoque) {
+        estoque->restaurar(itemId, "", 0, 0);  // Zera quantidade e mínimo
+    }
+    itens->remover(itemId);
+
+    // Modelos e níveis não passam pelo histórico: a remoção do item deixa de ser reversível
+    if (!usos.modelos.empty()) {
+        itens->avisarDescarte(
+            DescarteDependentes{TipoEntidade::ITEM, itemId, "linhas de modelos de rider descartadas"});
+    }
+    if (!usos.niveis.empty()) {
+        itens->avisarDescarte(
+            DescarteDependentes{TipoEntidade::ITEM, itemId, "níveis de reposição do item descartados"});
+    }
+    return true;
+}
+
+// ==================== Avisos dos gerenciadores ====================
+
+/**
+ * Compara os itens de antes/depois (maps ordenados por itemId) em paralelo
+ */
+template <typename ItemMapa>
+void IndiceReferencias::atualizar(int entidadeId, const map<int, ItemMapa>* antes,
+                                  const map<int, ItemMapa>* depois, set<int> Referencias::*membro) {
+    static const map<int, ItemMapa> vazio;
+    const map<int, ItemMapa>& a = antes ? *antes : vazio;
+    const map<int, ItemMapa>& d = depois ? *depois : vazio;
+    if (&a == &d) {
+        return;  // Mesmo map (cópia na escrita): itens não mudaram, ex: pedido marcado atendido
+    }
+
+    auto i = a.begin();
+    auto j = d.begin();
+    while (i != a.end() || j != d.end()) {
+        if (j == d.end() || (i != a.end() && i->first < j->first)) {
+            // Item saiu da entidade
+            int itemId = (i++)->first;
+            (porItem[itemId].*membro).erase(entidadeId);
+            descartarSeVazia(itemId);
+        } else if (i == a.end() || j->first < i->first) {
+            // Item entrou na entidade
+            (porItem[(j++)->first].*membro).insert(entidadeId);
+        } else {
+            ++i;  // Continua na entidade (quantidade pode ter mudado)
+            ++j;
+        }
+    }
+}
+
+void IndiceReferencias::descartarSeVazia(int itemId) {
+    auto it = porItem.find(itemId);
+    if (it != porItem.end() && it->second.vazia()) {
+        porItem.erase(it);
+    }
+}
+
+void IndiceReferencias::aoMudarCamarim(const Camarim* antes, const Camarim* depois) {
+    int id = antes ? antes->getId() : depois->getId();
+    atualizar(id, antes ? &antes->getItens() : nullptr, depois ? &depois->getItens() : nullptr,
+              &Referencias::camarins);
+}
+
+void IndiceReferencias::aoMudarPedido(const Pedido* antes, const Pedido* depois) {
+    int id = antes ? antes->getId() : depois->getId();
+    atualizar(id, antes ? &antes->getItens() : nullptr, depois ? &depois->getItens() : nullptr,
+              &Referencias::pedidos);
+}
+
+void IndiceReferencias::aoMudarLista(const ListaCompras* antes, const ListaCompras* depois) {
+    int id = antes ? antes->getId() : depois->getId();
+    atualizar(id, antes ? &antes->getItens() : nullptr, depois ? &depois->getItens() : nullptr,
+              &Referencias::listas);
+}
+
+void IndiceReferencias::aoMudarEstoque(const MudancaEstoque& mudanca) {
+    bool usado = mudanca.quantidadeDepois > 0 || mudanca.minimoDepois > 0;
+    if (usado) {
+        porItem[mudanca.itemId].noEstoque = true;
+        return;
+    }
+    auto it = porItem.find(mudanca.itemId);
+    if (it != porItem.end()) {
+        it->second.noEstoque = false;
+        descartarSeVazia(mudanca.itemId);
+    }
+}
@@ -0,0 +1,100 @@
+/**
+ * @file relatorio.cpp
+ * @brief Implementação do relatório geral (partes renderizadas no escalonador)
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ */
+
+// Inclui o header com as declarações
+#include "relatorio.h"
+// Para min, max
+#include <algorithm>
+// Para vector
+#include <vector>
+
+// Seções do relatório, na ordem em que aparecem
+enum SecaoRelatorio { SECAO_CAMARINS, SECAO_PEDIDOS, SECAO_LISTAS, SECAO_ESTOQUE, TOTAL_SECOES };
+
+// Registros [inicio, fim) de uma seção: uma tarefa do escalonador
+struct ParteRelatorio {
+    SecaoRelatorio secao;
+    size_t inicio;
+    size_t fim;
+};
+
+// exibir() de cada registro da parte, seguido de linha em branco (como nas listagens do menu)
+template <typename T>
+static void renderizar(const vector<T>& registros, size_t inicio, size_t fim, string& saida) {
+    for (size_t i = inicio; i < fim; i++) {
+        saida += registros[i].exibir();
+        saida += '\n';
+    }
+}
+
+string gerarRelatorio(const GerenciadorCamarins& camarins, const GerenciadorPedidos& pedidos,
+                      const GerenciadorListaCompras& listas, const Estoque& estoque,
+                      Escalonador* escalonador, size_t porTarefa) {
+    const vector<Camarim>& todosCamarins = camarins.todos();
+    const vector<Pedido>& todosPedidos = pedidos.todos();
+    const vector<ListaCompras>& todasListas = listas.todos();
+    vector<ItemEstoque> linhasEstoque = estoque.listar();  // O estoque é um map: cópia em ordem de ID
+
+    // ========== DIVISÃO EM PARTES ==========
+    porTarefa = max<size_t>(1, porTarefa);
+    const size_t tamanhos[TOTAL_SECOES] = {todosCamarins.size(), todosPedidos.size(),
+                                           todasListas.size(), linhasEstoque.size()};
+    vector<ParteRelatorio> partes;
+    for (int s = 0; s < TOTAL_SECOES; s++) {
+        for (size_t inicio = 0; inicio < tamanhos[s]; inicio += porTarefa) {
+            partes.push_back(ParteRelatorio{static_cast<SecaoRelatorio>(s), inicio,
+                                            min(tamanhos[s], inicio + porTarefa)});
+        }
+    }
+
+    // ========== RENDERIZAÇÃO (cada parte no seu buffer) ==========
+    vector<string> buffers(partes.size());
+    auto renderizarParte = [&](size_t i) {
+        const ParteRelatorio& parte = partes[i];
+        switch (parte.secao) {
+            case SECAO_CAMARINS: renderizar(todosCamarins, parte.inicio, parte.fim, buffers[i]); break;
+            case SECAO_PEDIDOS: renderizar(todosPedidos, parte.inicio, parte.fim, buffers[i]); break;
+            case SECAO_LISTAS: renderizar(todasListas, parte.inicio, parte.fim, buffers[i]); break;
+            case SECAO_ESTOQUE:
+                for (size_t l = parte.inicio; l < parte.fim; l++) {
+                    buffers[i] += linhasEstoque[l].exibir();
+                }
+                break;
+            default: break;
+        }
+    };
+    if (escalonador != nullptr) {
+        escalonador->paraCada(0, partes.size(), renderizarParte);
+    } else {
+        for (size_t i = 0; i < partes.size(); i++) {
+            renderizarParte(i);
+        }
+    }
+
+    // ========== CONCATENAÇÃO EM ORDEM ==========
+    size_t total = 0;
+    for (const string& buffer : buffers) {
+        total += buffer.size();
+    }
+    string saida;
+    saida.reserve(total + 256);
+    saida += "=== RELATÓRIO GERAL ===\n";
+    static const char* const TITULOS[TOTAL_SECOES] = {"Camarins", "Pedidos", "Listas de Compras", "Estoque"};
+    size_t proxima = 0;
+    for (int s = 0; s < TOTAL_SECOES; s++) {
+        saida += "\n--- " + string(TITULOS[s]) + " (" + to_string(tamanhos[s]) + ") ---\n";
+        if (s == SECAO_ESTOQUE) {
+            saida += linhasEstoque.empty() ? estoque.exibir() : Estoque::cabecalhoExibicao();
+        }
+        for (; proxima < partes.size() && partes[proxima].secao == s; proxima++) {
+            saida += buffers[proxima];
+            string().swap(buffers[proxima]);  // Libera a parte já copiada
+        }
+    }
+    return saida;
+}
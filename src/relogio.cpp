@@ -0,0 +1,80 @@
+/**
+ * @file relogio.cpp
+ * @brief Implementação do Relogio monotônico
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ */
+
+// Inclui o header com as declarações
+#include "relogio.h"
+// Exceções (horário inválido)
+#include "excecoes.h"
+// Relógios do sistema
+#include <chrono>
+// Para localtime e mktime
+#include <ctime>
+// Para formatação
+#include <sstream>
+#include <iomanip>
+
+// Estado do relógio (compartilhado por todo o programa)
+static long long ultimo = 0;             // Último carimbo devolvido
+static bool simulado = false;            // true = devolve 'instanteSimulado'
+static long long instanteSimulado = 0;
+
+/**
+ * Instante atual (monotônico)
+ */
+long long Relogio::agora() {
+    if (simulado) {
+        return ultimo = max(ultimo, instanteSimulado);
+    }
+
+    // Âncora: hora do sistema no primeiro uso; depois só o relógio estável avança
+    using namespace chrono;
+    static const long long base = duration_cast<microseconds>(system_clock::now().time_since_epoch()).count();
+    static const steady_clock::time_point inicio = steady_clock::now();
+
+    long long t = base + duration_cast<microseconds>(steady_clock::now() - inicio).count();
+    if (t <= ultimo) {
+        t = ultimo + 1;  // Estritamente crescente: duas chamadas no mesmo microssegundo
+    }
+    return ultimo = t;
+}
+
+void Relogio::simular(long long micros) {
+    simulado = true;
+    instanteSimulado = max(micros, ultimo);  // Nunca volta no tempo
+}
+
+void Relogio::usarRelogioReal() {
+    simulado = false;
+}
+
+/**
+ * Horário local de hoje em microssegundos
+ */
+long long Relogio::horarioDeHoje(int hora, int minuto) {
+    if (hora < 0 || hora > 23 || minuto < 0 || minuto > 59) {
+        throw ValidacaoException("Horário inválido");
+    }
+    time_t segundos = static_cast<time_t>(agora() / 1000000);
+    tm local = *localtime(&segundos);
+    local.tm_hour = hora;
+    local.tm_min = minuto;
+    local.tm_sec = 0;
+    local.tm_isdst = -1;  // Deixa mktime decidir o horário de verão
+    return static_cast<long long>(mktime(&local)) * 1000000;
+}
+
+/**
+ * Formata o instante no horário local
+ */
+string Relogio::formatar(long long micros) {
+    time_t segundos = static_cast<time_t>(micros / 1000000);
+    tm local = *localtime(&segundos);
+    stringstream ss;
+    ss << put_time(&local, "%d/%m/%Y %H:%M:%S");
+    return ss.str();
+}
@@ -0,0 +1,214 @@
+/**
+ * @file reposicao.cpp
+ * @brief Implementação da ReposicaoCamarins (níveis por camarim e plano em lote)
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ */
+
+// Inclui o header com as declarações
+#include "reposicao.h"
+// Para min
+#include <algorithm>
+// Para o estoque restante por item durante o planejamento
+#include <unordered_map>
+
+// ==================== Struct PlanoReposicao ====================
+
+int PlanoReposicao::totalUnidades() const {
+    int total = 0;
+    for (const auto& t : transferencias) {
+        total += t.quantidade;
+    }
+    return total;
+}
+
+// ==================== Classe ReposicaoCamarins ====================
+
+ReposicaoCamarins::ReposicaoCamarins() {}
+
+/**
+ * Destrutor - sai da lista de observadores dos camarins
+ */
+ReposicaoCamarins::~ReposicaoCamarins() {
+    desconectar();
+}
+
+void ReposicaoCamarins::conectar(GerenciadorCamarins& camarins, Estoque& estoque) {
+    desconectar();
+    niveis.clear();
+    camarinsPorItem.limpar();
+    this->camarins = &camarins;
+    this->estoque = &estoque;
+    camarins.adicionarObservador(this);  // O estoque só é lido: não precisa de avisos
+}
+
+void ReposicaoCamarins::desconectar() {
+    if (camarins) camarins->removerObservador(this);
+    camarins = nullptr;
+    estoque = nullptr;
+}
+
+void ReposicaoCamarins::exigirConexao() const {
+    if (camarins == nullptr) {
+        throw CamarimException("Reposição não está conectada");
+    }
+}
+
+// ==================== Níveis ====================
+
+void ReposicaoCamarins::definirNivel(int camarimId, int itemId, const string& nomeItem, int quantidade) {
+    exigirConexao();
+    if (camarins->buscarPorId(camarimId) == nullptr) {
+        throw CamarimException("Camarim com ID " + to_string(camarimId) + " não encontrado");
+    }
+    if (itemId < 0) {
+        throw ValidacaoException("ID do item inválido");
+    }
+    if (quantidade < 0) {
+        throw ValidacaoException("Quantidade não pode ser negativa");
+    }
+
+    if (quantidade == 0) {
+        // Remove o nível (e o camarim da reposição, se era o último)
+        auto sala = niveis.find(camarimId);
+        if (sala != niveis.end() && sala->second.erase(itemId) > 0) {
+            camarinsPorItem.remover(itemId, camarimId);
+            if (sala->second.empty()) {
+                niveis.erase(sala);
+            }
+        }
+        return;
+    }
+    if (nomeItem.empty()) {
+        throw ValidacaoException("Nome do item não pode ser vazio");
+    }
+    map<int, ItemCamarim>& sala = niveis[camarimId];
+    if (sala.count(itemId) == 0) {
+        camarinsPorItem.inserir(itemId, camarimId);
+    }
+    sala[itemId] = ItemCamarim(itemId, nomeItem, quantidade);
+}
+
+vector<ItemCamarim> ReposicaoCamarins::niveisDe(int camarimId) const {
+    vector<ItemCamarim> resultado;
+    auto sala = niveis.find(camarimId);
+    if (sala != niveis.end()) {
+        for (const auto& par : sala->second) {
+            resultado.push_back(par.second);
+        }
+    }
+    return resultado;
+}
+
+const vector<int>& ReposicaoCamarins::camarinsComNivel(int itemId) const {
+    return camarinsPorItem.buscar(itemId);
+}
+
+// ==================== Plano ====================
+
+/**
+ * Um merge ordenado por camarim: níveis x itens atuais (ambos por itemId)
+ */
+PlanoReposicao ReposicaoCamarins::planejar() const {
+    exigirConexao();
+    PlanoReposicao plano;
+    unordered_map<int, int> restante;  // itemId -> estoque ainda não prometido
+
+    for (const auto& sala : niveis) {  // map: camarins em ordem de ID
+        const map<int, ItemCamarim>& atuais = camarins->buscarPorId(sala.first)->getItens();
+        auto atual = atuais.begin();
+
+        for (const auto& par : sala.second) {
+            const ItemCamarim& nivel = par.second;
+            while (atual != atuais.end() && atual->first < nivel.itemId) {
+                ++atual;  // Item sem nível: não entra na reposição
+            }
+            int tem = (atual != atuais.end() && atual->first == nivel.itemId) ? atual->second.quantidade : 0;
+            int falta = nivel.quantidade - tem;
+            if (falta <= 0) {
+                continue;  // Já está no nível (ou acima)
+            }
+
+            auto disponivel = restante.find(nivel.itemId);
+            if (disponivel == restante.end()) {
+                disponivel = restante.emplace(nivel.itemId, estoque->obterQuantidade(nivel.itemId)).first;
+            }
+            int enviar = min(falta, disponivel->second);
+            disponivel->second -= enviar;
+
+            if (enviar > 0) {
+                plano.transferencias.push_back(TransferenciaReposicao{sala.first, nivel.itemId, nivel.nomeItem, enviar});
+            }
+            if (enviar < falta) {
+                plano.faltas.push_back(TransferenciaReposicao{sala.first, nivel.itemId, nivel.nomeItem, falta - enviar});
+            }
+        }
+    }
+    return plano;
+}
+
+/**
+ * Valida tudo, depois uma saída por item e um abastecimento por camarim
+ */
+void ReposicaoCamarins::executar(const PlanoReposicao& plano) {
+    exigirConexao();
+
+    // ===== Agrupa: total por item e linhas por camarim (ambos ordenados) =====
+    map<int, int> porItem;
+    map<int, CopiaNaEscrita<map<int, ItemCamarim>>> porCamarim;
+    for (const auto& t : plano.transferencias) {
+        if (t.quantidade <= 0) {
+            throw ValidacaoException("Quantidade deve ser maior que zero");
+        }
+        if (camarins->buscarPorId(t.camarimId) == nullptr) {
+            throw CamarimException("Camarim com ID " + to_string(t.camarimId) + " não encontrado");
+        }
+        porItem[t.itemId] += t.quantidade;
+        map<int, ItemCamarim>& linhas = porCamarim[t.camarimId].escrever();
+        auto linha = linhas.find(t.itemId);
+        if (linha == linhas.end()) {
+            linhas[t.itemId] = ItemCamarim(t.itemId, t.nomeItem, t.quantidade);
+        } else {
+            linha->second.quantidade += t.quantidade;
+        }
+    }
+    for (const auto& par : porItem) {
+        int disponivel = estoque->obterQuantidade(par.first);
+        if (disponivel < par.second) {
+            // Mesma mensagem de Estoque::removerItem
+            throw EstoqueInsuficienteException("Quantidade insuficiente. Disponível: " + to_string(disponivel)
+                                               + ", Solicitado: " + to_string(par.second));
+        }
+    }
+
+    // ===== Grava: nada abaixo pode falhar depois da validação =====
+    for (const auto& par : porItem) {
+        estoque->removerItem(par.first, par.second);
+    }
+    for (const auto& par : porCamarim) {
+        camarins->abastecer(par.first, par.second);
+    }
+}
+
+PlanoReposicao ReposicaoCamarins::repor() {
+    PlanoReposicao plano = planejar();
+    executar(plano);
+    return plano;
+}
+
+// ==================== Aviso dos camarins ====================
+
+void ReposicaoCamarins::aoMudarCamarim(const Camarim* antes, const Camarim* depois) {
+    if (depois == nullptr) {
+        auto sala = niveis.find(antes->getId());
+        if (sala != niveis.end()) {  // Camarim removido: níveis deixam de valer
+            for (const auto& par : sala->second) {
+                camarinsPorItem.remover(par.first, sala->first);
+            }
+            niveis.erase(sala);
+            camarins->avisarDescarte(DescarteDependentes{TipoEntidade::CAMARIM, antes->getId(),
+                                                         "níveis de reposição do camarim descartados"});
+        }
+    }
+}
@@ -0,0 +1,168 @@
+/**
+ * @file visao.cpp
+ * @brief Implementação da visão consolidada de camarins
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ */
+
+// Inclui o header com as declarações
+#include "visao.h"
+// Exceções customizadas (CamarimException)
+#include "excecoes.h"
+// Para stringstream e formatação
+#include <sstream>
+#include <iomanip>
+
+// ==================== Montagem ====================
+
+/**
+ * Preenche artistas, pedidos e conteúdo de uma visão (camarim já copiado)
+ */
+static void preencherVisao(VisaoCamarim& visao,
+                           const GerenciadorArtistas& artistas,
+                           const GerenciadorPedidos& pedidos,
+                           const GerenciadorItens& itens) {
+    int camarimId = visao.camarim.getId();
+    
+    // Artistas do camarim: índice por camarim (sem varrer todos os artistas)
+    visao.artistas = artistas.buscarPorCamarim(camarimId);
+    
+    // Pedidos do camarim: índice por camarim, separados por status em uma passada
+    for (Pedido& pedido : pedidos.buscarPorCamarim(camarimId)) {
+        if (pedido.isAtendido()) {
+            visao.atendidos.push_back(move(pedido));
+        } else {
+            for (const auto& par : pedido.getItens()) {
+                visao.unidadesPendentes += par.second.quantidade;
+            }
+            visao.pendentes.push_back(move(pedido));
+        }
+    }
+    
+    // Conteúdo: cada item resolvido no catálogo pelo índice hash por ID
+    for (const auto& par : visao.camarim.getItens()) {
+        const ItemCamarim& itemCamarim = par.second;
+        const Item* item = itens.buscarPorId(itemCamarim.itemId);
+        
+        ConteudoCamarim linha;
+        linha.itemId = itemCamarim.itemId;
+        linha.nomeItem = item ? item->getNome() : itemCamarim.nomeItem;
+        linha.quantidade = itemCamarim.quantidade;
+        linha.precoUnitario = item ? item->getPreco() : 0.0;
+        linha.subtotal = linha.quantidade * linha.precoUnitario;
+        linha.noCatalogo = item != nullptr;
+        
+        visao.unidades += linha.quantidade;
+        visao.valorConteudo += linha.subtotal;
+        visao.conteudo.push_back(linha);
+    }
+}
+
+/**
+ * Visão de um camarim
+ */
+VisaoCamarim montarVisaoCamarim(int camarimId,
+                                const GerenciadorCamarins& camarins,
+                                const GerenciadorArtistas& artistas,
+                                const GerenciadorPedidos& pedidos,
+                                const GerenciadorItens& itens) {
+    const Camarim* camarim = camarins.buscarPorId(camarimId);
+    if (camarim == nullptr) {
+        throw CamarimException("Camarim com ID " + to_string(camarimId) + " não encontrado");
+    }
+    
+    VisaoCamarim visao;
+    visao.camarim = *camarim;
+    preencherVisao(visao, artistas, pedidos, itens);
+    return visao;
+}
+
+/**
+ * Visão de todos os camarins
+ */
+vector<VisaoCamarim> montarQuadroBastidores(const GerenciadorCamarins& camarins,
+                                            const GerenciadorArtistas& artistas,
+                                            const GerenciadorPedidos& pedidos,
+                                            const GerenciadorItens& itens) {
+    vector<Camarim> todos = camarins.listar();
+    vector<VisaoCamarim> quadro(todos.size());  // Uma visão por camarim, já alocadas
+    
+    for (size_t i = 0; i < todos.size(); i++) {
+        quadro[i].camarim = move(todos[i]);
+        preencherVisao(quadro[i], artistas, pedidos, itens);
+    }
+    return quadro;
+}
+
+// ==================== Exibição ====================
+
+/**
+ * Exibe uma visão completa
+ */
+string VisaoCamarim::exibir() const {
+    stringstream ss;
+    ss << "=== VISÃO DO CAMARIM " << camarim.getId() << " - " << camarim.getNome() << " ===" << endl;
+    
+    ss << "\nArtistas (" << artistas.size() << "):" << endl;
+    if (artistas.empty()) {
+        ss << "  Nenhum artista alocado" << endl;
+    }
+    for (const auto& artista : artistas) {
+        ss << "  [" << artista.getId() << "] " << artista.getNome() << endl;
+    }
+    
+    ss << "\nPedidos pendentes (" << pendentes.size() << ", "
+       << unidadesPendentes << " unidades):" << endl;
+    for (const auto& pedido : pendentes) {
+        ss << "  Pedido #" << pedido.getId() << " - " << pedido.getNomeArtista()
+           << " (" << pedido.getItens().size() << " itens)" << endl;
+    }
+    ss << "Pedidos atendidos: " << atendidos.size() << endl;
+    
+    ss << "\nConteúdo:" << endl;
+    if (conteudo.empty()) {
+        ss << "  Nenhum item no camarim" << endl;
+    } else {
+        ss << left << setw(7) << "  ID" << setw(28) << "Nome" << setw(8) << "Qtd"
+           << setw(13) << "Preço" << "Subtotal" << endl;  // 13: "ç" ocupa 2 bytes
+        ss << "  " << string(60, '-') << endl;
+        for (const auto& linha : conteudo) {
+            ss << left << setw(7) << "  " + to_string(linha.itemId)
+               << setw(28) << (linha.noCatalogo ? linha.nomeItem : linha.nomeItem + " (*)")
+               << setw(8) << linha.quantidade
+               << fixed << setprecision(2) << "R$ " << setw(9) << linha.precoUnitario
+               << "R$ " << linha.subtotal << endl;
+        }
+        ss << "  Total: " << unidades << " unidades, R$ " << fixed << setprecision(2)
+           << valorConteudo << endl;
+    }
+    return ss.str();
+}
+
+/**
+ * Tabela resumida do quadro de bastidores
+ */
+string exibirQuadroBastidores(const vector<VisaoCamarim>& quadro) {
+    stringstream ss;
+    ss << "=== QUADRO DE BASTIDORES ===" << endl;
+    if (quadro.empty()) {
+        ss << "Nenhum camarim cadastrado" << endl;
+        return ss.str();
+    }
+    
+    ss << left << setw(5) << "ID" << setw(22) << "Camarim" << setw(10) << "Artistas"
+       << setw(11) << "Pendentes" << setw(11) << "Atendidos" << setw(9) << "Itens"
+       << "Valor" << endl;
+    ss << string(78, '-') << endl;
+    for (const auto& visao : quadro) {
+        ss << left << setw(5) << visao.camarim.getId()
+           << setw(22) << visao.camarim.getNome()
+           << setw(10) << visao.artistas.size()
+           << setw(11) << visao.pendentes.size()
+           << setw(11) << visao.atendidos.size()
+           << setw(9) << visao.unidades
+           << "R$ " << fixed << setprecision(2) << visao.valorConteudo << endl;
+    }
+    return ss.str();
+}
@@ -0,0 +1,2496 @@
+/**
+ * @file fuzz_gerenciadores.cpp
+ * @brief Harness diferencial: gerenciadores do sistema x implementação de referência
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ *
+ * Gera sequências aleatórias de operações (com parâmetros válidos e
+ * inválidos) e aplica CADA operação aos dois sistemas:
+ * - Sistema otimizado: classes reais de header/ e src/
+ * - Sistema de referência: versões lineares de referencia.h
+ *
+ * Após cada operação compara o resultado (valor de retorno, tipo e
+ * mensagem de exceção, saída de exibir()). A cada N operações compara
+ * também o estado completo (listar() de todos os gerenciadores).
+ * Qualquer divergência imprime a semente e a operação e termina com erro.
+ *
+ * Uso: make run-test ARGS="--semente S --rodadas R --operacoes N --intervalo-estado K"
+ */
+
+#include <iostream>   // Para cout, cerr
+#include <string>     // Para string
+#include <vector>     // Para vector
+#include <random>     // Para mt19937 (gerador pseudoaleatório)
+#include <chrono>     // Para medir tempo
+#include <sstream>    // Para stringstream
+#include <iomanip>    // Para setprecision
+#include <typeinfo>   // Para typeid (tipo dinâmico da exceção)
+#include <cmath>      // Para abs (tolerância do painel)
+#include <map>        // Para contagens exatas dos itens pedidos
+#include <algorithm>  // Para transform (grafias variantes)
+#include <cctype>     // Para toupper
+#include <set>        // Para os IDs já entregues pelo alocador
+#include <memory>     // Para unique_ptr (blocos de IDs encerrados em ordem sorteada)
+#include <stdexcept>  // Para runtime_error (tarefa do escalonador que falha)
+#include <limits>     // Para numeric_limits (índice de vencimentos inteiro)
+#include <thread>     // Para threads reais disputando o alocador de IDs
+#include <mutex>      // Para a trava de quem grava no gerenciador
+
+#include "artista.h"
+#include "item.h"
+#include "estoque.h"
+#include "camarim.h"
+#include "pedido.h"
+#include "listacompras.h"
+#include "excecoes.h"
+#include "painel.h"
+#include "relogio.h"
+#include "frequentes.h"
+#include "historico.h"
+#include "agenda.h"
+#include "alocacao.h"
+#include "modelo.h"
+#include "reposicao.h"
+#include "reconciliacao.h"
+#include "leitor.h"
+#include "esquema.h"
+#include "arquivo.h"
+#include "identificadores.h"
+#include "paralelo.h"
+#include "relatorio.h"
+#include "fornecedores.h"
+#include "visao.h"
+#include "referencia.h"
+
+using namespace std;
+
+// ==================== Sistemas comparados ====================
+
+/**
+ * @brief Agrupa os seis gerenciadores de um sistema
+ *
+ * TEMPLATE: o mesmo código de execução (executar) serve para o sistema
+ * real e para o de referência, pois ambos expõem a mesma interface.
+ */
+template <typename GI, typename GA, typename GC, typename GP, typename GL, typename E, typename H,
+          typename R, typename A, typename M, typename P, typename Q, typename LC, typename AR, typename F>
+struct Sistema {
+    using Reconciliacao = Q;  // Sem estado: só funções estáticas
+    using Leitor = LC;
+    using Arquivo = AR;
+
+    GI itens;
+    GA artistas;
+    GC camarins;
+    GP pedidos;
+    GL listas;
+    E estoque;
+    LC leitor{itens, estoque, 16};  // Lote pequeno: a gravação automática acontece nas rodadas
+    M modelos;
+    AR arquivo{4};  // Blocos pequenos: buscarPorId cruza vários pontos de partida
+    R referencias;    // Observadores declarados por último: destruídos antes dos gerenciadores
+    A agenda;
+    P reposicao;
+    F fornecedores;
+    H historico{32};
+
+    Sistema() {
+        referencias.conectar(itens, camarins, pedidos, listas, estoque);
+        referencias.acompanharModulos(modelos, reposicao);
+        agenda.conectar(artistas, camarins);
+        reposicao.conectar(camarins, estoque);
+        fornecedores.conectar(itens);
+        arquivo.conectar(itens);  // Nomes de item iguais aos do catálogo: só o bit
+        historico.conectar(itens, artistas, camarins, pedidos, listas, estoque);
+    }
+};
+
+using SistemaOtimizado = Sistema<GerenciadorItens, GerenciadorArtistas, GerenciadorCamarins,
+                                 GerenciadorPedidos, GerenciadorListaCompras, Estoque, Historico,
+                                 IndiceReferencias, AgendaCamarins, GerenciadorModelos,
+                                 ReposicaoCamarins, ReconciliacaoCamarins, LeitorCodigos,
+                                 ArquivoPedidos, TabelaFornecedores>;
+using SistemaReferencia = Sistema<referencia::GerenciadorItens, referencia::GerenciadorArtistas,
+                                  referencia::GerenciadorCamarins, referencia::GerenciadorPedidos,
+                                  referencia::GerenciadorListaCompras, referencia::Estoque,
+                                  referencia::Historico, referencia::IndiceReferencias,
+                                  referencia::AgendaCamarins, referencia::GerenciadorModelos,
+                                  referencia::ReposicaoCamarins, referencia::ReconciliacaoCamarins,
+                                  referencia::LeitorCodigos, referencia::ArquivoPedidos,
+                                  referencia::TabelaFornecedores>;
+
+// ==================== Operações ====================
+
+enum TipoOperacao {
+    ITEM_CADASTRAR, ITEM_BUSCAR_ID, ITEM_BUSCAR_NOME, ITEM_ATUALIZAR, ITEM_REMOVER,
+    ARTISTA_CADASTRAR, ARTISTA_BUSCAR_ID, ARTISTA_BUSCAR_CAMARIM, ARTISTA_ATUALIZAR, ARTISTA_REMOVER,
+    CAMARIM_CADASTRAR, CAMARIM_BUSCAR_ID, CAMARIM_BUSCAR_ARTISTA, CAMARIM_ATUALIZAR, CAMARIM_REMOVER,
+    CAMARIM_INSERIR_ITEM, CAMARIM_REMOVER_ITEM,
+    PEDIDO_CRIAR, PEDIDO_BUSCAR_ID, PEDIDO_BUSCAR_CAMARIM, PEDIDO_PENDENTES, PEDIDO_ADICIONAR_ITEM,
+    PEDIDO_REMOVER_ITEM, PEDIDO_ATENDER, PEDIDO_REMOVER,
+    LISTA_CRIAR, LISTA_ADICIONAR_ITEM, LISTA_REMOVER_ITEM, LISTA_ATUALIZAR_QTD, LISTA_TOTAL,
+    LISTA_LIMPAR, LISTA_REMOVER,
+    ESTOQUE_ADICIONAR, ESTOQUE_REMOVER, ESTOQUE_VERIFICAR, ESTOQUE_OBTER, ESTOQUE_ATUALIZAR,
+    ITEM_CONSULTAR, PEDIDO_CONSULTAR, ESTOQUE_CONSULTAR, ESTOQUE_DEFINIR_MINIMO,
+    PEDIDO_CRIADOS_ENTRE, PEDIDO_ATUALIZADOS_ENTRE, ESTOQUE_MOVIMENTOS_ENTRE, CAMARIM_ALTERACOES_ENTRE,
+    HISTORICO_DESFAZER, HISTORICO_REFAZER, HISTORICO_MARCAR, HISTORICO_DESFAZER_ATE,
+    ITEM_REFERENCIAS, ITEM_REMOVER_BLOQUEANDO, ITEM_REMOVER_CASCATA,
+    AGENDA_RESERVAR, AGENDA_CANCELAR, AGENDA_OCUPANTE, AGENDA_LIVRE, AGENDA_LIVRES,
+    AGENDA_DO_CAMARIM, AGENDA_DO_ARTISTA,
+    MODELO_CRIAR, MODELO_ADICIONAR_ITEM, MODELO_REMOVER_ITEM, MODELO_REMOVER,
+    MODELO_INSTANCIAR_PEDIDO, MODELO_INSTANCIAR_CAMARIM,
+    REPOSICAO_DEFINIR, REPOSICAO_NIVEIS, REPOSICAO_PLANEJAR, REPOSICAO_REPOR,
+    RECONCILIAR_CAMARIM, RECONCILIAR_CALCULAR_TODOS, RECONCILIAR_TODOS,
+    ITEM_DEFINIR_CODIGO, ITEM_BUSCAR_CODIGO, LEITOR_LER, LEITOR_FLUXO, LEITOR_DESCARREGAR,
+    ITEM_CONGELAR, ITEM_BUSCAR_NORMALIZADO, ARQUIVO_ARQUIVAR, ARQUIVO_CONSULTAR,
+    ESTOQUE_ADICIONAR_LOTE, ESTOQUE_LOTES_VENCENDO,
+    FORNECEDOR_CADASTRAR, FORNECEDOR_REMOVER, FORNECEDOR_DEFINIR_OFERTA, FORNECEDOR_REMOVER_OFERTA,
+    FORNECEDOR_COTAR, FORNECEDOR_GERAR_LISTA, FORNECEDOR_DIVIDIR, FORNECEDOR_DIVIDIR_EM_LISTAS,
+    VISAO_CAMARIM, VISAO_QUADRO,
+    TOTAL_OPERACOES  // Sentinela: quantidade de tipos de operação
+};
+
+static const char* NOMES_OPERACOES[TOTAL_OPERACOES] = {
+    "item.cadastrar", "item.buscarPorId", "item.buscarPorNome", "item.atualizar", "item.remover",
+    "artista.cadastrar", "artista.buscarPorId", "artista.buscarPorCamarim", "artista.atualizar",
+    "artista.remover",
+    "camarim.cadastrar", "camarim.buscarPorId", "camarim.buscarPorArtista", "camarim.atualizar",
+    "camarim.remover", "camarim.inserirItem", "camarim.removerItem",
+    "pedido.criar", "pedido.buscarPorId", "pedido.buscarPorCamarim", "pedido.listarPendentes",
+    "pedido.adicionarItem", "pedido.removerItem", "pedido.marcarAtendido", "pedido.remover",
+    "lista.criar", "lista.adicionarItem", "lista.removerItem", "lista.atualizarQuantidade",
+    "lista.calcularTotal", "lista.limpar", "lista.remover",
+    "estoque.adicionarItem", "estoque.removerItem", "estoque.verificarDisponibilidade",
+    "estoque.obterQuantidade", "estoque.atualizarQuantidade",
+    "item.consultar", "pedido.consultar", "estoque.consultar", "estoque.definirMinimo",
+    "pedido.buscarCriadosEntre", "pedido.buscarAtualizadosEntre", "estoque.movimentosEntre",
+    "camarim.alteracoesEntre",
+    "historico.desfazer", "historico.refazer", "historico.marcar", "historico.desfazerAte",
+    "referencias.referenciasDe", "referencias.removerItem[bloquear]", "referencias.removerItem[cascata]",
+    "agenda.reservar", "agenda.cancelar", "agenda.ocupante", "agenda.livre", "agenda.camarinsLivres",
+    "agenda.agendaDoCamarim", "agenda.agendaDoArtista",
+    "modelo.criar", "modelo.adicionarItem", "modelo.removerItem", "modelo.remover",
+    "modelo.instanciarPedido", "modelo.instanciarCamarim",
+    "reposicao.definirNivel", "reposicao.niveisDe", "reposicao.planejar", "reposicao.repor",
+    "reconciliacao.calcular+aplicar", "reconciliacao.calcularTodos", "reconciliacao.calcularTodos+aplicar",
+    "item.definirCodigoBarras", "item.buscarPorCodigo", "leitor.ler", "leitor.lerFluxo", "leitor.descarregar",
+    "item.congelar", "item.buscarPorNomeNormalizado", "arquivo.arquivar", "arquivo.consultar",
+    "estoque.adicionarLote", "estoque.lotesVencendo",
+    "fornecedores.cadastrarFornecedor", "fornecedores.removerFornecedor", "fornecedores.definirOferta",
+    "fornecedores.removerOferta", "fornecedores.cotar", "fornecedores.gerarListaCompras",
+    "fornecedores.dividir", "fornecedores.dividirEmListas",
+    "visao.montarVisaoCamarim", "visao.montarQuadroBastidores"
+};
+
+// Outra grafia do mesmo nome: 0 igual, 1 maiúsculas, 2 com espaços e pontuação, 3 outro nome
+string grafiaVariante(const string& nome, int variante) {
+    string resultado = nome;
+    switch (((variante % 4) + 4) % 4) {
+        case 1:
+            transform(resultado.begin(), resultado.end(), resultado.begin(),
+                      [](unsigned char c) { return static_cast<char>(toupper(c)); });
+            break;
+        case 2:
+            resultado = "  " + nome + ".";
+            break;
+        case 3:
+            resultado = nome + " Extra";
+            break;
+    }
+    return resultado;
+}
+
+// Entidades cujo maior ID conhecido é acompanhado pelo gerador
+enum Entidade { E_ITEM, E_ARTISTA, E_CAMARIM, E_PEDIDO, E_LISTA, E_RESERVA, E_MODELO, E_FORNECEDOR,
+                TOTAL_ENTIDADES };
+
+/**
+ * @struct Operacao
+ * @brief Uma operação com todos os parâmetros já sorteados
+ */
+struct Operacao {
+    TipoOperacao tipo;
+    int id;          // ID principal (entidade alvo)
+    int outro;       // ID secundário (item, camarim ou artista)
+    int quantidade;  // Quantidade (pode ser inválida de propósito)
+    double preco;    // Preço (pode ser negativo de propósito)
+    string texto;    // Nome/descrição (pode ser vazio de propósito)
+    long long instante;  // Relógio simulado durante a operação (µs)
+
+    string descrever() const {
+        stringstream ss;
+        ss << NOMES_OPERACOES[tipo] << "(id=" << id << ", outro=" << outro
+           << ", quantidade=" << quantidade << ", preco=" << preco
+           << ", texto=\"" << texto << "\", instante=" << instante << ")";
+        return ss.str();
+    }
+};
+
+/**
+ * @class GeradorOperacoes
+ * @brief Sorteia operações com IDs concentrados perto dos já existentes
+ */
+class GeradorOperacoes {
+private:
+    mt19937 rng;
+    int maiorId[TOTAL_ENTIDADES];  // Maior ID já devolvido por um cadastro
+    long long relogio;             // Instante simulado (avança 0 a 3 µs por operação)
+    long long ultimoMarcador = 0;  // Último marcador devolvido por historico.marcar()
+
+public:
+    GeradorOperacoes(unsigned semente, long long inicio) : rng(semente), relogio(inicio) {
+        for (int& id : maiorId) {
+            id = 0;
+        }
+    }
+
+    int inteiro(int min, int max) {
+        return uniform_int_distribution<int>(min, max)(rng);
+    }
+
+    // ID alvo: majoritariamente entre os recentes, às vezes inexistente ou negativo
+    int idDe(Entidade e) {
+        int escolha = inteiro(0, 19);
+        if (escolha == 0) {
+            return -1;
+        }
+        if (escolha == 1) {
+            return maiorId[e] + 1;
+        }
+        return inteiro(max(0, maiorId[e] - 24), maiorId[e]);
+    }
+
+    // Nome de um conjunto pequeno, para provocar nomes repetidos; "" ocasionalmente
+    string nome() {
+        static const char* nomes[] = {
+            "", "Agua", "Toalha", "Cerveja", "Fruta", "Suco", "Cafe",
+            "Cha", "Gelo", "Pao", "Queijo", "Vinho", "Guarana"
+        };
+        return nomes[inteiro(0, 12)];
+    }
+
+    void registrarCadastro(Entidade e, int id) {
+        maiorId[e] = max(maiorId[e], id);
+    }
+
+    void registrarMarcador(long long marcador) {
+        ultimoMarcador = marcador;
+    }
+
+    Operacao proxima() {
+        Operacao op;
+        op.tipo = static_cast<TipoOperacao>(inteiro(0, TOTAL_OPERACOES - 1));
+        op.quantidade = inteiro(-2, 15);
+        op.preco = inteiro(-100, 2000) / 100.0;
+        op.texto = nome();
+        relogio += inteiro(0, 3);  // 0 = mesmo instante da operação anterior (empates)
+        op.instante = relogio;
+
+        switch (op.tipo) {
+            case ITEM_CADASTRAR: case ITEM_BUSCAR_ID: case ITEM_BUSCAR_NOME:
+            case ITEM_ATUALIZAR: case ITEM_REMOVER: case ITEM_CONSULTAR:
+            case ITEM_REFERENCIAS: case ITEM_REMOVER_BLOQUEANDO: case ITEM_REMOVER_CASCATA:
+            case ITEM_CONGELAR: case ITEM_BUSCAR_NORMALIZADO:
+                op.id = idDe(E_ITEM);
+                op.outro = 0;
+                if ((op.tipo == ITEM_CADASTRAR || op.tipo == ITEM_ATUALIZAR) && inteiro(0, 5) == 0) {
+                    op.texto = grafiaVariante(op.texto, inteiro(1, 2));  // Mesmo nome normalizado
+                }
+                break;
+            case ARTISTA_CADASTRAR: case ARTISTA_BUSCAR_ID: case ARTISTA_BUSCAR_CAMARIM:
+            case ARTISTA_ATUALIZAR: case ARTISTA_REMOVER:
+                op.id = idDe(E_ARTISTA);
+                op.outro = idDe(E_CAMARIM);
+                break;
+            case CAMARIM_CADASTRAR: case CAMARIM_BUSCAR_ID: case CAMARIM_BUSCAR_ARTISTA:
+            case CAMARIM_ATUALIZAR: case CAMARIM_REMOVER:
+                op.id = idDe(E_CAMARIM);
+                op.outro = idDe(E_ARTISTA);
+                break;
+            case CAMARIM_INSERIR_ITEM: case CAMARIM_REMOVER_ITEM: case CAMARIM_ALTERACOES_ENTRE:
+                op.id = idDe(E_CAMARIM);
+                op.outro = idDe(E_ITEM);
+                break;
+            case VISAO_CAMARIM: case VISAO_QUADRO:
+                op.id = idDe(E_CAMARIM);
+                op.outro = 0;
+                break;
+            case PEDIDO_CRIAR: case PEDIDO_BUSCAR_CAMARIM:
+                op.id = idDe(E_CAMARIM);
+                op.outro = 0;
+                break;
+            case PEDIDO_BUSCAR_ID: case PEDIDO_PENDENTES: case PEDIDO_ADICIONAR_ITEM:
+            case PEDIDO_REMOVER_ITEM: case PEDIDO_ATENDER: case PEDIDO_REMOVER:
+            case PEDIDO_CONSULTAR: case PEDIDO_CRIADOS_ENTRE: case PEDIDO_ATUALIZADOS_ENTRE:
+            case ARQUIVO_ARQUIVAR: case ARQUIVO_CONSULTAR:
+                op.id = idDe(E_PEDIDO);
+                op.outro = idDe(E_ITEM);
+                break;
+            case LISTA_CRIAR: case LISTA_ADICIONAR_ITEM: case LISTA_REMOVER_ITEM:
+            case LISTA_ATUALIZAR_QTD: case LISTA_TOTAL: case LISTA_LIMPAR: case LISTA_REMOVER:
+                op.id = idDe(E_LISTA);
+                op.outro = idDe(E_ITEM);
+                break;
+            case AGENDA_RESERVAR: case AGENDA_OCUPANTE: case AGENDA_LIVRE: case AGENDA_LIVRES:
+            case AGENDA_DO_CAMARIM: case AGENDA_DO_ARTISTA:
+                op.id = idDe(E_CAMARIM);
+                op.outro = idDe(E_ARTISTA);
+                break;
+            case AGENDA_CANCELAR:
+                op.id = idDe(E_RESERVA);
+                op.outro = 0;
+                break;
+            case MODELO_CRIAR: case MODELO_ADICIONAR_ITEM: case MODELO_REMOVER_ITEM: case MODELO_REMOVER:
+                op.id = idDe(E_MODELO);
+                op.outro = idDe(E_ITEM);
+                break;
+            case MODELO_INSTANCIAR_PEDIDO: case MODELO_INSTANCIAR_CAMARIM:
+                op.id = idDe(E_MODELO);
+                op.outro = idDe(E_CAMARIM);
+                break;
+            case RECONCILIAR_TODOS:
+                if (inteiro(0, 3) != 0) {
+                    op.tipo = RECONCILIAR_CALCULAR_TODOS;  // Esvaziar tudo com frequência apagaria os camarins
+                }
+                op.id = idDe(E_CAMARIM);
+                op.outro = idDe(E_ITEM);
+                break;
+            case REPOSICAO_DEFINIR: case REPOSICAO_NIVEIS: case REPOSICAO_PLANEJAR: case REPOSICAO_REPOR:
+            case RECONCILIAR_CAMARIM: case RECONCILIAR_CALCULAR_TODOS:
+            case ITEM_DEFINIR_CODIGO: case ITEM_BUSCAR_CODIGO: case LEITOR_LER: case LEITOR_FLUXO:
+            case LEITOR_DESCARREGAR:
+                op.id = idDe(E_CAMARIM);
+                op.outro = idDe(E_ITEM);
+                break;
+            case HISTORICO_DESFAZER: case HISTORICO_REFAZER: case HISTORICO_MARCAR:
+            case HISTORICO_DESFAZER_ATE: {
+                // Marcador: o último devolvido, às vezes inválido (negativo ou futuro)
+                int escolha = inteiro(0, 9);
+                op.id = escolha == 0 ? -1 : escolha == 1 ? static_cast<int>(ultimoMarcador) + 1000
+                                                         : static_cast<int>(ultimoMarcador);
+                op.outro = 0;
+                break;
+            }
+            case ESTOQUE_ADICIONAR_LOTE: case ESTOQUE_LOTES_VENCENDO:
+                op.id = idDe(E_ITEM);
+                op.outro = inteiro(-1, 5);  // Validade (ver validadeDe): poucas, para juntar lotes e empatar
+                break;
+            case FORNECEDOR_CADASTRAR: case FORNECEDOR_REMOVER: case FORNECEDOR_DEFINIR_OFERTA:
+            case FORNECEDOR_REMOVER_OFERTA: case FORNECEDOR_COTAR:
+                if (op.tipo == FORNECEDOR_REMOVER && inteiro(0, 3) != 0) {
+                    op.tipo = FORNECEDOR_DEFINIR_OFERTA;  // Remover tanto quanto cadastra deixaria poucos fornecedores
+                }
+                op.id = idDe(E_FORNECEDOR);  // Ver sorteadoDe: quase sempre trocados por IDs existentes
+                op.outro = idDe(E_ITEM);
+                op.preco = inteiro(-1, 40) / 4.0;  // Quartos de real: custos exatos, empates de preço frequentes
+                break;
+            case FORNECEDOR_GERAR_LISTA: case FORNECEDOR_DIVIDIR: case FORNECEDOR_DIVIDIR_EM_LISTAS:
+                op.id = idDe(E_LISTA);
+                op.outro = 0;
+                break;
+            default:  // Operações de estoque: id = item
+                op.id = idDe(E_ITEM);
+                op.outro = 0;
+                break;
+        }
+        return op;
+    }
+};
+
+// ==================== Execução e renderização de resultados ====================
+
+// Converte resultados em texto comparável
+string texto(bool valor) { return valor ? "true" : "false"; }
+string texto(int valor) { return to_string(valor); }
+string texto(double valor) {
+    stringstream ss;
+    ss << setprecision(17) << valor;  // Precisão total: detecta diferenças de arredondamento
+    return ss.str();
+}
+
+template <typename T>
+string texto(const T* ponteiro) {
+    return ponteiro ? ponteiro->exibir() : "nullptr";
+}
+
+// Lotes: número, item, quantidade e validade (ordem importa: é a ordem de saída/vencimento)
+string texto(const vector<LoteEstoque>& lotes) {
+    string saida = "[" + to_string(lotes.size()) + "]";
+    for (const auto& l : lotes) {
+        saida += " #" + to_string(l.numero) + ":" + to_string(l.itemId) + "x" + to_string(l.quantidade) + "@"
+               + (l.validade == LoteEstoque::SEM_VALIDADE ? string("-") : to_string(l.validade));
+    }
+    return saida + "\n";
+}
+
+// Validade sorteada de um lote: outro = -1 sem validade; senão numa grade de 50 µs perto do
+// instante atual (operações próximas repetem a validade e juntam no mesmo lote)
+long long validadeDe(const Operacao& op) {
+    return op.outro < 0 ? LoteEstoque::SEM_VALIDADE : (op.instante / 50 + op.outro) * 50;
+}
+
+// Registros com carimbo de tempo: renderiza também os instantes
+string texto(const vector<MovimentoEstoque>& movimentos) {
+    string saida = "[" + to_string(movimentos.size()) + "]\n";
+    for (const auto& m : movimentos) {
+        saida += to_string(m.tempo) + " " + to_string(m.itemId) + " " + m.nomeItem + " "
+               + to_string(m.quantidadeAntes) + "->" + to_string(m.quantidadeDepois) + "\n";
+    }
+    return saida;
+}
+
+string texto(const vector<AlteracaoCamarim>& alteracoes) {
+    string saida = "[" + to_string(alteracoes.size()) + "]\n";
+    for (const auto& a : alteracoes) {
+        saida += to_string(a.tempo) + " camarim " + to_string(a.camarimId) + " " + a.descricao() + "\n";
+    }
+    return saida;
+}
+
+string instantes(const vector<Pedido>& pedidos) {
+    string saida = "[" + to_string(pedidos.size()) + "]\n";
+    for (const auto& p : pedidos) {
+        saida += to_string(p.getId()) + " criado " + to_string(p.getCriadoEm()) + " atualizado "
+               + to_string(p.getAtualizadoEm()) + "\n";
+    }
+    return saida;
+}
+
+string texto(const ReferenciasItem& r) {
+    string saida = string(r.noEstoque ? "estoque" : "-") + " camarins";
+    for (int id : r.camarins) saida += " " + to_string(id);
+    saida += " pedidos";
+    for (int id : r.pedidos) saida += " " + to_string(id);
+    saida += " listas";
+    for (int id : r.listas) saida += " " + to_string(id);
+    saida += " modelos";
+    for (int id : r.modelos) saida += " " + to_string(id);
+    saida += " niveis";
+    for (int id : r.niveis) saida += " " + to_string(id);
+    return saida;
+}
+
+string texto(const Reserva* r) {
+    if (!r) return "nullptr";
+    return to_string(r->id) + " camarim " + to_string(r->camarimId) + " artista " + to_string(r->artistaId)
+         + " [" + to_string(r->inicio) + ", " + to_string(r->fim) + ")";
+}
+
+string texto(const vector<Reserva>& reservas) {
+    string saida = "[" + to_string(reservas.size()) + "]\n";
+    for (const auto& r : reservas) saida += texto(&r) + "\n";
+    return saida;
+}
+
+// Modelos (real e referência têm classes diferentes): renderiza as linhas
+template <typename M>
+string textoModelo(const M* m) {
+    if (!m) return "nullptr";
+    string saida = to_string(m->getId()) + " " + m->getNome() + ":";
+    for (const auto& par : m->getItens()) {
+        saida += " " + to_string(par.first) + "/" + par.second.nomeItem + "x" + to_string(par.second.quantidade);
+    }
+    return saida;
+}
+
+template <typename M>
+string textoModelos(const vector<M>& modelos) {
+    string saida = "[" + to_string(modelos.size()) + "]\n";
+    for (const auto& m : modelos) saida += textoModelo(&m) + "\n";
+    return saida;
+}
+
+// Plano de reposição: transferências e faltas na ordem gerada
+string texto(const PlanoReposicao& plano) {
+    string saida = "transferir " + to_string(plano.transferencias.size()) + " (" + to_string(plano.totalUnidades()) + ")\n";
+    for (const auto& t : plano.transferencias) {
+        saida += to_string(t.camarimId) + " <- " + to_string(t.itemId) + "/" + t.nomeItem + "x" + to_string(t.quantidade) + "\n";
+    }
+    saida += "faltas " + to_string(plano.faltas.size()) + "\n";
+    for (const auto& f : plano.faltas) {
+        saida += to_string(f.camarimId) + " <- " + to_string(f.itemId) + "/" + f.nomeItem + "x" + to_string(f.quantidade) + "\n";
+    }
+    return saida;
+}
+
+// Reconciliação: destino de cada linha
+string texto(const ResultadoReconciliacao& r) {
+    string saida = "devolvido " + to_string(r.totalDevolvido()) + " consumido " + to_string(r.totalConsumido()) + "\n";
+    for (const auto& l : r.linhas) {
+        saida += to_string(l.camarimId) + ": " + to_string(l.itemId) + "/" + l.nomeItem + " " + to_string(l.quantidade)
+               + " = " + to_string(l.devolvido) + " + " + to_string(l.consumido) + "\n";
+    }
+    return saida;
+}
+
+// Leitor: contadores e últimos rejeitados
+string texto(const ResumoLeitura& r) {
+    return "leituras " + to_string(r.leituras) + " aceitas " + to_string(r.aceitas) + " rejeitadas "
+         + to_string(r.rejeitadas) + " lotes " + to_string(r.lotes) + " entradas " + to_string(r.entradas)
+         + " unidades " + to_string(r.unidades) + "\n";
+}
+
+// Fornecedores: ofertas na ordem de preço por unidade, cotações e divisões
+string texto(const vector<Fornecedor>& fornecedores) {
+    string saida = "[" + to_string(fornecedores.size()) + "]";
+    for (const auto& f : fornecedores) saida += " " + to_string(f.id) + "/" + f.nome;
+    return saida + "\n";
+}
+
+string texto(const vector<OfertaFornecedor>& ofertas) {
+    string saida = "[" + to_string(ofertas.size()) + "]";
+    for (const auto& o : ofertas) {
+        saida += " " + to_string(o.fornecedorId) + ":" + to_string(o.itemId) + "=" + texto(o.precoEmbalagem) + "/"
+               + to_string(o.unidadesEmbalagem);
+    }
+    return saida + "\n";
+}
+
+string texto(const CotacaoCompra& c) {
+    return "fornecedor " + to_string(c.fornecedorId) + " item " + to_string(c.itemId) + " x" + to_string(c.quantidade)
+         + " = " + to_string(c.embalagens) + " emb. " + to_string(c.unidades) + " un. a " + texto(c.precoUnitario)
+         + " custo " + texto(c.custo) + "\n";
+}
+
+string texto(const vector<ItemCompra>& itens) {
+    string saida = "[" + to_string(itens.size()) + "]";
+    for (const auto& i : itens) {
+        saida += " " + to_string(i.itemId) + "/" + i.nomeItem + "x" + to_string(i.quantidade) + "@" + texto(i.preco);
+    }
+    return saida + "\n";
+}
+
+string texto(const DivisaoCompras& d) {
+    string saida = "total " + texto(d.total()) + "\n";
+    for (const auto& p : d.pedidos) {
+        saida += to_string(p.fornecedorId) + "/" + p.nomeFornecedor + " " + texto(p.total()) + " " + texto(p.itens);
+    }
+    return saida + "sem oferta " + texto(d.semOferta);
+}
+
+string texto(const vector<string>& textos) {
+    string saida = "[" + to_string(textos.size()) + "]";
+    for (const string& t : textos) saida += " '" + t + "'";
+    return saida + "\n";
+}
+
+// Níveis de um camarim (ItemCamarim não tem exibir())
+string texto(const vector<ItemCamarim>& niveis) {
+    string saida = "[" + to_string(niveis.size()) + "]";
+    for (const auto& n : niveis) saida += " " + to_string(n.itemId) + "/" + n.nomeItem + "x" + to_string(n.quantidade);
+    return saida;
+}
+
+string texto(const vector<int>& ids) {
+    string saida = "[" + to_string(ids.size()) + "]";
+    for (int id : ids) saida += " " + to_string(id);
+    return saida;
+}
+
+string texto(const ListasPorFornecedor& criadas) {
+    return texto(criadas.porFornecedor) + " sem oferta " + to_string(criadas.semOferta);
+}
+
+// ItemEstoque não tem exibir(): renderiza os campos diretamente
+// Resultados das análises do arquivo (chave=valor, em ordem de chave)
+template <typename V>
+string texto(const map<int, V>& contagens) {
+    string saida = "[" + to_string(contagens.size()) + "]";
+    for (const auto& par : contagens) {
+        saida += " " + to_string(par.first) + "=" + to_string(par.second);
+    }
+    return saida + "\n";
+}
+
+string texto(const vector<ItemEstoque>& elementos) {
+    string saida = "[" + to_string(elementos.size()) + "]\n";
+    for (const auto& e : elementos) {
+        saida += to_string(e.itemId) + " " + e.nomeItem + " " + to_string(e.quantidade) + "\n";
+    }
+    return saida;
+}
+
+template <typename T>
+string texto(const vector<T>& elementos) {
+    string saida = "[" + to_string(elementos.size()) + "]\n";
+    for (const auto& e : elementos) {
+        saida += e.exibir();
+        saida += "\n";
+    }
+    return saida;
+}
+
+// Visão de camarim: exibir() arredonda e só conta os atendidos; aqui vai tudo, em precisão total
+string texto(const VisaoCamarim& v) {
+    string saida = v.exibir() + texto(v.artistas) + texto(v.pendentes) + texto(v.atendidos);
+    for (const auto& c : v.conteudo) {
+        saida += to_string(c.itemId) + "/" + c.nomeItem + "x" + to_string(c.quantidade) + "@" + texto(c.precoUnitario)
+               + "=" + texto(c.subtotal) + (c.noCatalogo ? "" : " fora do catálogo") + "\n";
+    }
+    return saida + to_string(v.unidades) + " unidades, " + to_string(v.unidadesPendentes) + " pendentes, "
+           + texto(v.valorConteudo) + "\n";
+}
+
+string texto(const vector<VisaoCamarim>& quadro) {
+    string saida = exibirQuadroBastidores(quadro);
+    for (const auto& v : quadro) saida += texto(v);
+    return saida;
+}
+
+/**
+ * @brief Monta uma consulta a partir dos parâmetros sorteados da operação
+ *
+ * Os bits de 'variante' ligam condições, ordenação e limite, de modo que o
+ * planejador do sistema real exercite todos os caminhos (índices e varredura).
+ * O plano escolhido não é comparado: apenas os registros devolvidos.
+ */
+Consulta consultaDe(const Operacao& op) {
+    int variante = op.quantidade + 2;  // 0..17
+    string trecho = op.texto.size() > 3 ? op.texto.substr(1, 3) : op.texto;
+    // Às vezes um ID fracionário ou fora da faixa de int (não encontra nada, sem cast indefinido)
+    double idConsultado = variante == 5 ? op.id + 0.5 : variante == 11 ? 4e9 : variante == 17 ? -4e9 : op.id;
+    Consulta c;
+
+    switch (op.tipo) {
+        case ITEM_CONSULTAR:
+            if (variante & 1) c.onde(Campo::ID, Operador::IGUAL, idConsultado);
+            if (variante & 2) c.ondeTexto(Campo::NOME, Operador::CONTEM, trecho);
+            if (variante & 4) c.onde(Campo::PRECO, Operador::ENTRE, 0.0, op.preco);
+            if (variante % 5 == 4) c.ondeTexto(Campo::NOME, Operador::IGUAL, op.texto);
+            if (variante & 8) c.ordenarPor(Campo::PRECO, false).ordenarPor(Campo::NOME);
+            break;
+        case PEDIDO_CONSULTAR:
+            if (variante & 1) c.onde(Campo::ATENDIDO, Operador::IGUAL, 0);
+            if (variante & 2) c.onde(Campo::QUANTIDADE, Operador::MAIOR, variante);
+            if (variante & 4) c.ondeTexto(Campo::NOME, Operador::CONTEM, trecho);
+            if (variante % 5 == 4) c.onde(Campo::CAMARIM, Operador::MENOR_IGUAL, op.outro);
+            if (variante % 3 == 1) c.onde(Campo::CAMARIM, Operador::IGUAL, op.outro % 4);
+            if (variante % 7 == 3) c.onde(Campo::ID, Operador::IGUAL, idConsultado);
+            if (variante & 8) c.ordenarPor(Campo::QUANTIDADE, false);
+            break;
+        default:  // ESTOQUE_CONSULTAR
+            if (variante & 1) c.onde(Campo::ID, Operador::MAIOR_IGUAL, op.id - 10);
+            if (variante & 2) c.onde(Campo::ID, Operador::MENOR, op.id + 5.5);
+            if (variante & 4) c.onde(Campo::QUANTIDADE, Operador::MAIOR_IGUAL, variante);
+            if (variante % 5 == 4) c.onde(Campo::ID, Operador::ENTRE, op.id, op.id + op.preco);
+            if (variante & 8) c.ordenarPor(Campo::QUANTIDADE);
+            break;
+    }
+    if (variante & 16) c.limitar(variante % 3);  // Limite 0 (sem limite), 1 ou 2
+    return c;
+}
+
+// Intervalo da agenda sorteado: início em -20..150 e duração em -10..200, múltiplos de 10
+// (reservas encostadas são frequentes; duração <= 0 é inválida de propósito)
+long long inicioAgenda(const Operacao& op) { return op.quantidade * 10LL; }
+long long fimAgenda(const Operacao& op) { return inicioAgenda(op) + static_cast<long long>(op.preco) * 10; }
+
+// EAN-13 de um pequeno conjunto (colisões frequentes); 'errado' troca o dígito verificador
+string codigoSorteado(int n, bool errado) {
+    string codigo = "789000000" + string(n < 10 ? "00" : n < 100 ? "0" : "") + to_string(n);
+    int soma = 0;
+    for (size_t i = 0; i < codigo.size(); i++) {
+        soma += (codigo[i] - '0') * (i % 2 == 1 ? 3 : 1);
+    }
+    int verificador = (10 - soma % 10) % 10;
+    return codigo + to_string(errado ? (verificador + 1) % 10 : verificador);
+}
+
+// Um de poucos registros existentes (os 3 de maior ID), para que o mesmo item receba ofertas de
+// vários fornecedores e as listas recém-geradas sejam divididas; 1 em 8 mantém o ID sorteado
+// (inexistente, negativo...)
+template <typename T>
+int sorteadoDe(const vector<T>& existentes, int id, int (*idDoRegistro)(const T&)) {
+    if (existentes.empty() || id < 0 || id % 8 == 0) {
+        return id;
+    }
+    return idDoRegistro(existentes[existentes.size() - 1 - id % min<size_t>(3, existentes.size())]);
+}
+
+int idDoItem(const Item& item) { return item.getId(); }
+int idDoCamarim(const Camarim& camarim) { return camarim.getId(); }
+int idDoFornecedor(const Fornecedor& fornecedor) { return fornecedor.id; }
+int idDaLista(const ListaCompras& lista) { return lista.getId(); }
+
+// Itens do catálogo com quantidades derivadas da operação (iguais nos dois sistemas): as listas
+// sorteadas raramente têm itens com ofertas
+template <typename S>
+vector<ItemCompra> comprasDoCatalogo(S& s, const Operacao& op) {
+    vector<ItemCompra> compras;
+    for (const Item& item : s.itens.listar()) {
+        compras.push_back(ItemCompra(item.getId(), item.getNome(), (item.getId() + op.quantidade + 14) % 15 + 1, 1.0));
+    }
+    return compras;
+}
+
+// Contagem do que sobrou, derivada das linhas do camarim (iguais nos dois sistemas)
+template <typename S>
+map<int, int> contagemSorteada(S& s, int camarimId, const Operacao& op) {
+    map<int, int> contagem;
+    const auto* camarim = s.camarins.buscarPorId(camarimId);
+    if (camarim != nullptr) {
+        for (const auto& par : camarim->getItens()) {
+            int fracao = ((par.first + camarimId + op.quantidade) % 4 + 4) % 4;
+            if (fracao > 0) {  // 0 = não contado: tudo consumido
+                contagem[par.first] = par.second.quantidade * fracao / 3;
+            }
+        }
+    }
+    if (op.preco < 2.0) {
+        contagem[op.outro] = op.quantidade;  // Às vezes negativa, excessiva ou de item ausente
+    }
+    return contagem;
+}
+
+// Contagens do fechamento geral: alguns camarins ficam sem contagem
+template <typename S>
+map<int, map<int, int>> contagensSorteadas(S& s, const Operacao& op) {
+    map<int, map<int, int>> contagens;
+    for (const auto& c : s.camarins.listar()) {
+        if ((c.getId() + op.quantidade + 3) % 3 != 0) {
+            contagens[c.getId()] = contagemSorteada(s, c.getId(), op);
+        }
+    }
+    if (op.preco < 1.0) {
+        contagens[op.id] = contagemSorteada(s, op.id, op);  // Às vezes camarim inexistente
+    }
+    return contagens;
+}
+
+/**
+ * @brief Executa uma operação em um sistema e devolve o resultado como texto
+ *
+ * Exceções viram texto com tipo dinâmico + mensagem, para que ambos os
+ * sistemas precisem lançar EXATAMENTE a mesma exceção.
+ */
+template <typename S>
+string executar(S& s, const Operacao& op) {
+    try {
+        switch (op.tipo) {
+            case ITEM_CADASTRAR:
+                return texto(s.itens.cadastrar(op.texto, op.preco));
+            case ITEM_BUSCAR_ID:
+                return texto(s.itens.buscarPorId(op.id));
+            case ITEM_BUSCAR_NOME:
+                return texto(s.itens.buscarPorNome(op.texto));
+            case ITEM_ATUALIZAR:
+                return texto(s.itens.atualizar(op.id, op.texto, op.preco));
+            case ITEM_REMOVER:
+                return texto(s.itens.remover(op.id));
+
+            case ARTISTA_CADASTRAR:
+                return texto(s.artistas.cadastrar(op.texto, op.outro));
+            case ARTISTA_BUSCAR_ID:
+                return texto(s.artistas.buscarPorId(op.id));
+            case ARTISTA_BUSCAR_CAMARIM:
+                return texto(s.artistas.buscarPorCamarim(op.outro));
+            case ARTISTA_ATUALIZAR:
+                return texto(s.artistas.atualizar(op.id, op.texto, op.outro));
+            case ARTISTA_REMOVER:
+                return texto(s.artistas.remover(op.id));
+
+            case CAMARIM_CADASTRAR:
+                return texto(s.camarins.cadastrar(op.texto, op.outro));
+            case CAMARIM_BUSCAR_ID:
+                return texto(s.camarins.buscarPorId(op.id));
+            case CAMARIM_BUSCAR_ARTISTA:
+                return texto(s.camarins.buscarPorArtista(op.outro));
+            case CAMARIM_ATUALIZAR:
+                return texto(s.camarins.atualizar(op.id, op.texto, op.outro));
+            case CAMARIM_REMOVER:
+                return texto(s.camarins.remover(op.id));
+            // Alterações pelos gerenciadores (avisam os observadores, ex: painel)
+            case CAMARIM_INSERIR_ITEM:
+                s.camarins.inserirItem(op.id, op.outro, op.texto, op.quantidade);
+                return s.camarins.buscarPorId(op.id)->exibir();
+            case CAMARIM_REMOVER_ITEM:
+                return texto(s.camarins.removerItem(op.id, op.outro, op.quantidade));
+
+            case PEDIDO_CRIAR:
+                return texto(s.pedidos.criar(op.id, op.texto));
+            case PEDIDO_BUSCAR_ID:
+                return texto(s.pedidos.buscarPorId(op.id));
+            case PEDIDO_BUSCAR_CAMARIM:
+                return texto(s.pedidos.buscarPorCamarim(op.id));
+            case PEDIDO_PENDENTES:
+                return texto(s.pedidos.listarPendentes());
+            case PEDIDO_ADICIONAR_ITEM: {
+                // Quantidade ímpar: o nome do catálogo (o arquivo o resolve pelo ID)
+                const Item* doCatalogo = s.itens.buscarPorId(op.outro);
+                string nome = doCatalogo != nullptr && op.quantidade % 2 != 0 ? doCatalogo->getNome() : op.texto;
+                s.pedidos.adicionarItem(op.id, op.outro, nome, op.quantidade);
+                return s.pedidos.buscarPorId(op.id)->exibir();
+            }
+            case PEDIDO_REMOVER_ITEM:
+                return texto(s.pedidos.removerItem(op.id, op.outro));
+            case PEDIDO_ATENDER:
+                s.pedidos.marcarAtendido(op.id);
+                return s.pedidos.buscarPorId(op.id)->exibir();
+            case PEDIDO_REMOVER:
+                return texto(s.pedidos.remover(op.id));
+
+            case LISTA_CRIAR:
+                return texto(s.listas.criar(op.texto));
+            case LISTA_ADICIONAR_ITEM:
+                s.listas.adicionarItem(op.id, op.outro, op.texto, op.quantidade, op.preco);
+                return s.listas.buscarPorId(op.id)->exibir();
+            case LISTA_REMOVER_ITEM:
+                return texto(s.listas.removerItem(op.id, op.outro));
+            case LISTA_ATUALIZAR_QTD:
+                s.listas.atualizarQuantidade(op.id, op.outro, op.quantidade);
+                return s.listas.buscarPorId(op.id)->exibir();
+            case LISTA_TOTAL: {
+                ListaCompras* lista = s.listas.buscarPorId(op.id);
+                return lista ? texto(lista->calcularTotal()) : "lista inexistente";
+            }
+            case LISTA_LIMPAR:
+                s.listas.limpar(op.id);
+                return s.listas.buscarPorId(op.id)->exibir();
+            case LISTA_REMOVER:
+                return texto(s.listas.remover(op.id));
+
+            case ESTOQUE_ADICIONAR:
+                s.estoque.adicionarItem(op.id, op.texto, op.quantidade);
+                return texto(s.estoque.obterQuantidade(op.id));
+            case ESTOQUE_REMOVER:
+                return texto(s.estoque.removerItem(op.id, op.quantidade));
+            case ESTOQUE_VERIFICAR:
+                return texto(s.estoque.verificarDisponibilidade(op.id, op.quantidade));
+            case ESTOQUE_OBTER:
+                return texto(s.estoque.obterQuantidade(op.id));
+            case ESTOQUE_ATUALIZAR:
+                s.estoque.atualizarQuantidade(op.id, op.quantidade);
+                return texto(s.estoque.obterQuantidade(op.id));
+            case ESTOQUE_ADICIONAR_LOTE:
+                s.estoque.adicionarLote(op.id, op.texto, op.quantidade, validadeDe(op));
+                return texto(s.estoque.listarLotes(op.id));
+            case ESTOQUE_LOTES_VENCENDO: {  // Janela em torno de agora; quantidade -2 = janela invertida
+                long long inicio = op.instante + (op.outro - 2) * 50;
+                long long fim = op.quantidade == -2 ? inicio - 1 : inicio + (op.quantidade + 2) * 20;
+                return texto(s.estoque.lotesVencendo(inicio, fim));
+            }
+
+            case FORNECEDOR_CADASTRAR:
+                return texto(s.fornecedores.cadastrarFornecedor(op.texto));
+            case FORNECEDOR_REMOVER: case FORNECEDOR_DEFINIR_OFERTA: case FORNECEDOR_REMOVER_OFERTA:
+            case FORNECEDOR_COTAR: {
+                int fornecedorId = sorteadoDe(s.fornecedores.listarFornecedores(), op.id, idDoFornecedor);
+                int itemId = sorteadoDe(s.itens.listar(), op.outro, idDoItem);
+                switch (op.tipo) {
+                    case FORNECEDOR_REMOVER:
+                        return texto(s.fornecedores.removerFornecedor(fornecedorId))
+                             + texto(s.fornecedores.listarFornecedores());
+                    case FORNECEDOR_DEFINIR_OFERTA:
+                        s.fornecedores.definirOferta(fornecedorId, itemId, op.preco, op.quantidade);
+                        return texto(s.fornecedores.ofertasDe(itemId));
+                    case FORNECEDOR_REMOVER_OFERTA:
+                        return texto(s.fornecedores.removerOferta(fornecedorId, itemId))
+                             + texto(s.fornecedores.ofertasDe(itemId));
+                    default:
+                        if (op.preco < 1.0) {
+                            s.fornecedores.conectar(s.itens);  // Reconectar mantém fornecedores e ofertas
+                        }
+                        return texto(s.fornecedores.cotar(itemId, op.quantidade));
+                }
+            }
+            case FORNECEDOR_GERAR_LISTA:  // Faltas do plano de reposição atual
+                return texto(s.fornecedores.gerarListaCompras(s.listas, op.texto, s.reposicao.planejar().faltas));
+            case FORNECEDOR_DIVIDIR: {
+                if (op.preco < 5.0) {  // Lista avulsa com o catálogo (não gravada)
+                    ListaCompras avulsa(0, "Catalogo");
+                    for (const auto& c : comprasDoCatalogo(s, op)) {
+                        avulsa.adicionarItem(c.itemId, c.nomeItem, c.quantidade, c.preco);
+                    }
+                    return texto(s.fornecedores.dividir(avulsa));
+                }
+                const auto* lista = s.listas.buscarPorId(sorteadoDe(s.listas.listar(), op.id, idDaLista));
+                return lista ? texto(s.fornecedores.dividir(*lista)) : string("nullptr");
+            }
+            case FORNECEDOR_DIVIDIR_EM_LISTAS: {
+                int listaId = sorteadoDe(s.listas.listar(), op.id, idDaLista);
+                string saida;
+                if (op.preco < 5.0) {  // Grava antes uma lista com o catálogo e divide essa
+                    listaId = s.listas.criarComItens(op.texto, comprasDoCatalogo(s, op));
+                    saida = texto(listaId) + " ";
+                }
+                return saida + texto(s.fornecedores.dividirEmListas(s.listas, listaId));
+            }
+
+            // Sem qualificação: a referência é achada pela busca por argumento (namespace referencia)
+            case VISAO_CAMARIM:
+                return texto(montarVisaoCamarim(sorteadoDe(s.camarins.listar(), op.id, idDoCamarim),
+                                                s.camarins, s.artistas, s.pedidos, s.itens));
+            case VISAO_QUADRO:
+                return texto(montarQuadroBastidores(s.camarins, s.artistas, s.pedidos, s.itens));
+
+            case ITEM_CONSULTAR:
+                return texto(s.itens.consultar(consultaDe(op)).registros);
+            case PEDIDO_CONSULTAR:
+                return texto(s.pedidos.consultar(consultaDe(op)).registros);
+            case ESTOQUE_CONSULTAR:
+                return texto(s.estoque.consultar(consultaDe(op)).registros);
+            case ESTOQUE_DEFINIR_MINIMO:
+                s.estoque.definirMinimo(op.id, op.quantidade);
+                return texto(s.estoque.obterMinimo(op.id));
+
+            // Períodos terminando um pouco antes do instante atual; quantidade -2 = período invertido
+            case PEDIDO_CRIADOS_ENTRE: case PEDIDO_ATUALIZADOS_ENTRE:
+            case ESTOQUE_MOVIMENTOS_ENTRE: case CAMARIM_ALTERACOES_ENTRE: {
+                long long fim = op.instante - (op.outro < 0 ? 0 : op.outro % 7) * 5;
+                long long inicio = op.quantidade == -2 ? fim + 1 : fim - (op.quantidade + 2) * 8;
+                if (op.tipo == PEDIDO_CRIADOS_ENTRE) {
+                    return instantes(s.pedidos.buscarCriadosEntre(inicio, fim));
+                }
+                if (op.tipo == PEDIDO_ATUALIZADOS_ENTRE) {
+                    return instantes(s.pedidos.buscarAtualizadosEntre(inicio, fim));
+                }
+                if (op.tipo == ESTOQUE_MOVIMENTOS_ENTRE) {
+                    return texto(s.estoque.movimentosEntre(inicio, fim));
+                }
+                return texto(s.camarins.alteracoesEntre(inicio, fim, op.id));
+            }
+            case HISTORICO_DESFAZER: {
+                string descricao = s.historico.proximoDesfazer();  // Antes: o comando sai da pilha
+                return descricao + " " + texto(s.historico.desfazer());
+            }
+            case HISTORICO_REFAZER: {
+                string descricao = s.historico.proximoRefazer();
+                return descricao + " " + texto(s.historico.refazer());
+            }
+            case HISTORICO_MARCAR:
+                return to_string(s.historico.marcar());
+            case HISTORICO_DESFAZER_ATE:
+                return texto(s.historico.desfazerAte(op.id));
+
+            case ITEM_REFERENCIAS:
+                return texto(s.referencias.referenciasDe(op.id)) + " " + texto(s.referencias.emUso(op.id));
+            case ITEM_REMOVER_BLOQUEANDO:
+                return texto(s.referencias.removerItem(op.id, ModoRemocao::BLOQUEAR));
+            case ITEM_REMOVER_CASCATA:
+                return texto(s.referencias.removerItem(op.id, ModoRemocao::CASCATA));
+
+            // Agenda: horários pequenos (dezenas de µs) para provocar conflitos e bordas
+            case AGENDA_RESERVAR:
+                return texto(s.agenda.reservar(op.id, op.outro, inicioAgenda(op), fimAgenda(op)));
+            case AGENDA_CANCELAR:
+                return texto(s.agenda.cancelar(op.id));
+            case AGENDA_OCUPANTE:
+                return texto(s.agenda.ocupante(op.id, inicioAgenda(op)));
+            case AGENDA_LIVRE:
+                return texto(s.agenda.livre(op.id, inicioAgenda(op), fimAgenda(op)));
+            case AGENDA_LIVRES:
+                return texto(s.agenda.camarinsLivres(inicioAgenda(op), fimAgenda(op)));
+            case AGENDA_DO_CAMARIM:
+                return texto(s.agenda.agendaDoCamarim(op.id, inicioAgenda(op), fimAgenda(op)));
+            case AGENDA_DO_ARTISTA:
+                return texto(s.agenda.agendaDoArtista(op.outro));
+
+            // Modelos: instâncias compartilham as linhas no sistema real (cópia na escrita)
+            case MODELO_CRIAR:
+                return texto(s.modelos.criar(op.texto));
+            case MODELO_ADICIONAR_ITEM:
+                s.modelos.adicionarItem(op.id, op.outro, op.texto, op.quantidade);
+                return textoModelo(s.modelos.buscarPorId(op.id));
+            case MODELO_REMOVER_ITEM:
+                return texto(s.modelos.removerItem(op.id, op.outro));
+            case MODELO_REMOVER:
+                return texto(s.modelos.remover(op.id));
+            case MODELO_INSTANCIAR_PEDIDO: {
+                int id = s.modelos.instanciarPedido(op.id, s.pedidos, op.outro, op.texto);
+                return texto(id) + "\n" + s.pedidos.buscarPorId(id)->exibir();
+            }
+            case MODELO_INSTANCIAR_CAMARIM:
+                s.modelos.instanciarCamarim(op.id, s.camarins, op.outro);
+                return s.camarins.buscarPorId(op.outro)->exibir();
+
+            // Reposição: níveis por camarim, plano em lote
+            case REPOSICAO_DEFINIR:
+                s.reposicao.definirNivel(op.id, op.outro, op.texto, op.quantidade);
+                return texto(s.reposicao.niveisDe(op.id));
+            case REPOSICAO_NIVEIS:
+                return texto(s.reposicao.niveisDe(op.id));
+            case REPOSICAO_PLANEJAR:
+                return texto(s.reposicao.planejar());
+            case REPOSICAO_REPOR:
+                return texto(s.reposicao.repor());
+
+            // Códigos de barras e leitor (lote de 16 leituras no sistema)
+            case ITEM_DEFINIR_CODIGO: {
+                string codigo = op.preco > 19.0 ? "" : codigoSorteado(op.quantidade + 2, op.preco < 2.0);
+                s.itens.definirCodigoBarras(op.id, codigo);
+                return texto(s.itens.buscarPorId(op.id));
+            }
+            case ITEM_BUSCAR_CODIGO:
+                return texto(s.itens.buscarPorCodigo(codigoSorteado(op.quantidade + 2, op.preco < 2.0)));
+            case LEITOR_LER: {
+                // Até 15 leituras: no máximo uma gravação automática por operação
+                string saida;
+                if (op.quantidade == -2) {
+                    s.leitor.ler(codigoSorteado(op.id % 17, false), 0);  // Lança ValidacaoException
+                }
+                vector<string> cadastrados;  // Códigos do catálogo (iguais nos dois sistemas)
+                for (const auto& item : s.itens.listar()) {
+                    if (!item.getCodigoBarras().empty()) cadastrados.push_back(item.getCodigoBarras());
+                }
+                for (int k = 0; k < op.quantidade + 2; k++) {
+                    int n = ((op.id * 7 + k * (op.outro + 1)) % 17 + 17) % 17;
+                    int quantidade = k % 3 == 2 ? 1 + (op.outro + 6) % 6 : 1;
+                    string codigo = cadastrados.empty() || k % 4 == 3
+                        ? codigoSorteado(n, (k + n) % 7 == 0)  // Às vezes desconhecido ou inválido
+                        : cadastrados[n % cadastrados.size()];
+                    saida += texto(s.leitor.ler(codigo, quantidade)) + " ";
+                }
+                return saida + "\n" + texto(s.leitor.listarPendentes()) + texto(s.leitor.getResumo());
+            }
+            case LEITOR_FLUXO: {
+                // Leitor próprio com lote grande: uma gravação só, no fim do fluxo
+                typename S::Leitor leitor(s.itens, s.estoque, 1000);
+                static const char* const QUANTIDADES[] = {"", " 3", " 12", " x", " -1", " 0", " 2 3",
+                                                          " +4", " 99999999999", "\r", " 5\r", "   "};
+                string fluxo;
+                for (int k = 0; k < op.quantidade + 3; k++) {
+                    fluxo += codigoSorteado((op.id + k * 3) % 17, k == 4) + QUANTIDADES[((k + op.outro) % 12 + 12) % 12] + "\n";
+                    if (k % 5 == 3) fluxo += "\n";  // Linha vazia
+                }
+                if (op.preco < 5.0) fluxo += "fim\n" + codigoSorteado(op.id % 17, false) + "\n";
+                stringstream entrada(fluxo);
+                long long linhas = leitor.lerFluxo(entrada, "fim");
+                return texto(static_cast<int>(linhas)) + "\n" + texto(leitor.getResumo())
+                     + texto(leitor.ultimosRejeitados()) + texto(leitor.listarPendentes());
+            }
+            case LEITOR_DESCARREGAR:
+                s.leitor.descarregar();
+                return texto(s.leitor.getResumo());
+
+            // Catálogo congelado: qualquer mutação de item descongela
+            case ITEM_CONGELAR: {
+                s.itens.congelar();
+                // Logo após congelar: todas as grafias de todos os nomes (e IDs vizinhos) pelas tabelas
+                string saida = texto(s.itens.estaCongelado());
+                for (const auto& item : s.itens.listar()) {
+                    for (int variante = 0; variante < 4; variante++) {
+                        const auto* achado = s.itens.buscarPorNomeNormalizado(grafiaVariante(item.getNome(), variante));
+                        saida += " " + (achado == nullptr ? string("-") : to_string(achado->getId()));
+                    }
+                    saida += s.itens.buscarPorId(item.getId() + 1) == nullptr ? " ." : " +";
+                }
+                return saida;
+            }
+            case ITEM_BUSCAR_NORMALIZADO:
+                return texto(s.itens.buscarPorNomeNormalizado(grafiaVariante(op.texto, op.quantidade)));
+
+            // Arquivo de pedidos: um pedido atendido ou todos de uma vez
+            case ARQUIVO_ARQUIVAR:
+                if (op.quantidade % 5 == 1) {
+                    s.arquivo.conectar(s.itens);  // Volta ao catálogo (desconectado em ARQUIVO_CONSULTAR)
+                }
+                if (op.quantidade % 4 == 0) {
+                    return texto(s.arquivo.arquivarAtendidos(s.pedidos));
+                }
+                return texto(s.arquivo.arquivar(s.pedidos, op.id));
+            case ARQUIVO_CONSULTAR: {
+                Pedido arquivado;
+                bool achou = s.arquivo.buscarPorId(op.id, arquivado);
+                string saida = texto(achou) + " " + (achou ? arquivado.exibir() + instantes({arquivado}) : string())
+                             + texto(s.arquivo.quantidadePorItem()) + texto(s.arquivo.pedidosPorCamarim());
+
+                // Arquivo próprio com TODOS os pedidos atuais (qualquer status), parte deles duas vezes
+                typename S::Arquivo copia(static_cast<size_t>(op.quantidade + 3));
+                if (op.quantidade % 2 == 0) {
+                    copia.conectar(s.itens);
+                }
+                vector<Pedido> atuais = s.pedidos.listar();
+                for (const auto& p : atuais) copia.arquivar(p);
+                for (size_t k = 0; k < atuais.size(); k += 3) {
+                    Pedido alterado = atuais[k];
+                    alterado.setAtendido(!alterado.isAtendido());  // A versão mais recente é a que vale
+                    copia.arquivar(alterado);
+                }
+                for (int id = op.id - 2; id <= op.id + 2; id++) {
+                    achou = copia.buscarPorId(id, arquivado);
+                    saida += texto(achou) + " " + (achou ? arquivado.exibir() + instantes({arquivado}) : string());
+                }
+                saida += texto(copia.quantidadePorItem()) + texto(copia.pedidosPorCamarim());
+
+                // Sem catálogo até o próximo ARQUIVO_ARQUIVAR: os nomes em uso ficam congelados
+                if (op.quantidade % 5 == 0) {
+                    s.arquivo.desconectar();
+                }
+                return saida;
+            }
+
+            // Reconciliação: calcular não altera nada; aplicar grava em lote
+            case RECONCILIAR_CAMARIM: {
+                map<int, map<int, int>> contagens;
+                contagens[op.id] = contagemSorteada(s, op.id, op);
+                ResultadoReconciliacao r = S::Reconciliacao::calcular(s.camarins, contagens);
+                S::Reconciliacao::aplicar(r, s.camarins, s.estoque);
+                return texto(r);
+            }
+            case RECONCILIAR_CALCULAR_TODOS:
+                return texto(S::Reconciliacao::calcularTodos(s.camarins, contagensSorteadas(s, op)));
+            case RECONCILIAR_TODOS: {
+                ResultadoReconciliacao r = S::Reconciliacao::calcularTodos(s.camarins, contagensSorteadas(s, op));
+                if (op.preco > 18.0 && !r.linhas.empty()) {  // Resultado adulterado
+                    if (op.preco > 19.0) {
+                        r.linhas.pop_back();  // Linha a menos: o camarim não bate com a contagem
+                    } else {
+                        r.linhas.back().devolvido++;  // Linha que não fecha: nada pode ser gravado
+                    }
+                }
+                S::Reconciliacao::aplicar(r, s.camarins, s.estoque);
+                return texto(r);
+            }
+
+            default:
+                return "operação desconhecida";
+        }
+    } catch (const ExcecaoBase& e) {
+        return string("EXCECAO ") + typeid(e).name() + ": " + e.what();
+    } catch (const exception& e) {
+        return string("EXCECAO STL ") + typeid(e).name() + ": " + e.what();
+    }
+}
+
+/**
+ * @brief Estado completo de um sistema como texto (para comparação periódica)
+ */
+template <typename S>
+string estadoCompleto(const S& s) {
+    string minimos;
+    for (const auto& par : s.estoque.listarMinimos()) {
+        minimos += to_string(par.first) + ">=" + to_string(par.second) + "\n";
+    }
+    string historico = to_string(s.historico.totalDesfazer()) + "/" + to_string(s.historico.totalRefazer()) + "\n";
+    for (const string& descricao : s.historico.listar()) {
+        historico += descricao + "\n";
+    }
+    // Referências de todos os IDs de item já sorteáveis (inclusive fora do catálogo)
+    vector<Item> catalogo = s.itens.listar();
+    int maiorItem = catalogo.empty() ? 0 : catalogo.back().getId();
+    string referencias;
+    for (int id = -1; id <= maiorItem + 1; id++) {
+        referencias += to_string(id) + ": " + texto(s.referencias.referenciasDe(id)) + "\n";
+    }
+    string congelado = s.itens.estaCongelado() ? "congelado\n" : "";
+    string leitor = texto(s.leitor.getResumo()) + texto(s.leitor.ultimosRejeitados())
+                  + texto(s.leitor.listarPendentes());
+    vector<Pedido> arquivados = s.arquivo.listar();
+    string arquivo = to_string(s.arquivo.tamanho()) + " arquivados\n" + texto(arquivados) + instantes(arquivados);
+    // Lotes de cada item (ordem de saída) e o índice de vencimentos inteiro
+    string lotes;
+    for (const ItemEstoque& e : s.estoque.listar()) {
+        lotes += to_string(e.itemId) + ": " + texto(s.estoque.listarLotes(e.itemId));
+    }
+    lotes += texto(s.estoque.lotesVencendo(numeric_limits<long long>::min(), LoteEstoque::SEM_VALIDADE));
+    // Fornecedores e as ofertas de cada ID (itens removidos não podem ter ofertas)
+    string fornecedores = texto(s.fornecedores.listarFornecedores());
+    for (int id = -1; id <= maiorItem + 1; id++) {
+        fornecedores += to_string(id) + ": " + texto(s.fornecedores.ofertasDe(id));
+    }
+    // Quadro de bastidores inteiro (cada camarim com artistas, pedidos e conteúdo)
+    string quadro = texto(montarQuadroBastidores(s.camarins, s.artistas, s.pedidos, s.itens));
+    string niveis;
+    for (const auto& c : s.camarins.listar()) {
+        niveis += to_string(c.getId()) + ": " + texto(s.reposicao.niveisDe(c.getId())) + "\n";
+    }
+    return historico + congelado + quadro + referencias + leitor + arquivo + lotes + fornecedores + niveis + texto(s.reposicao.planejar()) + texto(s.agenda.listar()) + textoModelos(s.modelos.listar()) + texto(catalogo) + texto(s.artistas.listar()) + texto(s.camarins.listar())
+         + texto(s.pedidos.listar()) + instantes(s.pedidos.listar()) + texto(s.listas.listar())
+         + s.estoque.exibir() + minimos;
+}
+
+/**
+ * @brief Recalcula os indicadores do painel do zero, varrendo a referência
+ *
+ * Oráculo do PainelBastidores, que só recebe deltas dos gerenciadores.
+ */
+IndicadoresPainel recalcularPainel(const SistemaReferencia& s) {
+    IndicadoresPainel esperado;
+    vector<Camarim> camarins = s.camarins.listar();
+    vector<Artista> artistas = s.artistas.listar();
+
+    for (const Camarim& c : camarins) {
+        bool ocupado = false;
+        for (const Artista& a : artistas) {
+            ocupado = ocupado || a.getCamarimId() == c.getId();
+        }
+        esperado.camarinsOcupados += ocupado;
+    }
+    for (const Artista& a : artistas) {
+        bool temCamarim = false;
+        for (const Camarim& c : camarins) {
+            temCamarim = temCamarim || a.getCamarimId() == c.getId();
+        }
+        esperado.artistasSemCamarim += !temCamarim;
+    }
+    for (const Pedido& p : s.pedidos.listar()) {
+        (p.isAtendido() ? esperado.pedidosAtendidos : esperado.pedidosPendentes)++;
+    }
+    for (const ListaCompras& l : s.listas.listar()) {
+        esperado.valorListas += l.calcularTotal();
+    }
+    for (const ItemEstoque& item : s.estoque.listar()) {
+        esperado.unidadesEstoque += item.quantidade;
+    }
+    for (const auto& par : s.estoque.listarMinimos()) {
+        esperado.itensAbaixoMinimo += s.estoque.obterQuantidade(par.first) < par.second;
+    }
+    return esperado;
+}
+
+/**
+ * @brief Compara indicadores (valorListas com tolerância: somas em ordem diferente)
+ */
+bool mesmosIndicadores(const IndicadoresPainel& a, const IndicadoresPainel& b) {
+    return a.pedidosPendentes == b.pedidosPendentes && a.pedidosAtendidos == b.pedidosAtendidos
+        && a.camarinsOcupados == b.camarinsOcupados && a.artistasSemCamarim == b.artistasSemCamarim
+        && a.itensAbaixoMinimo == b.itensAbaixoMinimo && a.unidadesEstoque == b.unidadesEstoque
+        && abs(a.valorListas - b.valorListas) < 1e-6 * max(1.0, abs(b.valorListas));
+}
+
+string texto(const IndicadoresPainel& i) {
+    stringstream ss;
+    ss << "pendentes=" << i.pedidosPendentes << " atendidos=" << i.pedidosAtendidos
+       << " ocupados=" << i.camarinsOcupados << " semCamarim=" << i.artistasSemCamarim
+       << " abaixoMinimo=" << i.itensAbaixoMinimo << " unidades=" << i.unidadesEstoque
+       << " valorListas=" << setprecision(17) << i.valorListas;
+    return ss.str();
+}
+
+/**
+ * @brief Confere os itens mais pedidos contra as contagens exatas
+ * @param eventos (instante, itemId) de cada adicionarItem bem-sucedido
+ * @param exato true se a capacidade comporta todos os itens (sem estimativa)
+ * @return Descrição da divergência (vazio = correto)
+ *
+ * Garantias do Space-Saving: contagem - erro <= real <= contagem, e no
+ * resumo geral todo item com real > total / K aparece.
+ */
+string conferirFrequentes(const ItensMaisPedidos& frequentes, const vector<pair<long long, int>>& eventos,
+                          size_t capacidade, int quantidadeBaldes, long long largura, bool exato) {
+    const size_t todos = 1000000;
+    long long atual = Relogio::agora() / largura;
+    vector<int> janelas = {0, 1, 3, quantidadeBaldes};  // 0 = desde o início
+
+    for (int janela : janelas) {
+        map<int, long long> real;
+        long long total = 0;
+        for (const auto& e : eventos) {
+            long long balde = e.first / largura;
+            if (janela == 0 || (balde > atual - janela && balde <= atual)) {
+                real[e.second]++;
+                total++;
+            }
+        }
+        vector<ItemFrequente> obtidos = janela == 0 ? frequentes.maisPedidos(todos)
+                                                    : frequentes.maisPedidos(todos, janela);
+        string onde = " (janela " + to_string(janela) + ")";
+
+        map<int, long long> reportados;
+        for (size_t i = 0; i < obtidos.size(); i++) {
+            const ItemFrequente& f = obtidos[i];
+            long long r = real.count(f.itemId) ? real[f.itemId] : 0;
+            if (f.minimoGarantido() > r || r > f.contagem || f.erro < 0) {
+                return "item " + to_string(f.itemId) + ": real " + to_string(r) + " fora de ["
+                       + to_string(f.minimoGarantido()) + ", " + to_string(f.contagem) + "]" + onde;
+            }
+            if (i > 0 && obtidos[i - 1].contagem < f.contagem) {
+                return "itens fora de ordem" + onde;
+            }
+            if (!reportados.emplace(f.itemId, f.contagem).second) {
+                return "item " + to_string(f.itemId) + " repetido" + onde;
+            }
+        }
+        if (janela == 0) {
+            if (frequentes.getTotal() != total) {
+                return "total " + to_string(frequentes.getTotal()) + " != " + to_string(total);
+            }
+            for (const auto& par : real) {
+                if (par.second * static_cast<long long>(capacidade) > total && !reportados.count(par.first)) {
+                    return "item frequente " + to_string(par.first) + " ausente" + onde;
+                }
+            }
+        }
+        if (exato && reportados != map<int, long long>(real.begin(), real.end())) {
+            return "contagens exatas divergentes" + onde;
+        }
+    }
+    return "";
+}
+
+/**
+ * @brief Coleções alteradas por uma operação (vazio = operação não altera nada)
+ *
+ * O histórico de referência fotografa essas coleções antes e depois da
+ * operação, na ordem em que o sistema real gera os avisos.
+ */
+vector<referencia::Colecao> colecoesAlteradas(TipoOperacao tipo) {
+    using referencia::Colecao;
+    switch (tipo) {
+        case ITEM_CADASTRAR: case ITEM_ATUALIZAR: case ITEM_REMOVER: case ITEM_REMOVER_BLOQUEANDO:
+            return {Colecao::ITENS};
+        case ITEM_REMOVER_CASCATA:
+            return {Colecao::CAMARINS, Colecao::PEDIDOS, Colecao::LISTAS, Colecao::ESTOQUE, Colecao::ITENS};
+        case ARTISTA_CADASTRAR: case ARTISTA_ATUALIZAR: case ARTISTA_REMOVER:
+            return {Colecao::ARTISTAS};
+        case CAMARIM_CADASTRAR: case CAMARIM_ATUALIZAR: case CAMARIM_REMOVER:
+        case CAMARIM_INSERIR_ITEM: case CAMARIM_REMOVER_ITEM: case MODELO_INSTANCIAR_CAMARIM:
+            return {Colecao::CAMARINS};
+        case PEDIDO_CRIAR: case PEDIDO_ADICIONAR_ITEM: case PEDIDO_REMOVER_ITEM:
+        case PEDIDO_ATENDER: case PEDIDO_REMOVER: case MODELO_INSTANCIAR_PEDIDO:
+            return {Colecao::PEDIDOS};
+        case LISTA_CRIAR: case LISTA_ADICIONAR_ITEM: case LISTA_REMOVER_ITEM:
+        case LISTA_ATUALIZAR_QTD: case LISTA_LIMPAR: case LISTA_REMOVER:
+            return {Colecao::LISTAS};
+        case ESTOQUE_ADICIONAR: case ESTOQUE_REMOVER: case ESTOQUE_ATUALIZAR: case ESTOQUE_DEFINIR_MINIMO:
+        case ESTOQUE_ADICIONAR_LOTE:
+            return {Colecao::ESTOQUE};
+        case FORNECEDOR_GERAR_LISTA: case FORNECEDOR_DIVIDIR_EM_LISTAS:  // Uma criação por lista
+            return {Colecao::LISTAS};
+        case REPOSICAO_REPOR:  // Saídas do estoque primeiro, depois um aviso por camarim
+            return {Colecao::ESTOQUE, Colecao::CAMARINS};
+        case RECONCILIAR_CAMARIM: case RECONCILIAR_TODOS:  // Um aviso por camarim, depois devoluções
+            return {Colecao::CAMARINS, Colecao::ESTOQUE};
+        case ITEM_DEFINIR_CODIGO:
+            return {Colecao::ITENS};
+        case LEITOR_LER: case LEITOR_FLUXO: case LEITOR_DESCARREGAR:  // Um aviso por item do lote
+            return {Colecao::ESTOQUE};
+        case ARQUIVO_ARQUIVAR:  // Um aviso (remoção) por pedido arquivado
+            return {Colecao::PEDIDOS};
+        default:
+            return {};
+    }
+}
+
+/**
+ * @brief Melhor alocação por força bruta: (artistas alocados, custo em cm)
+ *
+ * Tenta, para cada artista, todos os camarins ainda livres e "sem camarim".
+ * Só serve para instâncias minúsculas (até 5 x 5).
+ */
+pair<int, long long> melhorAlocacao(const vector<RequisitoArtista>& artistas, const vector<PerfilCamarim>& camarins,
+                                    const vector<vector<bool>>& proibido, size_t i, vector<bool>& usado) {
+    if (i == artistas.size()) {
+        return make_pair(0, 0LL);
+    }
+    pair<int, long long> melhor = melhorAlocacao(artistas, camarins, proibido, i + 1, usado);  // Sem camarim
+    for (size_t j = 0; j < camarins.size(); j++) {
+        long long c = AlocadorCamarins::custo(artistas[i], camarins[j]);
+        if (usado[j] || c < 0 || proibido[i][j]) {
+            continue;
+        }
+        usado[j] = true;
+        pair<int, long long> resto = melhorAlocacao(artistas, camarins, proibido, i + 1, usado);
+        usado[j] = false;
+        resto.first++;
+        resto.second += c;
+        // Mais artistas alocados primeiro; empate: menor custo
+        if (resto.first > melhor.first || (resto.first == melhor.first && resto.second < melhor.second)) {
+            melhor = resto;
+        }
+    }
+    return melhor;
+}
+
+/**
+ * @brief Conta os avisos de artistas e camarins (gravação parcial = algum aviso)
+ */
+struct ContadorAvisos : public ObservadorMutacoes {
+    int avisos = 0;
+    void aoMudarArtista(const Artista*, const Artista*) override { avisos++; }
+    void aoMudarCamarim(const Camarim*, const Camarim*) override { avisos++; }
+};
+
+/**
+ * @brief Confere o AlocadorCamarins contra força bruta e testa a gravação atômica
+ * @return Descrição da divergência (vazio = correto)
+ */
+string conferirAlocacao(unsigned semente) {
+    mt19937 rng(semente);
+    auto sortear = [&](int min, int max) { return uniform_int_distribution<int>(min, max)(rng); };
+    const long long inicio = 100, fim = 200;  // Horário do show (agenda)
+
+    for (int instancia = 0; instancia < 8; instancia++) {
+        GerenciadorArtistas artistas;
+        GerenciadorCamarins camarins;
+        AgendaCamarins agenda;
+        agenda.conectar(artistas, camarins);
+
+        vector<RequisitoArtista> requisitos(sortear(0, 5));
+        vector<PerfilCamarim> perfis(sortear(0, 5));
+        for (auto& r : requisitos) {
+            r.artistaId = artistas.cadastrar("Banda", sortear(0, 3));
+            r.integrantes = sortear(1, 4);
+            r.distanciaMaxima = sortear(0, 3) * 5.0;
+        }
+        for (auto& c : perfis) {
+            c.camarimId = camarins.cadastrar("Sala", 0);
+            c.capacidade = sortear(0, 5);
+            c.distanciaPalco = sortear(0, 40) / 2.0;
+            // Às vezes o camarim já está reservado (para um dos artistas) perto do horário
+            if (!requisitos.empty() && sortear(0, 2) == 0) {
+                int dono = requisitos[sortear(0, static_cast<int>(requisitos.size()) - 1)].artistaId;
+                int comeco = sortear(0, 250);
+                try {
+                    agenda.reservar(c.camarimId, dono, comeco, comeco + sortear(1, 60));
+                } catch (const ExcecaoBase&) {
+                    // Conflito de artista: segue sem essa reserva
+                }
+            }
+        }
+        bool usarAgenda = sortear(0, 1) == 1;
+
+        // Proibido: camarim com reserva de OUTRO artista no horário do show
+        vector<vector<bool>> proibido(requisitos.size(), vector<bool>(perfis.size(), false));
+        for (size_t j = 0; usarAgenda && j < perfis.size(); j++) {
+            for (const Reserva& r : agenda.agendaDoCamarim(perfis[j].camarimId, inicio, fim)) {
+                for (size_t i = 0; i < requisitos.size(); i++) {
+                    proibido[i][j] = proibido[i][j] || r.artistaId != requisitos[i].artistaId;
+                }
+            }
+        }
+
+        ResultadoAlocacao resultado = AlocadorCamarins::resolver(requisitos, perfis,
+                                                                 usarAgenda ? &agenda : nullptr, inicio, fim);
+
+        // 1) Resultado viável, completo e com custo ótimo
+        vector<bool> usado(perfis.size(), false);
+        pair<int, long long> esperado = melhorAlocacao(requisitos, perfis, proibido, 0, usado);
+        long long custo = 0;
+        for (const auto& par : resultado.pares) {
+            size_t i = 0, j = 0;
+            while (requisitos[i].artistaId != par.first) i++;
+            while (perfis[j].camarimId != par.second) j++;
+            long long c = AlocadorCamarins::custo(requisitos[i], perfis[j]);
+            if (c < 0 || proibido[i][j] || usado[j]) {
+                return "par inviável ou repetido: artista " + to_string(par.first) + ", camarim " + to_string(par.second);
+            }
+            usado[j] = true;
+            custo += c;
+        }
+        if (resultado.pares.size() + resultado.artistasSemCamarim.size() != requisitos.size() ||
+            resultado.pares.size() + resultado.camarinsSemArtista.size() != perfis.size()) {
+            return "resultado incompleto";
+        }
+        if (static_cast<int>(resultado.pares.size()) != esperado.first || custo != esperado.second ||
+            llround(resultado.custoTotal * 100) != custo) {
+            return "não ótimo: " + to_string(resultado.pares.size()) + " pares / " + to_string(custo)
+                 + " cm, esperado " + to_string(esperado.first) + " / " + to_string(esperado.second) + " cm";
+        }
+
+        // 2) Gravação: os dois lados de cada par apontam um para o outro
+        AlocadorCamarins::aplicar(resultado, artistas, camarins);
+        for (const auto& par : resultado.pares) {
+            if (artistas.buscarPorId(par.first)->getCamarimId() != par.second ||
+                camarins.buscarPorId(par.second)->getArtistaId() != par.first) {
+                return "par não gravado: artista " + to_string(par.first);
+            }
+        }
+        for (int id : resultado.artistasSemCamarim) {
+            if (artistas.buscarPorId(id)->getCamarimId() != 0) return "artista sem camarim não zerado";
+        }
+        for (int id : resultado.camarinsSemArtista) {
+            if (camarins.buscarPorId(id)->getArtistaId() != 0) return "camarim sem artista não zerado";
+        }
+
+        // 3) Atomicidade: uma escrita inválida no fim recusa tudo antes de gravar qualquer coisa
+        string antes = texto(artistas.listar()) + texto(camarins.listar());
+        ContadorAvisos contador;
+        artistas.adicionarObservador(&contador);
+        camarins.adicionarObservador(&contador);
+        // (aplicar grava pares, depois artistas e por último camarins)
+        ResultadoAlocacao falho;
+        for (const auto& r : requisitos) {
+            falho.artistasSemCamarim.push_back(r.artistaId);  // Tira todos os artistas dos camarins...
+        }
+        for (const auto& par : resultado.pares) {
+            falho.camarinsSemArtista.push_back(par.second);   // ...esvazia os camarins ocupados...
+        }
+        falho.camarinsSemArtista.push_back(9999);  // ...e termina em um camarim inexistente
+        try {
+            AlocadorCamarins::aplicar(falho, artistas, camarins);
+            return "aplicar não falhou com camarim inexistente";
+        } catch (const CamarimException&) {
+            // Esperado
+        }
+        artistas.removerObservador(&contador);
+        camarins.removerObservador(&contador);
+        if (texto(artistas.listar()) + texto(camarins.listar()) != antes) {
+            return "falha no meio da gravação deixou alterações";
+        }
+        if (contador.avisos != 0) {
+            return "aplicar recusado avisou " + to_string(contador.avisos) + " gravação(ões) parcial(is)";
+        }
+    }
+    return "";
+}
+
+/**
+ * @brief Confere um registro: acesso por Campo, CSV, JSON, binário e regras (esquema.h x tabelas manuais)
+ * @param valido 1 = deve passar em validar(), 0 = deve ser recusado, -1 = não confere
+ * @return Descrição da divergência (vazio = correto)
+ */
+template <typename T>
+string conferirRegistro(const T& r, int valido) {
+    static const Campo CAMPOS[] = {Campo::ID, Campo::NOME, Campo::PRECO, Campo::QUANTIDADE,
+                                   Campo::CAMARIM, Campo::ARTISTA, Campo::ATENDIDO};
+    string entidade = esquema::Esquema<T>::entidade;
+    for (Campo c : CAMPOS) {
+        double numero = -1.0, esperadoNumero = -1.0;
+        string esperadoTexto;
+        const string* textoCampo = campoTexto(r, c);
+        if (campoNumerico(r, c, numero) != referencia::campoNumerico(r, c, esperadoNumero) ||
+            numero != esperadoNumero ||
+            (textoCampo != nullptr) != referencia::campoTexto(r, c, esperadoTexto) ||
+            (textoCampo != nullptr && *textoCampo != esperadoTexto)) {
+            return entidade + ": campo '" + nomeCampo(c) + "' divergente";
+        }
+    }
+
+    vector<referencia::ValorRegistro> valores = referencia::registro(r);
+    string cabecalho;
+    for (const auto& v : valores) cabecalho += (cabecalho.empty() ? "" : ",") + v.nome;
+    stringstream binario;
+    esquema::escreverBinario(binario, r);
+    if (esquema::cabecalhoCsv<T>() != cabecalho) return entidade + ": cabeçalho CSV " + esquema::cabecalhoCsv<T>();
+    if (esquema::paraCsv(r) != referencia::csv(valores)) return entidade + ": CSV " + esquema::paraCsv(r);
+    if (esquema::paraJson(r) != referencia::json(valores)) return entidade + ": JSON " + esquema::paraJson(r);
+    if (binario.str() != referencia::binario(valores)) return entidade + ": binário divergente";
+
+    try {
+        esquema::validar(r);
+        if (valido == 0) return entidade + ": registro inválido aceito";
+    } catch (const ValidacaoException& e) {
+        if (valido == 1) return entidade + ": registro válido recusado (" + e.what() + ")";
+    }
+    return "";
+}
+
+/**
+ * @brief Confere o esquema sobre todo o estado do sistema e sobre registros extremos
+ * @return Descrição da divergência (vazio = correto)
+ */
+template <typename S>
+string conferirEsquema(const S& s) {
+    string erro;
+    auto conferirTodos = [&](const auto& registros) {
+        for (const auto& r : registros) {
+            if (erro.empty()) erro = conferirRegistro(r, 1);  // Setters e cadastros usam as regras da tabela
+        }
+    };
+    conferirTodos(s.itens.listar());
+    conferirTodos(s.estoque.listar());
+    conferirTodos(s.artistas.listar());
+    conferirTodos(s.camarins.listar());
+    conferirTodos(s.pedidos.listar());
+    conferirTodos(s.listas.listar());
+    if (!erro.empty()) return erro;
+
+    // Textos que exigem aspas/escape, UTF-8, preços com arredondamento e registros que violam as regras
+    static const char* const NOMES[] = {"Agua, \"com gas\"", "linha\nquebrada", "tab\tcr\r", "\x01\x1f",
+                                        "barra \\ invertida", "\xc3\x81gua Mineral", "\"", ","};
+    for (const char* nome : NOMES) {
+        for (double preco : {0.0, 2.005, 1234567.891, 0.125}) {
+            if (erro.empty()) erro = conferirRegistro(Item(7, nome, preco), 1);
+        }
+        if (erro.empty()) erro = conferirRegistro(ItemEstoque(-3, nome, 4), 0);
+        if (erro.empty()) erro = conferirRegistro(Artista(2, nome, 0), 1);
+        if (erro.empty()) erro = conferirRegistro(Pedido(1, 3, nome), 1);
+        if (erro.empty()) erro = conferirRegistro(ListaCompras(9, nome), 1);
+    }
+    if (erro.empty()) erro = conferirRegistro(Item(), 0);           // Nome vazio
+    if (erro.empty()) erro = conferirRegistro(ItemEstoque(1, "X", -1), 0);
+    if (erro.empty()) erro = conferirRegistro(Camarim(), 0);
+    if (!erro.empty()) return erro;
+
+    // Construtores e setters recusam com a mensagem da regra da tabela (única fonte)
+    auto recusa = [](function<void()> passo, const string& mensagem) {
+        try {
+            passo();
+        } catch (const ValidacaoException& e) {
+            return string(e.what()) == ValidacaoException(mensagem).what();
+        }
+        return false;
+    };
+    Item item(1, "Agua", 1.0);
+    Artista artista(1, "Banda", 0);
+    Camarim camarim(1, "Sala", 0);
+    Pedido pedido(1, 1, "Banda");
+    ListaCompras lista(1, "Compra");
+    if (!recusa([] { Item(-1, "Agua", 1.0); }, "ID do item não pode ser negativo")
+        || !recusa([&] { item.setNome(""); }, "Nome do item não pode ser vazio")
+        || !recusa([&] { item.setPreco(-0.5); }, "Preço do item não pode ser negativo")
+        || !recusa([] { Artista(-1, "Banda", 0); }, "ID do artista não pode ser negativo")
+        || !recusa([&] { artista.setId(-1); }, "ID do artista não pode ser negativo")
+        || !recusa([&] { artista.setNome(""); }, "Nome do artista não pode ser vazio")
+        || !recusa([&] { artista.setCamarimId(-1); }, "ID de camarim inválido")
+        || !recusa([] { Camarim(1, "", 0); }, "Nome do camarim não pode ser vazio")
+        || !recusa([&] { camarim.setId(-1); }, "ID do camarim inválido")
+        || !recusa([] { Pedido(1, -1, "Banda"); }, "ID do camarim inválido")
+        || !recusa([&] { pedido.setNomeArtista(""); }, "Nome do artista não pode ser vazio")
+        || !recusa([] { ListaCompras(1, ""); }, "Descrição não pode ser vazia")
+        || !recusa([&] { lista.setId(-1); }, "ID da lista inválido")) {
+        return "construtor ou setter fora das regras da tabela";
+    }
+    if (item.getNome() != "Agua" || artista.getId() != 1 || artista.getNome() != "Banda" || camarim.getId() != 1
+        || pedido.getNomeArtista() != "Banda" || lista.getId() != 1) {
+        return "setter recusado alterou o registro";
+    }
+    return "";
+}
+
+/**
+ * @brief Confere o AlocadorIds com blocos intercalados (threads simuladas)
+ * @return Descrição da divergência (vazio = correto)
+ *
+ * Cada "thread" é um Bloco; a ordem das chamadas é sorteada, e blocos são
+ * encerrados no meio. Os IDs devem sair únicos e abaixo do limite;
+ * encerrados os blocos do mais recente para o mais antigo, não pode sobrar
+ * faixa devolvível no fim (limite = maior ID entregue ou observado + 1).
+ */
+string conferirIds(unsigned semente) {
+    mt19937 rng(semente);
+    auto sortear = [&](int min, int max) { return uniform_int_distribution<int>(min, max)(rng); };
+
+    AlocadorIds alocador(1, sortear(1, 8));
+    vector<unique_ptr<AlocadorIds::Bloco>> blocos(sortear(1, 4));
+    vector<int> ultimaReserva(blocos.size(), -1);  // Momento da última faixa pega por bloco
+    set<int> entregues;
+    int observado = 0;
+
+    for (int passo = 0; passo < 400; passo++) {
+        int escolha = sortear(0, 19);
+        int id = 0;
+        if (escolha < 14) {  // Uma "thread" aloca pelo seu bloco
+            size_t b = static_cast<size_t>(sortear(0, static_cast<int>(blocos.size()) - 1));
+            if (!blocos[b]) blocos[b].reset(new AlocadorIds::Bloco(alocador));
+            id = blocos[b]->alocar();
+            if (blocos[b]->restantes() == alocador.getTamanhoBloco() - 1) ultimaReserva[b] = passo;
+        } else if (escolha < 16) {  // Thread encerrada no meio: sobra volta se for o último bloco
+            blocos[static_cast<size_t>(sortear(0, static_cast<int>(blocos.size()) - 1))].reset();
+            continue;
+        } else if (escolha < 18) {  // ID avulso, às vezes devolvido (cadastro que falhou)
+            id = alocador.alocar();
+            if (sortear(0, 1) == 0 && alocador.devolver(id)) continue;
+        } else {  // Registro carregado/restaurado com ID conhecido
+            observado = max(observado, alocador.getLimite() + sortear(0, 3));  // Ainda não entregue
+            alocador.observar(observado);
+            continue;
+        }
+        if (!entregues.insert(id).second) {
+            return "ID " + to_string(id) + " entregue duas vezes";
+        }
+        if (id >= alocador.getLimite()) {
+            return "ID " + to_string(id) + " >= limite " + to_string(alocador.getLimite());
+        }
+    }
+
+    // Encerra os blocos do que pegou faixa por último para o primeiro
+    vector<size_t> ordem(blocos.size());
+    for (size_t b = 0; b < ordem.size(); b++) ordem[b] = b;
+    sort(ordem.begin(), ordem.end(), [&](size_t a, size_t b) { return ultimaReserva[a] > ultimaReserva[b]; });
+    for (size_t b : ordem) blocos[b].reset();
+
+    int esperado = max(entregues.empty() ? 0 : *entregues.rbegin(), observado) + 1;
+    if (alocador.getLimite() != esperado) {
+        return "limite " + to_string(alocador.getLimite()) + " após encerrar os blocos (esperado "
+               + to_string(esperado) + ")";
+    }
+    int id = alocador.alocar();
+    if (id != esperado || !alocador.devolver(id) || alocador.getLimite() != esperado) {
+        return "ID avulso " + to_string(id) + " após encerrar os blocos (esperado " + to_string(esperado) + ")";
+    }
+
+    // Cadastro cuja montagem lança devolve o ID (sem lacuna)
+    Repositorio<ListaCompras> repositorio;
+    try {
+        repositorio.cadastrar([](int) -> ListaCompras { throw ValidacaoException("montagem falhou"); });
+    } catch (const ValidacaoException&) {
+    }
+    if (repositorio.getProximoId() != 1 || repositorio.cadastrar([](int n) { return ListaCompras(n, "L"); }).getId() != 1) {
+        return "cadastro que falhou consumiu o ID";
+    }
+    return "";
+}
+
+/**
+ * @brief Confere IDs alocados por várias threads de verdade
+ * @return Descrição da divergência (vazio = correto)
+ *
+ * 1) Alocador puro: cada thread usa o seu Bloco (às vezes devolvendo o
+ *    último ID) e também pega IDs avulsos, tudo ao mesmo tempo.
+ * 2) Gerenciador: cada thread cadastra itens pelo seu bloco, sob a trava
+ *    de quem grava.
+ * Cada thread usa faixas inteiras (nenhuma sobra), então os IDs devem sair
+ * ÚNICOS e DENSOS: exatamente 1..N, com limite N + 1.
+ */
+string conferirIdsConcorrentes(unsigned semente) {
+    const int THREADS = 4;
+    auto conferirDensos = [](vector<int> ids, int limite) -> string {
+        sort(ids.begin(), ids.end());
+        for (size_t i = 0; i < ids.size(); i++) {
+            if (ids[i] != static_cast<int>(i) + 1) {
+                return "IDs não são 1.." + to_string(ids.size()) + ": posição " + to_string(i) + " tem " + to_string(ids[i]);
+            }
+        }
+        if (limite != static_cast<int>(ids.size()) + 1) {
+            return "limite " + to_string(limite) + " após " + to_string(ids.size()) + " IDs";
+        }
+        return "";
+    };
+
+    // 1) Alocador puro
+    AlocadorIds alocador(1, static_cast<int>(semente % 16) + 1);
+    const int porThread = alocador.getTamanhoBloco() * 3;
+    vector<vector<int>> obtidos(THREADS);
+    vector<thread> threads;
+    for (int t = 0; t < THREADS; t++) {
+        threads.emplace_back([&, t] {
+            AlocadorIds::Bloco bloco(alocador);
+            for (int i = 0; i < porThread; i++) {
+                int id = bloco.alocar();
+                if (i % 5 == 0 && bloco.devolver(id)) {
+                    id = bloco.alocar();  // Cadastro que falhou: o mesmo ID volta
+                }
+                obtidos[static_cast<size_t>(t)].push_back(id);
+                if (i % 7 == 0) {
+                    obtidos[static_cast<size_t>(t)].push_back(alocador.alocar());
+                }
+            }
+        });
+    }
+    for (thread& th : threads) th.join();
+    vector<int> todos;
+    for (const auto& daThread : obtidos) todos.insert(todos.end(), daThread.begin(), daThread.end());
+    string erro = conferirDensos(todos, alocador.getLimite());
+    if (!erro.empty()) return "alocador: " + erro;
+
+    // 2) Cadastro pelo gerenciador
+    GerenciadorItens itens;
+    mutex trava;
+    threads.clear();
+    for (int t = 0; t < THREADS; t++) {
+        threads.emplace_back([&, t] {
+            AlocadorIds::Bloco bloco(itens.getAlocadorIds());
+            for (int i = 0; i < itens.getAlocadorIds().getTamanhoBloco() * 2; i++) {
+                lock_guard<mutex> escrita(trava);
+                itens.cadastrar("Item " + to_string(t) + "-" + to_string(i), 1.0, &bloco);
+            }
+        });
+    }
+    for (thread& th : threads) th.join();
+    todos.clear();
+    const int tamanho = itens.getAlocadorIds().getTamanhoBloco();
+    map<string, vector<int>> idsDaThread;  // "Item t-" -> IDs dessa thread, em ordem
+    for (const Item& item : itens.listar()) {
+        todos.push_back(item.getId());
+        idsDaThread[item.getNome().substr(0, item.getNome().find('-'))].push_back(item.getId());
+    }
+    // Os IDs de cada thread vêm das faixas do seu bloco: sequências inteiras de 'tamanho'
+    for (const auto& par : idsDaThread) {
+        for (size_t i = 0; i < par.second.size(); i++) {
+            int esperado = i % tamanho == 0 ? par.second[i] : par.second[i - 1] + 1;
+            if (par.second[i] != esperado || (i % tamanho == 0 && (par.second[i] - 1) % tamanho != 0)) {
+                return par.first + " recebeu ID " + to_string(par.second[i]) + " fora das faixas do seu bloco";
+            }
+        }
+    }
+    if (todos.size() != static_cast<size_t>(THREADS * itens.getAlocadorIds().getTamanhoBloco() * 2)) {
+        return "gerenciador guardou " + to_string(todos.size()) + " itens";
+    }
+    if (!is_sorted(todos.begin(), todos.end())) {
+        return "gerenciador fora da ordem de ID";
+    }
+    erro = conferirDensos(todos, itens.getAlocadorIds().getLimite());
+    return erro.empty() ? "" : "gerenciador: " + erro;
+}
+
+/**
+ * @brief Índice de teste: a chave "falha" faz inserir() lançar
+ */
+struct IndiceQueFalha {
+    using TipoChave = string;
+    static string chave(const Item& item) { return item.getNome(); }
+    void inserir(const string& nome, int) {
+        if (nome == "falha") throw ItemException("índice recusou a chave");
+    }
+    void remover(const string&, int) {}
+};
+
+/**
+ * @brief Confere Repositorio::alterar quando a alteração ou a reindexação lançam
+ * @return Descrição da divergência (vazio = correto)
+ *
+ * Alteração que lança depois de mudar a chave: os índices seguem a chave
+ * nova e a exceção da alteração chega a quem chamou. Índice que lança ao
+ * reindexar (concluir) propaga a sua exceção sem terminar o programa.
+ */
+string conferirReindexacao() {
+    using PorNome = IndiceUnico<&Item::getNome>;
+    Repositorio<Item, PorNome, IndiceQueFalha> repositorio;
+    Item& item = repositorio.cadastrar([](int id) { return Item(id, "Velho", 1.0); });
+    int id = item.getId();
+
+    try {
+        repositorio.alterar(item, [](Item& i) {
+            i.setNome("Novo");
+            i.setPreco(-1.0);  // Lança depois de mudar a chave
+        });
+        return "alteração inválida não lançou";
+    } catch (const ValidacaoException&) {
+        // Esperado: a exceção da alteração, não a do índice
+    }
+    if (repositorio.indice<PorNome>().buscar("Novo") != id || repositorio.indice<PorNome>().buscar("Velho") != 0) {
+        return "alteração que lançou deixou o índice na chave antiga";
+    }
+
+    try {
+        repositorio.alterar(item, [](Item& i) {
+            i.setNome("falha");
+            i.setPreco(-1.0);  // Alteração e índice lançam: vale a da alteração
+        });
+        return "alteração inválida não lançou";
+    } catch (const ValidacaoException&) {
+        // Esperado
+    }
+
+    repositorio.alterar(item, [](Item& i) { i.setNome("Outro"); });
+    try {
+        repositorio.alterar(item, [](Item& i) { i.setNome("falha"); });  // Só o índice lança (concluir)
+        return "reindexação que falhou não lançou";
+    } catch (const ItemException&) {
+        // Esperado
+    }
+    return "";
+}
+
+/**
+ * @brief Confere o Escalonador: paraCada, grupos aninhados, exceções e estatísticas
+ * @return Descrição da divergência (vazio = correto)
+ *
+ * Todo índice roda exatamente uma vez; quando corpo lança, a exceção chega
+ * a quem esperava, nenhum índice roda duas vezes (a parte que lançou para
+ * ali) e o escalonador continua usável.
+ * Tarefas que enviam tarefas e chamam paraCada() não podem travar, mesmo
+ * sem threads no escalonador.
+ */
+string conferirEscalonador(unsigned semente) {
+    mt19937 rng(semente);
+    auto sortear = [&](int min, int max) { return uniform_int_distribution<int>(min, max)(rng); };
+
+    Escalonador escalonador(static_cast<size_t>(sortear(0, 3)));
+    for (int lote = 0; lote < 6; lote++) {
+        size_t inicio = static_cast<size_t>(sortear(0, 5));
+        size_t fim = inicio + static_cast<size_t>(sortear(0, 200));
+        size_t porTarefa = static_cast<size_t>(sortear(0, 20));  // 0 vira 1
+        Prioridade prioridade = sortear(0, 1) == 0 ? Prioridade::INTERATIVA : Prioridade::LOTE;
+        int falha = sortear(0, 2) == 0 ? static_cast<int>(inicio) + sortear(0, static_cast<int>(fim - inicio)) : -1;
+        int segunda = falha + sortear(1, 4);  // Outra falha depois (pode cair fora da faixa)
+        vector<int> execucoes(fim, 0);  // Índices distintos: cada tarefa escreve na sua posição
+        bool lancou = false;
+        try {
+            escalonador.paraCada(inicio, fim, [&](size_t i) {
+                execucoes[i]++;
+                if (falha >= 0 && (static_cast<int>(i) == falha || static_cast<int>(i) == segunda)) {
+                    throw runtime_error("tarefa " + to_string(i));
+                }
+            }, porTarefa, prioridade);
+        } catch (const runtime_error& e) {
+            lancou = true;
+            string obtida = e.what();
+            if (obtida != "tarefa " + to_string(falha) && obtida != "tarefa " + to_string(segunda)) {
+                return "exceção errada: " + obtida;
+            }
+        }
+        if (lancou != (falha >= 0 && static_cast<size_t>(falha) < fim)) {
+            return "faixa [" + to_string(inicio) + ", " + to_string(fim) + ")"
+                   + (lancou ? " lançou sem falha" : " engoliu a exceção");
+        }
+        for (size_t i = 0; i < fim; i++) {
+            int esperado = i < inicio ? 0 : 1;
+            if (execucoes[i] != esperado && !(lancou && execucoes[i] == 0)) {
+                return "índice " + to_string(i) + " de [" + to_string(inicio) + ", " + to_string(fim)
+                       + ") executado " + to_string(execucoes[i]) + " vezes";
+            }
+        }
+    }
+
+    // Paralelismo aninhado: tarefas do grupo chamam paraCada() e enviam mais tarefas ao grupo
+    size_t linhas = static_cast<size_t>(sortear(1, 12));
+    size_t colunas = static_cast<size_t>(sortear(1, 30));
+    vector<vector<int>> matriz(linhas, vector<int>(colunas, 0));
+    vector<int> extras(linhas, 0);
+    {
+        Escalonador::Grupo grupo(escalonador);
+        for (size_t l = 0; l < linhas; l++) {
+            grupo.enviar([&, l] {
+                escalonador.paraCada(0, colunas, [&](size_t c) { matriz[l][c]++; }, 3, Prioridade::INTERATIVA);
+                grupo.enviar([&, l] { extras[l]++; });
+            });
+        }
+        if (linhas % 2 == 0) grupo.esperar();  // Senão o destrutor espera
+    }
+    for (size_t l = 0; l < linhas; l++) {
+        if (extras[l] != 1) return "tarefa aninhada da linha " + to_string(l) + " executada " + to_string(extras[l]) + " vezes";
+        for (size_t c = 0; c < colunas; c++) {
+            if (matriz[l][c] != 1) return "célula aninhada (" + to_string(l) + ", " + to_string(c) + ") incorreta";
+        }
+    }
+
+    // Grupo reaproveitado depois de uma exceção não a relança de novo
+    {
+        Escalonador::Grupo grupo(escalonador);
+        grupo.enviar([] { throw runtime_error("primeira"); });
+        try {
+            grupo.esperar();
+            return "grupo engoliu a exceção";
+        } catch (const runtime_error&) {
+        }
+        int executada = 0;
+        grupo.enviar([&] { executada++; });
+        try {
+            grupo.esperar();
+        } catch (const runtime_error& e) {
+            return string("grupo relançou a exceção antiga: ") + e.what();
+        }
+        if (executada != 1) return "grupo reaproveitado não executou a tarefa";
+    }
+
+    // Estatísticas: toda tarefa enviada é contada uma vez, na prioridade certa
+    EstatisticasEscalonador estatisticas = escalonador.getEstatisticas();
+    unsigned long long somaFilas = 0;
+    for (unsigned long long n : estatisticas.porFila) somaFilas += n;
+    if (estatisticas.porFila.size() != escalonador.getParalelismo() ||
+        somaFilas != estatisticas.interativas + estatisticas.lote ||
+        estatisticas.roubadas > somaFilas || estatisticas.executadasEsperando > somaFilas) {
+        return "estatísticas incoerentes";
+    }
+    Escalonador avulso(static_cast<size_t>(sortear(0, 2)));
+    int interativas = sortear(0, 20), deLote = sortear(0, 20);
+    {
+        Escalonador::Grupo grupo(avulso);
+        for (int k = 0; k < interativas + deLote; k++) {
+            grupo.enviar([] {}, k < interativas ? Prioridade::INTERATIVA : Prioridade::LOTE);
+        }
+        grupo.esperar();
+    }
+    estatisticas = avulso.getEstatisticas();
+    if (estatisticas.interativas != static_cast<unsigned long long>(interativas) ||
+        estatisticas.lote != static_cast<unsigned long long>(deLote)) {
+        return "estatísticas contaram " + to_string(estatisticas.interativas) + " interativas e "
+               + to_string(estatisticas.lote) + " de lote (esperado " + to_string(interativas) + " e "
+               + to_string(deLote) + ")";
+    }
+    return "";
+}
+
+/**
+ * @brief Confere buscas simultâneas no IndiceTrigramas
+ * @return Descrição da divergência (vazio = correto)
+ *
+ * As mesmas consultas rodam em sequência e depois espalhadas pelas threads
+ * de um Escalonador (várias vezes cada, índices de tamanhos diferentes):
+ * todas devem devolver o mesmo ranking. ID negativo não é indexado.
+ */
+string conferirBuscaConcorrente(unsigned semente) {
+    mt19937 rng(semente);
+    auto sortear = [&](int min, int max) { return uniform_int_distribution<int>(min, max)(rng); };
+    const vector<string> silabas = {"a", "gua", "ca", "fe", "su", "co", "min", "ral", "pao", " "};
+    auto nome = [&] {
+        string n;
+        for (int k = sortear(1, 5); k > 0; k--) n += silabas[static_cast<size_t>(sortear(0, 9))];
+        return n;
+    };
+
+    // Dois índices: o rascunho de cada thread serve a ambos, de tamanhos diferentes
+    vector<IndiceTrigramas> indices(2);
+    for (size_t i = 0; i < indices.size(); i++) {
+        for (int id = 0, total = sortear(1, 300) >> (2 * i); id <= total; id++) {
+            indices[i].inserir(id, nome());
+        }
+    }
+    try {
+        indices[0].inserir(-1, "agua");
+        return "inserir aceitou ID negativo";
+    } catch (const ValidacaoException&) {
+    }
+
+    vector<string> consultas(40);
+    vector<vector<Candidato>> esperados(consultas.size());
+    for (size_t c = 0; c < consultas.size(); c++) {
+        consultas[c] = nome();
+        esperados[c] = indices[c % 2].buscar(consultas[c], 8, 0.1);
+    }
+    vector<vector<Candidato>> obtidos(consultas.size() * 4);
+    Escalonador escalonador(3);
+    escalonador.paraCada(0, obtidos.size(), [&](size_t k) {
+        size_t c = k % consultas.size();
+        obtidos[k] = indices[c % 2].buscar(consultas[c], 8, 0.1);
+    }, 1);
+    for (size_t k = 0; k < obtidos.size(); k++) {
+        const vector<Candidato>& esperado = esperados[k % consultas.size()];
+        bool igual = obtidos[k].size() == esperado.size();
+        for (size_t r = 0; igual && r < esperado.size(); r++) {
+            igual = obtidos[k][r].id == esperado[r].id && obtidos[k][r].similaridade == esperado[r].similaridade;
+        }
+        if (!igual) return "busca simultânea por '" + consultas[k % consultas.size()] + "' divergiu";
+    }
+    return "";
+}
+
+/**
+ * @brief Confere que o histórico recusa desfazer/refazer remoções com descartes
+ * @return Descrição da divergência (vazio = correto)
+ *
+ * Roteiro fixo no sistema otimizado: remoção de camarim com reserva e com
+ * níveis de reposição, desfazer de cadastro que cancela reservas e pedido
+ * arquivado (um a um e em lote). Cada recusa deve deixar o sistema e o
+ * histórico intactos; remoção sem descarte continua reversível.
+ */
+string conferirDescartesHistorico() {
+    SistemaOtimizado s;
+    auto recusa = [](function<void()> passo) {
+        try {
+            passo();
+        } catch (const ValidacaoException&) {
+            return true;
+        }
+        return false;
+    };
+
+    long long inicio = s.historico.marcar();
+    int artista = s.artistas.cadastrar("Banda", 0);
+    int reservado = s.camarins.cadastrar("Sala reservada", 0);
+    int comNiveis = s.camarins.cadastrar("Sala com niveis", 0);
+    int livre = s.camarins.cadastrar("Sala livre", 0);
+    s.agenda.reservar(reservado, artista, 100, 200);
+    s.reposicao.definirNivel(comNiveis, 1, "Agua", 24);
+
+    // Camarim com reserva: desfazer e desfazerAte recusam sem mexer em nada
+    s.camarins.remover(reservado);
+    size_t total = s.historico.totalDesfazer();
+    if (!recusa([&] { s.historico.desfazer(); })) return "desfez remoção de camarim com reservas";
+    if (!recusa([&] { s.historico.desfazerAte(inicio); })) return "desfazerAte passou por remoção bloqueada";
+    if (s.camarins.buscarPorId(reservado) || !s.camarins.buscarPorId(livre) || !s.artistas.buscarPorId(artista)
+        || s.historico.totalDesfazer() != total || s.historico.totalRefazer() != 0) {
+        return "desfazer recusado alterou o sistema ou o histórico";
+    }
+
+    // Camarim com níveis: também recusa (o bloqueio é do comando, não do topo)
+    s.camarins.remover(comNiveis);
+    if (!recusa([&] { s.historico.desfazer(); })) return "desfez remoção de camarim com níveis";
+
+    // Camarim sem reservas nem níveis: continua reversível
+    s.camarins.remover(livre);
+    if (!s.historico.desfazer() || !s.camarins.buscarPorId(livre)) return "não desfez remoção sem descartes";
+    if (!s.historico.refazer() || s.camarins.buscarPorId(livre)) return "não refez remoção sem descartes";
+    if (!s.historico.desfazer()) return "não desfez remoção sem descartes pela segunda vez";
+
+    // Desfazer um cadastro que cancela reservas: o refazer fica bloqueado
+    int novo = s.camarins.cadastrar("Sala nova", 0);
+    s.agenda.reservar(novo, artista, 300, 400);
+    if (!s.historico.desfazer() || s.camarins.buscarPorId(novo)) return "não desfez cadastro de camarim";
+    if (!recusa([&] { s.historico.refazer(); })) return "refez cadastro cujas reservas foram canceladas";
+    if (s.camarins.buscarPorId(novo) || s.historico.totalRefazer() != 1) return "refazer recusado alterou o sistema";
+
+    // Pedido arquivado (um e em lote): desfazer não o duplica
+    for (int lote = 0; lote < 2; lote++) {
+        int pedido = s.pedidos.criar(livre, "Banda");
+        s.pedidos.marcarAtendido(pedido);
+        if (lote == 0) s.arquivo.arquivar(s.pedidos, pedido); else s.arquivo.arquivarAtendidos(s.pedidos);
+        if (!recusa([&] { s.historico.desfazer(); })) return "desfez pedido arquivado";
+        if (s.pedidos.buscarPorId(pedido) || s.arquivo.tamanho() != static_cast<size_t>(lote + 1)) {
+            return "desfazer recusado duplicou o pedido arquivado";
+        }
+    }
+    return "";
+}
+
+/**
+ * @brief Confere os nomes de item que o ArquivoPedidos resolve pelo catálogo
+ * @return Descrição da divergência (vazio = correto)
+ *
+ * No sorteio, poucas linhas chegam ao arquivo antes de o item mudar: o
+ * roteiro fixo renomeia (duas vezes sem arquivar no meio e depois de
+ * arquivar), remove e recria itens, desconecta e reconecta o catálogo.
+ * Cada pedido arquivado continua com os nomes que tinha ao ser arquivado.
+ */
+string conferirNomesArquivados() {
+    GerenciadorItens itens;
+    ArquivoPedidos arquivo(2);  // Declarado depois: sai do catálogo antes de ele ser destruído
+    arquivo.conectar(itens);
+    int agua = itens.cadastrar("Agua", 2.0);
+    int suco = itens.cadastrar("Suco", 5.0);
+    int gelo = itens.cadastrar("Gelo", 1.0);
+    int cha = itens.cadastrar("Cha", 3.0);
+
+    vector<Pedido> esperados;
+    auto arquivar = [&](int id, const vector<pair<int, string>>& linhas) {
+        Pedido pedido(id, 1, "Banda");
+        for (const auto& linha : linhas) pedido.adicionarItem(linha.first, linha.second, 1);
+        arquivo.arquivar(pedido);
+        esperados.push_back(pedido);
+    };
+    auto conferir = [&](const string& passo) -> string {
+        vector<Pedido> lidos = arquivo.listar();
+        for (size_t p = 0; p < esperados.size(); p++) {
+            Pedido buscado;
+            if (p >= lidos.size() || lidos[p].exibir() != esperados[p].exibir()
+                || !arquivo.buscarPorId(esperados[p].getId(), buscado) || buscado.exibir() != esperados[p].exibir()) {
+                return passo + ": pedido " + to_string(esperados[p].getId()) + " saiu com outros nomes";
+            }
+        }
+        return "";
+    };
+
+    // Nomes iguais ao do catálogo (só o bit) e um nome próprio ("Cha verde")
+    arquivar(1, {{agua, "Agua"}, {suco, "Suco"}, {gelo, "Gelo"}, {cha, "Cha verde"}});
+    string erro = conferir("arquivado");
+    if (!erro.empty()) return erro;
+
+    // Duas mudanças sem arquivamento no meio: vale o nome da época do pedido 1
+    itens.atualizar(agua, "Agua mineral", 2.0);
+    itens.atualizar(agua, "Agua com gas", 2.0);
+    arquivar(2, {{agua, "Agua com gas"}, {gelo, "Gelo"}});
+    itens.atualizar(agua, "Agua tonica", 2.0);  // Muda depois do pedido 2 também
+    itens.remover(gelo);
+    erro = conferir("renomeado e removido");
+    if (!erro.empty()) return erro;
+
+    // Recriado com outro nome: os pedidos antigos continuam com "Gelo"
+    itens.restaurar(Item(gelo, "Gelo picado", 1.0));
+    arquivar(3, {{gelo, "Gelo picado"}, {cha, "Cha gelado"}});
+    erro = conferir("recriado");
+    if (!erro.empty()) return erro;
+
+    // Sem catálogo: mudanças não avisadas não alcançam o arquivo
+    arquivo.desconectar();
+    itens.atualizar(suco, "Suco de uva", 5.0);
+    arquivar(4, {{suco, "Suco de uva"}, {cha, "Cha"}});  // Mesmo bloco do 3: buscarPorId pula o 3
+    erro = conferir("desconectado");
+    if (!erro.empty()) return erro;
+
+    // Reconectado: linhas novas voltam a sair do catálogo
+    arquivo.conectar(itens);
+    arquivar(5, {{agua, "Agua gelada"}, {suco, "Suco de uva"}, {cha, "Cha"}});
+    itens.atualizar(cha, "Cha mate", 3.0);
+    return conferir("reconectado");
+}
+
+/**
+ * @brief Confere a remoção de item com pedido atendido, modelo e nível de reposição
+ * @return Descrição da divergência (vazio = correto)
+ *
+ * No sorteio, cascatas sobre itens citados por pedidos atendidos quase não
+ * acontecem: o roteiro fixo cobre a recusa nos dois modos (sem mudar nada),
+ * a cascata completa depois de arquivar o pedido e a recusa em desfazê-la.
+ */
+string conferirRemocaoCascata() {
+    SistemaOtimizado s;
+    int item = s.itens.cadastrar("Agua", 2.0);
+    int camarim = s.camarins.cadastrar("Sala", 0);
+    s.camarins.inserirItem(camarim, item, "Agua", 3);
+    int pendente = s.pedidos.criar(camarim, "Banda");
+    s.pedidos.adicionarItem(pendente, item, "Agua", 2);
+    int atendido = s.pedidos.criar(camarim, "Banda");
+    s.pedidos.adicionarItem(atendido, item, "Agua", 1);
+    s.pedidos.marcarAtendido(atendido);
+    int lista = s.listas.criar("Compras");
+    s.listas.adicionarItem(lista, item, "Agua", 4, 2.0);
+    int modelo = s.modelos.criar("Rider");
+    s.modelos.adicionarItem(modelo, item, "Agua", 6);
+    s.reposicao.definirNivel(camarim, item, "Agua", 24);
+    s.estoque.adicionarItem(item, "Agua", 10);
+
+    ReferenciasItem r = s.referencias.referenciasDe(item);
+    if (r.modelos != vector<int>{modelo} || r.niveis != vector<int>{camarim} || r.total() != 7) {
+        return "referências esperadas: camarim, 2 pedidos, lista, modelo, nível e estoque; obtidas: " + texto(r);
+    }
+
+    // Pedido atendido cita o item: os dois modos recusam sem mudar nada
+    string antes = estadoCompleto(s);
+    long long marcador = s.historico.marcar();
+    for (ModoRemocao modo : {ModoRemocao::BLOQUEAR, ModoRemocao::CASCATA}) {
+        try {
+            s.referencias.removerItem(item, modo);
+            return "removeu item citado por pedido atendido";
+        } catch (const ItemException&) {
+        } catch (const ExcecaoBase& e) {
+            return string("remoção parou no meio: ") + e.what();
+        }
+        if (estadoCompleto(s) != antes || s.historico.marcar() != marcador) {
+            return "remoção recusada alterou o sistema";
+        }
+    }
+
+    // Arquivado o pedido, a cascata retira o item de todos os lugares
+    s.arquivo.arquivar(s.pedidos, atendido);
+    if (!s.referencias.removerItem(item, ModoRemocao::CASCATA)) return "cascata não removeu o item";
+    if (s.referencias.emUso(item) || !s.modelos.buscarPorId(modelo)->getItens().empty()
+        || !s.reposicao.niveisDe(camarim).empty() || s.pedidos.buscarPorId(pendente)->getItens().count(item)
+        || s.camarins.buscarPorId(camarim)->getItens().count(item) || s.estoque.obterQuantidade(item) != 0) {
+        return "cascata deixou referências ao item";
+    }
+
+    // Linhas do modelo e nível não voltam com o histórico: desfazer a remoção é recusado
+    try {
+        s.historico.desfazer();
+        return "desfez cascata que descartou modelo e nível";
+    } catch (const ValidacaoException&) {
+    }
+    return s.itens.buscarPorId(item) ? "desfazer recusado restaurou o item" : "";
+}
+
+/**
+ * @brief Relatório geral montado em sequência a partir da referência
+ */
+template <typename S>
+string relatorioEsperado(const S& s) {
+    string esperado = "=== RELATÓRIO GERAL ===\n";
+    auto secao = [&](const string& titulo, const auto& registros) {
+        esperado += "\n--- " + titulo + " (" + to_string(registros.size()) + ") ---\n";
+        for (const auto& r : registros) esperado += r.exibir() + "\n";
+    };
+    secao("Camarins", s.camarins.listar());
+    secao("Pedidos", s.pedidos.listar());
+    secao("Listas de Compras", s.listas.listar());
+    esperado += "\n--- Estoque (" + to_string(s.estoque.listar().size()) + ") ---\n" + s.estoque.exibir();
+    return esperado;
+}
+
+/**
+ * @brief Sincroniza os módulos da referência (sem observadores) com os gerenciadores
+ * @return Descartes na ordem em que o sistema real os avisa
+ */
+vector<DescarteDependentes> sincronizarModulos(SistemaReferencia& s) {
+    vector<DescarteDependentes> descartes;
+    for (vector<DescarteDependentes> doModulo : {s.agenda.sincronizar(), s.reposicao.sincronizar(),
+                                                 s.fornecedores.sincronizar(), s.referencias.sincronizar(),
+                                                 s.arquivo.sincronizar()}) {
+        descartes.insert(descartes.end(), doModulo.begin(), doModulo.end());
+    }
+    return descartes;
+}
+
+// Entidade criada por uma operação de cadastro (TOTAL_ENTIDADES se não for cadastro)
+Entidade entidadeCriada(TipoOperacao tipo) {
+    switch (tipo) {
+        case ITEM_CADASTRAR: return E_ITEM;
+        case ARTISTA_CADASTRAR: return E_ARTISTA;
+        case CAMARIM_CADASTRAR: return E_CAMARIM;
+        case PEDIDO_CRIAR: return E_PEDIDO;
+        case LISTA_CRIAR: return E_LISTA;
+        case AGENDA_RESERVAR: return E_RESERVA;
+        case MODELO_CRIAR: return E_MODELO;
+        case FORNECEDOR_CADASTRAR: return E_FORNECEDOR;
+        case FORNECEDOR_GERAR_LISTA: return E_LISTA;
+        default: return TOTAL_ENTIDADES;
+    }
+}
+
+/**
+ * @brief Executa uma rodada (sistemas novos) e compara tudo
+ * @return true se nenhuma divergência foi encontrada
+ */
+bool executarRodada(unsigned semente, int operacoes, int intervaloEstado, long long& contador) {
+    string erroAlocacao = conferirAlocacao(semente);
+    if (!erroAlocacao.empty()) {
+        cerr << "\n[FALHA] Alocação de camarins na semente " << semente << ": " << erroAlocacao << endl;
+        return false;
+    }
+    string erroIds = conferirIds(semente);
+    if (!erroIds.empty()) {
+        cerr << "\n[FALHA] Alocador de IDs na semente " << semente << ": " << erroIds << endl;
+        return false;
+    }
+    string erroIdsConcorrentes = conferirIdsConcorrentes(semente);
+    if (!erroIdsConcorrentes.empty()) {
+        cerr << "\n[FALHA] IDs alocados por várias threads na semente " << semente << ": " << erroIdsConcorrentes << endl;
+        return false;
+    }
+    string erroReindexacao = conferirReindexacao();
+    if (!erroReindexacao.empty()) {
+        cerr << "\n[FALHA] Reindexação do repositório: " << erroReindexacao << endl;
+        return false;
+    }
+    string erroEscalonador = conferirEscalonador(semente);
+    if (!erroEscalonador.empty()) {
+        cerr << "\n[FALHA] Escalonador na semente " << semente << ": " << erroEscalonador << endl;
+        return false;
+    }
+    string erroBusca = conferirBuscaConcorrente(semente);
+    if (!erroBusca.empty()) {
+        cerr << "\n[FALHA] Busca simultânea na semente " << semente << ": " << erroBusca << endl;
+        return false;
+    }
+    string erroCascata = conferirRemocaoCascata();
+    if (!erroCascata.empty()) {
+        cerr << "\n[FALHA] Remoção em cascata: " << erroCascata << endl;
+        return false;
+    }
+    string erroDescartes = conferirDescartesHistorico();
+    if (!erroDescartes.empty()) {
+        cerr << "\n[FALHA] Descartes no histórico: " << erroDescartes << endl;
+        return false;
+    }
+    string erroNomes = conferirNomesArquivados();
+    if (!erroNomes.empty()) {
+        cerr << "\n[FALHA] Nomes no arquivo de pedidos: " << erroNomes << endl;
+        return false;
+    }
+
+    SistemaOtimizado otimizado;
+    SistemaReferencia referencia;
+    referencia.historico.acompanhar([&referencia] { return sincronizarModulos(referencia); });
+    GeradorOperacoes gerador(semente, Relogio::agora() + 1);  // Relógio simulado só avança
+    
+    // Painel incremental acompanha o sistema otimizado desde o início
+    PainelBastidores painel;
+    painel.conectar(otimizado.artistas, otimizado.camarins, otimizado.pedidos,
+                    otimizado.listas, otimizado.estoque);
+
+    // Itens mais pedidos: resumo apertado (estimativas) e folgado (exato), baldes de 16 µs
+    const long long largura = 16;
+    ItensMaisPedidos apertado(4, 6, largura);
+    ItensMaisPedidos folgado(2048, 6, largura);
+    apertado.conectar(otimizado.pedidos);
+    folgado.conectar(otimizado.pedidos);
+    vector<pair<long long, int>> eventos;  // (instante, itemId) de cada item adicionado
+
+    // Relatório geral: escalonador de 3 threads (+ a principal) ou sequencial, partes de tamanho variado
+    Escalonador escalonador(3);
+    Escalonador* escalonadorRelatorio = semente % 4 == 0 ? nullptr : &escalonador;
+
+    for (int i = 0; i < operacoes; i++) {
+        Operacao op = gerador.proxima();
+        Relogio::simular(op.instante);  // Os dois sistemas recebem os mesmos carimbos
+        referencia.historico.iniciarOperacao(colecoesAlteradas(op.tipo));
+        string esperado = executar(referencia, op);
+        referencia.historico.concluirOperacao();
+        for (const auto& descarte : sincronizarModulos(referencia)) {
+            referencia.historico.descartar(descarte);  // Bloqueia a remoção que o causou
+        }
+        string obtido = executar(otimizado, op);
+        contador++;
+
+        if (esperado != obtido) {
+            cerr << "\n[FALHA] Divergência na semente " << semente << ", operação #" << i << endl;
+            cerr << "Operação: " << op.descrever() << endl;
+            cerr << "--- referência ---\n" << esperado << endl;
+            cerr << "--- otimizado ---\n" << obtido << endl;
+            return false;
+        }
+
+        // Acompanha IDs gerados para manter as operações sobre entidades existentes
+        Entidade criada = entidadeCriada(op.tipo);
+        if (criada != TOTAL_ENTIDADES && esperado.rfind("EXCECAO", 0) != 0) {
+            gerador.registrarCadastro(criada, stoi(esperado));
+        }
+        if (op.tipo == HISTORICO_MARCAR) {
+            gerador.registrarMarcador(stoll(esperado));
+        }
+        if (op.tipo == PEDIDO_ADICIONAR_ITEM && esperado.rfind("EXCECAO", 0) != 0) {
+            eventos.push_back(make_pair(op.instante, op.outro));
+        }
+        if (op.tipo == MODELO_INSTANCIAR_PEDIDO && esperado.rfind("EXCECAO", 0) != 0) {
+            // Cada linha do modelo conta como um item adicionado ao pedido
+            for (const auto& par : referencia.modelos.buscarPorId(op.id)->getItens()) {
+                eventos.push_back(make_pair(op.instante, par.first));
+            }
+            // Cópia na escrita: o pedido recém-criado usa o MESMO map do modelo
+            const Pedido* criado = otimizado.pedidos.buscarPorId(stoi(esperado));
+            if (&criado->getItens() != &otimizado.modelos.buscarPorId(op.id)->getItens()) {
+                cerr << "\n[FALHA] Pedido criado do modelo copiou as linhas na semente " << semente
+                     << ", operação #" << i << " (" << op.descrever() << ")" << endl;
+                return false;
+            }
+        }
+
+        if ((i + 1) % intervaloEstado == 0 || i + 1 == operacoes) {
+            string erroEsquema = conferirEsquema(otimizado);
+            if (!erroEsquema.empty()) {
+                cerr << "\n[FALHA] Esquema na semente " << semente << ", após a operação #" << i
+                     << ": " << erroEsquema << endl;
+                return false;
+            }
+            if (estadoCompleto(referencia) != estadoCompleto(otimizado)) {
+                cerr << "\n[FALHA] Estado completo divergente na semente " << semente
+                     << ", após a operação #" << i << " (" << op.descrever() << ")" << endl;
+                return false;
+            }
+            string relatorio = gerarRelatorio(otimizado.camarins, otimizado.pedidos, otimizado.listas,
+                                              otimizado.estoque, escalonadorRelatorio, static_cast<size_t>(i % 7));
+            if (relatorio != relatorioEsperado(referencia)) {
+                cerr << "\n[FALHA] Relatório geral divergente na semente " << semente
+                     << ", após a operação #" << i << " (" << op.descrever() << ")" << endl;
+                cerr << "--- esperado ---\n" << relatorioEsperado(referencia) << endl;
+                cerr << "--- obtido ---\n" << relatorio << endl;
+                return false;
+            }
+            IndicadoresPainel esperadoPainel = recalcularPainel(referencia);
+            PainelBastidores reconstruido;  // conectar() sobre o estado atual
+            reconstruido.conectar(otimizado.artistas, otimizado.camarins, otimizado.pedidos,
+                                  otimizado.listas, otimizado.estoque);
+            if (!mesmosIndicadores(painel.obter(), esperadoPainel) ||
+                !mesmosIndicadores(reconstruido.obter(), esperadoPainel)) {
+                cerr << "\n[FALHA] Painel divergente na semente " << semente
+                     << ", após a operação #" << i << " (" << op.descrever() << ")" << endl;
+                cerr << "esperado: " << texto(esperadoPainel) << endl;
+                cerr << "obtido:   " << texto(painel.obter()) << endl;
+                return false;
+            }
+            string erro = conferirFrequentes(apertado, eventos, 4, 6, largura, false);
+            if (erro.empty()) {
+                erro = conferirFrequentes(folgado, eventos, 2048, 6, largura, true);
+            }
+            if (!erro.empty()) {
+                cerr << "\n[FALHA] Itens mais pedidos divergentes na semente " << semente
+                     << ", após a operação #" << i << ": " << erro << endl;
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+    unsigned semente = 1;        // Semente da primeira rodada
+    int rodadas = 500;           // Cada rodada começa com sistemas vazios
+    int operacoes = 2000;        // Operações por rodada
+    int intervaloEstado = 250;   // Comparação do estado completo a cada K operações
+
+    for (int i = 1; i + 1 < argc; i++) {
+        string arg = argv[i];
+        if (arg == "--semente") {
+            semente = static_cast<unsigned>(stoul(argv[++i]));
+        } else if (arg == "--rodadas") {
+            rodadas = stoi(argv[++i]);
+        } else if (arg == "--operacoes") {
+            operacoes = stoi(argv[++i]);
+        } else if (arg == "--intervalo-estado") {
+            intervaloEstado = max(1, stoi(argv[++i]));
+        }
+    }
+
+    cout << "=== Harness diferencial: gerenciadores x referência ===" << endl;
+    cout << "Semente inicial: " << semente << ", rodadas: " << rodadas
+         << ", operações por rodada: " << operacoes << endl;
+
+    long long contador = 0;
+    auto inicio = chrono::steady_clock::now();
+
+    for (int r = 0; r < rodadas; r++) {
+        if (!executarRodada(semente + r, operacoes, intervaloEstado, contador)) {
+            cerr << "Reproduza com: --semente " << semente + r << " --rodadas 1 --operacoes "
+                 << operacoes << endl;
+            return 1;
+        }
+    }
+
+    double segundos = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+    cout << "[OK] " << contador << " operações sem divergência em " << fixed << setprecision(2)
+         << segundos << " s (" << setprecision(0) << (contador / segundos * 60.0)
+         << " operações/minuto)" << endl;
+    return 0;
+}
@@ -0,0 +1,2271 @@
+/**
+ * @file referencia.h
+ * @brief Implementações de referência (lineares) dos gerenciadores
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ *
+ * Cópia deliberadamente simples dos gerenciadores originais: um vector,
+ * proximoId, busca linear e remove_if. Serve de ORÁCULO para o harness
+ * diferencial (fuzz_gerenciadores.cpp): toda versão otimizada (índices,
+ * novo armazenamento) deve produzir exatamente os mesmos resultados,
+ * exceções e saídas de exibir() que estas classes.
+ *
+ * Consultas (consultar) usam sempre a varredura completa, sem índices: é
+ * o oráculo do planejador dos gerenciadores reais.
+ *
+ * NÃO otimize este arquivo: a simplicidade é o que o torna confiável.
+ */
+
+#ifndef REFERENCIA_H
+#define REFERENCIA_H
+
+#include <string>
+#include <vector>
+#include <map>
+#include <set>
+#include <algorithm>
+#include <sstream>
+#include <iomanip>
+#include <functional>
+#include <memory>
+#include <cstdio>
+#include <cstring>
+
+#include "item.h"
+#include "artista.h"
+#include "camarim.h"
+#include "pedido.h"
+#include "listacompras.h"
+#include "excecoes.h"
+#include "consulta.h"
+#include "estoque.h"
+#include "relogio.h"
+#include "referencias.h"  // ReferenciasItem, ModoRemocao
+#include "agenda.h"       // Reserva
+#include "reposicao.h"    // TransferenciaReposicao, PlanoReposicao
+#include "reconciliacao.h" // LinhaReconciliacao, ResultadoReconciliacao
+#include "leitor.h"        // ResumoLeitura
+#include "fornecedores.h"  // OfertaFornecedor, CotacaoCompra, DivisaoCompras
+#include "visao.h"         // VisaoCamarim, ConteudoCamarim
+
+using namespace std;
+
+namespace referencia {
+
+/**
+ * @brief Remove de um vector o elemento com o ID informado (padrão remove-erase)
+ * @return true se algum elemento foi removido
+ */
+template <typename T>
+bool removerPorId(vector<T>& elementos, int id) {
+    auto it = remove_if(elementos.begin(), elementos.end(),
+                        [id](const T& e) { return e.getId() == id; });
+    if (it == elementos.end()) {
+        return false;
+    }
+    elementos.erase(it, elementos.end());
+    return true;
+}
+
+/**
+ * @brief Busca linear por ID em um vector
+ * @return Ponteiro para o elemento ou nullptr
+ */
+template <typename T>
+T* buscarPorId(vector<T>& elementos, int id) {
+    for (auto& e : elementos) {
+        if (e.getId() == id) {
+            return &e;
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * @brief Substitui o elemento de mesmo ID ou o insere na posição do seu ID
+ * @return true se o elemento já existia
+ */
+template <typename T>
+bool restaurarPorId(vector<T>& elementos, const T& estado, int& proximoId) {
+    T* existente = buscarPorId(elementos, estado.getId());
+    if (existente != nullptr) {
+        *existente = estado;
+        return true;
+    }
+    auto pos = elementos.begin();
+    while (pos != elementos.end() && pos->getId() < estado.getId()) {
+        ++pos;
+    }
+    elementos.insert(pos, estado);
+    proximoId = max(proximoId, estado.getId() + 1);
+    return false;
+}
+
+// ==================== Catálogo de Itens ====================
+
+class GerenciadorItens {
+private:
+    vector<Item> itens;
+    int proximoId = 1;
+    bool congelado = false;  // Só o estado: a busca é sempre a varredura
+
+public:
+    int cadastrar(const string& nome, double preco) {
+        if (nome.empty()) {
+            throw ValidacaoException("Nome do item não pode ser vazio");
+        }
+        if (preco < 0) {
+            throw ValidacaoException("Preço do item não pode ser negativo");
+        }
+        if (buscarPorNome(nome) != nullptr) {
+            throw ItemException("Item já existe com este nome: " + nome);
+        }
+        congelado = false;
+        itens.push_back(Item(proximoId, nome, preco));
+        return proximoId++;
+    }
+
+    Item* buscarPorId(int id) { return referencia::buscarPorId(itens, id); }
+
+    Item* buscarPorNome(const string& nome) {
+        for (auto& item : itens) {
+            if (item.getNome() == nome) {
+                return &item;
+            }
+        }
+        return nullptr;
+    }
+
+    bool remover(int id) {
+        if (!removerPorId(itens, id)) {
+            return false;
+        }
+        congelado = false;
+        return true;
+    }
+
+    vector<Item> listar() const { return itens; }
+
+    ResultadoConsulta<Item> consultar(const Consulta& consulta) const {
+        consulta.validar<Item>();
+        return consulta.executar(itens, nullptr, "varredura");
+    }
+
+    bool atualizar(int id, const string& nome, double preco) {
+        Item* item = buscarPorId(id);
+        if (item == nullptr) {
+            throw ItemException("Item com ID " + to_string(id) + " não encontrado");
+        }
+        Item* itemComNome = buscarPorNome(nome);
+        if (itemComNome != nullptr && itemComNome->getId() != id) {
+            throw ItemException("Já existe outro item com este nome: " + nome);
+        }
+        congelado = false;
+        item->setNome(nome);
+        item->setPreco(preco);
+        return true;
+    }
+
+    Item* buscarPorCodigo(const string& codigo) {
+        for (auto& item : itens) {
+            if (!codigo.empty() && item.getCodigoBarras() == codigo) {
+                return &item;
+            }
+        }
+        return nullptr;
+    }
+
+    void definirCodigoBarras(int id, const string& codigo) {
+        Item* item = buscarPorId(id);
+        if (item == nullptr) {
+            throw ItemException("Item com ID " + to_string(id) + " não encontrado");
+        }
+        Item copia = *item;
+        copia.setCodigoBarras(codigo);  // Lança ValidacaoException se inválido
+        Item* dono = buscarPorCodigo(codigo);
+        if (dono != nullptr && dono->getId() != id) {
+            throw ItemException("Código de barras já usado pelo item " + to_string(dono->getId()));
+        }
+        if (item->getCodigoBarras() != codigo) {
+            congelado = false;
+        }
+        *item = copia;
+    }
+
+    void restaurar(const Item& estado) {
+        Item* itemComNome = buscarPorNome(estado.getNome());
+        if (itemComNome != nullptr && itemComNome->getId() != estado.getId()) {
+            throw ItemException("Já existe outro item com este nome: " + estado.getNome());
+        }
+        Item* dono = buscarPorCodigo(estado.getCodigoBarras());
+        if (dono != nullptr && dono->getId() != estado.getId()) {
+            throw ItemException("Código de barras já usado pelo item " + to_string(dono->getId()));
+        }
+        congelado = false;
+        restaurarPorId(itens, estado, proximoId);
+    }
+
+    void congelar() { congelado = true; }
+
+    bool estaCongelado() const { return congelado; }
+
+    const Item* buscarPorNomeNormalizado(const string& nome) const {
+        for (const auto& item : itens) {
+            if (normalizarNome(item.getNome()) == normalizarNome(nome)) {
+                return &item;
+            }
+        }
+        return nullptr;
+    }
+};
+
+// ==================== Artistas ====================
+
+class GerenciadorArtistas {
+private:
+    vector<Artista> artistas;
+    int proximoId = 1;
+
+public:
+    int cadastrar(const string& nome, int camarimId) {
+        if (nome.empty()) {
+            throw ValidacaoException("Nome do artista não pode ser vazio");
+        }
+        if (camarimId < 0) {
+            throw ValidacaoException("ID de camarim inválido");
+        }
+        artistas.push_back(Artista(proximoId, nome, camarimId));
+        return proximoId++;
+    }
+
+    Artista* buscarPorId(int id) { return referencia::buscarPorId(artistas, id); }
+
+    vector<Artista> buscarPorCamarim(int camarimId) const {
+        vector<Artista> resultado;
+        for (const auto& artista : artistas) {
+            if (artista.getCamarimId() == camarimId) {
+                resultado.push_back(artista);
+            }
+        }
+        return resultado;
+    }
+
+    bool remover(int id) { return removerPorId(artistas, id); }
+
+    vector<Artista> listar() const { return artistas; }
+
+    bool atualizar(int id, const string& nome, int camarimId) {
+        Artista* artista = buscarPorId(id);
+        if (artista == nullptr) {
+            throw ArtistaException("Artista com ID " + to_string(id) + " não encontrado");
+        }
+        artista->setNome(nome);
+        artista->setCamarimId(camarimId);
+        return true;
+    }
+
+    void restaurar(const Artista& estado) { restaurarPorId(artistas, estado, proximoId); }
+};
+
+// ==================== Camarins ====================
+
+class GerenciadorCamarins {
+private:
+    vector<Camarim> camarins;
+    int proximoId = 1;
+
+public:
+    int cadastrar(const string& nome, int artistaId) {
+        if (nome.empty()) {
+            throw ValidacaoException("Nome do camarim não pode ser vazio");
+        }
+        camarins.push_back(Camarim(proximoId, nome, artistaId));
+        registrar(proximoId, TipoAlteracaoCamarim::CRIADO, 0, 0);
+        return proximoId++;
+    }
+
+    Camarim* buscarPorId(int id) { return referencia::buscarPorId(camarins, id); }
+
+    Camarim* buscarPorArtista(int artistaId) {
+        for (auto& camarim : camarins) {
+            if (camarim.getArtistaId() == artistaId) {
+                return &camarim;
+            }
+        }
+        return nullptr;
+    }
+
+    bool remover(int id) {
+        if (!removerPorId(camarins, id)) {
+            return false;
+        }
+        registrar(id, TipoAlteracaoCamarim::REMOVIDO, 0, 0);
+        return true;
+    }
+
+    vector<Camarim> listar() const { return camarins; }
+
+    bool atualizar(int id, const string& nome, int artistaId) {
+        Camarim* camarim = buscarPorId(id);
+        if (camarim == nullptr) {
+            throw CamarimException("Camarim com ID " + to_string(id) + " não encontrado");
+        }
+        camarim->setNome(nome);
+        camarim->setArtistaId(artistaId);
+        registrar(id, TipoAlteracaoCamarim::ATUALIZADO, 0, 0);
+        return true;
+    }
+
+    void inserirItem(int camarimId, int itemId, const string& nomeItem, int quantidade) {
+        exigir(camarimId)->inserirItem(itemId, nomeItem, quantidade);
+        registrar(camarimId, TipoAlteracaoCamarim::ITEM_INSERIDO, itemId, quantidade);
+    }
+
+    bool removerItem(int camarimId, int itemId, int quantidade) {
+        if (!exigir(camarimId)->removerItem(itemId, quantidade)) {
+            return false;
+        }
+        registrar(camarimId, TipoAlteracaoCamarim::ITEM_REMOVIDO, itemId, quantidade);
+        return true;
+    }
+
+    void restaurar(const Camarim& estado) {
+        bool existia = restaurarPorId(camarins, estado, proximoId);
+        registrar(estado.getId(), existia ? TipoAlteracaoCamarim::ATUALIZADO : TipoAlteracaoCamarim::CRIADO, 0, 0);
+    }
+
+    vector<AlteracaoCamarim> alteracoesEntre(long long inicio, long long fim, int camarimId = 0) const {
+        vector<AlteracaoCamarim> resultado;
+        for (const auto& a : alteracoes) {
+            if (a.tempo >= inicio && a.tempo <= fim && (camarimId == 0 || a.camarimId == camarimId)) {
+                resultado.push_back(a);
+            }
+        }
+        return resultado;
+    }
+
+private:
+    vector<AlteracaoCamarim> alteracoes;
+
+    void registrar(int camarimId, TipoAlteracaoCamarim tipo, int itemId, int quantidade) {
+        alteracoes.push_back(AlteracaoCamarim{Relogio::agora(), camarimId, tipo, itemId, quantidade});
+    }
+
+    Camarim* exigir(int id) {
+        Camarim* camarim = buscarPorId(id);
+        if (camarim == nullptr) {
+            throw CamarimException("Camarim com ID " + to_string(id) + " não encontrado");
+        }
+        return camarim;
+    }
+};
+
+// ==================== Pedidos ====================
+
+class GerenciadorPedidos {
+private:
+    vector<Pedido> pedidos;
+    int proximoId = 1;
+
+public:
+    int criar(int camarimId, const string& nomeArtista) {
+        if (camarimId < 0) {
+            throw ValidacaoException("ID do camarim inválido");
+        }
+        if (nomeArtista.empty()) {
+            throw ValidacaoException("Nome do artista não pode ser vazio");
+        }
+        pedidos.push_back(Pedido(proximoId, camarimId, nomeArtista));
+        long long agora = Relogio::agora();
+        pedidos.back().setCriadoEm(agora);
+        pedidos.back().setAtualizadoEm(agora);
+        return proximoId++;
+    }
+
+    Pedido* buscarPorId(int id) { return referencia::buscarPorId(pedidos, id); }
+
+    vector<Pedido> buscarPorCamarim(int camarimId) const {
+        vector<Pedido> resultado;
+        for (const auto& pedido : pedidos) {
+            if (pedido.getCamarimId() == camarimId) {
+                resultado.push_back(pedido);
+            }
+        }
+        return resultado;
+    }
+
+    vector<Pedido> listarPendentes() const {
+        vector<Pedido> pendentes;
+        for (const auto& pedido : pedidos) {
+            if (!pedido.isAtendido()) {
+                pendentes.push_back(pedido);
+            }
+        }
+        return pendentes;
+    }
+
+    bool remover(int id) { return removerPorId(pedidos, id); }
+
+    vector<Pedido> listar() const { return pedidos; }
+
+    ResultadoConsulta<Pedido> consultar(const Consulta& consulta) const {
+        consulta.validar<Pedido>();
+        return consulta.executar(pedidos, nullptr, "varredura");
+    }
+
+    void adicionarItem(int pedidoId, int itemId, const string& nomeItem, int quantidade) {
+        Pedido* pedido = exigir(pedidoId);
+        pedido->adicionarItem(itemId, nomeItem, quantidade);
+        pedido->setAtualizadoEm(Relogio::agora());
+    }
+
+    bool removerItem(int pedidoId, int itemId) {
+        Pedido* pedido = exigir(pedidoId);
+        if (!pedido->removerItem(itemId)) {
+            return false;
+        }
+        pedido->setAtualizadoEm(Relogio::agora());
+        return true;
+    }
+
+    void marcarAtendido(int pedidoId) {
+        Pedido* pedido = exigir(pedidoId);
+        pedido->marcarAtendido();
+        pedido->setAtualizadoEm(Relogio::agora());
+    }
+
+    void restaurar(const Pedido& estado) {
+        restaurarPorId(pedidos, estado, proximoId);
+        buscarPorId(estado.getId())->setAtualizadoEm(Relogio::agora());
+    }
+
+    vector<Pedido> buscarCriadosEntre(long long inicio, long long fim) const {
+        vector<Pedido> resultado;
+        for (const auto& pedido : pedidos) {
+            if (pedido.getCriadoEm() >= inicio && pedido.getCriadoEm() <= fim) {
+                resultado.push_back(pedido);
+            }
+        }
+        return resultado;
+    }
+
+    vector<Pedido> buscarAtualizadosEntre(long long inicio, long long fim) const {
+        vector<Pedido> resultado;
+        for (const auto& pedido : pedidos) {
+            if (pedido.getAtualizadoEm() >= inicio && pedido.getAtualizadoEm() <= fim) {
+                resultado.push_back(pedido);
+            }
+        }
+        // Ordem de alteração; stable_sort mantém o menor ID primeiro nos empates
+        stable_sort(resultado.begin(), resultado.end(), [](const Pedido& a, const Pedido& b) {
+            return a.getAtualizadoEm() < b.getAtualizadoEm();
+        });
+        return resultado;
+    }
+
+private:
+    Pedido* exigir(int id) {
+        Pedido* pedido = buscarPorId(id);
+        if (pedido == nullptr) {
+            throw PedidoException("Pedido com ID " + to_string(id) + " não encontrado");
+        }
+        return pedido;
+    }
+};
+
+// ==================== Listas de Compras ====================
+
+class GerenciadorListaCompras {
+private:
+    vector<ListaCompras> listas;
+    int proximoId = 1;
+
+public:
+    int criar(const string& descricao) {
+        if (descricao.empty()) {
+            throw ValidacaoException("Descrição não pode ser vazia");
+        }
+        listas.push_back(ListaCompras(proximoId, descricao));
+        return proximoId++;
+    }
+
+    int criarComItens(const string& descricao, const vector<ItemCompra>& itens) {
+        if (descricao.empty()) {
+            throw ValidacaoException("Descrição não pode ser vazia");
+        }
+        ListaCompras lista(0, descricao);
+        for (const auto& i : itens) lista.adicionarItem(i.itemId, i.nomeItem, i.quantidade, i.preco);
+        lista.setId(proximoId);
+        listas.push_back(lista);
+        return proximoId++;
+    }
+
+    ListaCompras* buscarPorId(int id) { return referencia::buscarPorId(listas, id); }
+
+    bool remover(int id) { return removerPorId(listas, id); }
+
+    vector<ListaCompras> listar() const { return listas; }
+
+    void adicionarItem(int listaId, int itemId, const string& nomeItem, int quantidade, double preco) {
+        exigir(listaId)->adicionarItem(itemId, nomeItem, quantidade, preco);
+    }
+
+    bool removerItem(int listaId, int itemId) { return exigir(listaId)->removerItem(itemId); }
+
+    void atualizarQuantidade(int listaId, int itemId, int quantidade) {
+        exigir(listaId)->atualizarQuantidade(itemId, quantidade);
+    }
+
+    void limpar(int listaId) { exigir(listaId)->limpar(); }
+
+    void restaurar(const ListaCompras& estado) { restaurarPorId(listas, estado, proximoId); }
+
+private:
+    ListaCompras* exigir(int id) {
+        ListaCompras* lista = buscarPorId(id);
+        if (lista == nullptr) {
+            throw ListaComprasException("Lista com ID " + to_string(id) + " não encontrada");
+        }
+        return lista;
+    }
+};
+
+// ==================== Estoque ====================
+
+class Estoque {
+private:
+    map<int, ItemEstoque> itens;
+    map<int, int> minimos;
+    vector<MovimentoEstoque> movimentos;
+    map<int, vector<LoteEstoque>> lotes;  // Lotes por item, em ordem de entrada (sem heap)
+    int proximoLote = 1;
+
+    static bool saiAntes(const LoteEstoque& a, const LoteEstoque& b) {
+        return a.validade != b.validade ? a.validade < b.validade : a.numero < b.numero;
+    }
+
+    void receber(int itemId, int quantidade, long long validade) {
+        if (quantidade == 0) return;
+        for (LoteEstoque& l : lotes[itemId]) {
+            if (l.validade == validade) { l.quantidade += quantidade; return; }
+        }
+        lotes[itemId].push_back(LoteEstoque{itemId, proximoLote++, quantidade, validade});
+    }
+
+    // Varre o item inteiro atrás do lote que sai primeiro, uma unidade de lote por vez
+    void consumir(int itemId, int quantidade) {
+        while (quantidade > 0) {
+            vector<LoteEstoque>& v = lotes[itemId];
+            auto primeiro = min_element(v.begin(), v.end(), saiAntes);
+            int retirada = min(quantidade, primeiro->quantidade);
+            primeiro->quantidade -= retirada;
+            quantidade -= retirada;
+            if (primeiro->quantidade == 0) v.erase(primeiro);
+        }
+        if (lotes.count(itemId) && lotes[itemId].empty()) lotes.erase(itemId);
+    }
+
+    void ajustar(int itemId, int antes, int depois) {
+        if (depois < antes) consumir(itemId, antes - depois);
+        else receber(itemId, depois - antes, LoteEstoque::SEM_VALIDADE);
+    }
+
+    void registrar(int itemId, const string& nomeItem, int quantidadeAntes) {
+        if (obterQuantidade(itemId) != quantidadeAntes) {
+            movimentos.push_back(MovimentoEstoque{Relogio::agora(), itemId, nomeItem,
+                                                  quantidadeAntes, obterQuantidade(itemId)});
+        }
+    }
+
+public:
+    void adicionarItem(int itemId, const string& nomeItem, int quantidade) {
+        adicionarLote(itemId, nomeItem, quantidade, LoteEstoque::SEM_VALIDADE);
+    }
+
+    void adicionarLote(int itemId, const string& nomeItem, int quantidade, long long validade) {
+        if (itemId < 0) {
+            throw ValidacaoException("ID do item inválido");
+        }
+        if (nomeItem.empty()) {
+            throw ValidacaoException("Nome do item não pode ser vazio");
+        }
+        if (quantidade < 0) {
+            throw ValidacaoException("Quantidade não pode ser negativa");
+        }
+        int antes = obterQuantidade(itemId);
+        if (itens.find(itemId) != itens.end()) {
+            itens[itemId].quantidade += quantidade;
+        } else {
+            itens[itemId] = ItemEstoque(itemId, nomeItem, quantidade);
+        }
+        receber(itemId, quantidade, validade);
+        registrar(itemId, itens[itemId].nomeItem, antes);
+    }
+
+    bool removerItem(int itemId, int quantidade) {
+        if (itens.find(itemId) == itens.end()) {
+            throw EstoqueException("Item não encontrado no estoque (ID: " + to_string(itemId) + ")");
+        }
+        if (quantidade < 0) {
+            throw ValidacaoException("Quantidade não pode ser negativa");
+        }
+        if (itens[itemId].quantidade < quantidade) {
+            throw EstoqueInsuficienteException(
+                "Quantidade insuficiente. Disponível: " + to_string(itens[itemId].quantidade) +
+                ", Solicitado: " + to_string(quantidade));
+        }
+        int antes = itens[itemId].quantidade;
+        string nome = itens[itemId].nomeItem;
+        consumir(itemId, quantidade);
+        itens[itemId].quantidade -= quantidade;
+        if (itens[itemId].quantidade == 0) {
+            itens.erase(itemId);
+        }
+        registrar(itemId, nome, antes);
+        return true;
+    }
+
+    bool verificarDisponibilidade(int itemId, int quantidade) const {
+        auto it = itens.find(itemId);
+        return it != itens.end() && it->second.quantidade >= quantidade;
+    }
+
+    int obterQuantidade(int itemId) const {
+        auto it = itens.find(itemId);
+        return it == itens.end() ? 0 : it->second.quantidade;
+    }
+
+    vector<ItemEstoque> listar() const {
+        vector<ItemEstoque> lista;
+        for (const auto& par : itens) {
+            lista.push_back(par.second);
+        }
+        return lista;
+    }
+
+    ResultadoConsulta<ItemEstoque> consultar(const Consulta& consulta) const {
+        consulta.validar<ItemEstoque>();
+        return consulta.executar(listar(), nullptr, "varredura");
+    }
+
+    void atualizarQuantidade(int itemId, int novaQuantidade) {
+        if (itens.find(itemId) == itens.end()) {
+            throw EstoqueException("Item não encontrado no estoque");
+        }
+        if (novaQuantidade < 0) {
+            throw ValidacaoException("Quantidade não pode ser negativa");
+        }
+        int antes = itens[itemId].quantidade;
+        string nome = itens[itemId].nomeItem;
+        ajustar(itemId, antes, novaQuantidade);
+        itens[itemId].quantidade = novaQuantidade;
+        if (novaQuantidade == 0) {
+            itens.erase(itemId);
+        }
+        registrar(itemId, nome, antes);
+    }
+
+    vector<MovimentoEstoque> movimentosEntre(long long inicio, long long fim) const {
+        vector<MovimentoEstoque> resultado;
+        for (const auto& m : movimentos) {
+            if (m.tempo >= inicio && m.tempo <= fim) {
+                resultado.push_back(m);
+            }
+        }
+        return resultado;
+    }
+
+    void definirMinimo(int itemId, int minimo) {
+        if (itemId < 0) {
+            throw ValidacaoException("ID do item inválido");
+        }
+        if (minimo < 0) {
+            throw ValidacaoException("Estoque mínimo não pode ser negativo");
+        }
+        if (minimo == 0) {
+            minimos.erase(itemId);
+        } else {
+            minimos[itemId] = minimo;
+        }
+    }
+
+    int obterMinimo(int itemId) const {
+        auto it = minimos.find(itemId);
+        return it == minimos.end() ? 0 : it->second;
+    }
+
+    map<int, int> listarMinimos() const { return minimos; }
+
+    void restaurar(int itemId, const string& nomeItem, int quantidade, int minimo) {
+        if (quantidade < 0 || minimo < 0) {
+            throw ValidacaoException("Quantidade não pode ser negativa");
+        }
+        int antes = obterQuantidade(itemId);
+        auto it = itens.find(itemId);
+        string nome = it == itens.end() ? nomeItem : it->second.nomeItem;
+        ajustar(itemId, antes, quantidade);
+        if (quantidade == 0) {
+            itens.erase(itemId);
+        } else if (it != itens.end()) {
+            it->second.quantidade = quantidade;
+        } else {
+            itens[itemId] = ItemEstoque(itemId, nomeItem, quantidade);
+        }
+        if (minimo == 0) {
+            minimos.erase(itemId);
+        } else {
+            minimos[itemId] = minimo;
+        }
+        registrar(itemId, nome, antes);
+    }
+
+    void restaurarLotes(int itemId, const string& nomeItem, const vector<LoteEstoque>& novos, int minimo) {
+        int total = 0;
+        for (const LoteEstoque& l : novos) total += l.quantidade;
+        int antes = obterQuantidade(itemId);
+        auto it = itens.find(itemId);
+        string nome = it == itens.end() ? nomeItem : it->second.nomeItem;
+        lotes.erase(itemId);
+        for (const LoteEstoque& l : novos) {
+            if (l.quantidade > 0) lotes[itemId].push_back(l);
+            proximoLote = max(proximoLote, l.numero + 1);
+        }
+        if (total == 0) {
+            itens.erase(itemId);
+        } else if (it != itens.end()) {
+            it->second.quantidade = total;
+        } else {
+            itens[itemId] = ItemEstoque(itemId, nomeItem, total);
+        }
+        if (minimo == 0) {
+            minimos.erase(itemId);
+        } else {
+            minimos[itemId] = minimo;
+        }
+        registrar(itemId, nome, antes);
+    }
+
+    vector<LoteEstoque> listarLotes(int itemId) const {
+        auto it = lotes.find(itemId);
+        vector<LoteEstoque> v = it == lotes.end() ? vector<LoteEstoque>() : it->second;
+        sort(v.begin(), v.end(), saiAntes);
+        return v;
+    }
+
+    map<int, vector<LoteEstoque>> todosLotes() const {
+        map<int, vector<LoteEstoque>> todos;
+        for (const auto& par : lotes) todos[par.first] = listarLotes(par.first);
+        return todos;
+    }
+
+    vector<LoteEstoque> lotesVencendo(long long inicio, long long fim) const {
+        vector<LoteEstoque> v;
+        for (const auto& par : lotes) {
+            for (const LoteEstoque& l : par.second) {
+                if (l.validade != LoteEstoque::SEM_VALIDADE && l.validade >= inicio && l.validade <= fim) {
+                    v.push_back(l);
+                }
+            }
+        }
+        sort(v.begin(), v.end(), saiAntes);
+        return v;
+    }
+
+    string exibir() const {
+        stringstream ss;
+        ss << "=== ESTOQUE ===" << endl;
+        if (itens.empty()) {
+            ss << "Estoque vazio" << endl;
+        } else {
+            ss << left << setw(5) << "ID" << setw(30) << "Nome"
+               << setw(10) << "Quantidade" << endl;
+            ss << string(45, '-') << endl;
+            for (const auto& par : itens) {
+                const ItemEstoque& item = par.second;
+                ss << left << setw(5) << item.itemId
+                   << setw(30) << item.nomeItem
+                   << setw(10) << item.quantidade << endl;
+            }
+        }
+        return ss.str();
+    }
+};
+
+// ==================== Histórico (desfazer/refazer) ====================
+
+// Coleção afetada por uma operação (o histórico fotografa só ela)
+enum class Colecao { ITENS, ARTISTAS, CAMARINS, PEDIDOS, LISTAS, ESTOQUE };
+
+// Igualdade campo a campo (avisos sem mudança real não viram comando)
+inline bool igual(const Item& a, const Item& b) {
+    return a.getNome() == b.getNome() && a.getPreco() == b.getPreco()
+        && a.getCodigoBarras() == b.getCodigoBarras();
+}
+inline bool igual(const Artista& a, const Artista& b) {
+    return a.getNome() == b.getNome() && a.getCamarimId() == b.getCamarimId();
+}
+inline bool igual(const Camarim& a, const Camarim& b) {
+    if (a.getNome() != b.getNome() || a.getArtistaId() != b.getArtistaId()) return false;
+    vector<string> x, y;
+    for (const auto& p : a.getItens()) x.push_back(to_string(p.first) + p.second.nomeItem + "#" + to_string(p.second.quantidade));
+    for (const auto& p : b.getItens()) y.push_back(to_string(p.first) + p.second.nomeItem + "#" + to_string(p.second.quantidade));
+    return x == y;
+}
+inline bool igual(const Pedido& a, const Pedido& b) {
+    if (a.getCamarimId() != b.getCamarimId() || a.getNomeArtista() != b.getNomeArtista() ||
+        a.isAtendido() != b.isAtendido() || a.getCriadoEm() != b.getCriadoEm() ||
+        a.getAtualizadoEm() != b.getAtualizadoEm()) return false;
+    vector<string> x, y;
+    for (const auto& p : a.getItens()) x.push_back(to_string(p.first) + p.second.nomeItem + "#" + to_string(p.second.quantidade));
+    for (const auto& p : b.getItens()) y.push_back(to_string(p.first) + p.second.nomeItem + "#" + to_string(p.second.quantidade));
+    return x == y;
+}
+inline bool igual(const ListaCompras& a, const ListaCompras& b) {
+    if (a.getDescricao() != b.getDescricao() || a.getItens().size() != b.getItens().size()) return false;
+    auto j = b.getItens().begin();
+    for (const auto& p : a.getItens()) {
+        const ItemCompra& x = p.second;
+        const ItemCompra& y = (j++)->second;
+        if (x.itemId != y.itemId || x.nomeItem != y.nomeItem || x.quantidade != y.quantidade ||
+            x.preco != y.preco || x.subtotal != y.subtotal) return false;
+    }
+    return true;
+}
+
+inline string rotulo(const Item& i) { return "item " + to_string(i.getId()) + " (" + i.getNome() + ")"; }
+inline string rotulo(const Artista& a) { return "artista " + to_string(a.getId()) + " (" + a.getNome() + ")"; }
+inline string rotulo(const Camarim& c) { return "camarim " + to_string(c.getId()) + " (" + c.getNome() + ")"; }
+inline string rotulo(const Pedido& p) { return "pedido " + to_string(p.getId()) + " (" + p.getNomeArtista() + ")"; }
+inline string rotulo(const ListaCompras& l) { return "lista " + to_string(l.getId()) + " (" + l.getDescricao() + ")"; }
+
+inline TipoEntidade tipoDe(const Item*) { return TipoEntidade::ITEM; }
+inline TipoEntidade tipoDe(const Artista*) { return TipoEntidade::ARTISTA; }
+inline TipoEntidade tipoDe(const Camarim*) { return TipoEntidade::CAMARIM; }
+inline TipoEntidade tipoDe(const Pedido*) { return TipoEntidade::PEDIDO; }
+inline TipoEntidade tipoDe(const ListaCompras*) { return TipoEntidade::LISTA; }
+
+/**
+ * Oráculo do Historico: em vez de receber avisos, fotografa a coleção
+ * afetada antes da operação (iniciarOperacao) e compara por ID depois
+ * (concluirOperacao). Cada diferença vira um comando.
+ *
+ * Descartes dos módulos: os da operação chegam por descartar() (bloqueiam
+ * o comando que removeu a entidade); os de um desfazer/refazer vêm da
+ * função de acompanhar(), chamada depois de cada passo, e bloqueiam o
+ * comando aplicado.
+ */
+class Historico {
+private:
+    struct Comando {
+        long long numero = 0;
+        string descricao;
+        function<void()> desfazer;
+        function<void()> refazer;
+        bool entidade = false;  // Cadastro/remoção/alteração de entidade (não estoque)
+        TipoEntidade tipo = TipoEntidade::ITEM;
+        int id = 0;
+        bool remocao = false;
+        string bloqueio;
+
+        void bloquear(const string& motivo) { bloqueio += (bloqueio.empty() ? "" : "; ") + motivo; }
+    };
+
+    vector<Comando> paraDesfazer;
+    vector<Comando> paraRefazer;
+    size_t capacidade;
+    long long proximoNumero = 0;
+    long long ultimoDescartado = -1;
+    long long inicioOperacao = 0;  // Número do primeiro comando da operação atual
+    function<vector<DescarteDependentes>()> sincronizarModulos;
+
+    GerenciadorItens* itens = nullptr;
+    GerenciadorArtistas* artistas = nullptr;
+    GerenciadorCamarins* camarins = nullptr;
+    GerenciadorPedidos* pedidos = nullptr;
+    GerenciadorListaCompras* listas = nullptr;
+    Estoque* estoque = nullptr;
+
+    // Fotografia das coleções afetadas (comparadas na ordem informada)
+    vector<Colecao> colecoes;
+    vector<Item> itensAntes;
+    vector<Artista> artistasAntes;
+    vector<Camarim> camarinsAntes;
+    vector<Pedido> pedidosAntes;
+    vector<ListaCompras> listasAntes;
+    vector<ItemEstoque> estoqueAntes;
+    map<int, int> minimosAntes;
+    map<int, vector<LoteEstoque>> lotesAntes;
+
+    Comando& adicionar(const string& descricao, function<void()> desfazer, function<void()> refazer) {
+        paraRefazer.clear();
+        if (paraDesfazer.size() >= capacidade) {
+            ultimoDescartado = paraDesfazer.front().numero;
+            paraDesfazer.erase(paraDesfazer.begin());
+        }
+        Comando comando;
+        comando.numero = proximoNumero++;
+        comando.descricao = descricao;
+        comando.desfazer = desfazer;
+        comando.refazer = refazer;
+        paraDesfazer.push_back(comando);
+        return paraDesfazer.back();
+    }
+
+    static void exigirReversivel(const Comando& c, bool desfazendo) {
+        if (!c.bloqueio.empty()) {
+            throw ValidacaoException(string("Não é possível ") + (desfazendo ? "desfazer" : "refazer")
+                                     + " \"" + c.descricao + "\": " + c.bloqueio);
+        }
+    }
+
+    // Aplica e atribui ao comando tudo o que os módulos descartarem em seguida
+    void aplicar(Comando& c, bool desfazendo) {
+        exigirReversivel(c, desfazendo);
+        (desfazendo ? c.desfazer : c.refazer)();
+        if (sincronizarModulos) {
+            for (const auto& d : sincronizarModulos()) c.bloquear(d.motivo);
+        }
+    }
+
+    template <typename T, typename G>
+    void comparar(const vector<T>& antes, const vector<T>& depois, G* gerenciador) {
+        map<int, shared_ptr<T>> a, d;
+        for (const T& e : antes) a[e.getId()] = make_shared<T>(e);
+        for (const T& e : depois) d[e.getId()] = make_shared<T>(e);
+        map<int, bool> ids;
+        for (const auto& p : a) ids[p.first] = true;
+        for (const auto& p : d) ids[p.first] = true;
+
+        for (const auto& par : ids) {
+            int id = par.first;
+            shared_ptr<T> x = a.count(id) ? a[id] : nullptr;
+            shared_ptr<T> y = d.count(id) ? d[id] : nullptr;
+            if (x && y && igual(*x, *y)) {
+                continue;
+            }
+            string descricao = !x ? "Cadastro de " + rotulo(*y)
+                             : !y ? "Remoção de " + rotulo(*x)
+                                  : "Alteração de " + rotulo(*y);
+            auto colocar = [gerenciador, id](shared_ptr<T> estado) {
+                if (estado) gerenciador->restaurar(*estado); else gerenciador->remover(id);
+            };
+            Comando& c = adicionar(descricao, [colocar, x] { colocar(x); }, [colocar, y] { colocar(y); });
+            c.entidade = true;
+            c.tipo = tipoDe(static_cast<const T*>(nullptr));
+            c.id = id;
+            c.remocao = !y;
+        }
+    }
+
+    void compararEstoque() {
+        // itemId -> (quantidade, mínimo) e nomes, antes e depois
+        map<int, pair<int, int>> a, d;
+        map<int, string> nomeAntes, nomeDepois;
+        for (const auto& e : estoqueAntes) { a[e.itemId].first = e.quantidade; nomeAntes[e.itemId] = e.nomeItem; }
+        for (const auto& m : minimosAntes) a[m.first].second = m.second;
+        for (const auto& e : estoque->listar()) { d[e.itemId].first = e.quantidade; nomeDepois[e.itemId] = e.nomeItem; }
+        for (const auto& m : estoque->listarMinimos()) d[m.first].second = m.second;
+
+        map<int, bool> ids;
+        for (const auto& p : a) ids[p.first] = true;
+        for (const auto& p : d) ids[p.first] = true;
+        for (const auto& par : ids) {
+            int id = par.first;
+            pair<int, int> x = a.count(id) ? a[id] : make_pair(0, 0);
+            pair<int, int> y = d.count(id) ? d[id] : make_pair(0, 0);
+            if (x == y) {
+                continue;
+            }
+            string nome = nomeDepois.count(id) ? nomeDepois[id] : nomeAntes.count(id) ? nomeAntes[id] : "";
+            string descricao = "Estoque do item " + to_string(id) + ": quantidade " + to_string(x.first)
+                               + " -> " + to_string(y.first) + ", mínimo " + to_string(x.second)
+                               + " -> " + to_string(y.second);
+            Estoque* e = estoque;
+            vector<LoteEstoque> lx = lotesAntes.count(id) ? lotesAntes[id] : vector<LoteEstoque>();
+            vector<LoteEstoque> ly = estoque->listarLotes(id);
+            adicionar(descricao, [e, id, nome, x, lx] { e->restaurarLotes(id, nome, lx, x.second); },
+                                 [e, id, nome, y, ly] { e->restaurarLotes(id, nome, ly, y.second); });
+        }
+    }
+
+public:
+    explicit Historico(size_t capacidade = 100) : capacidade(capacidade) {}
+
+    void conectar(GerenciadorItens& i, GerenciadorArtistas& a, GerenciadorCamarins& c,
+                  GerenciadorPedidos& p, GerenciadorListaCompras& l, Estoque& e) {
+        itens = &i; artistas = &a; camarins = &c; pedidos = &p; listas = &l; estoque = &e;
+    }
+
+    // Função que sincroniza os módulos e devolve o que descartaram
+    void acompanhar(function<vector<DescarteDependentes>()> sincronizar) { sincronizarModulos = sincronizar; }
+
+    // Descarte causado pela operação: bloqueia o comando dela que removeu a entidade
+    void descartar(const DescarteDependentes& d) {
+        for (auto it = paraDesfazer.rbegin(); it != paraDesfazer.rend() && it->numero >= inicioOperacao; ++it) {
+            if (it->entidade && it->remocao && it->tipo == d.tipo && it->id == d.id) {
+                it->bloquear(d.motivo);
+                return;
+            }
+        }
+    }
+
+    void iniciarOperacao(const vector<Colecao>& afetadas) {
+        inicioOperacao = proximoNumero;
+        colecoes = afetadas;
+        for (Colecao c : colecoes) fotografar(c);
+    }
+
+    void concluirOperacao() {
+        for (Colecao c : colecoes) comparar(c);
+    }
+
+    void fotografar(Colecao c) {
+        switch (c) {
+            case Colecao::ITENS: itensAntes = itens->listar(); break;
+            case Colecao::ARTISTAS: artistasAntes = artistas->listar(); break;
+            case Colecao::CAMARINS: camarinsAntes = camarins->listar(); break;
+            case Colecao::PEDIDOS: pedidosAntes = pedidos->listar(); break;
+            case Colecao::LISTAS: listasAntes = listas->listar(); break;
+            case Colecao::ESTOQUE:
+                estoqueAntes = estoque->listar();
+                minimosAntes = estoque->listarMinimos();
+                lotesAntes = estoque->todosLotes();
+                break;
+        }
+    }
+
+    void comparar(Colecao c) {
+        switch (c) {
+            case Colecao::ITENS: comparar(itensAntes, itens->listar(), itens); break;
+            case Colecao::ARTISTAS: comparar(artistasAntes, artistas->listar(), artistas); break;
+            case Colecao::CAMARINS: comparar(camarinsAntes, camarins->listar(), camarins); break;
+            case Colecao::PEDIDOS: comparar(pedidosAntes, pedidos->listar(), pedidos); break;
+            case Colecao::LISTAS: comparar(listasAntes, listas->listar(), listas); break;
+            case Colecao::ESTOQUE: compararEstoque(); break;
+        }
+    }
+
+    bool desfazer() {
+        if (paraDesfazer.empty()) {
+            return false;
+        }
+        aplicar(paraDesfazer.back(), true);
+        paraRefazer.push_back(paraDesfazer.back());
+        paraDesfazer.pop_back();
+        return true;
+    }
+
+    bool refazer() {
+        if (paraRefazer.empty()) {
+            return false;
+        }
+        aplicar(paraRefazer.back(), false);
+        paraDesfazer.push_back(paraRefazer.back());
+        paraRefazer.pop_back();
+        return true;
+    }
+
+    string proximoDesfazer() const { return paraDesfazer.empty() ? "" : paraDesfazer.back().descricao; }
+    string proximoRefazer() const { return paraRefazer.empty() ? "" : paraRefazer.back().descricao; }
+    long long marcar() const { return proximoNumero; }
+
+    int desfazerAte(long long marcador) {
+        if (marcador < 0 || marcador > proximoNumero) {
+            throw ValidacaoException("Marcador inválido");
+        }
+        if (marcador <= ultimoDescartado) {
+            throw ValidacaoException("Marcador anterior ao início do histórico");
+        }
+        for (auto it = paraDesfazer.rbegin(); it != paraDesfazer.rend() && it->numero >= marcador; ++it) {
+            exigirReversivel(*it, true);
+        }
+        int desfeitos = 0;
+        while (!paraDesfazer.empty() && paraDesfazer.back().numero >= marcador) {
+            desfazer();
+            desfeitos++;
+        }
+        return desfeitos;
+    }
+
+    vector<string> listar() const {
+        vector<string> descricoes;
+        for (auto it = paraDesfazer.rbegin(); it != paraDesfazer.rend(); ++it) {
+            descricoes.push_back(it->descricao);
+        }
+        return descricoes;
+    }
+
+    size_t totalDesfazer() const { return paraDesfazer.size(); }
+    size_t totalRefazer() const { return paraRefazer.size(); }
+};
+
+// ==================== Agenda de camarins ====================
+
+/**
+ * Oráculo da AgendaCamarins: vetor de reservas com varredura linear.
+ * Sem observadores: sincronizar() descarta reservas de camarins/artistas
+ * removidos, devolve os descartes (como avisarDescarte) e é chamada pelo
+ * harness depois de cada operação e de cada passo do histórico.
+ */
+class AgendaCamarins {
+private:
+    vector<Reserva> reservas;  // Ordem de ID
+    int proximoId = 1;
+    GerenciadorArtistas* artistas = nullptr;
+    GerenciadorCamarins* camarins = nullptr;
+
+    static void validar(long long inicio, long long fim) {
+        if (fim <= inicio) throw ValidacaoException("Fim do período deve ser depois do início");
+    }
+
+    // Entre as reservas sobrepostas, a que começa por último (mesma escolha do sistema real)
+    const Reserva* conflito(bool porCamarim, int id, long long inicio, long long fim) const {
+        const Reserva* escolhida = nullptr;
+        for (const Reserva& r : reservas) {
+            if ((porCamarim ? r.camarimId : r.artistaId) == id && r.sobrepoe(inicio, fim) &&
+                (!escolhida || r.inicio > escolhida->inicio)) {
+                escolhida = &r;
+            }
+        }
+        return escolhida;
+    }
+
+    static void ordenarPorInicio(vector<Reserva>& v) {
+        sort(v.begin(), v.end(), [](const Reserva& a, const Reserva& b) { return a.inicio < b.inicio; });
+    }
+
+public:
+    void conectar(GerenciadorArtistas& a, GerenciadorCamarins& c) { artistas = &a; camarins = &c; }
+
+    vector<DescarteDependentes> sincronizar() {
+        set<int> semCamarim, semArtista;
+        reservas.erase(remove_if(reservas.begin(), reservas.end(), [&](const Reserva& r) {
+            if (!camarins->buscarPorId(r.camarimId)) semCamarim.insert(r.camarimId);
+            else if (!artistas->buscarPorId(r.artistaId)) semArtista.insert(r.artistaId);
+            else return false;
+            return true;
+        }), reservas.end());
+        vector<DescarteDependentes> descartes;
+        for (int id : semCamarim) descartes.push_back({TipoEntidade::CAMARIM, id, "reservas do camarim descartadas"});
+        for (int id : semArtista) descartes.push_back({TipoEntidade::ARTISTA, id, "reservas do artista descartadas"});
+        return descartes;
+    }
+
+    int reservar(int camarimId, int artistaId, long long inicio, long long fim) {
+        validar(inicio, fim);
+        if (!camarins->buscarPorId(camarimId)) {
+            throw CamarimException("Camarim com ID " + to_string(camarimId) + " não encontrado");
+        }
+        if (!artistas->buscarPorId(artistaId)) {
+            throw ArtistaException("Artista com ID " + to_string(artistaId) + " não encontrado");
+        }
+        if (const Reserva* r = conflito(true, camarimId, inicio, fim)) {
+            throw CamarimException("Camarim " + to_string(camarimId) + " já reservado neste horário (reserva "
+                                   + to_string(r->id) + ", artista " + to_string(r->artistaId) + ")");
+        }
+        if (const Reserva* r = conflito(false, artistaId, inicio, fim)) {
+            throw ArtistaException("Artista " + to_string(artistaId) + " já tem reserva neste horário (reserva "
+                                   + to_string(r->id) + ", camarim " + to_string(r->camarimId) + ")");
+        }
+        Reserva r;
+        r.id = proximoId++; r.camarimId = camarimId; r.artistaId = artistaId; r.inicio = inicio; r.fim = fim;
+        reservas.push_back(r);
+        return r.id;
+    }
+
+    bool cancelar(int id) {
+        for (size_t i = 0; i < reservas.size(); i++) {
+            if (reservas[i].id == id) { reservas.erase(reservas.begin() + i); return true; }
+        }
+        return false;
+    }
+
+    const Reserva* buscarPorId(int id) const {
+        for (const Reserva& r : reservas) if (r.id == id) return &r;
+        return nullptr;
+    }
+
+    const Reserva* ocupante(int camarimId, long long instante) const {
+        return conflito(true, camarimId, instante, instante + 1);
+    }
+
+    bool livre(int camarimId, long long inicio, long long fim) const {
+        validar(inicio, fim);
+        return camarins->buscarPorId(camarimId) && !conflito(true, camarimId, inicio, fim);
+    }
+
+    vector<int> camarinsLivres(long long inicio, long long fim) const {
+        validar(inicio, fim);
+        vector<int> livres;
+        for (const Camarim& c : camarins->listar()) {
+            if (!conflito(true, c.getId(), inicio, fim)) livres.push_back(c.getId());
+        }
+        return livres;
+    }
+
+    vector<Reserva> agendaDoCamarim(int camarimId, long long inicio, long long fim) const {
+        validar(inicio, fim);
+        vector<Reserva> v;
+        for (const Reserva& r : reservas) if (r.camarimId == camarimId && r.sobrepoe(inicio, fim)) v.push_back(r);
+        ordenarPorInicio(v);
+        return v;
+    }
+
+    vector<Reserva> agendaDoArtista(int artistaId) const {
+        vector<Reserva> v;
+        for (const Reserva& r : reservas) if (r.artistaId == artistaId) v.push_back(r);
+        ordenarPorInicio(v);
+        return v;
+    }
+
+    vector<Reserva> listar() const { return reservas; }
+};
+
+// ==================== Modelos de rider ====================
+
+/**
+ * Oráculo do ModeloRider: um map simples, sem compartilhamento.
+ */
+struct ModeloRider {
+    int id = 0;
+    string nome;
+    map<int, ItemPedido> itens;
+
+    int getId() const { return id; }
+    string getNome() const { return nome; }
+    const map<int, ItemPedido>& getItens() const { return itens; }
+};
+
+/**
+ * Oráculo do GerenciadorModelos: instanciar = criar e adicionar linha a
+ * linha pelos gerenciadores de referência (cópias independentes).
+ */
+class GerenciadorModelos {
+private:
+    vector<ModeloRider> modelos;
+    int proximoId = 1;
+
+    const ModeloRider& exigir(int id) const {
+        for (const auto& m : modelos) {
+            if (m.id == id) return m;
+        }
+        throw ModeloException("Modelo com ID " + to_string(id) + " não encontrado");
+    }
+
+public:
+    int criar(const string& nome) {
+        if (nome.empty()) {
+            throw ValidacaoException("Nome do modelo não pode ser vazio");
+        }
+        ModeloRider m;
+        m.id = proximoId;
+        m.nome = nome;
+        modelos.push_back(m);
+        return proximoId++;
+    }
+
+    ModeloRider* buscarPorId(int id) { return referencia::buscarPorId(modelos, id); }
+
+    bool remover(int id) { return removerPorId(modelos, id); }
+
+    vector<ModeloRider> listar() const { return modelos; }
+
+    void adicionarItem(int modeloId, int itemId, const string& nomeItem, int quantidade) {
+        exigir(modeloId);
+        if (itemId < 0) throw ValidacaoException("ID do item inválido");
+        if (nomeItem.empty()) throw ValidacaoException("Nome do item não pode ser vazio");
+        if (quantidade <= 0) throw ValidacaoException("Quantidade deve ser maior que zero");
+        map<int, ItemPedido>& itens = buscarPorId(modeloId)->itens;
+        if (itens.count(itemId)) {
+            itens[itemId].quantidade += quantidade;
+        } else {
+            itens[itemId] = ItemPedido(itemId, nomeItem, quantidade);
+        }
+    }
+
+    bool removerItem(int modeloId, int itemId) {
+        exigir(modeloId);
+        return buscarPorId(modeloId)->itens.erase(itemId) > 0;
+    }
+
+    int instanciarPedido(int modeloId, GerenciadorPedidos& pedidos, int camarimId,
+                         const string& nomeArtista) const {
+        const ModeloRider& m = exigir(modeloId);
+        int id = pedidos.criar(camarimId, nomeArtista);
+        for (const auto& par : m.itens) {
+            pedidos.adicionarItem(id, par.first, par.second.nomeItem, par.second.quantidade);
+        }
+        return id;
+    }
+
+    void instanciarCamarim(int modeloId, GerenciadorCamarins& camarins, int camarimId) const {
+        const ModeloRider& m = exigir(modeloId);
+        if (camarins.buscarPorId(camarimId) == nullptr) {
+            throw CamarimException("Camarim com ID " + to_string(camarimId) + " não encontrado");
+        }
+        for (const auto& par : m.itens) {
+            camarins.inserirItem(camarimId, par.first, par.second.nomeItem, par.second.quantidade);
+        }
+    }
+};
+
+// ==================== Reposição de camarins ====================
+
+/**
+ * Oráculo da ReposicaoCamarins: níveis em um vector sem ordem, ordenados
+ * a cada plano; busca linear dos itens do camarim. Sem observadores:
+ * sincronizar() descarta níveis de camarins removidos (e devolve os descartes).
+ */
+class ReposicaoCamarins {
+private:
+    vector<TransferenciaReposicao> niveis;  // 'quantidade' = nível
+    GerenciadorCamarins* camarins = nullptr;
+    Estoque* estoque = nullptr;
+
+    vector<TransferenciaReposicao> ordenados() const {
+        vector<TransferenciaReposicao> v = niveis;
+        sort(v.begin(), v.end(), [](const TransferenciaReposicao& a, const TransferenciaReposicao& b) {
+            return a.camarimId != b.camarimId ? a.camarimId < b.camarimId : a.itemId < b.itemId;
+        });
+        return v;
+    }
+
+public:
+    void conectar(GerenciadorCamarins& c, Estoque& e) {
+        camarins = &c;
+        estoque = &e;
+        niveis.clear();
+    }
+
+    vector<DescarteDependentes> sincronizar() {
+        vector<TransferenciaReposicao> validos;
+        set<int> descartados;
+        for (const auto& n : niveis) {
+            if (camarins->buscarPorId(n.camarimId) != nullptr) validos.push_back(n);
+            else descartados.insert(n.camarimId);
+        }
+        niveis = validos;
+        vector<DescarteDependentes> descartes;
+        for (int id : descartados) {
+            descartes.push_back({TipoEntidade::CAMARIM, id, "níveis de reposição do camarim descartados"});
+        }
+        return descartes;
+    }
+
+    void definirNivel(int camarimId, int itemId, const string& nomeItem, int quantidade) {
+        if (camarins->buscarPorId(camarimId) == nullptr) {
+            throw CamarimException("Camarim com ID " + to_string(camarimId) + " não encontrado");
+        }
+        if (itemId < 0) throw ValidacaoException("ID do item inválido");
+        if (quantidade < 0) throw ValidacaoException("Quantidade não pode ser negativa");
+        vector<TransferenciaReposicao> outros;
+        for (const auto& n : niveis) {
+            if (n.camarimId != camarimId || n.itemId != itemId) outros.push_back(n);
+        }
+        if (quantidade == 0) {
+            niveis = outros;
+            return;
+        }
+        if (nomeItem.empty()) throw ValidacaoException("Nome do item não pode ser vazio");
+        outros.push_back(TransferenciaReposicao{camarimId, itemId, nomeItem, quantidade});
+        niveis = outros;
+    }
+
+    vector<ItemCamarim> niveisDe(int camarimId) const {
+        vector<ItemCamarim> v;
+        for (const auto& n : ordenados()) {
+            if (n.camarimId == camarimId) v.push_back(ItemCamarim(n.itemId, n.nomeItem, n.quantidade));
+        }
+        return v;
+    }
+
+    PlanoReposicao planejar() const {
+        PlanoReposicao plano;
+        map<int, int> prometido;
+        for (const auto& n : ordenados()) {
+            int tem = 0;
+            for (const auto& p : camarins->buscarPorId(n.camarimId)->getItens()) {
+                if (p.first == n.itemId) tem = p.second.quantidade;
+            }
+            int falta = n.quantidade - tem;
+            if (falta <= 0) continue;
+            int enviar = min(falta, estoque->obterQuantidade(n.itemId) - prometido[n.itemId]);
+            prometido[n.itemId] += enviar;
+            if (enviar > 0) plano.transferencias.push_back(TransferenciaReposicao{n.camarimId, n.itemId, n.nomeItem, enviar});
+            if (enviar < falta) plano.faltas.push_back(TransferenciaReposicao{n.camarimId, n.itemId, n.nomeItem, falta - enviar});
+        }
+        return plano;
+    }
+
+    void executar(const PlanoReposicao& plano) {
+        map<int, int> porItem;
+        for (const auto& t : plano.transferencias) {
+            if (t.quantidade <= 0) throw ValidacaoException("Quantidade deve ser maior que zero");
+            if (camarins->buscarPorId(t.camarimId) == nullptr) {
+                throw CamarimException("Camarim com ID " + to_string(t.camarimId) + " não encontrado");
+            }
+            porItem[t.itemId] += t.quantidade;
+        }
+        for (const auto& par : porItem) {
+            int disponivel = estoque->obterQuantidade(par.first);
+            if (disponivel < par.second) {
+                throw EstoqueInsuficienteException("Quantidade insuficiente. Disponível: " + to_string(disponivel)
+                                                   + ", Solicitado: " + to_string(par.second));
+            }
+        }
+        for (const auto& par : porItem) estoque->removerItem(par.first, par.second);
+        vector<TransferenciaReposicao> v = plano.transferencias;
+        sort(v.begin(), v.end(), [](const TransferenciaReposicao& a, const TransferenciaReposicao& b) {
+            return a.camarimId != b.camarimId ? a.camarimId < b.camarimId : a.itemId < b.itemId;
+        });
+        for (const auto& t : v) camarins->inserirItem(t.camarimId, t.itemId, t.nomeItem, t.quantidade);
+    }
+
+    PlanoReposicao repor() {
+        PlanoReposicao plano = planejar();
+        executar(plano);
+        return plano;
+    }
+};
+
+// ==================== Referências de itens ====================
+
+/**
+ * Oráculo do IndiceReferencias: varre todos os gerenciadores a cada consulta.
+ */
+class IndiceReferencias {
+private:
+    GerenciadorItens* itens = nullptr;
+    GerenciadorCamarins* camarins = nullptr;
+    GerenciadorPedidos* pedidos = nullptr;
+    GerenciadorListaCompras* listas = nullptr;
+    Estoque* estoque = nullptr;
+    GerenciadorModelos* modelos = nullptr;
+    ReposicaoCamarins* reposicao = nullptr;
+    vector<DescarteDependentes> descartes;  // Modelos/níveis descartados desde o último sincronizar()
+
+public:
+    void conectar(GerenciadorItens& i, GerenciadorCamarins& c, GerenciadorPedidos& p,
+                  GerenciadorListaCompras& l, Estoque& e) {
+        itens = &i; camarins = &c; pedidos = &p; listas = &l; estoque = &e;
+    }
+
+    void acompanharModulos(GerenciadorModelos& m, ReposicaoCamarins& r) { modelos = &m; reposicao = &r; }
+
+    ReferenciasItem referenciasDe(int itemId) const {
+        ReferenciasItem r;
+        r.noEstoque = estoque->obterQuantidade(itemId) > 0 || estoque->obterMinimo(itemId) > 0;
+        for (const Camarim& c : camarins->listar()) if (c.getItens().count(itemId)) r.camarins.push_back(c.getId());
+        for (const Pedido& p : pedidos->listar()) if (p.getItens().count(itemId)) r.pedidos.push_back(p.getId());
+        for (const ListaCompras& l : listas->listar()) if (l.getItens().count(itemId)) r.listas.push_back(l.getId());
+        for (const ModeloRider& m : modelos->listar()) if (m.itens.count(itemId)) r.modelos.push_back(m.id);
+        for (const Camarim& c : camarins->listar()) {
+            for (const ItemCamarim& n : reposicao->niveisDe(c.getId())) {
+                if (n.itemId == itemId) r.niveis.push_back(c.getId());
+            }
+        }
+        return r;
+    }
+
+    bool emUso(int itemId) const { return referenciasDe(itemId).total() > 0; }
+
+    bool removerItem(int itemId, ModoRemocao modo = ModoRemocao::BLOQUEAR) {
+        if (itens->buscarPorId(itemId) == nullptr) {
+            return false;
+        }
+        ReferenciasItem r = referenciasDe(itemId);
+        if (r.total() > 0 && modo == ModoRemocao::BLOQUEAR) {
+            throw ItemException("Item " + to_string(itemId) + " em uso: " + r.descrever());
+        }
+        int atendidos = 0;
+        for (int id : r.pedidos) atendidos += pedidos->buscarPorId(id)->isAtendido();
+        if (atendidos > 0) {
+            throw ItemException("Item " + to_string(itemId) + " consta em " + to_string(atendidos)
+                                + " pedido(s) atendido(s): arquive-os antes de remover o item");
+        }
+        for (int id : r.camarins) camarins->removerItem(id, itemId, camarins->buscarPorId(id)->getItens().at(itemId).quantidade);
+        for (int id : r.pedidos) pedidos->removerItem(id, itemId);
+        for (int id : r.listas) listas->removerItem(id, itemId);
+        for (int id : r.modelos) modelos->removerItem(id, itemId);
+        for (int id : r.niveis) reposicao->definirNivel(id, itemId, "", 0);
+        if (r.noEstoque) estoque->restaurar(itemId, "", 0, 0);
+        itens->remover(itemId);
+        if (!r.modelos.empty()) descartes.push_back({TipoEntidade::ITEM, itemId, "linhas de modelos de rider descartadas"});
+        if (!r.niveis.empty()) descartes.push_back({TipoEntidade::ITEM, itemId, "níveis de reposição do item descartados"});
+        return true;
+    }
+
+    // Devolve (e esquece) os descartes desde a última chamada
+    vector<DescarteDependentes> sincronizar() {
+        vector<DescarteDependentes> feitos;
+        feitos.swap(descartes);
+        return feitos;
+    }
+};
+
+// ==================== Fornecedores ====================
+
+/**
+ * Oráculo da TabelaFornecedores: todas as ofertas num vector sem ordem;
+ * cotar() calcula o custo de todas as ofertas do item e fica com a
+ * primeira de menor custo na ordem (preço por unidade, fornecedorId).
+ */
+class TabelaFornecedores {
+private:
+    map<int, string> fornecedores;
+    int proximoFornecedor = 1;
+    vector<OfertaFornecedor> todas;
+    GerenciadorItens* itens = nullptr;
+
+    static bool antes(const OfertaFornecedor& a, const OfertaFornecedor& b) {
+        double pa = a.precoEmbalagem * b.unidadesEmbalagem, pb = b.precoEmbalagem * a.unidadesEmbalagem;
+        return pa != pb ? pa < pb : a.fornecedorId < b.fornecedorId;
+    }
+
+public:
+    void conectar(GerenciadorItens& i) {
+        itens = &i;
+        sincronizar();
+    }
+
+    // Descarta ofertas de itens removidos do catálogo (e devolve os descartes)
+    vector<DescarteDependentes> sincronizar() {
+        vector<OfertaFornecedor> validas;
+        set<int> descartados;
+        for (const auto& o : todas) {
+            if (itens->buscarPorId(o.itemId) != nullptr) validas.push_back(o);
+            else descartados.insert(o.itemId);
+        }
+        todas = validas;
+        vector<DescarteDependentes> descartes;
+        for (int id : descartados) {
+            descartes.push_back({TipoEntidade::ITEM, id, "ofertas de fornecedores do item descartadas"});
+        }
+        return descartes;
+    }
+
+    int cadastrarFornecedor(const string& nome) {
+        if (nome.empty()) throw ValidacaoException("Nome do fornecedor não pode ser vazio");
+        fornecedores[proximoFornecedor] = nome;
+        return proximoFornecedor++;
+    }
+
+    bool removerFornecedor(int fornecedorId) {
+        if (fornecedores.erase(fornecedorId) == 0) return false;
+        vector<OfertaFornecedor> outras;
+        for (const auto& o : todas) {
+            if (o.fornecedorId != fornecedorId) outras.push_back(o);
+        }
+        todas = outras;
+        return true;
+    }
+
+    vector<Fornecedor> listarFornecedores() const {
+        vector<Fornecedor> v;
+        for (const auto& par : fornecedores) v.push_back(Fornecedor{par.first, par.second});
+        return v;
+    }
+
+    void definirOferta(int fornecedorId, int itemId, double precoEmbalagem, int unidadesEmbalagem) {
+        if (fornecedores.count(fornecedorId) == 0) {
+            throw ValidacaoException("Fornecedor com ID " + to_string(fornecedorId) + " não encontrado");
+        }
+        if (itens->buscarPorId(itemId) == nullptr) {
+            throw ItemException("Item com ID " + to_string(itemId) + " não encontrado");
+        }
+        if (precoEmbalagem < 0) throw ValidacaoException("Preço não pode ser negativo");
+        if (unidadesEmbalagem <= 0) throw ValidacaoException("Embalagem deve ter pelo menos uma unidade");
+        removerOferta(fornecedorId, itemId);
+        todas.push_back(OfertaFornecedor{fornecedorId, itemId, precoEmbalagem, unidadesEmbalagem});
+    }
+
+    bool removerOferta(int fornecedorId, int itemId) {
+        for (size_t i = 0; i < todas.size(); i++) {
+            if (todas[i].fornecedorId == fornecedorId && todas[i].itemId == itemId) {
+                todas.erase(todas.begin() + i);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    vector<OfertaFornecedor> ofertasDe(int itemId) const {
+        vector<OfertaFornecedor> v;
+        for (const auto& o : todas) {
+            if (o.itemId == itemId) v.push_back(o);
+        }
+        sort(v.begin(), v.end(), antes);
+        return v;
+    }
+
+    CotacaoCompra cotar(int itemId, int quantidade) const {
+        if (itemId < 0) throw ValidacaoException("ID do item inválido");
+        if (quantidade <= 0) throw ValidacaoException("Quantidade deve ser maior que zero");
+        CotacaoCompra c;
+        c.itemId = itemId;
+        c.quantidade = quantidade;
+        vector<OfertaFornecedor> v = ofertasDe(itemId);
+        if (v.empty()) {
+            const Item* item = itens->buscarPorId(itemId);
+            c.unidades = quantidade;
+            c.precoUnitario = item ? item->getPreco() : 0.0;
+            c.custo = quantidade * c.precoUnitario;
+            return c;
+        }
+        for (const auto& o : v) {
+            int embalagens = (quantidade + o.unidadesEmbalagem - 1) / o.unidadesEmbalagem;
+            double custo = embalagens * o.precoEmbalagem;
+            if (c.fornecedorId == 0 || custo < c.custo) {
+                c.fornecedorId = o.fornecedorId;
+                c.embalagens = embalagens;
+                c.unidades = embalagens * o.unidadesEmbalagem;
+                c.precoUnitario = o.precoUnitario();
+                c.custo = custo;
+            }
+        }
+        return c;
+    }
+
+    int gerarListaCompras(GerenciadorListaCompras& listas, const string& descricao,
+                          const vector<TransferenciaReposicao>& faltas) const {
+        if (faltas.empty()) throw ValidacaoException("Nenhum item a comprar");
+        map<int, int> total;
+        map<int, string> nomes;
+        for (const auto& f : faltas) {
+            total[f.itemId] += f.quantidade;
+            nomes[f.itemId] = f.nomeItem;
+        }
+        vector<ItemCompra> linhas;
+        for (const auto& par : total) {
+            CotacaoCompra c = cotar(par.first, par.second);
+            linhas.push_back(ItemCompra(par.first, nomes[par.first], c.unidades, c.precoUnitario));
+        }
+        return listas.criarComItens(descricao, linhas);
+    }
+
+    DivisaoCompras dividir(const ListaCompras& lista) const {
+        DivisaoCompras d;
+        for (const auto& f : fornecedores) {
+            PedidoFornecedor p;
+            p.fornecedorId = f.first;
+            p.nomeFornecedor = f.second;
+            for (const auto& par : lista.getItens()) {
+                CotacaoCompra c = cotar(par.first, par.second.quantidade);
+                if (c.fornecedorId == f.first) {
+                    p.itens.push_back(ItemCompra(par.first, par.second.nomeItem, c.unidades, c.precoUnitario));
+                }
+            }
+            if (!p.itens.empty()) d.pedidos.push_back(p);
+        }
+        for (const auto& par : lista.getItens()) {
+            if (cotar(par.first, par.second.quantidade).fornecedorId == 0) d.semOferta.push_back(par.second);
+        }
+        return d;
+    }
+
+    ListasPorFornecedor dividirEmListas(GerenciadorListaCompras& listas, int listaId) const {
+        ListaCompras* lista = listas.buscarPorId(listaId);
+        if (lista == nullptr) {
+            throw ListaComprasException("Lista com ID " + to_string(listaId) + " não encontrada");
+        }
+        ListaCompras copia = *lista;
+        DivisaoCompras d = dividir(copia);
+        ListasPorFornecedor ids;
+        for (const auto& p : d.pedidos) {
+            ids.porFornecedor.push_back(listas.criarComItens(copia.getDescricao() + " - " + p.nomeFornecedor, p.itens));
+        }
+        if (!d.semOferta.empty()) {
+            ids.semOferta = listas.criarComItens(copia.getDescricao() + " - Sem oferta", d.semOferta);
+        }
+        return ids;
+    }
+};
+
+// ==================== Reconciliação de camarins ====================
+
+/**
+ * Oráculo da ReconciliacaoCamarins: busca linear da contagem de cada
+ * linha; grava com um removerItem por linha (quantidade inteira) e um
+ * adicionarItem por item.
+ */
+class ReconciliacaoCamarins {
+private:
+    static void reconciliarCamarim(const Camarim& camarim, const map<int, int>& contagem,
+                                   vector<LinhaReconciliacao>& linhas) {
+        for (const auto& contado : contagem) {
+            if (contado.second < 0) throw ValidacaoException("Quantidade não pode ser negativa");
+            if (camarim.getItens().count(contado.first) == 0) throw CamarimException("Item não encontrado no camarim");
+            if (contado.second > camarim.getItens().at(contado.first).quantidade) {
+                throw ValidacaoException("Contagem maior que a quantidade no camarim");
+            }
+        }
+        for (const auto& par : camarim.getItens()) {
+            int sobrou = 0;
+            for (const auto& contado : contagem) {
+                if (contado.first == par.first) sobrou = contado.second;
+            }
+            linhas.push_back(LinhaReconciliacao{camarim.getId(), par.first, par.second.nomeItem,
+                                                par.second.quantidade, sobrou, par.second.quantidade - sobrou});
+        }
+    }
+
+public:
+    static ResultadoReconciliacao calcular(GerenciadorCamarins& camarins, const map<int, map<int, int>>& contagens) {
+        ResultadoReconciliacao resultado;
+        for (const auto& par : contagens) {
+            Camarim* camarim = camarins.buscarPorId(par.first);
+            if (camarim == nullptr) {
+                throw CamarimException("Camarim com ID " + to_string(par.first) + " não encontrado");
+            }
+            reconciliarCamarim(*camarim, par.second, resultado.linhas);
+        }
+        return resultado;
+    }
+
+    static ResultadoReconciliacao calcularTodos(GerenciadorCamarins& camarins,
+                                                const map<int, map<int, int>>& contagens) {
+        for (const auto& par : contagens) {
+            if (camarins.buscarPorId(par.first) == nullptr) {
+                throw CamarimException("Camarim com ID " + to_string(par.first) + " não encontrado");
+            }
+        }
+        ResultadoReconciliacao resultado;
+        for (const auto& camarim : camarins.listar()) {
+            map<int, int> contagem;
+            if (contagens.count(camarim.getId())) contagem = contagens.at(camarim.getId());
+            reconciliarCamarim(camarim, contagem, resultado.linhas);
+        }
+        return resultado;
+    }
+
+    static void aplicar(const ResultadoReconciliacao& resultado, GerenciadorCamarins& camarins, Estoque& estoque) {
+        set<pair<int, int>> vistas;
+        for (const auto& l : resultado.linhas) {
+            if (l.devolvido < 0 || l.consumido < 0 || l.devolvido + l.consumido != l.quantidade
+                || !vistas.insert(make_pair(l.camarimId, l.itemId)).second) {
+                throw ValidacaoException("Linha de reconciliação inconsistente");
+            }
+        }
+        map<int, string> nomes;
+        map<int, int> devolucoes;
+        set<int> ids;
+        for (const auto& l : resultado.linhas) ids.insert(l.camarimId);
+        for (int id : ids) {
+            Camarim* camarim = camarins.buscarPorId(id);
+            if (camarim == nullptr) throw CamarimException("Camarim com ID " + to_string(id) + " não encontrado");
+            size_t linhas = 0;
+            bool igual = true;
+            for (const auto& l : resultado.linhas) {
+                if (l.camarimId != id) continue;
+                linhas++;
+                if (camarim->getItens().count(l.itemId) == 0
+                    || camarim->getItens().at(l.itemId).quantidade != l.quantidade) igual = false;
+            }
+            if (!igual || linhas != camarim->getItens().size()) {
+                throw CamarimException("Camarim " + to_string(id) + " mudou desde a contagem");
+            }
+            for (const auto& l : resultado.linhas) {
+                if (l.camarimId == id && l.devolvido > 0) {
+                    if (!nomes.count(l.itemId)) nomes[l.itemId] = camarim->getItens().at(l.itemId).nomeItem;
+                    devolucoes[l.itemId] += l.devolvido;
+                }
+            }
+        }
+        for (int id : ids) {
+            map<int, ItemCamarim> itens = camarins.buscarPorId(id)->getItens();
+            for (const auto& par : itens) camarins.removerItem(id, par.first, par.second.quantidade);
+        }
+        for (const auto& par : devolucoes) estoque.adicionarItem(par.first, nomes[par.first], par.second);
+    }
+};
+
+// ==================== Leitor de códigos de barras ====================
+
+/**
+ * Oráculo do LeitorCodigos: guarda cada leitura aceita em um vector e só
+ * agrupa por item na hora de gravar.
+ */
+class LeitorCodigos {
+private:
+    GerenciadorItens& itens;
+    Estoque& estoque;
+    size_t limiteLote;
+    vector<ItemEstoque> lidas;  // Uma por leitura aceita
+    ResumoLeitura resumo;
+    vector<string> rejeitados;
+
+    void rejeitar(const string& codigo) {
+        resumo.rejeitadas++;
+        rejeitados.push_back(codigo);
+        if (rejeitados.size() > ::LeitorCodigos::MAX_REJEITADOS) rejeitados.erase(rejeitados.begin());
+    }
+
+    // Inteiro positivo que cabe em int (sinal '+' opcional, como stoi)
+    static bool quantidadeValida(const string& texto, int& quantidade) {
+        size_t i = (texto[0] == '+' || texto[0] == '-') ? 1 : 0;
+        if (i == texto.size() || texto.size() - i > 18) return false;
+        long long valor = 0;
+        for (size_t j = i; j < texto.size(); j++) {
+            if (texto[j] < '0' || texto[j] > '9') return false;
+            valor = valor * 10 + (texto[j] - '0');
+        }
+        if (texto[0] == '-') valor = -valor;
+        if (valor <= 0 || valor > 2147483647LL) return false;
+        quantidade = static_cast<int>(valor);
+        return true;
+    }
+
+public:
+    LeitorCodigos(GerenciadorItens& itens, Estoque& estoque, size_t limiteLote = 512)
+        : itens(itens), estoque(estoque), limiteLote(limiteLote) {}
+
+    bool ler(const string& codigo, int quantidade = 1) {
+        if (quantidade <= 0) throw ValidacaoException("Quantidade deve ser maior que zero");
+        resumo.leituras++;
+        Item* item = itens.buscarPorCodigo(codigo);
+        if (item == nullptr) {
+            rejeitar(codigo);
+            return false;
+        }
+        resumo.aceitas++;
+        lidas.push_back(ItemEstoque(item->getId(), item->getNome(), quantidade));
+        if (lidas.size() >= limiteLote) descarregar();
+        return true;
+    }
+
+    long long lerFluxo(istream& entrada, const string& fim = "") {
+        long long linhas = 0;
+        string linha;
+        while (getline(entrada, linha)) {
+            if (!linha.empty() && linha[linha.size() - 1] == '\r') linha.erase(linha.size() - 1);
+            if (!fim.empty() && linha == fim) break;
+            vector<string> partes;
+            string atual;
+            for (char c : linha + " ") {
+                if (c == ' ' || c == '\t') {
+                    if (!atual.empty()) partes.push_back(atual);
+                    atual.clear();
+                } else {
+                    atual += c;
+                }
+            }
+            if (partes.empty()) continue;
+            linhas++;
+            int quantidade = 1;
+            if (partes.size() > 2 || (partes.size() == 2 && !quantidadeValida(partes[1], quantidade))) {
+                resumo.leituras++;
+                rejeitar(linha);
+                continue;
+            }
+            ler(partes[0], quantidade);
+        }
+        descarregar();
+        return linhas;
+    }
+
+    void descarregar() {
+        if (lidas.empty()) return;
+        map<int, ItemEstoque> soma;
+        for (const auto& l : lidas) {
+            if (soma.count(l.itemId)) soma[l.itemId].quantidade += l.quantidade;
+            else soma[l.itemId] = l;
+        }
+        for (const auto& par : soma) {
+            estoque.adicionarItem(par.first, par.second.nomeItem, par.second.quantidade);
+            resumo.entradas++;
+            resumo.unidades += par.second.quantidade;
+        }
+        resumo.lotes++;
+        lidas.clear();
+    }
+
+    vector<ItemEstoque> listarPendentes() const {
+        map<int, ItemEstoque> soma;
+        for (const auto& l : lidas) {
+            if (soma.count(l.itemId)) soma[l.itemId].quantidade += l.quantidade;
+            else soma[l.itemId] = l;
+        }
+        vector<ItemEstoque> resultado;
+        for (const auto& par : soma) resultado.push_back(par.second);
+        return resultado;
+    }
+
+    ResumoLeitura getResumo() const { return resumo; }
+    const vector<string>& ultimosRejeitados() const { return rejeitados; }
+};
+
+// ==================== Arquivo de pedidos ====================
+
+/**
+ * Oráculo do ArquivoPedidos: os pedidos arquivados em um vector, sem
+ * compressão; as análises varrem os objetos completos.
+ */
+class ArquivoPedidos {
+private:
+    vector<Pedido> pedidos;
+    vector<DescarteDependentes> descartes;  // Pedidos movidos desde o último sincronizar()
+
+public:
+    explicit ArquivoPedidos(size_t = 128) {}
+
+    // Guarda cópias inteiras dos pedidos: o catálogo não é consultado
+    void conectar(GerenciadorItens&) {}
+    void desconectar() {}
+
+    void arquivar(const Pedido& pedido) { pedidos.push_back(pedido); }
+
+    bool arquivar(GerenciadorPedidos& gerenciador, int pedidoId) {
+        Pedido* pedido = gerenciador.buscarPorId(pedidoId);
+        if (pedido == nullptr || !pedido->isAtendido()) return false;
+        pedidos.push_back(*pedido);
+        gerenciador.remover(pedidoId);
+        descartes.push_back({TipoEntidade::PEDIDO, pedidoId, "pedido movido para o arquivo"});
+        return true;
+    }
+
+    // Devolve (e esquece) os pedidos movidos desde a última chamada
+    vector<DescarteDependentes> sincronizar() {
+        vector<DescarteDependentes> movidos;
+        movidos.swap(descartes);
+        return movidos;
+    }
+
+    int arquivarAtendidos(GerenciadorPedidos& gerenciador) {
+        int arquivados = 0;
+        for (const Pedido& pedido : gerenciador.listar()) {
+            if (pedido.isAtendido()) arquivados += arquivar(gerenciador, pedido.getId());
+        }
+        return arquivados;
+    }
+
+    vector<Pedido> listar() const { return pedidos; }
+
+    bool buscarPorId(int id, Pedido& saida) const {
+        for (size_t i = pedidos.size(); i-- > 0;) {
+            if (pedidos[i].getId() == id) {
+                saida = pedidos[i];
+                return true;
+            }
+        }
+        return false;
+    }
+
+    map<int, long long> quantidadePorItem() const {
+        map<int, long long> total;
+        for (const auto& pedido : pedidos) {
+            for (const auto& par : pedido.getItens()) total[par.first] += par.second.quantidade;
+        }
+        return total;
+    }
+
+    map<int, int> pedidosPorCamarim() const {
+        map<int, int> contagem;
+        for (const auto& pedido : pedidos) contagem[pedido.getCamarimId()]++;
+        return contagem;
+    }
+
+    size_t tamanho() const { return pedidos.size(); }
+};
+
+// ==================== Visão de camarins ====================
+
+/**
+ * Oráculo de montarVisaoCamarim / montarQuadroBastidores: para cada
+ * camarim, varre todos os artistas, todos os pedidos e o catálogo inteiro
+ * (sem índices), na ordem de listar().
+ */
+inline VisaoCamarim visaoDe(const Camarim& camarim, const GerenciadorArtistas& artistas,
+                            const GerenciadorPedidos& pedidos, const GerenciadorItens& itens) {
+    VisaoCamarim v;
+    v.camarim = camarim;
+    for (const Artista& a : artistas.listar()) {
+        if (a.getCamarimId() == camarim.getId()) v.artistas.push_back(a);
+    }
+    for (const Pedido& p : pedidos.listar()) {
+        if (p.getCamarimId() != camarim.getId()) continue;
+        if (p.isAtendido()) {
+            v.atendidos.push_back(p);
+        } else {
+            v.pendentes.push_back(p);
+            for (const auto& par : p.getItens()) v.unidadesPendentes += par.second.quantidade;
+        }
+    }
+    vector<Item> catalogo = itens.listar();
+    for (const auto& par : camarim.getItens()) {
+        const Item* item = nullptr;
+        for (const Item& i : catalogo) {
+            if (i.getId() == par.first) item = &i;
+        }
+        ConteudoCamarim c;
+        c.itemId = par.first;
+        c.nomeItem = item ? item->getNome() : par.second.nomeItem;
+        c.quantidade = par.second.quantidade;
+        c.precoUnitario = item ? item->getPreco() : 0.0;
+        c.subtotal = c.quantidade * c.precoUnitario;
+        c.noCatalogo = item != nullptr;
+        v.unidades += c.quantidade;
+        v.valorConteudo += c.subtotal;
+        v.conteudo.push_back(c);
+    }
+    return v;
+}
+
+inline VisaoCamarim montarVisaoCamarim(int camarimId, const GerenciadorCamarins& camarins,
+                                       const GerenciadorArtistas& artistas, const GerenciadorPedidos& pedidos,
+                                       const GerenciadorItens& itens) {
+    for (const Camarim& c : camarins.listar()) {
+        if (c.getId() == camarimId) return visaoDe(c, artistas, pedidos, itens);
+    }
+    throw CamarimException("Camarim com ID " + to_string(camarimId) + " não encontrado");
+}
+
+inline vector<VisaoCamarim> montarQuadroBastidores(const GerenciadorCamarins& camarins,
+                                                   const GerenciadorArtistas& artistas,
+                                                   const GerenciadorPedidos& pedidos,
+                                                   const GerenciadorItens& itens) {
+    vector<VisaoCamarim> quadro;
+    for (const Camarim& c : camarins.listar()) quadro.push_back(visaoDe(c, artistas, pedidos, itens));
+    return quadro;
+}
+
+// ==================== Campos das entidades (oráculo do esquema) ====================
+
+/**
+ * Tabelas de campos escritas à mão, um switch por entidade (como eram
+ * antes de esquema.h). Chame sempre qualificado (referencia::campoNumerico):
+ * sem a qualificação, a busca por argumento também acha as versões globais.
+ */
+template <typename ItemMapa>
+double somarQuantidades(const map<int, ItemMapa>& itens) {
+    double total = 0.0;
+    for (const auto& par : itens) total += par.second.quantidade;
+    return total;
+}
+
+inline bool campoNumerico(const Item& item, Campo campo, double& valor) {
+    switch (campo) {
+        case Campo::ID:    valor = item.getId(); return true;
+        case Campo::PRECO: valor = item.getPreco(); return true;
+        default:           return false;
+    }
+}
+
+inline bool campoNumerico(const ItemEstoque& item, Campo campo, double& valor) {
+    switch (campo) {
+        case Campo::ID:         valor = item.itemId; return true;
+        case Campo::QUANTIDADE: valor = item.quantidade; return true;
+        default:                return false;
+    }
+}
+
+inline bool campoNumerico(const Artista& artista, Campo campo, double& valor) {
+    switch (campo) {
+        case Campo::ID:      valor = artista.getId(); return true;
+        case Campo::CAMARIM: valor = artista.getCamarimId(); return true;
+        default:             return false;
+    }
+}
+
+inline bool campoNumerico(const Camarim& camarim, Campo campo, double& valor) {
+    switch (campo) {
+        case Campo::ID:         valor = camarim.getId(); return true;
+        case Campo::ARTISTA:    valor = camarim.getArtistaId(); return true;
+        case Campo::QUANTIDADE: valor = somarQuantidades(camarim.getItens()); return true;
+        default:                return false;
+    }
+}
+
+inline bool campoNumerico(const Pedido& pedido, Campo campo, double& valor) {
+    switch (campo) {
+        case Campo::ID:         valor = pedido.getId(); return true;
+        case Campo::CAMARIM:    valor = pedido.getCamarimId(); return true;
+        case Campo::ATENDIDO:   valor = pedido.isAtendido() ? 1.0 : 0.0; return true;
+        case Campo::QUANTIDADE: valor = somarQuantidades(pedido.getItens()); return true;
+        default:                return false;
+    }
+}
+
+inline bool campoNumerico(const ListaCompras& lista, Campo campo, double& valor) {
+    switch (campo) {
+        case Campo::ID:         valor = lista.getId(); return true;
+        case Campo::PRECO:      valor = lista.calcularTotal(); return true;
+        case Campo::QUANTIDADE: valor = somarQuantidades(lista.getItens()); return true;
+        default:                return false;
+    }
+}
+
+inline bool campoTexto(const Item& item, Campo campo, string& valor) {
+    if (campo != Campo::NOME) return false;
+    valor = item.getNome();
+    return true;
+}
+
+inline bool campoTexto(const ItemEstoque& item, Campo campo, string& valor) {
+    if (campo != Campo::NOME) return false;
+    valor = item.nomeItem;
+    return true;
+}
+
+inline bool campoTexto(const Artista& artista, Campo campo, string& valor) {
+    if (campo != Campo::NOME) return false;
+    valor = artista.getNome();
+    return true;
+}
+
+inline bool campoTexto(const Camarim& camarim, Campo campo, string& valor) {
+    if (campo != Campo::NOME) return false;
+    valor = camarim.getNome();
+    return true;
+}
+
+inline bool campoTexto(const Pedido& pedido, Campo campo, string& valor) {
+    if (campo != Campo::NOME) return false;
+    valor = pedido.getNomeArtista();
+    return true;
+}
+
+inline bool campoTexto(const ListaCompras& lista, Campo campo, string& valor) {
+    if (campo != Campo::NOME) return false;
+    valor = lista.getDescricao();
+    return true;
+}
+
+// ===== Serialização: cada entidade lista seus valores; os formatos são escritos à mão =====
+
+/**
+ * @struct ValorRegistro
+ * @brief Um campo serializado: tipo 'i' (int), 'l' (long long), 'd' (double), 'b' (bool) ou 's' (texto)
+ */
+struct ValorRegistro {
+    string nome;
+    char tipo;
+    long long inteiro;
+    double real;
+    string texto;
+};
+
+inline ValorRegistro valorInteiro(const string& nome, int v) { return ValorRegistro{nome, 'i', v, 0.0, ""}; }
+inline ValorRegistro valorLongo(const string& nome, long long v) { return ValorRegistro{nome, 'l', v, 0.0, ""}; }
+inline ValorRegistro valorReal(const string& nome, double v) { return ValorRegistro{nome, 'd', 0, v, ""}; }
+inline ValorRegistro valorLogico(const string& nome, bool v) { return ValorRegistro{nome, 'b', v ? 1 : 0, 0.0, ""}; }
+inline ValorRegistro valorTexto(const string& nome, const string& v) { return ValorRegistro{nome, 's', 0, 0.0, v}; }
+
+inline long long quantidadeTotal(const Camarim& c) { return static_cast<long long>(somarQuantidades(c.getItens())); }
+inline long long quantidadeTotal(const Pedido& p) { return static_cast<long long>(somarQuantidades(p.getItens())); }
+inline long long quantidadeTotal(const ListaCompras& l) { return static_cast<long long>(somarQuantidades(l.getItens())); }
+
+inline vector<ValorRegistro> registro(const Item& i) {
+    return {valorInteiro("id", i.getId()), valorTexto("nome", i.getNome()), valorReal("preco", i.getPreco()),
+            valorTexto("codigoBarras", i.getCodigoBarras())};
+}
+inline vector<ValorRegistro> registro(const ItemEstoque& e) {
+    return {valorInteiro("itemId", e.itemId), valorTexto("nomeItem", e.nomeItem), valorInteiro("quantidade", e.quantidade)};
+}
+inline vector<ValorRegistro> registro(const Artista& a) {
+    return {valorInteiro("id", a.getId()), valorTexto("nome", a.getNome()), valorInteiro("camarimId", a.getCamarimId())};
+}
+inline vector<ValorRegistro> registro(const Camarim& c) {
+    return {valorInteiro("id", c.getId()), valorTexto("nome", c.getNome()), valorInteiro("artistaId", c.getArtistaId()),
+            valorLongo("quantidade", quantidadeTotal(c))};
+}
+inline vector<ValorRegistro> registro(const Pedido& p) {
+    return {valorInteiro("id", p.getId()), valorInteiro("camarimId", p.getCamarimId()),
+            valorTexto("nomeArtista", p.getNomeArtista()), valorLogico("atendido", p.isAtendido()),
+            valorLongo("quantidade", quantidadeTotal(p)), valorLongo("criadoEm", p.getCriadoEm()),
+            valorLongo("atualizadoEm", p.getAtualizadoEm())};
+}
+inline vector<ValorRegistro> registro(const ListaCompras& l) {
+    return {valorInteiro("id", l.getId()), valorTexto("descricao", l.getDescricao()),
+            valorReal("total", l.calcularTotal()), valorLongo("quantidade", quantidadeTotal(l))};
+}
+
+// Número como texto (o mesmo em CSV e JSON)
+inline string numero(const ValorRegistro& v) {
+    if (v.tipo == 'b') return v.inteiro ? "true" : "false";
+    if (v.tipo == 'd') {
+        char buffer[64];
+        snprintf(buffer, sizeof(buffer), "%.2f", v.real);
+        return buffer;
+    }
+    return to_string(v.inteiro);
+}
+
+inline string csv(const vector<ValorRegistro>& valores) {
+    string linha;
+    for (size_t k = 0; k < valores.size(); k++) {
+        if (k > 0) linha += ",";
+        if (valores[k].tipo != 's') {
+            linha += numero(valores[k]);
+            continue;
+        }
+        const string& t = valores[k].texto;
+        bool aspas = false;
+        for (char c : t) aspas = aspas || c == ',' || c == '"' || c == '\r' || c == '\n';
+        if (!aspas) {
+            linha += t;
+            continue;
+        }
+        linha += "\"";
+        for (char c : t) linha += c == '"' ? string("\"\"") : string(1, c);
+        linha += "\"";
+    }
+    return linha;
+}
+
+inline string json(const vector<ValorRegistro>& valores) {
+    string objeto = "{";
+    for (size_t k = 0; k < valores.size(); k++) {
+        objeto += (k > 0 ? ",\"" : "\"") + valores[k].nome + "\":";
+        if (valores[k].tipo != 's') {
+            objeto += numero(valores[k]);
+            continue;
+        }
+        objeto += "\"";
+        for (unsigned char c : valores[k].texto) {
+            if (c == '"') objeto += "\\\"";
+            else if (c == '\\') objeto += "\\\\";
+            else if (c == '\n') objeto += "\\n";
+            else if (c == '\r') objeto += "\\r";
+            else if (c == '\t') objeto += "\\t";
+            else if (c < 0x20) {
+                char buffer[8];
+                snprintf(buffer, sizeof(buffer), "\\u%04x", c);
+                objeto += buffer;
+            } else objeto += static_cast<char>(c);
+        }
+        objeto += "\"";
+    }
+    return objeto + "}";
+}
+
+inline string binario(const vector<ValorRegistro>& valores) {
+    string bytes;
+    auto anexar = [&](unsigned long long v, int n) {
+        for (int k = 0; k < n; k++) {
+            bytes += static_cast<char>(v % 256);
+            v /= 256;
+        }
+    };
+    for (const auto& v : valores) {
+        switch (v.tipo) {
+            case 'i': anexar(static_cast<unsigned int>(static_cast<int>(v.inteiro)), 4); break;
+            case 'l': anexar(static_cast<unsigned long long>(v.inteiro), 8); break;
+            case 'b': anexar(v.inteiro, 1); break;
+            case 'd': {
+                unsigned long long bits;
+                memcpy(&bits, &v.real, sizeof(bits));
+                anexar(bits, 8);
+                break;
+            }
+            default:
+                anexar(v.texto.size(), 4);
+                bytes += v.texto;
+        }
+    }
+    return bytes;
+}
+
+}  // namespace referencia
+
+#endif // REFERENCIA_H